@@ -10,9 +10,16 @@
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ::Data
 {
+    AZ_CVAR(bool, cl_assetContainerPrioritizeByDepth, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Schedule the reads of deeper asset dependencies ahead of the assets depending on them when loading an asset container.");
+
     AssetContainer::AssetContainer(Asset<AssetData> rootAsset, const AssetLoadParameters& loadParams, bool isReload)
     {
         m_rootAsset = AssetInternal::WeakAsset<AssetData>(rootAsset);
@@ -61,7 +68,7 @@ namespace AZ::Data
             // Queue each asset to load.
             auto queuedDependentAsset = AssetManager::Instance().GetAssetInternal(
                 dependentAsset.GetId(), dependentAsset.GetType(),
-                AZ::Data::AssetLoadBehavior::Default, loadParamsCopyWithNoLoadingFilter,
+                AZ::Data::AssetLoadBehavior::Default, GetDependencyLoadParameters(dependentAssetInfo, loadParamsCopyWithNoLoadingFilter),
                 dependentAssetInfo, HasPreloads(dependentAsset.GetId()));
 
             // Verify that the returned asset reference matches the one that we found or created and queued to load.
@@ -72,6 +79,44 @@ namespace AZ::Data
         return dependencyAssets;
     }
 
+    AssetLoadParameters AssetContainer::GetDependencyLoadParameters(
+        const AssetInfo& dependencyInfo, const AssetLoadParameters& loadParams) const
+    {
+        auto depthIter = m_dependencyDepths.find(dependencyInfo.m_assetId);
+        if (!cl_assetContainerPrioritizeByDepth || depthIter == m_dependencyDepths.end())
+        {
+            return loadParams;
+        }
+
+        const AssetHandler* handler = AssetManager::Instance().GetHandler(dependencyInfo.m_assetType);
+        if (!handler)
+        {
+            return loadParams;
+        }
+
+        IO::IStreamerTypes::Deadline deadline;
+        IO::IStreamerTypes::Priority priority;
+        handler->GetDefaultAssetLoadPriority(dependencyInfo.m_assetType, deadline, priority);
+        deadline = loadParams.m_deadline.value_or(deadline);
+        priority = loadParams.m_priority.value_or(priority);
+
+        // An asset can't complete before the dependencies below it, so the deeper a dependency is, the sooner its data is needed.
+        // The deepest dependencies get a fraction of the deadline of the root asset, and a slightly higher priority for reads
+        // that have no deadline.
+        const AZ::u32 depth = depthIter->second;
+        if (deadline != IO::IStreamerTypes::s_noDeadline)
+        {
+            deadline = deadline * (m_maxDependencyDepth - depth + 1) / (m_maxDependencyDepth + 1);
+        }
+        priority = aznumeric_cast<IO::IStreamerTypes::Priority>(
+            AZStd::min<AZ::u32>(priority + depth, IO::IStreamerTypes::s_priorityHighest));
+
+        AssetLoadParameters dependencyLoadParams = loadParams;
+        dependencyLoadParams.m_deadline = deadline;
+        dependencyLoadParams.m_priority = priority;
+        return dependencyLoadParams;
+    }
+
     void AssetContainer::AddDependentAssets(Asset<AssetData> rootAsset, const AssetLoadParameters& loadParams)
     {
         AssetId rootAssetId = rootAsset.GetId();
@@ -84,7 +129,8 @@ namespace AZ::Data
         // Every asset dependency that we're aware of, whether or not it gets filtered out by the asset filter callback.
         // This will be used at the point that asset references get serialized in to see whether or not we've received any
         // unexpected assets that didn't appear in our asset catalog dependency list that need to be loaded anyways.
-        AZStd::vector<AssetId> handledAssetDependencyList;
+        // It's shared with the load filter below, which is copied into the load parameters of every dependency.
+        auto handledAssetDependencyList = AZStd::make_shared<AZStd::vector<AssetId>>();
 
         // Cached AssetInfo to save another lookup inside Assetmanager
         AZStd::vector<AssetInfo> dependencyInfoList;
@@ -96,8 +142,29 @@ namespace AZ::Data
         if (loadParams.m_dependencyRules == AssetDependencyLoadRules::UseLoadBehavior)
         {
             AZStd::unordered_set<AssetId> noloadDependencies;
-            AssetCatalogRequestBus::BroadcastResult(getDependenciesResult, &AssetCatalogRequestBus::Events::GetLoadBehaviorProductDependencies,
-                                                    rootAssetId, noloadDependencies, preloadDependencies);
+            AZStd::shared_ptr<const LoadBehaviorDependencyClosure> dependencyClosure;
+            AssetCatalogRequestBus::BroadcastResult(dependencyClosure, &AssetCatalogRequestBus::Events::GetLoadBehaviorDependencyClosure,
+                                                    rootAssetId);
+            if (dependencyClosure)
+            {
+                // The catalog keeps the flattened dependencies of the asset, including how deep each one is, which is used to
+                // schedule the reads of the whole graph at once in the order their data is needed.
+                getDependenciesResult = Success(dependencyClosure->m_dependencies);
+                noloadDependencies = dependencyClosure->m_noloadDependencies;
+                preloadDependencies = dependencyClosure->m_preloadDependencies;
+
+                m_maxDependencyDepth = dependencyClosure->m_maxDepth;
+                m_dependencyDepths.reserve(dependencyClosure->m_dependencies.size());
+                for (size_t i = 0; i < dependencyClosure->m_dependencies.size(); ++i)
+                {
+                    m_dependencyDepths.emplace(dependencyClosure->m_dependencies[i].m_assetId, dependencyClosure->m_depths[i]);
+                }
+            }
+            else
+            {
+                AssetCatalogRequestBus::BroadcastResult(getDependenciesResult, &AssetCatalogRequestBus::Events::GetLoadBehaviorProductDependencies,
+                                                        rootAssetId, noloadDependencies, preloadDependencies);
+            }
             if (!noloadDependencies.empty())
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> dependencyLock(m_dependencyMutex);
@@ -123,7 +190,7 @@ namespace AZ::Data
                 // No matter whether or not the asset dependency is valid, loaded, or filtered out, mark it as successfully handled.
                 // When we encounter the asset reference during serialization, we will know that it should intentionally be skipped.
                 // Otherwise, it would be treated as a missing dependency and assert.
-                handledAssetDependencyList.emplace_back(thisAsset.m_assetId);
+                handledAssetDependencyList->emplace_back(thisAsset.m_assetId);
 
                 if (!assetInfo.m_assetId.IsValid())
                 {
@@ -193,8 +260,8 @@ namespace AZ::Data
             // the loadParams.m_assetLoadFilterCB that was passed into the AddDependentAssets() methods to use as the dependent
             // asset filter instead of this lambda function.
             AZ_UNUSED(handledAssetDependencyList); // Prevent unused warning in release builds
-            AZ_Assert(AZStd::find(handledAssetDependencyList.begin(), handledAssetDependencyList.end(), filterInfo.m_assetId) !=
-                handledAssetDependencyList.end(),
+            AZ_Assert(AZStd::find(handledAssetDependencyList->begin(), handledAssetDependencyList->end(), filterInfo.m_assetId) !=
+                handledAssetDependencyList->end(),
                 "Dependent Asset ID (%s) is expected to load, but the Asset Catalog has no dependency recorded. "
                 "Examine the asset builder for the asset relying on this to ensure it is generating the correct dependencies.",
                 filterInfo.m_assetId.ToString<AZStd::string>().c_str());
@@ -523,7 +590,7 @@ namespace AZ::Data
 
     void AssetContainer::RemoveWaitingAsset(const AssetId& thisAsset)
     {
-        bool allReady{ false };
+        int remainingCount{ 0 };
         {
             bool disconnectEbus = false;
 
@@ -532,13 +599,12 @@ namespace AZ::Data
                 // If we're trying to remove something already removed, just ignore it
                 if (m_waitingAssets.erase(thisAsset))
                 {
-                    m_waitingCount -= 1;
+                    remainingCount = --m_waitingCount;
                     disconnectEbus = true;
-
                 }
-                if (m_waitingAssets.empty())
+                else
                 {
-                    allReady = true;
+                    remainingCount = m_waitingCount;
                 }
             }
 
@@ -553,10 +619,9 @@ namespace AZ::Data
         // list *while* we're still building up the list, so the list would appear to be empty too soon.
         // We also guard against sending it multiple times (m_finalNotificationSent), because in some error conditions, it may be
         // possible to try to remove the same asset multiple times, which if it's the last asset, it could trigger multiple
-        // notifications.
-        if (allReady && m_initComplete && !m_finalNotificationSent)
+        // notifications. The exchange makes sure only one of the threads completing the last assets sends it.
+        if (remainingCount == 0 && m_initComplete && !m_finalNotificationSent.exchange(true))
         {
-            m_finalNotificationSent = true;
             if (m_rootAsset)
             {
                 AssetManagerBus::Broadcast(&AssetManagerBus::Events::OnAssetContainerReady, this);
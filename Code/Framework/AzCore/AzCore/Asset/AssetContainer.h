@@ -83,6 +83,10 @@ namespace AZ
             virtual AZStd::vector<AZStd::pair<AssetInfo, Asset<AssetData>>> CreateAndQueueDependentAssets(
                 const AZStd::vector<AssetInfo>& dependencyInfoList, const AssetLoadParameters& loadParamsCopyWithNoLoadingFilter);
 
+            // Returns the load parameters to queue a dependency with.  When the catalog provides the depth of the dependency, its read
+            // is scheduled ahead of the reads of the assets depending on it.
+            AssetLoadParameters GetDependencyLoadParameters(const AssetInfo& dependencyInfo, const AssetLoadParameters& loadParams) const;
+
             // Waiting assets are those which have not yet signalled ready.  In the case of PreLoad dependencies the data may have completed the load cycle but
             // the Assets aren't considered "Ready" yet if there are PreLoad dependencies still loading and will still be in the list until the point that asset and
             // All of its preload dependencies have been loaded, when it signals OnAssetReady
@@ -133,6 +137,7 @@ namespace AZ
 
             mutable AZStd::recursive_mutex m_readyMutex;
             AZStd::set<AssetId> m_waitingAssets;
+            // Completion counter, the container is ready once every waiting asset has been removed.
             AZStd::atomic_int m_waitingCount{0};
             AZStd::atomic_int m_invalidDependencies{ 0 };
             AZStd::unordered_set<AZ::Data::AssetId> m_unloadedDependencies;
@@ -145,6 +150,11 @@ namespace AZ
 
             // AssetId -> List of assets waiting on it
             PreloadAssetListType m_preloadWaitList;
+
+            // AssetId -> Shortest distance from the root asset in the dependency graph, when provided by the catalog.
+            // Only used while the dependencies are queued.
+            AZStd::unordered_map<AssetId, AZ::u32> m_dependencyDepths;
+            AZ::u32 m_maxDependencyDepth{ 0 };
         private:
             AssetContainer operator=(const AssetContainer& copyContainer) = delete;
             AssetContainer operator=(const AssetContainer&& copyContainer) = delete;
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetLoadTimeline.h>
+#include <AzCore/Debug/PerformanceCollector.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ::Data
+{
+    bool AssetLoadTimeline::HasStage(AssetLoadStage stage) const
+    {
+        return m_stageTimes[static_cast<size_t>(stage)].time_since_epoch().count() != 0;
+    }
+
+    AZStd::chrono::microseconds AssetLoadTimeline::GetDuration(AssetLoadStage from, AssetLoadStage to) const
+    {
+        if (!HasStage(from) || !HasStage(to))
+        {
+            return AZStd::chrono::microseconds(0);
+        }
+        return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            m_stageTimes[static_cast<size_t>(to)] - m_stageTimes[static_cast<size_t>(from)]);
+    }
+
+    AZStd::chrono::microseconds AssetLoadTimeline::GetTotalDuration() const
+    {
+        return GetDuration(AssetLoadStage::Queued, AssetLoadStage::Ready);
+    }
+
+    AZStd::span<const AZStd::string_view> AssetLoadTimelineRecorder::GetMetricNames()
+    {
+        static constexpr AZStd::string_view metricNames[] = {
+            StreamReadMetric, JobQueueMetric, LoadAssetDataMetric, DependencyWaitMetric, NotifyMetric, TotalMetric
+        };
+        return metricNames;
+    }
+
+    void AssetLoadTimelineRecorder::SetEnabled(bool enabled)
+    {
+        m_enabled = enabled;
+        if (!enabled)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            m_activeTimelines.clear();
+        }
+    }
+
+    bool AssetLoadTimelineRecorder::IsEnabled() const
+    {
+        return m_enabled;
+    }
+
+    void AssetLoadTimelineRecorder::SetMaxCompletedTimelines(size_t maxCompletedTimelines)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_maxCompletedTimelines = maxCompletedTimelines;
+        while (m_completedTimelines.size() > m_maxCompletedTimelines)
+        {
+            m_completedTimelines.pop_front();
+        }
+        m_unreportedTimelineCount = AZStd::min(m_unreportedTimelineCount, m_completedTimelines.size());
+    }
+
+    void AssetLoadTimelineRecorder::BeginTimeline(const AssetId& assetId, const AssetType& assetType, const AZStd::string& hint, bool isReload)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        AssetLoadTimeline timeline;
+        timeline.m_assetId = assetId;
+        timeline.m_assetType = assetType;
+        timeline.m_hint = hint;
+        timeline.m_isReload = isReload;
+        timeline.m_stageTimes[static_cast<size_t>(AssetLoadStage::Queued)] = AZStd::chrono::steady_clock::now();
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_activeTimelines[assetId] = AZStd::move(timeline);
+    }
+
+    void AssetLoadTimelineRecorder::RecordStage(const AssetId& assetId, AssetLoadStage stage)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        const AssetLoadTimeline::TimePoint now = AZStd::chrono::steady_clock::now();
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        auto it = m_activeTimelines.find(assetId);
+        if (it != m_activeTimelines.end())
+        {
+            it->second.m_stageTimes[static_cast<size_t>(stage)] = now;
+        }
+    }
+
+    void AssetLoadTimelineRecorder::CompleteTimeline(const AssetId& assetId, bool succeeded)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        const AssetLoadTimeline::TimePoint now = AZStd::chrono::steady_clock::now();
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        auto it = m_activeTimelines.find(assetId);
+        if (it == m_activeTimelines.end())
+        {
+            return;
+        }
+
+        it->second.m_stageTimes[static_cast<size_t>(AssetLoadStage::Ready)] = now;
+        it->second.m_succeeded = succeeded;
+        m_completedTimelines.push_back(AZStd::move(it->second));
+        m_activeTimelines.erase(it);
+
+        ++m_unreportedTimelineCount;
+        while (m_completedTimelines.size() > m_maxCompletedTimelines)
+        {
+            m_completedTimelines.pop_front();
+        }
+        m_unreportedTimelineCount = AZStd::min(m_unreportedTimelineCount, m_completedTimelines.size());
+    }
+
+    void AssetLoadTimelineRecorder::DiscardTimeline(const AssetId& assetId)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_activeTimelines.erase(assetId);
+    }
+
+    AZStd::vector<AssetLoadTimeline> AssetLoadTimelineRecorder::GetCompletedTimelines() const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        return AZStd::vector<AssetLoadTimeline>(m_completedTimelines.begin(), m_completedTimelines.end());
+    }
+
+    void AssetLoadTimelineRecorder::ClearCompletedTimelines()
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_completedTimelines.clear();
+        m_unreportedTimelineCount = 0;
+    }
+
+    void AssetLoadTimelineRecorder::ReportSamples(Debug::PerformanceCollector& collector)
+    {
+        AZStd::vector<AssetLoadTimeline> unreportedTimelines;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            if (!collector.IsWaitingBeforeCapture())
+            {
+                unreportedTimelines.reserve(m_unreportedTimelineCount);
+                for (size_t index = m_completedTimelines.size() - m_unreportedTimelineCount; index < m_completedTimelines.size(); ++index)
+                {
+                    unreportedTimelines.push_back(m_completedTimelines[index]);
+                }
+            }
+            m_unreportedTimelineCount = 0;
+        }
+
+        for (const AssetLoadTimeline& timeline : unreportedTimelines)
+        {
+            auto recordStep = [&collector, &timeline](AZStd::string_view metricName, AssetLoadStage from, AssetLoadStage to)
+            {
+                if (timeline.HasStage(from) && timeline.HasStage(to))
+                {
+                    collector.RecordSample(metricName, timeline.GetDuration(from, to));
+                }
+            };
+
+            recordStep(StreamReadMetric, AssetLoadStage::Queued, AssetLoadStage::StreamRead);
+            recordStep(JobQueueMetric, AssetLoadStage::StreamRead, AssetLoadStage::LoadStarted);
+            recordStep(LoadAssetDataMetric, AssetLoadStage::LoadStarted, AssetLoadStage::DataLoaded);
+            recordStep(DependencyWaitMetric, AssetLoadStage::DataLoaded, AssetLoadStage::PostLoad);
+            recordStep(NotifyMetric, AssetLoadStage::PostLoad, AssetLoadStage::Ready);
+            recordStep(TotalMetric, AssetLoadStage::Queued, AssetLoadStage::Ready);
+        }
+    }
+} // namespace AZ::Data
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::Debug
+{
+    class PerformanceCollector;
+}
+
+namespace AZ::Data
+{
+    //! The stages an asset goes through while it's loaded by the AssetManager, in the order they happen.
+    enum class AssetLoadStage : u32
+    {
+        Queued,       //!< The asset data stream was queued with the streamer.
+        StreamRead,   //!< The streamer finished reading, and if needed decompressing, the asset data.
+        LoadStarted,  //!< A job started processing the streamed data.
+        DataLoaded,   //!< AssetHandler::LoadAssetData finished.
+        PostLoad,     //!< The load was finalized after any preload dependencies were ready.
+        Ready,        //!< The ready, reloaded or error notification was dispatched.
+        Count
+    };
+
+    //! The times at which a single asset load reached each of the AssetLoadStages.
+    struct AssetLoadTimeline
+    {
+        using TimePoint = AZStd::chrono::steady_clock::time_point;
+
+        //! Returns true if the load went through the given stage.
+        bool HasStage(AssetLoadStage stage) const;
+        //! Returns the time between two stages, or zero if the load didn't go through both of them.
+        AZStd::chrono::microseconds GetDuration(AssetLoadStage from, AssetLoadStage to) const;
+        //! Returns the time from queueing the asset until its notification was dispatched.
+        AZStd::chrono::microseconds GetTotalDuration() const;
+
+        AssetId m_assetId;
+        AssetType m_assetType;
+        AZStd::string m_hint;
+        AZStd::array<TimePoint, static_cast<size_t>(AssetLoadStage::Count)> m_stageTimes{};
+        bool m_isReload = false;
+        bool m_succeeded = false;
+    };
+
+    //! Records an AssetLoadTimeline for every asset the AssetManager loads while recording is enabled.
+    //! Recording is controlled through the cl_assetLoadTimelineEnable cvar or SetEnabled.
+    //!
+    //! The completed timelines can be inspected directly with GetCompletedTimelines, or reported to a
+    //! Debug::PerformanceCollector through ReportSamples. The collector needs to be created with the names
+    //! returned by GetMetricNames.
+    class AssetLoadTimelineRecorder
+    {
+    public:
+        //! Metrics reported to the PerformanceCollector, one for each step between two stages and one for the whole load.
+        static constexpr AZStd::string_view StreamReadMetric = "AssetLoad StreamRead";
+        static constexpr AZStd::string_view JobQueueMetric = "AssetLoad JobQueue";
+        static constexpr AZStd::string_view LoadAssetDataMetric = "AssetLoad LoadAssetData";
+        static constexpr AZStd::string_view DependencyWaitMetric = "AssetLoad DependencyWait";
+        static constexpr AZStd::string_view NotifyMetric = "AssetLoad Notify";
+        static constexpr AZStd::string_view TotalMetric = "AssetLoad Total";
+
+        static AZStd::span<const AZStd::string_view> GetMetricNames();
+
+        static constexpr size_t DefaultMaxCompletedTimelines = 4096;
+
+        void SetEnabled(bool enabled);
+        bool IsEnabled() const;
+
+        //! Sets how many completed timelines are kept. The oldest timelines are dropped first.
+        void SetMaxCompletedTimelines(size_t maxCompletedTimelines);
+
+        //! Starts a new timeline for the asset at the Queued stage, replacing any timeline still in progress for it.
+        void BeginTimeline(const AssetId& assetId, const AssetType& assetType, const AZStd::string& hint, bool isReload);
+        //! Records the time the asset reached the given stage. Does nothing if no timeline is in progress for the asset.
+        void RecordStage(const AssetId& assetId, AssetLoadStage stage);
+        //! Records the Ready stage and moves the timeline to the completed timelines.
+        void CompleteTimeline(const AssetId& assetId, bool succeeded);
+        //! Drops the timeline in progress for the asset, used for canceled loads.
+        void DiscardTimeline(const AssetId& assetId);
+
+        AZStd::vector<AssetLoadTimeline> GetCompletedTimelines() const;
+        void ClearCompletedTimelines();
+
+        //! Records the durations of all timelines that completed since the previous call as samples in the collector.
+        //! The collector isn't thread safe, so this needs to be called from the thread that calls its FrameTick.
+        //! Timelines that complete while the collector isn't capturing aren't reported.
+        void ReportSamples(Debug::PerformanceCollector& collector);
+
+    private:
+        AZStd::unordered_map<AssetId, AssetLoadTimeline> m_activeTimelines;
+        AZStd::deque<AssetLoadTimeline> m_completedTimelines;
+        //! Number of timelines at the end of m_completedTimelines that haven't been passed to ReportSamples yet.
+        size_t m_unreportedTimelineCount = 0;
+        size_t m_maxCompletedTimelines = DefaultMaxCompletedTimelines;
+        mutable AZStd::mutex m_mutex;
+        AZStd::atomic_bool m_enabled{ false };
+    };
+} // namespace AZ::Data
@@ -50,6 +50,17 @@ namespace AZ::Data
     AZ_CVAR(bool, cl_assetLoadError, false, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Enable failure of all asset loads.");
 
+    static void OnAssetLoadTimelineEnableChanged(const bool& enable)
+    {
+        if (AssetManager::IsReady())
+        {
+            AssetManager::Instance().GetLoadTimelineRecorder().SetEnabled(enable);
+        }
+    }
+
+    AZ_CVAR(bool, cl_assetLoadTimelineEnable, false, &OnAssetLoadTimelineEnableChanged, AZ::ConsoleFunctorFlags::Null,
+        "Record how long every asset load spends in each load stage. See AZ::Data::AssetLoadTimelineRecorder.");
+
     static constexpr char kAssetDBInstanceVarName[] = "AssetDatabaseInstance";
 
     /*
@@ -176,6 +187,8 @@ namespace AZ::Data
                 AZ_PROFILE_SCOPE(AzCore, "AZ::Data::LoadAssetJob::Process: %s",
                     asset.GetHint().c_str());
 
+                m_owner->GetLoadTimelineRecorder().RecordStage(asset.GetId(), AssetLoadStage::LoadStarted);
+
                 if (m_owner->ValidateAndRegisterAssetLoading(asset))
                 {
                     LoadAndSignal(asset);
@@ -189,6 +202,7 @@ namespace AZ::Data
                 AZ_STRING_ARG(asset.GetId().ToFixedString())));
 
             const bool loadSucceeded = LoadData();
+            m_owner->GetLoadTimelineRecorder().RecordStage(asset.GetId(), AssetLoadStage::DataLoaded);
 
             ASSET_DEBUG_OUTPUT(AZStd::string::format(
                 "LoadAndSignal - Post - Result: %s - Signal: %s - " AZ_STRING_FORMAT,
@@ -555,6 +569,8 @@ namespace AZ::Data
     {
         (void)desc;
 
+        m_loadTimelineRecorder.SetEnabled(cl_assetLoadTimelineEnable);
+
         AssetManagerBus::Handler::BusConnect();
     }
 
@@ -700,15 +716,18 @@ namespace AZ::Data
                     {
                         // this scope is used to control the scope of the lock.
                         AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                        for (const auto &assetEntry : m_assets)
+                        for (const AssetMapStripe& stripe : m_assetMapStripes)
                         {
-                            // is the handler that handles this type, this handler we're removing?
-                            if (assetEntry.second->m_registeredHandler == handler)
+                            for (const auto& assetEntry : stripe.m_assets)
                             {
-                                AZ_Error("AssetManager", false, "Asset handler for %s is being removed, when assetid %s is still loaded!\n",
-                                            assetEntry.second->GetType().ToString<AZ::OSString>().c_str(),
-                                            assetEntry.second->GetId().ToString<AZ::OSString>().c_str()); // this will write the name IF AVAILABLE
-                                assetEntry.second->UnregisterWithHandler();
+                                // is the handler that handles this type, this handler we're removing?
+                                if (assetEntry.second->m_registeredHandler == handler)
+                                {
+                                    AZ_Error("AssetManager", false, "Asset handler for %s is being removed, when assetid %s is still loaded!\n",
+                                                assetEntry.second->GetType().ToString<AZ::OSString>().c_str(),
+                                                assetEntry.second->GetId().ToString<AZ::OSString>().c_str()); // this will write the name IF AVAILABLE
+                                    assetEntry.second->UnregisterWithHandler();
+                                }
                             }
                         }
                     }
@@ -794,17 +813,20 @@ namespace AZ::Data
 
         AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
         // First, release any containers that were loading this asset
-        for (auto asset = m_assets.begin();asset != m_assets.end();)
+        for (AssetMapStripe& stripe : m_assetMapStripes)
         {
-            if (asset->second->m_useCount == 0)
+            for (auto asset = stripe.m_assets.begin(); asset != stripe.m_assets.end();)
             {
-                auto releaseAsset = asset->second;
-                ++asset;
-                ReleaseAssetContainersForAsset(releaseAsset);
-            }
-            else
-            {
-                ++asset;
+                if (asset->second->m_useCount == 0)
+                {
+                    auto releaseAsset = asset->second;
+                    ++asset;
+                    ReleaseAssetContainersForAsset(releaseAsset);
+                }
+                else
+                {
+                    ++asset;
+                }
             }
         }
 
@@ -812,13 +834,16 @@ namespace AZ::Data
 
         AZStd::vector<AssetData*> assetsToRelease;
 
-        for(auto&& asset : m_assets)
+        for (const AssetMapStripe& stripe : m_assetMapStripes)
         {
-            if(asset.second->m_weakUseCount == 0)
+            for (auto&& asset : stripe.m_assets)
             {
-                // Keep a separate list of assets to release, because releasing them will modify the m_assets list that we're
-                // currently looping on.
-                assetsToRelease.push_back(asset.second);
+                if (asset.second->m_weakUseCount == 0)
+                {
+                    // Keep a separate list of assets to release, because releasing them will modify the asset map that we're
+                    // currently looping on.
+                    assetsToRelease.push_back(asset.second);
+                }
             }
         }
 
@@ -859,6 +884,12 @@ namespace AZ::Data
     //=========================================================================
     Asset<AssetData> AssetManager::FindAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior)
     {
+        // Only canonical ids are stored in the asset map, so if the id is found there it doesn't need to be resolved by the catalog.
+        if (Asset<AssetData> asset = FindAssetInMap(assetId, assetReferenceLoadBehavior); asset)
+        {
+            return asset;
+        }
+
         // Look up the asset id in the catalog, and use the result of that instead.
         // If assetId is a legacy id, assetInfo.m_assetId will be the canonical id. Otherwise, assetInfo.m_assetID == assetId.
         // This is because only canonical ids are stored in m_assets (see below).
@@ -872,16 +903,50 @@ namespace AZ::Data
         // If the catalog is not available, use the original assetId
         const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-        AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-        AssetMap::iterator it = m_assets.find(assetToFind);
-        if (it != m_assets.end())
+        return FindAssetInMap(assetToFind, assetReferenceLoadBehavior);
+    }
+
+    auto AssetManager::GetAssetMapStripe(const AssetId& assetId) -> AssetMapStripe&
+    {
+        return m_assetMapStripes[AZStd::hash<AssetId>()(assetId) % AssetMapStripeCount];
+    }
+
+    Asset<AssetData> AssetManager::FindAssetInMap(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior)
+    {
+        AssetData* assetData = nullptr;
         {
-            Asset<AssetData> asset(assetReferenceLoadBehavior);
-            asset.SetData(it->second);
+            AssetMapStripe& stripe = GetAssetMapStripe(assetId);
+            AZStd::shared_lock<AZStd::shared_mutex> stripeLock(stripe.m_mutex);
+            AssetMap::iterator it = stripe.m_assets.find(assetId);
+            if (it == stripe.m_assets.end())
+            {
+                return Asset<AssetData>(assetReferenceLoadBehavior);
+            }
 
-            return asset;
+            // Claim a reference while the stripe is locked, as ReleaseAsset can only remove the asset from the map while it's
+            // unreferenced. The rest of the asset is set up outside of the lock.
+            assetData = it->second;
+            assetData->AcquireWeak();
         }
-        return Asset<AssetData>(assetReferenceLoadBehavior);
+
+        Asset<AssetData> asset(assetReferenceLoadBehavior);
+        asset.SetData(assetData);
+        assetData->ReleaseWeak();
+        return asset;
+    }
+
+    AssetData* AssetManager::FindRegisteredAssetData(const AssetId& assetId)
+    {
+        AssetMapStripe& stripe = GetAssetMapStripe(assetId);
+        AssetMap::iterator it = stripe.m_assets.find(assetId);
+        return it != stripe.m_assets.end() ? it->second : nullptr;
+    }
+
+    void AssetManager::RegisterAssetData(const AssetId& assetId, AssetData* assetData)
+    {
+        AssetMapStripe& stripe = GetAssetMapStripe(assetId);
+        AZStd::scoped_lock<AZStd::shared_mutex> stripeLock(stripe.m_mutex);
+        stripe.m_assets[assetId] = assetData;
     }
 
     AZStd::pair<AZ::IO::IStreamerTypes::Deadline, AZ::IO::IStreamerTypes::Priority> GetEffectiveDeadlineAndPriority(
@@ -911,6 +976,18 @@ namespace AZ::Data
     //=========================================================================
     Asset<AssetData> AssetManager::GetAsset(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams)
     {
+        // Assets that are already loaded are handed out straight from the asset map. Only canonical ids are stored there, so a hit
+        // doesn't need the catalog to resolve the id, and neither the catalog lock nor the asset lock are taken.
+        // Anything else (legacy ids, type mismatches, assets still loading or being reloaded) goes through the regular path below.
+        if (!loadParams.m_reloadMissingDependencies)
+        {
+            Asset<AssetData> loadedAsset = FindAssetInMap(assetId, assetReferenceLoadBehavior);
+            if (loadedAsset && loadedAsset.IsReady() && loadedAsset.GetType() == assetType)
+            {
+                return loadedAsset;
+            }
+        }
+
         // If parallel dependent loads are disabled, just try to load the requested asset directly, and let it trigger
         // dependent loads as they're encountered.
         // Parallel dependent loads are disabled during asset building because there is no guarantee that dependency information
@@ -1003,6 +1080,19 @@ namespace AZ::Data
 
         AZ_PROFILE_SCOPE(AzCore, "GetAsset: %s", assetInfo.m_relativePath.c_str());
 
+        // Assets that are done loading are handed out without taking the asset lock, which is only needed to create or queue assets.
+        {
+            Asset<AssetData> loadedAsset = FindAssetInMap(assetInfo.m_assetId, assetReferenceLoadBehavior);
+            if (loadedAsset && (loadedAsset->IsReady() || loadedAsset->IsError()))
+            {
+                if (!assetInfo.m_relativePath.empty())
+                {
+                    loadedAsset.m_assetHint = assetInfo.m_relativePath;
+                }
+                return loadedAsset;
+            }
+        }
+
         AZStd::shared_ptr<AssetDataStream> dataStream;
         AssetStreamInfo loadInfo;
         bool triggerAssetErrorNotification = false;
@@ -1020,10 +1110,9 @@ namespace AZ::Data
             {
                 AZ_PROFILE_SCOPE(AzCore, "GetAsset: FindAsset");
 
-                AssetMap::iterator it = m_assets.find(assetInfo.m_assetId);
-                if (it != m_assets.end())
+                assetData = FindRegisteredAssetData(assetInfo.m_assetId);
+                if (assetData)
                 {
-                    assetData = it->second;
                     asset.SetData(assetData);
                 }
                 else
@@ -1070,7 +1159,7 @@ namespace AZ::Data
                 if (isNewEntry && assetData->IsRegisterReadonlyAndShareable())
                 {
                     AZ_PROFILE_SCOPE(AzCore, "GetAsset: RegisterAsset");
-                    m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
+                    RegisterAssetData(assetInfo.m_assetId, assetData);
                 }
                 if (assetData->GetStatus() == AssetData::AssetStatus::NotLoaded)
                 {
@@ -1260,8 +1349,7 @@ namespace AZ::Data
         AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
 
         // check if asset already exist
-        AssetMap::iterator it = m_assets.find(assetId);
-        if (it == m_assets.end())
+        if (!FindRegisteredAssetData(assetId))
         {
             // find the asset type handler
             AssetHandlerMap::iterator handlerIt = m_handlers.find(assetType);
@@ -1279,7 +1367,7 @@ namespace AZ::Data
                     assetData->RegisterWithHandler(handler);
                     if (assetData->IsRegisterReadonlyAndShareable())
                     {
-                        m_assets.insert(AZStd::make_pair(assetId, assetData));
+                        RegisterAssetData(assetId, assetData);
                     }
 
                     Asset<AssetData> asset(assetReferenceLoadBehavior);
@@ -1314,7 +1402,10 @@ namespace AZ::Data
         if (removeAssetFromHash)
         {
             AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
-            AssetMap::iterator it = m_assets.find(assetId);
+            // The stripe is locked as well, since FindAssetInMap can claim a reference without holding m_assetMutex.
+            AssetMapStripe& stripe = GetAssetMapStripe(assetId);
+            AZStd::scoped_lock<AZStd::shared_mutex> stripeLock(stripe.m_mutex);
+            AssetMap::iterator it = stripe.m_assets.find(assetId);
             // need to check the count again in here in case
            // someone was trying to get the asset on another thread
            // Set it to -1 so only this thread will attempt to clean up the cache and delete the asset
@@ -1322,10 +1413,10 @@ namespace AZ::Data
             // if the assetId is not in the map or if the identifierId
             // do not match it implies that the asset has been already destroyed.
             // if the usecount is non zero it implies that we cannot destroy this asset.
-            if (it != m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
+            if (it != stripe.m_assets.end() && it->second->m_creationToken == creationToken && it->second->m_weakUseCount.compare_exchange_strong(expectedRefCount, -1))
             {
                 wasInAssetsHash = true;
-                m_assets.erase(it);
+                stripe.m_assets.erase(it);
                 destroyAsset = true;
             }
         }
@@ -1461,9 +1552,9 @@ namespace AZ::Data
 
         {
             AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            auto assetIter = m_assets.find(assetId);
+            AssetData* assetData = FindRegisteredAssetData(assetId);
 
-            if (assetIter == m_assets.end() || assetIter->second->IsLoading())
+            if (!assetData || assetData->IsLoading())
             {
                 // Only existing assets can be reloaded.
                 ASSET_DEBUG_OUTPUT(AZStd::string::format("Asset does not exist or is already loading - reload abort - " AZ_STRING_FORMAT,
@@ -1507,14 +1598,14 @@ namespace AZ::Data
             AssetData* newAssetData = nullptr;
             AssetHandler* handler = nullptr;
 
-            bool preventAutoReload = isAutoReload && assetIter->second && !assetIter->second->HandleAutoReload();
+            bool preventAutoReload = isAutoReload && !assetData->HandleAutoReload();
 
             // when Asset<T>'s constructor is called (the one that takes an AssetData), it updates the AssetID
             // of the Asset<T> to be the real latest canonical assetId of the asset, so we cache that here instead of have it happen
             // implicitly and repeatedly for anything we call.
-            Asset<AssetData> currentAsset(assetIter->second, AZ::Data::AssetLoadBehavior::Default);
+            Asset<AssetData> currentAsset(assetData, AZ::Data::AssetLoadBehavior::Default);
 
-            if (!assetIter->second->IsRegisterReadonlyAndShareable() && !preventAutoReload)
+            if (!assetData->IsRegisterReadonlyAndShareable() && !preventAutoReload)
             {
                 // Reloading an "instance asset" is basically a no-op.
                 // We'll simply notify users to reload the asset.
@@ -1621,23 +1712,22 @@ namespace AZ::Data
         {
             AZ_Assert(asset.Get(), "Asset data for reload is missing.");
             AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
+            AssetData* found = FindRegisteredAssetData(asset.GetId());
             AZ_Assert(
-                m_assets.find(asset.GetId()) != m_assets.end(),
+                found,
                 "Unable to reload asset %s because it's not in the AssetManager's asset list.", asset.ToString<AZStd::string>().c_str());
             AZ_Assert(
-                m_assets.find(asset.GetId()) == m_assets.end() ||
-                    asset->RTTI_GetType() == m_assets.find(asset.GetId())->second->RTTI_GetType(),
+                !found || asset->RTTI_GetType() == found->RTTI_GetType(),
                 "New and old data types are mismatched!");
 
-            auto found = m_assets.find(asset.GetId());
-            if ((found == m_assets.end()) || (asset->RTTI_GetType() != found->second->RTTI_GetType()))
+            if (!found || (asset->RTTI_GetType() != found->RTTI_GetType()))
             {
                 return; // this will just lead to crashes down the line and the above asserts cover this.
             }
 
             AssetData* newData = asset.Get();
 
-            if (found->second != newData)
+            if (found != newData)
             {
                 // Notify users that we are about to change asset
                 AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetPreReload, asset);
@@ -1692,8 +1782,8 @@ namespace AZ::Data
             bool requeue{ false };
             {
                 AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-                auto found = m_assets.find(assetId);
-                AZ_Assert(found == m_assets.end() || asset.Get()->RTTI_GetType() == found->second->RTTI_GetType(),
+                AssetData* found = FindRegisteredAssetData(assetId);
+                AZ_Assert(!found || asset.Get()->RTTI_GetType() == found->RTTI_GetType(),
                     "New and old data types are mismatched!");
 
                 // if we are here it implies that we have two assets with the same asset id, and we are
@@ -1702,14 +1792,14 @@ namespace AZ::Data
                 // because of creation token mismatch when it's ref count finally goes to zero. Since the old asset is not shareable anymore
                 // manually setting the creationToken to default creation token will ensure that the asset is destroyed correctly.
                 asset.m_assetData->m_creationToken = ++m_creationTokenGenerator;
-                if (found != m_assets.end())
+                if (found)
                 {
-                    found->second->m_creationToken = AZ::Data::s_defaultCreationToken;
+                    found->m_creationToken = AZ::Data::s_defaultCreationToken;
                 }
 
                 // Held references to old data are retained, but replace the entry in the DB for future requests.
                 // Fire an OnAssetReloaded message so listeners can react to the new data.
-                m_assets[assetId] = asset.Get();
+                RegisterAssetData(assetId, asset.Get());
 
                 // Release the reload reference.
                 auto reloadInfo = m_reloads.find(assetId);
@@ -1789,11 +1879,13 @@ namespace AZ::Data
                     if (data->GetStatus() != AssetData::AssetStatus::Queued)
                     {
                         AZ_Warning("AssetManager", false, "Asset %s no longer in Queued state, abandoning load", loadingAsset.GetId().ToString<AZStd::string>().c_str());
+                        m_loadTimelineRecorder.DiscardTimeline(assetId);
                         return;
                     }
                     data->m_status = AssetData::AssetStatus::StreamReady;
                     UpdateDebugStatus(loadingAsset);
                 }
+                m_loadTimelineRecorder.RecordStage(assetId, AssetLoadStage::StreamRead);
 
                 // The callback from AZ Streamer blocks the streaming thread until this function completes. To minimize the overhead,
                 // do the majority of the work in a separate job.
@@ -1848,6 +1940,8 @@ namespace AZ::Data
 
         auto&& [deadline, priority] = GetEffectiveDeadlineAndPriority(*handler, asset.GetType(), loadParams);
 
+        m_loadTimelineRecorder.BeginTimeline(asset.GetId(), asset.GetType(), asset.GetHint(), isReload);
+
         // Track the load request and queue the asset data stream load.
         AddActiveStreamerRequest(asset.GetId(), dataStream);
         dataStream->Open(
@@ -1862,8 +1956,11 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::NotifyAssetReady(Asset<AssetData> asset)
     {
+        AZ_PROFILE_SCOPE(AzCore, "AssetManager::NotifyAssetReady: %s", asset.GetHint().c_str());
+
         AssetData* data = asset.Get();
         AZ_Assert(data, "NotifyAssetReady: asset is missing info!");
+        m_loadTimelineRecorder.CompleteTimeline(asset.GetId(), true);
         data->m_status = AssetData::AssetStatus::Ready;
 
         AssetLoadBus::Event(asset.GetId(), &AssetLoadBus::Events::OnAssetReady, asset); // Broadcast to any containers first
@@ -1883,6 +1980,7 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::NotifyAssetReloaded(Asset<AssetData> asset)
     {
+        m_loadTimelineRecorder.CompleteTimeline(asset.GetId(), true);
         AssignAssetData(asset);
     }
 
@@ -1891,6 +1989,8 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::NotifyAssetReloadError(Asset<AssetData> asset)
     {
+        m_loadTimelineRecorder.CompleteTimeline(asset.GetId(), false);
+
         // Failed reloads have no side effects. Just notify observers (error reporting, etc).
         {
             AZStd::lock_guard<AZStd::recursive_mutex> assetLock(m_assetMutex);
@@ -1905,6 +2005,7 @@ namespace AZ::Data
     //=========================================================================
     void AssetManager::NotifyAssetError(Asset<AssetData> asset)
     {
+        m_loadTimelineRecorder.CompleteTimeline(asset.GetId(), false);
         asset.Get()->m_status = AssetData::AssetStatus::Error;
         AssetLoadBus::Event(asset.GetId(), &AssetLoadBus::Events::OnAssetError, asset); // Broadcast to any containers first
         AssetBus::Event(asset.GetId(), &AssetBus::Events::OnAssetError, asset);
@@ -2040,6 +2141,11 @@ namespace AZ::Data
         return (!(m_activeJobs.empty() && m_activeAssetDataStreamRequests.empty()));
     }
 
+    AssetLoadTimelineRecorder& AssetManager::GetLoadTimelineRecorder()
+    {
+        return m_loadTimelineRecorder;
+    }
+
     //=========================================================================
     // AddBlockingRequest
     //=========================================================================
@@ -2139,6 +2245,8 @@ namespace AZ::Data
 
     void AssetManager::OnAssetCanceled(AssetId assetId)
     {
+        m_loadTimelineRecorder.DiscardTimeline(assetId);
+
         // Queue broadcast message for delivery on game thread.
         AssetBus::QueueFunction(&AssetManager::NotifyAssetCanceled, this, assetId);
     }
@@ -2257,6 +2365,8 @@ namespace AZ::Data
         AZStd::shared_ptr<AssetDataStream> stream,
         const AssetFilterCB& assetLoadFilterCB)
     {
+        AZ_PROFILE_SCOPE(AzCore, "AssetHandler::LoadAssetData: %s", asset.GetHint().c_str());
+
 #ifdef AZ_ENABLE_TRACING
         auto start = AZStd::chrono::steady_clock::now();
 #endif
@@ -2331,6 +2441,8 @@ namespace AZ::Data
                                 bool isReload, AZ::Data::AssetHandler* assetHandler)
     {
         AZ_PROFILE_FUNCTION(AzCore);
+        m_loadTimelineRecorder.RecordStage(asset.GetId(), AssetLoadStage::PostLoad);
+
         if (!assetHandler)
         {
             assetHandler = GetHandler(asset.GetType());
@@ -2408,25 +2520,33 @@ namespace AZ::Data
 
         // we need to cache the AssetStreamInfo since json objects are referencing the names in it. 
         AZStd::vector<AssetStreamInfo> cachedStreamInfos;
-        cachedStreamInfos.reserve(m_assets.size());
+        size_t assetCount = 0;
+        for (const AssetMapStripe& stripe : m_assetMapStripes)
+        {
+            assetCount += stripe.m_assets.size();
+        }
+        cachedStreamInfos.reserve(assetCount);
 
-        for (const auto& assetEntry : m_assets)
+        for (const AssetMapStripe& stripe : m_assetMapStripes)
         {
-            cachedStreamInfos.emplace_back(GetLoadStreamInfoForAsset(assetEntry.first, assetEntry.second->GetType()));
+            for (const auto& assetEntry : stripe.m_assets)
+            {
+                cachedStreamInfos.emplace_back(GetLoadStreamInfoForAsset(assetEntry.first, assetEntry.second->GetType()));
 
-            const AssetStreamInfo& streamInfo = cachedStreamInfos.back();
-            totalSize += streamInfo.m_dataLen;
-            auto& typeInfo = assetTypeInfos[AZStd::string(assetEntry.second->RTTI_GetTypeName())];
-            typeInfo.size += streamInfo.m_dataLen;
-            typeInfo.count++;
+                const AssetStreamInfo& streamInfo = cachedStreamInfos.back();
+                totalSize += streamInfo.m_dataLen;
+                auto& typeInfo = assetTypeInfos[AZStd::string(assetEntry.second->RTTI_GetTypeName())];
+                typeInfo.size += streamInfo.m_dataLen;
+                typeInfo.count++;
 
-            rapidjson::Value assetInfoObject(rapidjson::kObjectType);
+                rapidjson::Value assetInfoObject(rapidjson::kObjectType);
 
-            assetInfoObject.AddMember("Type", rapidjson::StringRef(assetEntry.second->RTTI_GetTypeName()), doc.GetAllocator());
-            assetInfoObject.AddMember("Path", rapidjson::StringRef(streamInfo.m_streamName.c_str()), doc.GetAllocator());
-            assetInfoObject.AddMember("SizeInBytes", static_cast<uint64_t>(streamInfo.m_dataLen), doc.GetAllocator());
-            assetInfoObject.AddMember("RefCount", static_cast<uint64_t>(assetEntry.second->GetUseCount()), doc.GetAllocator());
-            infoArray.PushBack(assetInfoObject, doc.GetAllocator());
+                assetInfoObject.AddMember("Type", rapidjson::StringRef(assetEntry.second->RTTI_GetTypeName()), doc.GetAllocator());
+                assetInfoObject.AddMember("Path", rapidjson::StringRef(streamInfo.m_streamName.c_str()), doc.GetAllocator());
+                assetInfoObject.AddMember("SizeInBytes", static_cast<uint64_t>(streamInfo.m_dataLen), doc.GetAllocator());
+                assetInfoObject.AddMember("RefCount", static_cast<uint64_t>(assetEntry.second->GetUseCount()), doc.GetAllocator());
+                infoArray.PushBack(assetInfoObject, doc.GetAllocator());
+            }
         }
                 
         rapidjson::Value typeSizeArray(rapidjson::kArrayType);
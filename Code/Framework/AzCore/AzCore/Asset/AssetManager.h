@@ -11,12 +11,15 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetContainer.h>
 #include <AzCore/Asset/AssetDataStream.h>
+#include <AzCore/Asset/AssetLoadTimeline.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // used as allocator for most components
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
@@ -324,6 +327,12 @@ namespace AZ
             */
             bool HasActiveJobsOrStreamerRequests();
 
+            /**
+            * Returns the recorder that tracks how long each asset spends in every stage of its load.
+            * Recording is disabled by default and can be enabled with the cl_assetLoadTimelineEnable cvar.
+            */
+            AssetLoadTimelineRecorder& GetLoadTimelineRecorder();
+
             // memory debug output
             void DumpLoadedAssetsInfo();
 
@@ -355,6 +364,24 @@ namespace AZ
             void PostLoad(AZ::Data::Asset<AZ::Data::AssetData>& asset, bool loadSucceeded, bool isReload, AZ::Data::AssetHandler* assetHandler = nullptr);
 
             Asset<AssetData> GetAssetInternal(const AssetId& assetId, const AssetType& assetType, AssetLoadBehavior assetReferenceLoadBehavior, const AssetLoadParameters& loadParams = AssetLoadParameters{}, AssetInfo assetInfo = AssetInfo(), bool signalLoaded = false);
+
+            //! The asset map is split into stripes that are locked on their own, so looking up an asset only takes a shared lock on
+            //! the stripe of its id instead of m_assetMutex. Stripes are only modified while m_assetMutex is held as well, which
+            //! allows code holding m_assetMutex to read and iterate them without locking the stripes.
+            struct AssetMapStripe
+            {
+                AssetMap m_assets;
+                AZStd::shared_mutex m_mutex; // lock exclusively when modifying the stripe, shared when reading it without m_assetMutex
+            };
+            static constexpr size_t AssetMapStripeCount = 64;
+
+            AssetMapStripe& GetAssetMapStripe(const AssetId& assetId);
+            //! Looks up an asset in the asset map without taking m_assetMutex.
+            Asset<AssetData> FindAssetInMap(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior);
+            //! Returns the data registered for an asset id, to be called while holding m_assetMutex.
+            AssetData* FindRegisteredAssetData(const AssetId& assetId);
+            //! Registers the data for an asset id, replacing any data that was registered for it. m_assetMutex must be held.
+            void RegisterAssetData(const AssetId& assetId, AssetData* assetData);
             // Alternative path to GetAssetInternal intended to be called by the AssetContainer when reloading an asset
             // Assumes the asset is already ready to go and just needs to be set up for loading
             void QueueAssetReload(AZ::Data::Asset<AZ::Data::AssetData> asset, bool signalLoaded);
@@ -409,8 +436,8 @@ namespace AZ
             AssetHandlerMap         m_handlers;
             AssetCatalogMap         m_catalogs;
             AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
-            AssetMap                m_assets;
-            AZStd::recursive_mutex  m_assetMutex;       // lock when accessing the asset map
+            AZStd::array<AssetMapStripe, AssetMapStripeCount> m_assetMapStripes;
+            AZStd::recursive_mutex  m_assetMutex;       // lock when modifying the asset map or the loading state of assets
 
             WeakAssetContainerMap   m_assetContainers;
             OwnedAssetContainerMap  m_ownedAssetContainers;
@@ -419,6 +446,7 @@ namespace AZ
 
             AZStd::thread::id m_mainThreadId;
             IDebugAssetEvent* m_debugAssetEvents{ nullptr };
+            AssetLoadTimelineRecorder m_loadTimelineRecorder;
 
             int m_creationTokenGenerator = 0; // this is used to generate unique identifiers for assets
 
@@ -55,6 +55,24 @@ namespace AZ
         };
 
         using PreloadAssetListType = AZStd::unordered_map<AZ::Data::AssetId, AZStd::unordered_set<AZ::Data::AssetId>>;
+
+        /**
+         * The flattened dependencies of an asset, following the load behavior rules of GetLoadBehaviorProductDependencies.
+         * Catalogs keep these around so that loading an asset doesn't need to walk its dependency graph every time.
+         */
+        struct LoadBehaviorDependencyClosure
+        {
+            AZ_CLASS_ALLOCATOR(LoadBehaviorDependencyClosure, AZ::SystemAllocator);
+
+            //! Every dependency that isn't NoLoad, in breadth first order from the asset.
+            AZStd::vector<ProductDependency> m_dependencies;
+            //! Shortest distance of each dependency from the asset, 1 for the direct dependencies.
+            AZStd::vector<AZ::u32> m_depths;
+            AZ::u32 m_maxDepth = 0;
+            AZStd::unordered_set<AssetId> m_noloadDependencies;
+            PreloadAssetListType m_preloadDependencies;
+        };
+
         /**
          * Request bus for asset catalogs. Presently we expect only one asset catalog, so this
          * bus is limited to one handlers.
@@ -202,6 +220,12 @@ namespace AZ
             /// NoLoad assets however simply wait for the user to request an additional load - they or their dependencies don't begin loading by default
             virtual AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> GetLoadBehaviorProductDependencies([[maybe_unused]] const AZ::Data::AssetId& id, [[maybe_unused]] AZStd::unordered_set<AZ::Data::AssetId>& noloadSet, [[maybe_unused]] PreloadAssetListType& preloadLists) { return AZ::Failure<AZStd::string>("Not implemented"); }
 
+            /// Retrieves the same dependencies as GetLoadBehaviorProductDependencies, along with how deep each of them is in the dependency graph.
+            /// The closure is shared with other callers and must not be modified.
+            /// \param id - the id of the asset to look up the dependencies for
+            /// \return the dependency closure of the asset, or nullptr if the catalog doesn't provide closures.
+            virtual AZStd::shared_ptr<const LoadBehaviorDependencyClosure> GetLoadBehaviorDependencyClosure([[maybe_unused]] const AZ::Data::AssetId& id) { return {}; }
+
             /// Retrieves a list of all products the given (product) asset depends on (recursively).
             /// \param id - the id of the asset to look up the dependencies for
             /// \param exclusionList - list of AssetIds to ignore (recursively).  If a match is found, it and all its dependencies are skipped.
@@ -610,6 +610,14 @@ namespace AZ
          */
         virtual void GetWarnings([[maybe_unused]] StringWarningArray& warnings, [[maybe_unused]] const Component* instance) const { }
 
+        /**
+         * Specifies whether the provided, dependent, required and incompatible services are the same for every instance.
+         * When true for all components on an entity, the order the components are activated in can be cached and shared
+         * between entities with the same component types. Descriptors that refine services per instance must return false.
+         * @return True if the services don't depend on the instance. Otherwise, false.
+         */
+        virtual bool HasInstanceIndependentServices() const { return false; }
+
         /**
          * Gets the current descriptor.
          * @param instance The current descriptor.
@@ -733,6 +741,14 @@ namespace AZ
             CallReflect(reflection, typename HasComponentReflect<ComponentClass>::type());
         }
 
+        /**
+         * Services are forwarded to static functions on the component class, so they're the same for every instance.
+         */
+        bool HasInstanceIndependentServices() const override
+        {
+            return true;
+        }
+
         /**
          * Calls the static function AZ::ComponentDescriptor::GetProvidedServices, if the user provided it.
          * @param provided Array of provided services.
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/ComponentActivationOrderCache.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    bool ComponentActivationOrderCache::ApplyCachedOrder(Entity::ComponentArrayType& inOutComponents) const
+    {
+        if (inOutComponents.empty() ||
+            AZStd::find(inOutComponents.begin(), inOutComponents.end(), nullptr) != inOutComponents.end())
+        {
+            return false;
+        }
+
+        const size_t signature = CalculateSignature(inOutComponents);
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        auto bucket = m_orders.find(signature);
+        if (bucket == m_orders.end())
+        {
+            return false;
+        }
+
+        const size_t componentCount = inOutComponents.size();
+        for (const CachedOrder& order : bucket->second)
+        {
+            if (order.m_componentTypes.size() != componentCount)
+            {
+                continue;
+            }
+
+            bool isMatch = true;
+            for (size_t i = 0; i < componentCount; ++i)
+            {
+                if (order.m_componentTypes[i] != inOutComponents[i]->RTTI_GetType())
+                {
+                    isMatch = false;
+                    break;
+                }
+            }
+
+            if (isMatch)
+            {
+                Entity::ComponentArrayType sortedComponents;
+                sortedComponents.reserve(componentCount);
+                for (u32 index : order.m_sortedIndices)
+                {
+                    sortedComponents.push_back(inOutComponents[index]);
+                }
+                inOutComponents = AZStd::move(sortedComponents);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ComponentActivationOrderCache::StoreOrder(
+        const Entity::ComponentArrayType& unsortedComponents, const Entity::ComponentArrayType& sortedComponents)
+    {
+        // Dependency sort drops null components, in which case the indices can't be mapped back.
+        if (unsortedComponents.empty() || unsortedComponents.size() != sortedComponents.size())
+        {
+            return;
+        }
+
+        CachedOrder order;
+        order.m_componentTypes.reserve(unsortedComponents.size());
+        for (const Component* component : unsortedComponents)
+        {
+            const TypeId& componentType = component->RTTI_GetType();
+            if (AZStd::find(order.m_componentTypes.begin(), order.m_componentTypes.end(), componentType) != order.m_componentTypes.end())
+            {
+                // Components of the same type are ordered by their component id, which differs between entities.
+                return;
+            }
+
+            ComponentDescriptor* descriptor = nullptr;
+            ComponentDescriptorBus::EventResult(descriptor, componentType, &ComponentDescriptorBus::Events::GetDescriptor);
+            if (!descriptor || !descriptor->HasInstanceIndependentServices())
+            {
+                return;
+            }
+            order.m_componentTypes.push_back(componentType);
+        }
+
+        order.m_sortedIndices.reserve(sortedComponents.size());
+        for (const Component* component : sortedComponents)
+        {
+            auto it = AZStd::find(unsortedComponents.begin(), unsortedComponents.end(), component);
+            if (it == unsortedComponents.end())
+            {
+                return;
+            }
+            order.m_sortedIndices.push_back(aznumeric_cast<u32>(AZStd::distance(unsortedComponents.begin(), it)));
+        }
+
+        const size_t signature = CalculateSignature(unsortedComponents);
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        AZStd::vector<CachedOrder>& bucket = m_orders[signature];
+        auto existing = AZStd::find_if(
+            bucket.begin(), bucket.end(),
+            [&order](const CachedOrder& cachedOrder)
+            {
+                return cachedOrder.m_componentTypes == order.m_componentTypes;
+            });
+        if (existing == bucket.end())
+        {
+            bucket.push_back(AZStd::move(order));
+            ++m_orderCount;
+        }
+    }
+
+    void ComponentActivationOrderCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_orders.clear();
+        m_orderCount = 0;
+    }
+
+    size_t ComponentActivationOrderCache::GetCachedOrderCount() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_orderCount;
+    }
+
+    size_t ComponentActivationOrderCache::CalculateSignature(const Entity::ComponentArrayType& components)
+    {
+        size_t signature = components.size();
+        for (const Component* component : components)
+        {
+            AZStd::hash_combine(signature, component->RTTI_GetType());
+        }
+        return signature;
+    }
+} // namespace AZ
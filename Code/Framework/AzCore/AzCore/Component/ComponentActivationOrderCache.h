@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AZ
+{
+    /**
+     * Caches the order Entity::DependencySort puts components in, keyed by the types of the components in their
+     * unsorted order. Entities that are created from the same source, such as the clones of a spawnable, have identical
+     * component signatures and can reuse the order instead of sorting their components again on activation.
+     *
+     * Only signatures where every component type is unique and every descriptor reports instance independent services
+     * are cached, as for those the sort result only depends on the component types. Failed sorts are never cached so
+     * the detailed error is still reported for every entity.
+     */
+    class ComponentActivationOrderCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ComponentActivationOrderCache, SystemAllocator);
+
+        /**
+         * Puts the components in the cached order if an order has been stored for their signature.
+         * @param inOutComponents The unsorted components. Only modified if an order was found.
+         * @return True if a cached order was found and applied, otherwise false.
+         */
+        bool ApplyCachedOrder(Entity::ComponentArrayType& inOutComponents) const;
+
+        /**
+         * Stores the order that sorting the unsorted components resulted in, if the signature can be cached.
+         * @param unsortedComponents The components before they were sorted.
+         * @param sortedComponents The same components after a successful call to Entity::DependencySort.
+         */
+        void StoreOrder(const Entity::ComponentArrayType& unsortedComponents, const Entity::ComponentArrayType& sortedComponents);
+
+        //! Removes all cached orders. Called when component descriptors are registered or unregistered.
+        void Clear();
+
+        size_t GetCachedOrderCount() const;
+
+    private:
+        struct CachedOrder
+        {
+            AZStd::vector<TypeId> m_componentTypes;
+            AZStd::vector<u32> m_sortedIndices;
+        };
+
+        static size_t CalculateSignature(const Entity::ComponentArrayType& components);
+
+        //! Orders are bucketed by a hash of the component types. Collisions are resolved by comparing the full type lists.
+        AZStd::unordered_map<size_t, AZStd::vector<CachedOrder>> m_orders;
+        size_t m_orderCount{ 0 };
+        mutable AZStd::shared_mutex m_mutex;
+    };
+} // namespace AZ
@@ -15,6 +15,7 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/Component/ComponentUpdateScheduler.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Date/DateFormat.h>
 
@@ -444,6 +445,7 @@ namespace AZ
 
     ComponentApplication::ComponentApplication(int argC, char** argV, ComponentApplicationSettings componentAppSettings)
         : m_timeSystem(AZStd::make_unique<TimeSystem>())
+        , m_componentUpdateScheduler(AZStd::make_unique<ComponentUpdateScheduler>())
     {
         if (Interface<ComponentApplicationRequests>::Get() == nullptr)
         {
@@ -1024,6 +1026,7 @@ namespace AZ
 
         m_entities.clear();
         m_entities.rehash(0); // force free all memory
+        m_activationOrderCache.Clear();
 
         DestroyReflectionManager();
         ComponentApplicationLifecycle::SignalEvent(*m_settingsRegistry, "ReflectionManagerUnavailable", R"({})");
@@ -1219,6 +1222,9 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::RegisterComponentDescriptor(const ComponentDescriptor* descriptor)
     {
+        // A descriptor replacing an earlier one for the same type can change the services it provides.
+        m_activationOrderCache.Clear();
+
         if (ReflectionEnvironment::GetReflectionManager())
         {
             ReflectionEnvironment::GetReflectionManager()->Reflect(
@@ -1235,6 +1241,8 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::UnregisterComponentDescriptor(const ComponentDescriptor* descriptor)
     {
+        m_activationOrderCache.Clear();
+
         if (ReflectionEnvironment::GetReflectionManager())
         {
             ReflectionEnvironment::GetReflectionManager()->Unreflect(descriptor->GetUuid());
@@ -1370,6 +1378,11 @@ namespace AZ
         }
     }
 
+    ComponentActivationOrderCache* ComponentApplication::GetComponentActivationOrderCache()
+    {
+        return &m_activationOrderCache;
+    }
+
     //=========================================================================
     // GetSerializeContext
     //=========================================================================
@@ -1642,6 +1655,9 @@ namespace AZ
             const AZ::TimeUs deltaTimeUs = m_timeSystem->AdvanceTickDeltaTimes();
             const float deltaTimeSeconds = AZ::TimeUsToSeconds(deltaTimeUs);
             AZ::TickBus::Broadcast(&TickEvents::OnTick, deltaTimeSeconds, GetTimeAtCurrentTick());
+
+            AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ComponentUpdateScheduler");
+            m_componentUpdateScheduler->Update(deltaTimeSeconds, GetTimeAtCurrentTick());
         }
 
         m_timeSystem->ApplyTickRateLimiterIfNeeded();
@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/ComponentActivationOrderCache.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Memory/AllocationRecords.h>
@@ -38,6 +39,7 @@ namespace AZ
     class Module;
     class ModuleManager;
     class TimeSystem;
+    class ComponentUpdateScheduler;
 }
 namespace AZ::Metrics
 {
@@ -198,6 +200,7 @@ namespace AZ
         AZStd::string GetEntityName(const EntityId& id) override;
         bool SetEntityName(const EntityId& id, const AZStd::string_view name) override;
         void EnumerateEntities(const ComponentApplicationRequests::EntityCallback& callback) override;
+        ComponentActivationOrderCache* GetComponentActivationOrderCache() override;
         ComponentApplication* GetApplication() override { return this; }
         /// Returns the serialize context that has been registered with the app, if there is one.
         SerializeContext* GetSerializeContext() override;
@@ -377,12 +380,14 @@ namespace AZ
         bool                                        m_isStarted{ false };
         IAllocator*                                 m_osAllocator{ nullptr };
         EntitySetType                               m_entities;
+        ComponentActivationOrderCache               m_activationOrderCache;
 
         AZ::SettingsRegistryInterface::NotifyEventHandler m_projectPathChangedHandler;
         AZ::SettingsRegistryInterface::NotifyEventHandler m_projectNameChangedHandler;
         AZ::SettingsRegistryInterface::NotifyEventHandler m_commandLineUpdatedHandler;
 
         AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<AZ::ComponentUpdateScheduler> m_componentUpdateScheduler;
 
         // ConsoleFunctorHandle is responsible for unregistering the Settings Registry Console
         // from the m_console member when it goes out of scope
@@ -158,6 +158,10 @@ namespace AZ
         //! @param callback A reference to the callback that is invoked for each entity.
         virtual void EnumerateEntities(const EntityCallback& callback) = 0;
 
+        //! Returns the cache of component activation orders that entities use to skip sorting their components.
+        //! @return The cache, if the app has one.
+        virtual class ComponentActivationOrderCache* GetComponentActivationOrderCache() { return nullptr; }
+
         //! Returns the serialize context that was registered with the app.
         //! @return The serialize context, if there is one. SerializeContext is a class that contains reflection data
         //! for serialization and construction of objects.
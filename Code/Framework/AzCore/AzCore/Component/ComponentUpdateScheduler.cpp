@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentUpdateScheduler.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    AZ_CVAR(bool, cl_componentUpdateSchedulerParallel, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Run the batches of the component update scheduler in parallel on the task graph when it's active.");
+
+    ComponentUpdateScheduler::ComponentUpdateScheduler()
+    {
+        if (Interface<ComponentUpdateSchedulerInterface>::Get() == nullptr)
+        {
+            Interface<ComponentUpdateSchedulerInterface>::Register(this);
+        }
+    }
+
+    ComponentUpdateScheduler::~ComponentUpdateScheduler()
+    {
+        if (Interface<ComponentUpdateSchedulerInterface>::Get() == this)
+        {
+            Interface<ComponentUpdateSchedulerInterface>::Unregister(this);
+        }
+    }
+
+    bool ComponentUpdateScheduler::RegisterUpdateType(const TypeId& type, ComponentUpdateDescriptor descriptor, UpdateFunction function)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        AZ_Assert(function, "No update function provided for type %s.", type.ToString<AZStd::string>().c_str());
+
+        // Registering during an update is safe, the running update only uses the batches it collected when it started.
+        // A type that is unregistered during an update is only removed once the update completes, so it can't be registered
+        // again until then.
+        auto [it, inserted] = m_batches.emplace(type, nullptr);
+        if (!inserted)
+        {
+            AZ_Warning("ComponentUpdateScheduler", false, it->second->m_isUnregistered
+                    ? "Update type %s (%s) is being unregistered and can't be registered again until the current update completes."
+                    : "Update type %s (%s) is already registered.",
+                type.ToString<AZStd::string>().c_str(), descriptor.m_name);
+            return false;
+        }
+
+        it->second = AZStd::make_unique<UpdateBatch>();
+        UpdateBatch* batch = it->second.get();
+        batch->m_type = type;
+        batch->m_descriptor = AZStd::move(descriptor);
+        batch->m_function = AZStd::move(function);
+        batch->m_registrationIndex = m_nextRegistrationIndex++;
+
+        auto insertPosition = AZStd::upper_bound(m_sortedBatches.begin(), m_sortedBatches.end(), batch,
+            [](const UpdateBatch* lhs, const UpdateBatch* rhs)
+            {
+                return lhs->m_descriptor.m_order != rhs->m_descriptor.m_order
+                    ? lhs->m_descriptor.m_order < rhs->m_descriptor.m_order
+                    : lhs->m_registrationIndex < rhs->m_registrationIndex;
+            });
+        m_sortedBatches.insert(insertPosition, batch);
+        return true;
+    }
+
+    void ComponentUpdateScheduler::UnregisterUpdateType(const TypeId& type)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_isUpdating)
+        {
+            // The batch may be running, so it's only marked here. A batch that hasn't started yet is skipped, and the batch
+            // is removed once the update completes.
+            auto it = m_batches.find(type);
+            if (it != m_batches.end() && !it->second->m_isUnregistered)
+            {
+                it->second->m_isUnregistered = true;
+                m_pendingUnregistrations.push_back(type);
+            }
+        }
+        else
+        {
+            UnregisterUpdateTypeInternal(type);
+        }
+    }
+
+    void ComponentUpdateScheduler::UnregisterUpdateTypeInternal(const TypeId& type)
+    {
+        auto it = m_batches.find(type);
+        if (it == m_batches.end())
+        {
+            return;
+        }
+
+        auto sortedIt = AZStd::find(m_sortedBatches.begin(), m_sortedBatches.end(), it->second.get());
+        if (sortedIt != m_sortedBatches.end())
+        {
+            m_sortedBatches.erase(sortedIt);
+        }
+        m_batches.erase(it);
+    }
+
+    bool ComponentUpdateScheduler::IsUpdateTypeRegistered(const TypeId& type) const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        auto it = m_batches.find(type);
+        return it != m_batches.end() && !it->second->m_isUnregistered;
+    }
+
+    void ComponentUpdateScheduler::AddInstance(const TypeId& type, void* instance)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_isUpdating)
+        {
+            m_pendingInstanceChanges.push_back({ type, instance, true });
+        }
+        else
+        {
+            AddInstanceInternal(type, instance);
+        }
+    }
+
+    void ComponentUpdateScheduler::RemoveInstance(const TypeId& type, void* instance)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_isUpdating)
+        {
+            m_pendingInstanceChanges.push_back({ type, instance, false });
+        }
+        else
+        {
+            RemoveInstanceInternal(type, instance);
+        }
+    }
+
+    void ComponentUpdateScheduler::Update(float deltaTime, ScriptTimePoint time)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        AZStd::vector<UpdateBatch*> batches;
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            batches.reserve(m_sortedBatches.size());
+            for (UpdateBatch* batch : m_sortedBatches)
+            {
+                if (!batch->m_instances.empty())
+                {
+                    batches.push_back(batch);
+                }
+            }
+            if (batches.empty())
+            {
+                return;
+            }
+            m_isUpdating = true;
+        }
+
+        bool runInParallel = m_taskExecutor != nullptr;
+        if (!runInParallel && cl_componentUpdateSchedulerParallel)
+        {
+            auto taskGraphActiveInterface = Interface<TaskGraphActiveInterface>::Get();
+            runInParallel = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        }
+
+        if (runInParallel)
+        {
+            UpdateOnTaskGraph(batches, deltaTime, time);
+        }
+        else
+        {
+            UpdateSerially(batches, deltaTime, time);
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_isUpdating = false;
+        ApplyPendingInstanceChanges();
+        for (const TypeId& type : m_pendingUnregistrations)
+        {
+            UnregisterUpdateTypeInternal(type);
+        }
+        m_pendingUnregistrations.clear();
+    }
+
+    void ComponentUpdateScheduler::SetTaskExecutor(TaskExecutor* executor)
+    {
+        m_taskExecutor = executor;
+    }
+
+    bool ComponentUpdateScheduler::HasConflict(const UpdateBatch& earlier, const UpdateBatch& later)
+    {
+        auto intersects = [](const AZStd::vector<ComponentUpdateResource>& lhs, const AZStd::vector<ComponentUpdateResource>& rhs)
+        {
+            return AZStd::find_first_of(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()) != lhs.end();
+        };
+
+        const ComponentUpdateDescriptor& earlierDescriptor = earlier.m_descriptor;
+        const ComponentUpdateDescriptor& laterDescriptor = later.m_descriptor;
+        return intersects(earlierDescriptor.m_writes, laterDescriptor.m_reads) ||
+            intersects(earlierDescriptor.m_writes, laterDescriptor.m_writes) ||
+            intersects(earlierDescriptor.m_reads, laterDescriptor.m_writes);
+    }
+
+    void ComponentUpdateScheduler::UpdateSerially(const AZStd::vector<UpdateBatch*>& batches, float deltaTime, ScriptTimePoint time)
+    {
+        for (UpdateBatch* batch : batches)
+        {
+            PrepareBatch(*batch);
+            if (batch->m_instances.empty())
+            {
+                continue;
+            }
+
+            AZ_PROFILE_SCOPE(AzCore, "ComponentUpdateScheduler: %s", batch->m_descriptor.m_name);
+            batch->m_function(AZStd::span<void* const>(batch->m_instances.data(), batch->m_instances.size()), deltaTime, time);
+        }
+    }
+
+    void ComponentUpdateScheduler::UpdateOnTaskGraph(const AZStd::vector<UpdateBatch*>& batches, float deltaTime, ScriptTimePoint time)
+    {
+        static const TaskDescriptor updateBatchDescriptor{ "ComponentUpdateScheduler: Update batch", "Component Update" };
+        static const TaskDescriptor batchBoundaryDescriptor{ "ComponentUpdateScheduler: Batch boundary", "Component Update" };
+
+        TaskGraph taskGraph{ "ComponentUpdateScheduler" };
+
+        // The first and last task of every batch, used to order batches that access the same data.
+        AZStd::vector<TaskToken> firstTokens;
+        AZStd::vector<TaskToken> lastTokens;
+        firstTokens.reserve(batches.size());
+        lastTokens.reserve(batches.size());
+
+        for (UpdateBatch* batch : batches)
+        {
+            const size_t instanceCount = batch->m_instances.size();
+            const size_t instancesPerTask = batch->m_descriptor.m_instancesPerTask > 0
+                ? batch->m_descriptor.m_instancesPerTask
+                : instanceCount;
+
+            // The chunks read the instance count when they run, as instances can be removed from the batch by PrepareBatch
+            // after the graph is built. Instances are only added once the update completes, so the batch never grows.
+            auto updateChunk = [batch, instancesPerTask, deltaTime, time](size_t begin)
+            {
+                const size_t currentCount = batch->m_instances.size();
+                if (begin >= currentCount)
+                {
+                    return;
+                }
+
+                AZ_PROFILE_SCOPE(AzCore, "ComponentUpdateScheduler: %s", batch->m_descriptor.m_name);
+                const size_t count = AZStd::min(instancesPerTask, currentCount - begin);
+                batch->m_function(AZStd::span<void* const>(batch->m_instances.data() + begin, count), deltaTime, time);
+            };
+
+            if (instanceCount <= instancesPerTask)
+            {
+                TaskToken token = taskGraph.AddTask(
+                    updateBatchDescriptor,
+                    [this, batch, updateChunk]()
+                    {
+                        PrepareBatch(*batch);
+                        updateChunk(0);
+                    });
+                firstTokens.push_back(token);
+                lastTokens.push_back(token);
+                continue;
+            }
+
+            // Split the batch over multiple tasks and surround them with tasks that don't update anything so the batch can
+            // be ordered as a whole.
+            TaskToken beginToken = taskGraph.AddTask(
+                batchBoundaryDescriptor,
+                [this, batch]()
+                {
+                    PrepareBatch(*batch);
+                });
+            TaskToken endToken = taskGraph.AddTask(batchBoundaryDescriptor, []() {});
+            for (size_t begin = 0; begin < instanceCount; begin += instancesPerTask)
+            {
+                TaskToken chunkToken = taskGraph.AddTask(
+                    updateBatchDescriptor,
+                    [updateChunk, begin]()
+                    {
+                        updateChunk(begin);
+                    });
+                chunkToken.Follows(beginToken);
+                chunkToken.Precedes(endToken);
+            }
+            firstTokens.push_back(beginToken);
+            lastTokens.push_back(endToken);
+        }
+
+        for (size_t later = 1; later < batches.size(); ++later)
+        {
+            for (size_t earlier = 0; earlier < later; ++earlier)
+            {
+                if (HasConflict(*batches[earlier], *batches[later]))
+                {
+                    firstTokens[later].Follows(lastTokens[earlier]);
+                }
+            }
+        }
+
+        TaskGraphEvent finishedEvent{ "ComponentUpdateScheduler Wait" };
+        if (m_taskExecutor)
+        {
+            taskGraph.SubmitOnExecutor(*m_taskExecutor, &finishedEvent);
+        }
+        else
+        {
+            taskGraph.Submit(&finishedEvent);
+        }
+        finishedEvent.Wait();
+    }
+
+    void ComponentUpdateScheduler::PrepareBatch(UpdateBatch& batch)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (batch.m_isUnregistered)
+        {
+            batch.m_instances.clear();
+            batch.m_instanceIndices.clear();
+            return;
+        }
+
+        // Instances removed by batches that already ran may be destroyed by now, so they're removed before this batch runs
+        // rather than once the update completes. Additions are still applied once the update completes, so an addition that
+        // is followed by a removal of the same instance is dropped along with the removal.
+        auto keptEnd = m_pendingInstanceChanges.begin();
+        for (auto it = m_pendingInstanceChanges.begin(); it != m_pendingInstanceChanges.end(); ++it)
+        {
+            if (it->m_type != batch.m_type)
+            {
+                *keptEnd++ = *it;
+            }
+            else if (it->m_isAdd)
+            {
+                *keptEnd++ = *it;
+            }
+            else
+            {
+                RemoveInstanceInternal(batch.m_type, it->m_instance);
+                keptEnd = AZStd::remove_if(m_pendingInstanceChanges.begin(), keptEnd,
+                    [&batch, instance = it->m_instance](const PendingInstanceChange& change)
+                    {
+                        return change.m_type == batch.m_type && change.m_instance == instance;
+                    });
+            }
+        }
+        m_pendingInstanceChanges.erase(keptEnd, m_pendingInstanceChanges.end());
+    }
+
+    void ComponentUpdateScheduler::ApplyPendingInstanceChanges()
+    {
+        for (const PendingInstanceChange& change : m_pendingInstanceChanges)
+        {
+            if (change.m_isAdd)
+            {
+                AddInstanceInternal(change.m_type, change.m_instance);
+            }
+            else
+            {
+                RemoveInstanceInternal(change.m_type, change.m_instance);
+            }
+        }
+        m_pendingInstanceChanges.clear();
+    }
+
+    void ComponentUpdateScheduler::AddInstanceInternal(const TypeId& type, void* instance)
+    {
+        auto it = m_batches.find(type);
+        if (it == m_batches.end())
+        {
+            AZ_Error("ComponentUpdateScheduler", false, "Instance added for update type %s that isn't registered.",
+                type.ToString<AZStd::string>().c_str());
+            return;
+        }
+
+        UpdateBatch& batch = *it->second;
+        if (batch.m_instanceIndices.emplace(instance, batch.m_instances.size()).second)
+        {
+            batch.m_instances.push_back(instance);
+        }
+    }
+
+    void ComponentUpdateScheduler::RemoveInstanceInternal(const TypeId& type, void* instance)
+    {
+        auto it = m_batches.find(type);
+        if (it == m_batches.end())
+        {
+            return;
+        }
+
+        UpdateBatch& batch = *it->second;
+        auto indexIt = batch.m_instanceIndices.find(instance);
+        if (indexIt == batch.m_instanceIndices.end())
+        {
+            return;
+        }
+
+        // Swap with the last instance so the instances stay contiguous. This changes the update order of the moved instance.
+        const size_t index = indexIt->second;
+        batch.m_instanceIndices.erase(indexIt);
+        void* lastInstance = batch.m_instances.back();
+        batch.m_instances.pop_back();
+        if (index < batch.m_instances.size())
+        {
+            batch.m_instances[index] = lastInstance;
+            batch.m_instanceIndices[lastInstance] = index;
+        }
+    }
+} // namespace AZ
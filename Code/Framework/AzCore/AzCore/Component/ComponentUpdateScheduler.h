@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+
+    //! Identifies data that component update functions read or write, for instance AZ_CRC_CE("Transforms").
+    using ComponentUpdateResource = Crc32;
+
+    //! Describes how all instances of a component type are updated by the ComponentUpdateScheduler.
+    struct ComponentUpdateDescriptor
+    {
+        //! Label used for profiling and task tracking. Expected to be a string literal.
+        const char* m_name = "ComponentUpdate";
+        //! Data the update reads. Batches that only read the same data can run at the same time.
+        AZStd::vector<ComponentUpdateResource> m_reads;
+        //! Data the update writes. A batch never runs at the same time as another batch that reads or writes the same data.
+        AZStd::vector<ComponentUpdateResource> m_writes;
+        //! Order of batches that access the same data, lower runs first. Uses the same values as TickBus::GetTickOrder.
+        int m_order = TICK_DEFAULT;
+        //! If not zero, the instances are split in chunks of this size that are updated in parallel. Only use this
+        //! when updating an instance doesn't touch any other instance of the same type.
+        AZ::u32 m_instancesPerTask = 0;
+    };
+
+    //! Opt-in alternative to the TickBus for components that need per-frame work. Instead of every component
+    //! connecting to the TickBus, a component type registers a single update function that receives all active
+    //! instances of that type in one contiguous batch. Batches that don't access the same data, according to their
+    //! declared reads and writes, are run in parallel on the task graph.
+    //!
+    //! Batches are updated once per ComponentApplication::Tick, after the TickBus has been dispatched. Update functions
+    //! may run on task threads, so they shouldn't activate or deactivate entities or send events that aren't thread safe.
+    //! Queue that work with TickBus::QueueFunction instead.
+    class ComponentUpdateSchedulerInterface
+    {
+    public:
+        AZ_RTTI(ComponentUpdateSchedulerInterface, "{6F1B7C55-2E0A-4C4B-9E31-8D4B1F0A5C27}");
+
+        using UpdateFunction = AZStd::function<void(AZStd::span<void* const> instances, float deltaTime, ScriptTimePoint time)>;
+
+        virtual ~ComponentUpdateSchedulerInterface() = default;
+
+        //! Registers the function that updates all instances of the given type. Returns false if the type is already registered.
+        virtual bool RegisterUpdateType(const TypeId& type, ComponentUpdateDescriptor descriptor, UpdateFunction function) = 0;
+        //! Removes the update function and all instances of the given type. When called during an update, the batch of
+        //! the type is skipped if it hasn't run yet and is removed once the update completes.
+        virtual void UnregisterUpdateType(const TypeId& type) = 0;
+        virtual bool IsUpdateTypeRegistered(const TypeId& type) const = 0;
+
+        //! Adds an instance to the batch of its type, typically called from Component::Activate.
+        virtual void AddInstance(const TypeId& type, void* instance) = 0;
+        //! Removes an instance from the batch of its type, typically called from Component::Deactivate. When called during
+        //! an update, the instance isn't passed to its update function anymore unless its batch already started.
+        virtual void RemoveInstance(const TypeId& type, void* instance) = 0;
+
+        //! Typed versions of the functions above. The update function is called with an
+        //! AZStd::span<ComponentType* const> holding the instances, the delta time in seconds and the time of the tick.
+        template<class ComponentType, class Function>
+        bool RegisterUpdateType(ComponentUpdateDescriptor descriptor, Function&& function);
+        template<class ComponentType>
+        void UnregisterUpdateType();
+        template<class ComponentType>
+        void AddInstance(ComponentType* instance);
+        template<class ComponentType>
+        void RemoveInstance(ComponentType* instance);
+    };
+
+    //! Default implementation of the ComponentUpdateSchedulerInterface, owned by the ComponentApplication.
+    class ComponentUpdateScheduler
+        : public ComponentUpdateSchedulerInterface
+    {
+    public:
+        AZ_RTTI(ComponentUpdateScheduler, "{0C8E6B1D-5F47-4E0B-A7B2-3B9D6E2F4A81}", ComponentUpdateSchedulerInterface);
+        AZ_CLASS_ALLOCATOR(ComponentUpdateScheduler, SystemAllocator);
+
+        ComponentUpdateScheduler();
+        ~ComponentUpdateScheduler() override;
+
+        //! ComponentUpdateSchedulerInterface overrides.
+        //! @{
+        bool RegisterUpdateType(const TypeId& type, ComponentUpdateDescriptor descriptor, UpdateFunction function) override;
+        void UnregisterUpdateType(const TypeId& type) override;
+        bool IsUpdateTypeRegistered(const TypeId& type) const override;
+        void AddInstance(const TypeId& type, void* instance) override;
+        void RemoveInstance(const TypeId& type, void* instance) override;
+        //! @}
+
+        using ComponentUpdateSchedulerInterface::RegisterUpdateType;
+        using ComponentUpdateSchedulerInterface::UnregisterUpdateType;
+        using ComponentUpdateSchedulerInterface::AddInstance;
+        using ComponentUpdateSchedulerInterface::RemoveInstance;
+
+        //! Runs the update functions of all registered types that have instances.
+        //! This is called from the owner of the scheduler, ComponentApplication in Tick().
+        void Update(float deltaTime, ScriptTimePoint time);
+
+        //! Overrides the executor the batches are run on. By default the batches run on the task graph's default
+        //! executor if the task graph is active, and serially otherwise.
+        void SetTaskExecutor(TaskExecutor* executor);
+
+    private:
+        struct UpdateBatch
+        {
+            TypeId m_type;
+            ComponentUpdateDescriptor m_descriptor;
+            UpdateFunction m_function;
+            AZStd::vector<void*> m_instances;
+            //! Position of each instance in m_instances so instances can be removed without a search.
+            AZStd::unordered_map<void*, size_t> m_instanceIndices;
+            size_t m_registrationIndex = 0;
+            //! Set when the type is unregistered during an update, the batch is removed once the update completes.
+            bool m_isUnregistered = false;
+        };
+
+        struct PendingInstanceChange
+        {
+            TypeId m_type;
+            void* m_instance = nullptr;
+            bool m_isAdd = false;
+        };
+
+        static bool HasConflict(const UpdateBatch& earlier, const UpdateBatch& later);
+        void UpdateSerially(const AZStd::vector<UpdateBatch*>& batches, float deltaTime, ScriptTimePoint time);
+        void UpdateOnTaskGraph(const AZStd::vector<UpdateBatch*>& batches, float deltaTime, ScriptTimePoint time);
+        //! Applies changes made during the update that have to be applied before the batch runs. Called right before a batch
+        //! is updated, while no other task accesses its instances.
+        void PrepareBatch(UpdateBatch& batch);
+        void ApplyPendingInstanceChanges();
+        void UnregisterUpdateTypeInternal(const TypeId& type);
+        void AddInstanceInternal(const TypeId& type, void* instance);
+        void RemoveInstanceInternal(const TypeId& type, void* instance);
+
+        AZStd::unordered_map<TypeId, AZStd::unique_ptr<UpdateBatch>> m_batches;
+        //! All batches in the order they run in when executed serially, sorted by their order and then by registration.
+        AZStd::vector<UpdateBatch*> m_sortedBatches;
+        size_t m_nextRegistrationIndex = 0;
+
+        //! Instances added while the batches are being updated are added once the update completes. Removed instances are
+        //! removed before their batch runs if it hasn't run yet, and otherwise once the update completes.
+        AZStd::vector<PendingInstanceChange> m_pendingInstanceChanges;
+        //! Types unregistered while the batches are being updated, removed once the update completes.
+        AZStd::vector<TypeId> m_pendingUnregistrations;
+        mutable AZStd::mutex m_mutex;
+        bool m_isUpdating = false;
+
+        TaskExecutor* m_taskExecutor = nullptr;
+    };
+
+    template<class ComponentType, class Function>
+    bool ComponentUpdateSchedulerInterface::RegisterUpdateType(ComponentUpdateDescriptor descriptor, Function&& function)
+    {
+        return RegisterUpdateType(
+            azrtti_typeid<ComponentType>(),
+            AZStd::move(descriptor),
+            [function = AZStd::forward<Function>(function)](AZStd::span<void* const> instances, float deltaTime, ScriptTimePoint time)
+            {
+                // Instances are stored as the void* of a ComponentType*, see AddInstance.
+                AZStd::span<ComponentType* const> typedInstances(
+                    reinterpret_cast<ComponentType* const*>(instances.data()), instances.size());
+                function(typedInstances, deltaTime, time);
+            });
+    }
+
+    template<class ComponentType>
+    void ComponentUpdateSchedulerInterface::UnregisterUpdateType()
+    {
+        UnregisterUpdateType(azrtti_typeid<ComponentType>());
+    }
+
+    template<class ComponentType>
+    void ComponentUpdateSchedulerInterface::AddInstance(ComponentType* instance)
+    {
+        AddInstance(azrtti_typeid<ComponentType>(), static_cast<void*>(instance));
+    }
+
+    template<class ComponentType>
+    void ComponentUpdateSchedulerInterface::RemoveInstance(ComponentType* instance)
+    {
+        RemoveInstance(azrtti_typeid<ComponentType>(), static_cast<void*>(instance));
+    }
+} // namespace AZ
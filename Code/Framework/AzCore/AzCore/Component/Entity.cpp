@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/ComponentActivationOrderCache.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/EntityIdSerializer.h>
 #include <AzCore/Component/EntitySerializer.h>
@@ -260,8 +261,33 @@ namespace AZ
 
         if (!m_isDependencyReady)
         {
+            // Entities with the same component types, such as clones from a spawnable, sort to the same order, so reuse
+            // the order from an earlier entity when there is one.
+            ComponentActivationOrderCache* orderCache = nullptr;
+            if (auto* componentApplication = AZ::Interface<ComponentApplicationRequests>::Get(); componentApplication != nullptr)
+            {
+                orderCache = componentApplication->GetComponentActivationOrderCache();
+            }
+
+            if (orderCache && orderCache->ApplyCachedOrder(m_components))
+            {
+                m_isDependencyReady = true;
+                return outcome;
+            }
+
+            ComponentArrayType unsortedComponents;
+            if (orderCache)
+            {
+                unsortedComponents = m_components;
+            }
+
             outcome = DependencySort(m_components);
             m_isDependencyReady = outcome.IsSuccess();
+
+            if (orderCache && m_isDependencyReady)
+            {
+                orderCache->StoreOrder(unsortedComponents, m_components);
+            }
         }
 
         return outcome;
@@ -17,6 +17,8 @@ set(FILES
     Asset/AssetDataStream.h
     Asset/AssetJsonSerializer.cpp
     Asset/AssetJsonSerializer.h
+    Asset/AssetLoadTimeline.cpp
+    Asset/AssetLoadTimeline.h
     Asset/AssetManager.cpp
     Asset/AssetManager.h
     Asset/AssetManager_private.h
@@ -34,6 +36,8 @@ set(FILES
     Casting/numeric_cast_internal.h
     Component/Component.cpp
     Component/Component.h
+    Component/ComponentActivationOrderCache.cpp
+    Component/ComponentActivationOrderCache.h
     Component/ComponentApplication.cpp
     Component/ComponentApplication.h
     Component/ComponentApplicationBus.h
@@ -42,6 +46,8 @@ set(FILES
     Component/ComponentBus.cpp
     Component/ComponentBus.h
     Component/ComponentExport.h
+    Component/ComponentUpdateScheduler.cpp
+    Component/ComponentUpdateScheduler.h
     Component/Entity.cpp
     Component/Entity.h
     Component/EntityBus.h
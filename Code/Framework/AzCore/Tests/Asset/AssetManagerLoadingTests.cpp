@@ -1044,7 +1044,60 @@ namespace UnitTest
         m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
     }
 
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_LoadTimeline_RecordingEnabled_RecordsAllStagesInOrder)
+#else
+    TEST_F(AssetJobsFloodTest, LoadTimeline_RecordingEnabled_RecordsAllStagesInOrder)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusConnect();
+        // Setup has already created/destroyed assets
+        m_assetHandlerAndCatalog->m_numCreations = 0;
+        m_assetHandlerAndCatalog->m_numDestructions = 0;
+
+        AssetLoadTimelineRecorder& recorder = m_testAssetManager->GetLoadTimelineRecorder();
+        recorder.SetEnabled(true);
+        {
+            OnAssetReadyListener preloadBListener(PreloadAssetBId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>());
+            auto asset = m_testAssetManager->GetAsset(PreloadAssetBId, azrtti_typeid<AssetWithQueueAndPreLoadReferences>(),
+                AZ::Data::AssetLoadBehavior::Default);
+
+            auto maxTimeout = AZStd::chrono::steady_clock::now() + DefaultTimeoutSeconds;
+
+            while (!preloadBListener.m_ready)
+            {
+                m_testAssetManager->DispatchEvents();
+                if (AZStd::chrono::steady_clock::now() > maxTimeout)
+                {
+                    break;
+                }
+                AZStd::this_thread::yield();
+            }
+            EXPECT_EQ(preloadBListener.m_ready, 1);
 
+            AZStd::vector<AssetLoadTimeline> timelines = recorder.GetCompletedTimelines();
+            ASSERT_EQ(timelines.size(), 1);
+            const AssetLoadTimeline& timeline = timelines[0];
+            EXPECT_EQ(timeline.m_assetId, PreloadAssetBId);
+            EXPECT_TRUE(timeline.m_succeeded);
+            EXPECT_FALSE(timeline.m_isReload);
+
+            for (u32 stage = 0; stage < static_cast<u32>(AssetLoadStage::Count); ++stage)
+            {
+                EXPECT_TRUE(timeline.HasStage(static_cast<AssetLoadStage>(stage)));
+                if (stage > 0)
+                {
+                    EXPECT_LE(timeline.m_stageTimes[stage - 1], timeline.m_stageTimes[stage]);
+                }
+            }
+            EXPECT_GE(timeline.GetTotalDuration(), timeline.GetDuration(AssetLoadStage::LoadStarted, AssetLoadStage::DataLoaded));
+        }
+        recorder.SetEnabled(false);
+        recorder.ClearCompletedTimelines();
+
+        CheckFinishedCreationsAndDestructions();
+        m_assetHandlerAndCatalog->AssetCatalogRequestBus::Handler::BusDisconnect();
+    }
 
     TEST_F(AssetJobsFloodTest, ContainerCoreTest_BasicDependencyManagement_Success)
     {
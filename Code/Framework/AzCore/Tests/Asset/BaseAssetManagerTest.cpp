@@ -50,9 +50,23 @@ namespace UnitTest
         return m_ownedAssetContainers;
     }
 
-    const AssetManager::AssetMap& TestAssetManager::GetAssets() const
+    size_t TestAssetManager::GetAssetCount()
     {
-        return m_assets;
+        size_t assetCount = 0;
+        for (AssetMapStripe& stripe : m_assetMapStripes)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> stripeLock(stripe.m_mutex);
+            assetCount += stripe.m_assets.size();
+        }
+        return assetCount;
+    }
+
+    bool TestAssetManager::IsAssetInMap(const AssetId& assetId)
+    {
+        // Look the asset up without referencing it, as that could release it again.
+        AssetMapStripe& stripe = GetAssetMapStripe(assetId);
+        AZStd::shared_lock<AZStd::shared_mutex> stripeLock(stripe.m_mutex);
+        return stripe.m_assets.find(assetId) != stripe.m_assets.end();
     }
 
     void BaseAssetManagerTest::SetUp()
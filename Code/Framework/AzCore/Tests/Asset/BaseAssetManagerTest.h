@@ -37,7 +37,10 @@ namespace UnitTest
 
         const AZ::Data::AssetManager::OwnedAssetContainerMap& GetAssetContainers() const;
 
-        const AssetMap& GetAssets() const;
+        // Number of assets in the asset map
+        size_t GetAssetCount();
+
+        bool IsAssetInMap(const AssetId& assetId);
 
         // Expose these methods so that they can be queried by the unit tests.
         using AssetManager::GetAssetInternal;
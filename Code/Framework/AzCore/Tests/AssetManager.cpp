@@ -806,21 +806,19 @@ namespace UnitTest
 
         AssetManager::Instance().DispatchEvents();
 
-        auto&& assets = m_testAssetManager->GetAssets();
-
-        EXPECT_EQ(assets.size(), 1);
-        EXPECT_NE(assets.find(MyAsset1Id), assets.end());
+        EXPECT_EQ(m_testAssetManager->GetAssetCount(), 1);
+        EXPECT_TRUE(m_testAssetManager->IsAssetInMap(MyAsset1Id));
 
         AssetManager::Instance().ResumeAssetRelease();
         
         // Sleep to allow for the assets to release
         int retryCount = 100;
-        while ((--retryCount>0) && assets.size() > 0)
+        while ((--retryCount>0) && m_testAssetManager->GetAssetCount() > 0)
         {
             AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(10));
         }
 
-        EXPECT_EQ(assets.size(), 0);
+        EXPECT_EQ(m_testAssetManager->GetAssetCount(), 0);
     }
 
     TEST_F(AssetManagerTest, AssetManager_SuspendResumeAssetRelease_ReusedAssetIsNotReleased)
@@ -836,11 +834,115 @@ namespace UnitTest
 
         asset = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset1Id, AssetLoadBehavior::Default);
 
-        auto&& assets = m_testAssetManager->GetAssets();
-
         AssetManager::Instance().ResumeAssetRelease();
 
-        EXPECT_EQ(assets.size(), 1);
-        EXPECT_NE(assets.find(MyAsset1Id), assets.end());
+        EXPECT_EQ(m_testAssetManager->GetAssetCount(), 1);
+        EXPECT_TRUE(m_testAssetManager->IsAssetInMap(MyAsset1Id));
+    }
+
+    TEST_F(AssetManagerTest, GetAsset_AssetAlreadyLoaded_CatalogNotQueried)
+    {
+        auto asset = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset1Id, AssetLoadBehavior::Default);
+        asset.BlockUntilLoadComplete();
+        ASSERT_TRUE(asset.IsReady());
+
+        const int assetInfoRequests = m_assetHandlerAndCatalog->m_numAssetInfoRequests;
+
+        auto requestedAsset = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset1Id, AssetLoadBehavior::Default);
+        auto foundAsset = AssetManager::Instance().FindAsset<AssetWithCustomData>(MyAsset1Id, AssetLoadBehavior::Default);
+
+        EXPECT_EQ(requestedAsset.Get(), asset.Get());
+        EXPECT_EQ(foundAsset.Get(), asset.Get());
+        EXPECT_EQ(m_assetHandlerAndCatalog->m_numAssetInfoRequests, assetInfoRequests);
     }
 }
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace UnitTest;
+
+    // Measures how well lookups of loaded assets scale when many threads request the same few assets.
+    class AssetManagerHotAssetBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t HotAssetCount = 16;
+
+        void CreateHotAssets()
+        {
+            m_serializeContext = aznew SerializeContext();
+            AssetWithCustomData::Reflect(*m_serializeContext);
+
+            m_testAssetManager = aznew TestAssetManager(AssetManager::Descriptor());
+            AssetManager::SetInstance(m_testAssetManager);
+
+            m_assetHandlerAndCatalog = aznew DataDrivenHandlerAndCatalog;
+            m_assetHandlerAndCatalog->m_context = m_serializeContext;
+            AssetManager::Instance().RegisterHandler(m_assetHandlerAndCatalog, azrtti_typeid<AssetWithCustomData>());
+
+            for (size_t i = 0; i < HotAssetCount; ++i)
+            {
+                Asset<AssetWithCustomData> asset(
+                    aznew AssetWithCustomData(AssetId(Uuid::CreateRandom(), 0), AssetData::AssetStatus::Ready), AssetLoadBehavior::Default);
+                AssetManager::Instance().AssignAssetData(asset);
+
+                m_hotAssetInfos[i].m_assetId = asset.GetId();
+                m_hotAssetInfos[i].m_assetType = asset.GetType();
+                m_hotAssets[i] = AZStd::move(asset);
+            }
+        }
+
+        void DestroyHotAssets()
+        {
+            for (Asset<AssetWithCustomData>& asset : m_hotAssets)
+            {
+                asset.Reset();
+            }
+            AssetManager::Instance().DispatchEvents();
+
+            AssetManager::Instance().UnregisterHandler(m_assetHandlerAndCatalog);
+            delete m_assetHandlerAndCatalog;
+            m_assetHandlerAndCatalog = nullptr;
+
+            AssetManager::Destroy();
+            m_testAssetManager = nullptr;
+
+            delete m_serializeContext;
+            m_serializeContext = nullptr;
+        }
+
+    protected:
+        SerializeContext* m_serializeContext{ nullptr };
+        TestAssetManager* m_testAssetManager{ nullptr };
+        DataDrivenHandlerAndCatalog* m_assetHandlerAndCatalog{ nullptr };
+        AZStd::array<Asset<AssetWithCustomData>, HotAssetCount> m_hotAssets;
+        AZStd::array<AssetInfo, HotAssetCount> m_hotAssetInfos;
+    };
+
+    BENCHMARK_DEFINE_F(AssetManagerHotAssetBenchmarkFixture, GetAsset_LoadedAssets)(::benchmark::State& state)
+    {
+        if (state.thread_index() == 0)
+        {
+            CreateHotAssets();
+        }
+
+        size_t assetIndex = state.thread_index();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            const AssetInfo& assetInfo = m_hotAssetInfos[assetIndex++ % HotAssetCount];
+            Asset<AssetData> asset = AssetManager::Instance().GetAsset(assetInfo.m_assetId, assetInfo.m_assetType, AssetLoadBehavior::Default);
+            benchmark::DoNotOptimize(asset.Get());
+        }
+        state.SetItemsProcessed(state.iterations());
+
+        if (state.thread_index() == 0)
+        {
+            DestroyHotAssets();
+        }
+    }
+    BENCHMARK_REGISTER_F(AssetManagerHotAssetBenchmarkFixture, GetAsset_LoadedAssets)->ThreadRange(1, 32)->UseRealTime();
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
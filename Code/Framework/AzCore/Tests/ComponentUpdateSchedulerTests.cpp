@@ -0,0 +1,491 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ComponentUpdateScheduler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    struct UpdatePosition
+    {
+        AZ_TYPE_INFO(UpdatePosition, "{4E2A9C1B-7D35-4F8E-B6A0-1C3D5E7F9A2B}");
+
+        float m_position = 0.0f;
+    };
+
+    struct UpdateFollower
+    {
+        AZ_TYPE_INFO(UpdateFollower, "{A83D5F20-6B1C-4E97-8D4A-2F6E0B9C7D13}");
+
+        const UpdatePosition* m_target = nullptr;
+        float m_position = 0.0f;
+    };
+
+    static constexpr AZ::ComponentUpdateResource PositionsResource = AZ_CRC_CE("Positions");
+
+    class ComponentUpdateSchedulerTest : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_scheduler = AZStd::make_unique<AZ::ComponentUpdateScheduler>();
+        }
+
+        void TearDown() override
+        {
+            m_scheduler.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::ComponentUpdateScheduler> m_scheduler;
+    };
+
+    TEST_F(ComponentUpdateSchedulerTest, Construct_RegistersInterface)
+    {
+        EXPECT_EQ(AZ::Interface<AZ::ComponentUpdateSchedulerInterface>::Get(), m_scheduler.get());
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, RegisterUpdateType_SameTypeTwice_ReturnsFalse)
+    {
+        auto update = [](AZStd::span<UpdatePosition* const>, float, AZ::ScriptTimePoint) {};
+        EXPECT_TRUE(m_scheduler->RegisterUpdateType<UpdatePosition>({}, update));
+        EXPECT_TRUE(m_scheduler->IsUpdateTypeRegistered(azrtti_typeid<UpdatePosition>()));
+        EXPECT_FALSE(m_scheduler->RegisterUpdateType<UpdatePosition>({}, update));
+
+        m_scheduler->UnregisterUpdateType<UpdatePosition>();
+        EXPECT_FALSE(m_scheduler->IsUpdateTypeRegistered(azrtti_typeid<UpdatePosition>()));
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, Update_MultipleInstances_UpdatesAllInstancesInOneCall)
+    {
+        int callCount = 0;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            {},
+            [&callCount](AZStd::span<UpdatePosition* const> instances, float deltaTime, AZ::ScriptTimePoint)
+            {
+                ++callCount;
+                for (UpdatePosition* instance : instances)
+                {
+                    instance->m_position += deltaTime;
+                }
+            });
+
+        UpdatePosition instances[3];
+        for (UpdatePosition& instance : instances)
+        {
+            m_scheduler->AddInstance(&instance);
+        }
+
+        m_scheduler->Update(0.5f, {});
+
+        EXPECT_EQ(1, callCount);
+        for (const UpdatePosition& instance : instances)
+        {
+            EXPECT_FLOAT_EQ(0.5f, instance.m_position);
+        }
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, Update_NoInstances_UpdateFunctionNotCalled)
+    {
+        bool called = false;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            {},
+            [&called](AZStd::span<UpdatePosition* const>, float, AZ::ScriptTimePoint)
+            {
+                called = true;
+            });
+
+        m_scheduler->Update(0.5f, {});
+
+        EXPECT_FALSE(called);
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, Update_DifferentOrders_LowerOrderRunsFirst)
+    {
+        AZStd::vector<int> updateOrder;
+
+        AZ::ComponentUpdateDescriptor followerDescriptor;
+        followerDescriptor.m_order = AZ::ComponentTickBus::TICK_DEFAULT;
+        m_scheduler->RegisterUpdateType<UpdateFollower>(
+            followerDescriptor,
+            [&updateOrder](AZStd::span<UpdateFollower* const>, float, AZ::ScriptTimePoint)
+            {
+                updateOrder.push_back(1);
+            });
+
+        AZ::ComponentUpdateDescriptor positionDescriptor;
+        positionDescriptor.m_order = AZ::ComponentTickBus::TICK_PHYSICS;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            positionDescriptor,
+            [&updateOrder](AZStd::span<UpdatePosition* const>, float, AZ::ScriptTimePoint)
+            {
+                updateOrder.push_back(0);
+            });
+
+        UpdatePosition position;
+        UpdateFollower follower;
+        m_scheduler->AddInstance(&follower);
+        m_scheduler->AddInstance(&position);
+
+        m_scheduler->Update(0.0f, {});
+
+        ASSERT_EQ(2, updateOrder.size());
+        EXPECT_EQ(0, updateOrder[0]);
+        EXPECT_EQ(1, updateOrder[1]);
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, RemoveInstance_InstanceRemoved_NoLongerUpdated)
+    {
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            {},
+            [](AZStd::span<UpdatePosition* const> instances, float deltaTime, AZ::ScriptTimePoint)
+            {
+                for (UpdatePosition* instance : instances)
+                {
+                    instance->m_position += deltaTime;
+                }
+            });
+
+        UpdatePosition instances[3];
+        for (UpdatePosition& instance : instances)
+        {
+            m_scheduler->AddInstance(&instance);
+        }
+        m_scheduler->RemoveInstance(&instances[0]);
+
+        m_scheduler->Update(1.0f, {});
+
+        EXPECT_FLOAT_EQ(0.0f, instances[0].m_position);
+        EXPECT_FLOAT_EQ(1.0f, instances[1].m_position);
+        EXPECT_FLOAT_EQ(1.0f, instances[2].m_position);
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, AddAndRemoveInstance_DuringUpdate_AppliedAfterUpdate)
+    {
+        UpdatePosition instances[2];
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            {},
+            [this, &instances](AZStd::span<UpdatePosition* const> updatedInstances, float deltaTime, AZ::ScriptTimePoint)
+            {
+                for (UpdatePosition* instance : updatedInstances)
+                {
+                    instance->m_position += deltaTime;
+                }
+                m_scheduler->RemoveInstance(&instances[0]);
+                m_scheduler->AddInstance(&instances[1]);
+            });
+
+        m_scheduler->AddInstance(&instances[0]);
+
+        m_scheduler->Update(1.0f, {});
+        EXPECT_FLOAT_EQ(1.0f, instances[0].m_position);
+        EXPECT_FLOAT_EQ(0.0f, instances[1].m_position);
+
+        m_scheduler->Update(1.0f, {});
+        EXPECT_FLOAT_EQ(1.0f, instances[0].m_position);
+        EXPECT_FLOAT_EQ(1.0f, instances[1].m_position);
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, RemoveInstance_OtherTypeDuringUpdate_RemovedBeforeItsBatchRuns)
+    {
+        UpdateFollower followers[3];
+
+        AZ::ComponentUpdateDescriptor positionDescriptor;
+        positionDescriptor.m_order = AZ::ComponentTickBus::TICK_PHYSICS;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            positionDescriptor,
+            [this, &followers](AZStd::span<UpdatePosition* const>, float, AZ::ScriptTimePoint)
+            {
+                m_scheduler->RemoveInstance(&followers[1]);
+            });
+
+        AZStd::vector<UpdateFollower*> updatedFollowers;
+        m_scheduler->RegisterUpdateType<UpdateFollower>(
+            {},
+            [&updatedFollowers](AZStd::span<UpdateFollower* const> instances, float, AZ::ScriptTimePoint)
+            {
+                updatedFollowers.insert(updatedFollowers.end(), instances.begin(), instances.end());
+            });
+
+        UpdatePosition position;
+        m_scheduler->AddInstance(&position);
+        for (UpdateFollower& follower : followers)
+        {
+            m_scheduler->AddInstance(&follower);
+        }
+
+        m_scheduler->Update(1.0f, {});
+
+        ASSERT_EQ(2, updatedFollowers.size());
+        EXPECT_NE(updatedFollowers.end(), AZStd::find(updatedFollowers.begin(), updatedFollowers.end(), &followers[0]));
+        EXPECT_NE(updatedFollowers.end(), AZStd::find(updatedFollowers.begin(), updatedFollowers.end(), &followers[2]));
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, AddAndRemoveInstance_OtherTypeDuringUpdate_InstanceNotAdded)
+    {
+        UpdateFollower follower;
+
+        AZ::ComponentUpdateDescriptor positionDescriptor;
+        positionDescriptor.m_order = AZ::ComponentTickBus::TICK_PHYSICS;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            positionDescriptor,
+            [this, &follower](AZStd::span<UpdatePosition* const>, float, AZ::ScriptTimePoint)
+            {
+                m_scheduler->AddInstance(&follower);
+                m_scheduler->RemoveInstance(&follower);
+            });
+
+        int followerCallCount = 0;
+        m_scheduler->RegisterUpdateType<UpdateFollower>(
+            {},
+            [&followerCallCount](AZStd::span<UpdateFollower* const>, float, AZ::ScriptTimePoint)
+            {
+                ++followerCallCount;
+            });
+
+        UpdatePosition position;
+        m_scheduler->AddInstance(&position);
+
+        m_scheduler->Update(1.0f, {});
+        m_scheduler->Update(1.0f, {});
+
+        EXPECT_EQ(0, followerCallCount);
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, UnregisterUpdateType_DuringUpdate_BatchSkippedAndRemovedAfterUpdate)
+    {
+        AZ::ComponentUpdateDescriptor positionDescriptor;
+        positionDescriptor.m_order = AZ::ComponentTickBus::TICK_PHYSICS;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            positionDescriptor,
+            [this](AZStd::span<UpdatePosition* const>, float, AZ::ScriptTimePoint)
+            {
+                m_scheduler->UnregisterUpdateType<UpdateFollower>();
+                EXPECT_FALSE(m_scheduler->IsUpdateTypeRegistered(azrtti_typeid<UpdateFollower>()));
+            });
+
+        int followerCallCount = 0;
+        auto updateFollowers = [&followerCallCount](AZStd::span<UpdateFollower* const>, float, AZ::ScriptTimePoint)
+        {
+            ++followerCallCount;
+        };
+        m_scheduler->RegisterUpdateType<UpdateFollower>({}, updateFollowers);
+
+        UpdatePosition position;
+        UpdateFollower follower;
+        m_scheduler->AddInstance(&position);
+        m_scheduler->AddInstance(&follower);
+
+        m_scheduler->Update(1.0f, {});
+
+        EXPECT_EQ(0, followerCallCount);
+        EXPECT_FALSE(m_scheduler->IsUpdateTypeRegistered(azrtti_typeid<UpdateFollower>()));
+
+        m_scheduler->UnregisterUpdateType<UpdatePosition>();
+        EXPECT_TRUE(m_scheduler->RegisterUpdateType<UpdateFollower>({}, updateFollowers));
+        m_scheduler->AddInstance(&follower);
+        m_scheduler->Update(1.0f, {});
+
+        EXPECT_EQ(1, followerCallCount);
+    }
+
+    TEST_F(ComponentUpdateSchedulerTest, RegisterUpdateType_DuringUpdate_RegisteredImmediately)
+    {
+        bool registered = false;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            {},
+            [this, &registered](AZStd::span<UpdatePosition* const>, float, AZ::ScriptTimePoint)
+            {
+                if (!registered)
+                {
+                    registered = m_scheduler->RegisterUpdateType<UpdateFollower>(
+                        {},
+                        [](AZStd::span<UpdateFollower* const> instances, float deltaTime, AZ::ScriptTimePoint)
+                        {
+                            for (UpdateFollower* instance : instances)
+                            {
+                                instance->m_position += deltaTime;
+                            }
+                        });
+                }
+            });
+
+        UpdatePosition position;
+        m_scheduler->AddInstance(&position);
+
+        m_scheduler->Update(1.0f, {});
+
+        EXPECT_TRUE(registered);
+        EXPECT_TRUE(m_scheduler->IsUpdateTypeRegistered(azrtti_typeid<UpdateFollower>()));
+
+        UpdateFollower follower;
+        m_scheduler->AddInstance(&follower);
+        m_scheduler->Update(1.0f, {});
+
+        EXPECT_FLOAT_EQ(1.0f, follower.m_position);
+    }
+
+    class ComponentUpdateSchedulerParallelTest : public ComponentUpdateSchedulerTest
+    {
+    public:
+        void SetUp() override
+        {
+            ComponentUpdateSchedulerTest::SetUp();
+            m_executor = aznew AZ::TaskExecutor();
+            m_scheduler->SetTaskExecutor(m_executor);
+        }
+
+        void TearDown() override
+        {
+            m_scheduler->SetTaskExecutor(nullptr);
+            azdestroy(m_executor);
+            ComponentUpdateSchedulerTest::TearDown();
+        }
+
+    protected:
+        AZ::TaskExecutor* m_executor = nullptr;
+    };
+
+    TEST_F(ComponentUpdateSchedulerParallelTest, Update_ChunkedWriterAndReader_ReaderRunsAfterAllWritesComplete)
+    {
+        constexpr size_t InstanceCount = 100;
+
+        AZ::ComponentUpdateDescriptor positionDescriptor;
+        positionDescriptor.m_name = "UpdatePosition";
+        positionDescriptor.m_writes = { PositionsResource };
+        positionDescriptor.m_instancesPerTask = 8;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            positionDescriptor,
+            [](AZStd::span<UpdatePosition* const> instances, float deltaTime, AZ::ScriptTimePoint)
+            {
+                for (UpdatePosition* instance : instances)
+                {
+                    instance->m_position += deltaTime;
+                }
+            });
+
+        // Only waits for the position batch because it reads the data that batch writes.
+        AZ::ComponentUpdateDescriptor followerDescriptor;
+        followerDescriptor.m_name = "UpdateFollower";
+        followerDescriptor.m_reads = { PositionsResource };
+        followerDescriptor.m_order = AZ::ComponentTickBus::TICK_LAST;
+        m_scheduler->RegisterUpdateType<UpdateFollower>(
+            followerDescriptor,
+            [](AZStd::span<UpdateFollower* const> instances, float, AZ::ScriptTimePoint)
+            {
+                for (UpdateFollower* instance : instances)
+                {
+                    instance->m_position = instance->m_target->m_position;
+                }
+            });
+
+        AZStd::vector<UpdatePosition> positions(InstanceCount);
+        AZStd::vector<UpdateFollower> followers(InstanceCount);
+        for (size_t i = 0; i < InstanceCount; ++i)
+        {
+            followers[i].m_target = &positions[i];
+            m_scheduler->AddInstance(&positions[i]);
+            m_scheduler->AddInstance(&followers[i]);
+        }
+
+        m_scheduler->Update(1.0f, {});
+        m_scheduler->Update(1.0f, {});
+
+        for (size_t i = 0; i < InstanceCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(2.0f, positions[i].m_position);
+            EXPECT_FLOAT_EQ(2.0f, followers[i].m_position);
+        }
+    }
+
+    TEST_F(ComponentUpdateSchedulerParallelTest, RemoveInstance_OtherTypeDuringUpdate_ChunkedBatchSkipsRemovedInstance)
+    {
+        constexpr size_t FollowerCount = 9;
+
+        AZStd::vector<UpdateFollower> followers(FollowerCount);
+
+        // The follower batch reads the positions this batch writes, so it always runs after it.
+        AZ::ComponentUpdateDescriptor positionDescriptor;
+        positionDescriptor.m_writes = { PositionsResource };
+        positionDescriptor.m_order = AZ::ComponentTickBus::TICK_PHYSICS;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            positionDescriptor,
+            [this, &followers](AZStd::span<UpdatePosition* const>, float, AZ::ScriptTimePoint)
+            {
+                m_scheduler->RemoveInstance(&followers[0]);
+                m_scheduler->RemoveInstance(&followers[4]);
+            });
+
+        AZ::ComponentUpdateDescriptor followerDescriptor;
+        followerDescriptor.m_reads = { PositionsResource };
+        followerDescriptor.m_instancesPerTask = 2;
+        m_scheduler->RegisterUpdateType<UpdateFollower>(
+            followerDescriptor,
+            [](AZStd::span<UpdateFollower* const> instances, float deltaTime, AZ::ScriptTimePoint)
+            {
+                for (UpdateFollower* instance : instances)
+                {
+                    instance->m_position += deltaTime;
+                }
+            });
+
+        UpdatePosition position;
+        m_scheduler->AddInstance(&position);
+        for (UpdateFollower& follower : followers)
+        {
+            m_scheduler->AddInstance(&follower);
+        }
+
+        m_scheduler->Update(1.0f, {});
+
+        for (size_t i = 0; i < FollowerCount; ++i)
+        {
+            EXPECT_FLOAT_EQ((i == 0 || i == 4) ? 0.0f : 1.0f, followers[i].m_position);
+        }
+    }
+
+    TEST_F(ComponentUpdateSchedulerParallelTest, Update_ChunkedInstances_EveryInstanceUpdatedOnce)
+    {
+        constexpr size_t InstanceCount = 37;
+
+        AZStd::atomic<size_t> updatedCount{ 0 };
+        AZ::ComponentUpdateDescriptor descriptor;
+        descriptor.m_instancesPerTask = 5;
+        m_scheduler->RegisterUpdateType<UpdatePosition>(
+            descriptor,
+            [&updatedCount](AZStd::span<UpdatePosition* const> instances, float deltaTime, AZ::ScriptTimePoint)
+            {
+                EXPECT_LE(instances.size(), 5);
+                for (UpdatePosition* instance : instances)
+                {
+                    instance->m_position += deltaTime;
+                }
+                updatedCount += instances.size();
+            });
+
+        AZStd::vector<UpdatePosition> positions(InstanceCount);
+        for (UpdatePosition& position : positions)
+        {
+            m_scheduler->AddInstance(&position);
+        }
+
+        m_scheduler->Update(1.0f, {});
+
+        EXPECT_EQ(InstanceCount, updatedCount);
+        for (const UpdatePosition& position : positions)
+        {
+            EXPECT_FLOAT_EQ(1.0f, position.m_position);
+        }
+    }
+} // namespace UnitTest
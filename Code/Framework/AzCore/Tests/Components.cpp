@@ -982,6 +982,48 @@ namespace UnitTest
         };
     }
 
+    TEST_F(ComponentDependency, ActivationOrderCache_EntityWithSameComponents_ReusesSortedOrder)
+    {
+        ComponentActivationOrderCache* orderCache = m_componentApp->GetComponentActivationOrderCache();
+        ASSERT_NE(nullptr, orderCache);
+        orderCache->Clear();
+
+        m_entity->CreateComponent<ComponentB>();
+        m_entity->CreateComponent<ComponentC>();
+        m_entity->CreateComponent<ComponentD>();
+        m_entity->CreateComponent<ComponentE>();
+        EXPECT_EQ(Entity::DependencySortResult::Success, m_entity->EvaluateDependencies());
+        EXPECT_EQ(1, orderCache->GetCachedOrderCount());
+
+        Entity otherEntity;
+        otherEntity.CreateComponent<ComponentB>();
+        otherEntity.CreateComponent<ComponentC>();
+        otherEntity.CreateComponent<ComponentD>();
+        otherEntity.CreateComponent<ComponentE>();
+        EXPECT_EQ(Entity::DependencySortResult::Success, otherEntity.EvaluateDependencies());
+        EXPECT_EQ(1, orderCache->GetCachedOrderCount());
+
+        const Entity::ComponentArrayType& sorted = m_entity->GetComponents();
+        const Entity::ComponentArrayType& otherSorted = otherEntity.GetComponents();
+        ASSERT_EQ(sorted.size(), otherSorted.size());
+        for (size_t i = 0; i < sorted.size(); ++i)
+        {
+            EXPECT_EQ(sorted[i]->RTTI_GetType(), otherSorted[i]->RTTI_GetType());
+        }
+    }
+
+    TEST_F(ComponentDependency, ActivationOrderCache_ComponentWithInstanceDependentServices_IsNotCached)
+    {
+        ComponentActivationOrderCache* orderCache = m_componentApp->GetComponentActivationOrderCache();
+        ASSERT_NE(nullptr, orderCache);
+        orderCache->Clear();
+
+        // ComponentA uses a custom descriptor, so its services may differ per instance.
+        CreateComponents_ABCDE();
+        EXPECT_EQ(Entity::DependencySortResult::Success, m_entity->EvaluateDependencies());
+        EXPECT_EQ(0, orderCache->GetCachedOrderCount());
+    }
+
     // Check that invalid user input, in the form of services accidentally listed multiple times,
     // is handled appropriately and doesn't result in infinite loops.
 
@@ -2053,5 +2095,63 @@ namespace Benchmark
 
     BENCHMARK(BM_ComponentDependencySort)->Arg(6)->Arg(60);
 
+    // Evaluates the dependencies of entities with identical components, as happens when activating clones from a spawnable.
+    // The argument selects whether the activation order cache is used (1) or cleared before every evaluation (0), in which
+    // case every entity goes through a full dependency sort.
+    static void BM_ComponentActivationOrderCache(::benchmark::State& state)
+    {
+        // descriptors are cleaned up when ComponentApplication shuts down
+        aznew UnitTest::ComponentB::DescriptorType;
+        aznew UnitTest::ComponentC::DescriptorType;
+        aznew UnitTest::ComponentD::DescriptorType;
+        aznew UnitTest::ComponentE::DescriptorType;
+        aznew UnitTest::ComponentE2::DescriptorType;
+
+        ComponentApplication componentApp;
+
+        ComponentApplication::Descriptor desc;
+        desc.m_useExistingAllocator = true;
+        AZ::ComponentApplication::StartupParameters startupParameters;
+        startupParameters.m_loadSettingsRegistry = false;
+        Entity* systemEntity = componentApp.Create(desc, startupParameters);
+        systemEntity->Init();
+
+        const bool useCache = state.range(0) != 0;
+        ComponentActivationOrderCache* orderCache = componentApp.GetComponentActivationOrderCache();
+        orderCache->Clear();
+
+        constexpr size_t EntityCount = 100;
+        AZStd::vector<AZStd::unique_ptr<Entity>> entities;
+        entities.reserve(EntityCount);
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            Entity* entity = entities.emplace_back(AZStd::make_unique<Entity>()).get();
+            entity->CreateComponent<UnitTest::ComponentE2>();
+            entity->CreateComponent<UnitTest::ComponentD>();
+            entity->CreateComponent<UnitTest::ComponentC>();
+            entity->CreateComponent<UnitTest::ComponentE>();
+            entity->CreateComponent<UnitTest::ComponentB>();
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZStd::unique_ptr<Entity>& entity : entities)
+            {
+                if (!useCache)
+                {
+                    orderCache->Clear();
+                }
+
+                entity->InvalidateDependencies();
+                [[maybe_unused]] Entity::DependencySortResult result = entity->EvaluateDependencies();
+                AZ_Assert(result == Entity::DependencySortResult::Success, "Sort failed");
+            }
+        }
+
+        entities.clear();
+    }
+
+    BENCHMARK(BM_ComponentActivationOrderCache)->Arg(0)->Arg(1);
+
 } // Benchmark
 #endif // HAVE_BENCHMARK
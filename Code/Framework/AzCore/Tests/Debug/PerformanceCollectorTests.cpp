@@ -9,6 +9,7 @@
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzTest/AzTest.h>
 
+#include <AzCore/Asset/AssetLoadTimeline.h>
 #include <AzCore/Debug/PerformanceCollector.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
@@ -214,4 +215,56 @@ namespace UnitTest
         ASSERT_EQ(testFileExtention, actualExtension);
     }
 
+    TEST_F(PerformanceCollectorTest, AssetLoadTimelineRecorder_ReportSamples_RecordsOneSamplePerLoadStep)
+    {
+        const AZStd::string LogCategory("PerformanceCollectorTest");
+        auto onCompleteCallback = [](AZ::u32)
+        {
+        };
+
+        AZ::Debug::PerformanceCollector performanceCollector(
+            LogCategory, AZ::Data::AssetLoadTimelineRecorder::GetMetricNames(), onCompleteCallback);
+        performanceCollector.UpdateDataLogType(AZ::Debug::PerformanceCollector::DataLogType::LogAllSamples);
+        performanceCollector.UpdateFrameCountPerCaptureBatch(1);
+        performanceCollector.UpdateWaitTimeBeforeEachBatch(AZStd::chrono::seconds(0));
+        performanceCollector.UpdateNumberOfCaptureBatches(1);
+
+        AZ::Data::AssetLoadTimelineRecorder recorder;
+        recorder.SetEnabled(true);
+
+        // A load that completes before the capture starts isn't reported.
+        const AZ::Data::AssetId skippedAssetId(AZ::Uuid::CreateRandom(), 0);
+        recorder.BeginTimeline(skippedAssetId, AZ::Uuid::CreateRandom(), "skipped", false);
+        recorder.CompleteTimeline(skippedAssetId, true);
+        recorder.ReportSamples(performanceCollector);
+
+        performanceCollector.FrameTick();
+
+        const AZ::Data::AssetId assetId(AZ::Uuid::CreateRandom(), 0);
+        recorder.BeginTimeline(assetId, AZ::Uuid::CreateRandom(), "reported", false);
+        recorder.RecordStage(assetId, AZ::Data::AssetLoadStage::StreamRead);
+        recorder.RecordStage(assetId, AZ::Data::AssetLoadStage::LoadStarted);
+        recorder.RecordStage(assetId, AZ::Data::AssetLoadStage::DataLoaded);
+        recorder.RecordStage(assetId, AZ::Data::AssetLoadStage::PostLoad);
+        recorder.CompleteTimeline(assetId, true);
+        recorder.ReportSamples(performanceCollector);
+
+        performanceCollector.FrameTick();
+
+        EXPECT_EQ(recorder.GetCompletedTimelines().size(), 2);
+
+        rapidjson::Document jsonDoc;
+        jsonDoc.Parse(performanceCollector.GetOutputDataBuffer().c_str());
+        ASSERT_TRUE(!jsonDoc.HasParseError());
+        ASSERT_TRUE(jsonDoc.IsArray());
+
+        const auto metricNames = AZ::Data::AssetLoadTimelineRecorder::GetMetricNames();
+        ASSERT_EQ(jsonDoc.Size(), metricNames.size());
+        for (rapidjson::SizeType i = 0; i < jsonDoc.Size(); i++)
+        {
+            EXPECT_EQ(metricNames[i], jsonDoc[i]["name"].GetString());
+            EXPECT_TRUE(jsonDoc[i].HasMember("dur"));
+        }
+    }
+
 }//namespace UnitTest
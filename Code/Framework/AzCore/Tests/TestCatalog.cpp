@@ -313,6 +313,8 @@ namespace UnitTest
 
     AssetInfo DataDrivenHandlerAndCatalog::GetAssetInfoById(const AssetId& assetId)
     {
+        ++m_numAssetInfoRequests;
+
         AssetInfo result;
         const auto* def = FindById(assetId);
 
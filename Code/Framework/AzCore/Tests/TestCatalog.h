@@ -108,6 +108,7 @@ namespace UnitTest
         AZStd::atomic_int m_numCreations = 0;
         AZStd::atomic_int m_numDestructions = 0;
         AZStd::atomic_int m_numLoads = 0;
+        AZStd::atomic_int m_numAssetInfoRequests = 0;
         AZStd::atomic_bool m_failLoad{ false };
         SerializeContext* m_context{ nullptr };
 
@@ -72,6 +72,7 @@ set(FILES
     BehaviorContext.cpp
     BehaviorContextFixture.h
     Components.cpp
+    ComponentUpdateSchedulerTests.cpp
     Console/LoggerSystemComponentTests.cpp
     Console/ConsoleTests.cpp
     Date/DateFormatTests.cpp
@@ -22,6 +22,7 @@
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzCore/std/sort.h>
@@ -29,6 +30,7 @@
 
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/BinaryAssetRegistry.h>
 #include <AzFramework/IO/FileOperations.h>
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/NestedArchive.h>
@@ -2122,6 +2124,12 @@ namespace AZ::IO
         AZ::SerializeContext* serializeContext = nullptr;
         AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
         AZ_Assert(serializeContext, "Failed to retrieve serialize context.");
+        const AZStd::span<const char> catalogData(static_cast<const char*>(fileData->GetData()), fileData->GetFileEntry()->desc.lSizeUncompressed);
+        if (AzFramework::BinaryAssetRegistry::IsBinaryAssetRegistry(catalogData))
+        {
+            auto catalogInfo = AZStd::make_shared<AzFramework::AssetRegistry>();
+            return AzFramework::BinaryAssetRegistry::Read(catalogData, *catalogInfo) ? catalogInfo : nullptr;
+        }
         auto catalogInfo = AZStd::shared_ptr<AzFramework::AssetRegistry>(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetRegistry>(fileData->GetData(), fileData->GetFileEntry()->desc.lSizeUncompressed));
 
         return catalogInfo;
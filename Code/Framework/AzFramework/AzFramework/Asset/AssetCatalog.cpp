@@ -13,11 +13,13 @@
 #include <AzCore/Asset/AssetTypeInfoBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/ObjectStream.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -27,6 +29,7 @@
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/Asset/AssetRegistry.h>
 #include <AzFramework/Asset/AssetSystemBus.h>
+#include <AzFramework/Asset/BinaryAssetRegistry.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 
 // uncomment to have the catalog be dumped to stdout:
@@ -35,6 +38,37 @@
 
 namespace AzFramework
 {
+    namespace
+    {
+        bool ReadCatalogFile(const char* catalogRegistryFile, AZStd::vector<char>& bytes)
+        {
+            // even though this could be a chunk of memory to allocate and deallocate, this is many times faster and more efficient
+            // in terms of memory AND fragmentation than allowing it to perform thousands of reads on physical media.
+            if (catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
+            {
+                AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
+                AZ::u64 size = 0;
+                AZ::IO::FileIOBase::GetInstance()->Size(catalogRegistryFile, size);
+
+                if (size)
+                {
+                    if (AZ::IO::FileIOBase::GetInstance()->Open(catalogRegistryFile, AZ::IO::OpenMode::ModeRead, handle))
+                    {
+                        bytes.resize_no_construct(size);
+                        // this call will fail on purpose if bytes.size() != size successfully actually read from disk.
+                        if (!AZ::IO::FileIOBase::GetInstance()->Read(handle, bytes.data(), bytes.size(), true))
+                        {
+                            AZ_Error("AssetCatalog", false, "File %s failed read - read was truncated!", catalogRegistryFile);
+                            bytes.set_capacity(0);
+                        }
+                        AZ::IO::FileIOBase::GetInstance()->Close(handle);
+                    }
+                }
+            }
+            return !bytes.empty();
+        }
+    } // namespace
+
     //=========================================================================
     // AssetCatalog ctor
     //=========================================================================
@@ -179,6 +213,12 @@ namespace AzFramework
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+        if (m_binaryRegistry)
+        {
+            // The binary catalog doesn't store the info of assets as such, so it has to be built to get to the path.
+            return GetAssetInfoByIdInternal(id).m_relativePath;
+        }
+
         auto foundIter = m_registry->m_assetIdToInfo.find(id);
         if (foundIter != m_registry->m_assetIdToInfo.end())
         {
@@ -215,6 +255,18 @@ namespace AzFramework
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+        if (m_binaryRegistry)
+        {
+            AZ::Data::AssetInfo assetInfo;
+            if (m_binaryRegistry->GetAssetInfo(id, assetInfo))
+            {
+                return assetInfo;
+            }
+
+            AZ::Data::AssetId legacyMapping = m_binaryRegistry->GetAssetIdByLegacyAssetId(id);
+            return legacyMapping.IsValid() ? GetAssetInfoByIdInternal(legacyMapping) : AZ::Data::AssetInfo();
+        }
+
         auto foundIter = m_registry->m_assetIdToInfo.find(id);
         if (foundIter != m_registry->m_assetIdToInfo.end())
         {
@@ -246,6 +298,17 @@ namespace AzFramework
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+            if (m_binaryRegistry)
+            {
+                AZ::Data::AssetId foundId = m_binaryRegistry->GetAssetIdByPath(m_pathBuffer);
+                AZ::Data::AssetInfo assetInfo;
+                if (foundId.IsValid() &&
+                    (!autoRegisterIfNotFound || (m_binaryRegistry->GetAssetInfo(foundId, assetInfo) && !assetInfo.m_assetType.IsNull())))
+                {
+                    return foundId;
+                }
+            }
+
             AZ::Data::AssetId foundId = m_registry->GetAssetIdByPath(m_pathBuffer.c_str());
             if (foundId.IsValid())
             {
@@ -282,6 +345,7 @@ namespace AzFramework
 
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+                MaterializeBinaryRegistry();
                 m_registry->RegisterAsset(generatedID, newInfo);
             }
 
@@ -299,6 +363,16 @@ namespace AzFramework
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
         AZStd::vector<AZStd::string> registeredAssetPaths;
+        if (m_binaryRegistry)
+        {
+            registeredAssetPaths.reserve(m_binaryRegistry->GetAssetCount());
+            m_binaryRegistry->EnumerateAssets(
+                [&registeredAssetPaths](const AZ::Data::AssetInfo& assetInfo)
+                {
+                    registeredAssetPaths.emplace_back(assetInfo.m_relativePath);
+                });
+        }
+
         for (auto assetIdToInfoPair : m_registry->m_assetIdToInfo)
         {
             registeredAssetPaths.emplace_back(assetIdToInfoPair.second.m_relativePath);
@@ -310,6 +384,16 @@ namespace AzFramework
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetDirectProductDependencies(const AZ::Data::AssetId& id)
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+        if (m_binaryRegistry)
+        {
+            AZStd::vector<AZ::Data::ProductDependency> dependencies;
+            if (!m_binaryRegistry->GetAssetDependencies(id, dependencies))
+            {
+                return AZ::Failure<AZStd::string>("Failed to find asset in dependency map");
+            }
+            return AZ::Success(AZStd::move(dependencies));
+        }
+
         auto itr = m_registry->m_assetDependencies.find(id);
 
         if (itr == m_registry->m_assetDependencies.end())
@@ -360,32 +444,71 @@ namespace AzFramework
 
     AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> AssetCatalog::GetLoadBehaviorProductDependencies(const AZ::Data::AssetId& id, AZStd::unordered_set<AZ::Data::AssetId>& noloadSet, AZ::Data::PreloadAssetListType& preloadAssetList)
     {
+        AZStd::shared_ptr<const AZ::Data::LoadBehaviorDependencyClosure> closure = GetLoadBehaviorDependencyClosure(id);
+
+        noloadSet.insert(closure->m_noloadDependencies.begin(), closure->m_noloadDependencies.end());
+        for (const auto& [assetId, preloads] : closure->m_preloadDependencies)
+        {
+            preloadAssetList[assetId].insert(preloads.begin(), preloads.end());
+        }
+
+        return AZ::Success(closure->m_dependencies);
+    }
+
+    AZStd::shared_ptr<const AZ::Data::LoadBehaviorDependencyClosure> AssetCatalog::GetLoadBehaviorDependencyClosure(const AZ::Data::AssetId& id)
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+
+        auto closureIter = m_dependencyClosures.find(id);
+        if (closureIter == m_dependencyClosures.end())
+        {
+            closureIter = m_dependencyClosures.emplace(id, BuildLoadBehaviorDependencyClosure(id)).first;
+        }
+        return closureIter->second;
+    }
+
+    AZStd::shared_ptr<AZ::Data::LoadBehaviorDependencyClosure> AssetCatalog::BuildLoadBehaviorDependencyClosure(const AZ::Data::AssetId& id) const
+    {
+        auto closure = AZStd::make_shared<AZ::Data::LoadBehaviorDependencyClosure>();
+
         AZStd::vector<AZ::Data::ProductDependency> dependencyList;
-        AZStd::vector<AZ::Data::ProductDependency> returnList;
+        // Depth of each entry of dependencyList, which is one more than the depth of the asset it was found from.
+        AZStd::vector<AZ::u32> depthList;
         AZStd::unordered_set<AZ::Data::AssetId> assetSet;
 
-        AddAssetDependencies(id, assetSet, dependencyList, {}, {}, preloadAssetList);
+        AddAssetDependencies(id, assetSet, dependencyList, {}, {}, closure->m_preloadDependencies);
+        depthList.resize(dependencyList.size(), 1);
 
         // dependencyList will be appended to while looping, so use a traditional loop
         for (size_t i = 0; i < dependencyList.size(); ++i)
         {
             if (AZ::Data::ProductDependencyInfo::LoadBehaviorFromFlags(dependencyList[i].m_flags) == AZ::Data::AssetLoadBehavior::NoLoad)
             {
-                noloadSet.insert(dependencyList[i].m_assetId);
+                closure->m_noloadDependencies.insert(dependencyList[i].m_assetId);
                 assetSet.erase(dependencyList[i].m_assetId);
             }
             else
             {
-                returnList.push_back(dependencyList[i]);
+                const AZ::u32 depth = depthList[i];
+                closure->m_dependencies.push_back(dependencyList[i]);
+                closure->m_depths.push_back(depth);
+                closure->m_maxDepth = AZStd::max(closure->m_maxDepth, depth);
                 // Copy the asset Id out of the list into a temp variable before passing it in.  AddAssetDependencies will modify
                 // dependencyList, which can cause reallocations of the list, so the reference to a specific entry might not remain
                 // valid throughout the entire call.
                 AZ::Data::AssetId searchId = dependencyList[i].m_assetId;
-                AddAssetDependencies(searchId, assetSet, dependencyList, {}, {}, preloadAssetList);
+                AddAssetDependencies(searchId, assetSet, dependencyList, {}, {}, closure->m_preloadDependencies);
+                // The list is walked breadth first, so this is the shortest path to any dependency found for the first time here.
+                depthList.resize(dependencyList.size(), depth + 1);
             }
         }
 
-        return AZ::Success(AZStd::move(returnList));
+        return closure;
+    }
+
+    void AssetCatalog::InvalidateDependencyClosures()
+    {
+        m_dependencyClosures.clear();
     }
 
     bool AssetCatalog::DoesAssetIdMatchWildcardPatternInternal(const AZ::Data::AssetId& assetId, const AZStd::string& wildcardPattern) const
@@ -422,13 +545,23 @@ namespace AzFramework
         using namespace AZ::Data;
 
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
-        auto itr = m_registry->m_assetDependencies.find(searchAssetId);
-
-        if (itr != m_registry->m_assetDependencies.end())
+        const AZStd::vector<ProductDependency>* assetDependencyList = nullptr;
+        AZStd::vector<ProductDependency> binaryDependencyList;
+        if (m_binaryRegistry)
         {
-            AZStd::vector<ProductDependency>& assetDependencyList = itr->second;
+            if (m_binaryRegistry->GetAssetDependencies(searchAssetId, binaryDependencyList))
+            {
+                assetDependencyList = &binaryDependencyList;
+            }
+        }
+        else if (auto itr = m_registry->m_assetDependencies.find(searchAssetId); itr != m_registry->m_assetDependencies.end())
+        {
+            assetDependencyList = &itr->second;
+        }
 
-            for (const ProductDependency& dependency : assetDependencyList)
+        if (assetDependencyList)
+        {
+            for (const ProductDependency& dependency : *assetDependencyList)
             {
                 if (!dependency.m_assetId.IsValid())
                 {
@@ -515,9 +648,20 @@ namespace AzFramework
             // Make sure we don't hold on to any locks during the enumerateCB, so copy the registry info to a local variable
             // and unlock the registryMutex before calling the callback.
             m_registryMutex.lock();
+            // The binary catalog is never modified, so holding on to it is enough to enumerate it without the lock.
+            AZStd::shared_ptr<const BinaryAssetRegistry> binaryRegistry = m_binaryRegistry;
             auto assetIdToInfoCopy = m_registry->m_assetIdToInfo;
             m_registryMutex.unlock();
 
+            if (binaryRegistry)
+            {
+                binaryRegistry->EnumerateAssets(
+                    [&enumerateCB](const AZ::Data::AssetInfo& assetInfo)
+                    {
+                        enumerateCB(assetInfo.m_assetId, assetInfo);
+                    });
+            }
+
             for (auto& it : assetIdToInfoCopy)
             {
                 enumerateCB(it.first, it.second);
@@ -566,30 +710,8 @@ namespace AzFramework
 
             AZ_TracePrintf("AssetCatalog", "Initializing asset catalog with root \"%s\"", assetRoot.c_str());
 
-            // even though this could be a chunk of memory to allocate and deallocate, this is many times faster and more efficient
-            // in terms of memory AND fragmentation than allowing it to perform thousands of reads on physical media.
             AZStd::vector<char> bytes;
-            if (catalogRegistryFile && AZ::IO::FileIOBase::GetInstance())
-            {
-                AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
-                AZ::u64 size = 0;
-                AZ::IO::FileIOBase::GetInstance()->Size(catalogRegistryFile, size);
-
-                if (size)
-                {
-                    if (AZ::IO::FileIOBase::GetInstance()->Open(catalogRegistryFile, AZ::IO::OpenMode::ModeRead, handle))
-                    {
-                        bytes.resize_no_construct(size);
-                        // this call will fail on purpose if bytes.size() != size successfully actually read from disk.
-                        if (!AZ::IO::FileIOBase::GetInstance()->Read(handle, bytes.data(), bytes.size(), true))
-                        {
-                            AZ_Error("AssetCatalog", false, "File %s failed read - read was truncated!", catalogRegistryFile);
-                            bytes.set_capacity(0);
-                        }
-                        AZ::IO::FileIOBase::GetInstance()->Close(handle);
-                    }
-                }
-            }
+            ReadCatalogFile(catalogRegistryFile, bytes);
 
             if (!bytes.empty())
             {
@@ -600,26 +722,48 @@ namespace AzFramework
                     prevRegistry = AZStd::move(m_registry);
                     m_registry.reset(aznew AssetRegistry());
                 }
-                AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
-#if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
-                ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
-                    AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
-                    [this, &catalogStream, &serializeContext]
+                // The catalog is loaded over the current one.
+                MaterializeBinaryRegistry();
+
+                if (BinaryAssetRegistry::IsBinaryAssetRegistry(bytes))
+                {
+                    // The binary catalog is used in place, the registry is only filled in if the catalog gets modified.
+                    m_binaryRegistry = BinaryAssetRegistry::Create(AZStd::move(bytes));
+                    AZ_Error("AssetCatalog", m_binaryRegistry, "Binary asset catalog %s is invalid.", catalogRegistryFile);
+                    if (!m_registry->IsEmpty())
                     {
-                        AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
-                    },
-                        "Asset Catalog Loading Thread"
-                        );
+                        MaterializeBinaryRegistry();
+                    }
+                }
+                else
+                {
+                    AZ::IO::MemoryStream catalogStream(bytes.data(), bytes.size());
+#if (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+                    ApplicationRequests::Bus::Broadcast(&ApplicationRequests::PumpSystemEventLoopWhileDoingWorkInNewThread,
+                        AZStd::chrono::milliseconds(AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING_INTERVAL_MS),
+                        [this, &catalogStream, &serializeContext]
+                        {
+                            AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                        },
+                            "Asset Catalog Loading Thread"
+                            );
 #else
-                AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
+                    AZ::Utils::LoadObjectFromStreamInPlace<AzFramework::AssetRegistry>(catalogStream, *m_registry.get(), serializeContext, AZ::ObjectStream::FilterDescriptor(&AZ::Data::AssetFilterNoAssetLoading));
 #endif // (AZ_TRAIT_PUMP_SYSTEM_EVENTS_WHILE_LOADING)
+                }
 
-                AZ_TracePrintf("AssetCatalog", "Loaded registry containing %u assets.\n", m_registry->m_assetIdToInfo.size());
+                AZ_TracePrintf("AssetCatalog", "Loaded registry containing %zu assets.\n",
+                    m_binaryRegistry ? m_binaryRegistry->GetAssetCount() : m_registry->m_assetIdToInfo.size());
+                InvalidateDependencyClosures();
 
                 // It's currently possible in tools for us to have received updates from AP which were applied before the catalog was ready to load
                 if (!m_initialized)
                 {
-                    ApplyDeltaCatalog(prevRegistry);
+                    // Applying an empty registry would needlessly materialize a binary catalog.
+                    if (!prevRegistry->IsEmpty())
+                    {
+                        ApplyDeltaCatalog(prevRegistry);
+                    }
                     m_initialized = true;
                 }
                 shouldBroadcast = true;
@@ -679,6 +823,7 @@ namespace AzFramework
         }
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            MaterializeBinaryRegistry();
             m_registry->RegisterAsset(id, info);
         }
         AzFramework::AssetCatalogEventBus::Broadcast(&AzFramework::AssetCatalogEventBus::Events::OnCatalogAssetAdded, id);
@@ -699,7 +844,9 @@ namespace AzFramework
             });
 
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            MaterializeBinaryRegistry();
             m_registry->UnregisterAsset(assetId);
+            InvalidateDependencyClosures();
         }
     }
 
@@ -829,6 +976,14 @@ namespace AzFramework
                     // the lock must expire before we send out notifications to other systems.
                     AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+                    AZ::Data::AssetInfo knownAssetInfo;
+                    if (m_binaryRegistry && isCatalogInitialize && m_binaryRegistry->GetAssetInfo(assetId, knownAssetInfo))
+                    {
+                        // Assets that are already known are skipped below, which doesn't require modifying the catalog.
+                        return;
+                    }
+                    MaterializeBinaryRegistry();
+
                     // is it an add or a change?
                     auto assetInfoPair = m_registry->m_assetIdToInfo.find(assetId);
                     isNewAsset = (assetInfoPair == m_registry->m_assetIdToInfo.end());
@@ -860,6 +1015,7 @@ namespace AzFramework
 
                     m_registry->RegisterAsset(assetId, newData);
                     m_registry->SetAssetDependencies(assetId, message.m_dependencies);
+                    InvalidateDependencyClosures();
 
                     for (const auto& mapping : message.m_legacyAssetIds)
                     {
@@ -954,6 +1110,7 @@ namespace AzFramework
                 UnregisterAsset(assetId);
                 {
                     AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+                    MaterializeBinaryRegistry();
                     m_registry->UnregisterLegacyAssetMappingsForAsset(assetId);
                 }
                 // queue this for later delivery, since we are not on the main thread:
@@ -1038,9 +1195,25 @@ namespace AzFramework
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
         m_registry->Clear();
+        m_binaryRegistry.reset();
+        InvalidateDependencyClosures();
         m_initialized = false;
     }
 
+    //=========================================================================
+    // MaterializeBinaryRegistry
+    //=========================================================================
+    void AssetCatalog::MaterializeBinaryRegistry()
+    {
+        if (m_binaryRegistry)
+        {
+            AZ_PROFILE_FUNCTION(AzFramework);
+            // The registry is empty while the binary catalog is in use, so this leaves it with exactly the content of the catalog.
+            m_binaryRegistry->CopyTo(*m_registry);
+            m_binaryRegistry.reset();
+        }
+    }
+
 
     //=========================================================================
     // AddCatalogEntry
@@ -1086,7 +1259,20 @@ namespace AzFramework
     AZStd::shared_ptr<AzFramework::AssetRegistry> AssetCatalog::LoadCatalogFromFile(const char* catalogFile)
     {
         AZStd::shared_ptr<AzFramework::AssetRegistry> deltaCatalog;
-        deltaCatalog.reset(AZ::Utils::LoadObjectFromFile<AzFramework::AssetRegistry>(catalogFile));
+        AZStd::vector<char> bytes;
+        if (ReadCatalogFile(catalogFile, bytes) && BinaryAssetRegistry::IsBinaryAssetRegistry(bytes))
+        {
+            // Delta catalogs are merged into the catalog they're added to, so they're read into a registry.
+            deltaCatalog = AZStd::make_shared<AzFramework::AssetRegistry>();
+            if (!BinaryAssetRegistry::Read(bytes, *deltaCatalog))
+            {
+                deltaCatalog.reset();
+            }
+        }
+        else
+        {
+            deltaCatalog.reset(AZ::Utils::LoadObjectFromFile<AzFramework::AssetRegistry>(catalogFile));
+        }
         if (!deltaCatalog)
         {
             AZ_Error("AssetCatalog", false, "Failed to load catalog %s", catalogFile);
@@ -1144,7 +1330,9 @@ namespace AzFramework
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+        MaterializeBinaryRegistry();
         m_registry->AddRegistry(deltaCatalog);
+        InvalidateDependencyClosures();
         return true;
     }
 
@@ -1208,6 +1396,7 @@ namespace AzFramework
     bool AssetCatalog::SaveCatalog(const char* catalogRegistryFile)
     {
         AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+        MaterializeBinaryRegistry();
         return SaveCatalog(catalogRegistryFile, m_registry.get());
     }
 
@@ -1216,6 +1405,25 @@ namespace AzFramework
     //=========================================================================
     bool AssetCatalog::SaveCatalog(const char* catalogRegistryFile, AzFramework::AssetRegistry* catalogRegistry)
     {
+        bool saveBinaryCatalog = false;
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            settingsRegistry->Get(saveBinaryCatalog, BinaryAssetRegistry::SaveBinaryCatalogKey);
+        }
+
+        AZStd::vector<char> binaryCatalog;
+        if (saveBinaryCatalog && BinaryAssetRegistry::Write(*catalogRegistry, binaryCatalog))
+        {
+            AZ::IO::FileIOStream fileStream;
+            if (!fileStream.Open(catalogRegistryFile, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary) ||
+                fileStream.Write(binaryCatalog.size(), binaryCatalog.data()) != binaryCatalog.size())
+            {
+                AZ_Warning("AssetCatalog", false, "Failed to save catalog file %s", catalogRegistryFile);
+                return false;
+            }
+            return true;
+        }
+
         AZ::SerializeContext* serializeContext = nullptr;
         AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationRequests::GetSerializeContext);
         AZ_Assert(serializeContext, "Unable to retrieve serialize context.");
@@ -1285,6 +1493,11 @@ namespace AzFramework
     {
         AzFramework::AssetRegistry deltaRegistry;
         AZStd::vector<AZ::Data::AssetId> deltaPakAssetIds;
+        {
+            // The legacy id mappings are only looked up through the registry.
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            MaterializeBinaryRegistry();
+        }
         for (const AZStd::string& file : files)
         {
             AZ::Data::AssetId asset = m_registry->GetAssetIdByPath(file.c_str());
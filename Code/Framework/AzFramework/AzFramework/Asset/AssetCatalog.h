@@ -22,6 +22,7 @@ namespace AzFramework
 {
     class AssetRegistry;
     class AssetBundleManifest;
+    class BinaryAssetRegistry;
 
     /*
      * An asset catalog keeps a registry of asset data information (file name, size, type, etc)
@@ -82,6 +83,7 @@ namespace AzFramework
         AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> GetAllProductDependenciesFilter(const AZ::Data::AssetId& id, const AZStd::unordered_set<AZ::Data::AssetId>& exclusionList, const AZStd::vector<AZStd::string>& wildcardPatternExclusionList) override;
         AZ::Outcome<AZStd::vector<AZ::Data::ProductDependency>, AZStd::string> GetLoadBehaviorProductDependencies(const AZ::Data::AssetId& id, AZStd::unordered_set<AZ::Data::AssetId>& noloadSet,
             AZ::Data::PreloadAssetListType& preloadAssetList) override;
+        AZStd::shared_ptr<const AZ::Data::LoadBehaviorDependencyClosure> GetLoadBehaviorDependencyClosure(const AZ::Data::AssetId& id) override;
 
         bool DoesAssetIdMatchWildcardPattern(const AZ::Data::AssetId& assetId, const AZStd::string& wildcardPattern) override;
 
@@ -113,6 +115,10 @@ namespace AzFramework
                                   AZStd::unordered_set<AZ::Data::AssetId>& exclusionList,
                                   const AZStd::vector<AZStd::string>& wildcardPatternExclusionList,
                                   AZ::Data::PreloadAssetListType& preloadAssetList) const;
+        /// Walks the dependencies of an asset breadth first to build its load behavior dependency closure.
+        AZStd::shared_ptr<AZ::Data::LoadBehaviorDependencyClosure> BuildLoadBehaviorDependencyClosure(const AZ::Data::AssetId& id) const;
+        /// Discards the cached dependency closures. Must be called with the registry locked whenever dependencies in the registry change.
+        void InvalidateDependencyClosures();
         // Called by LoadCatalog to load the base
         bool LoadBaseCatalogInternal();
         // Called by RemoveDeltaCatalog - reassemble our registry from loaded catalog files
@@ -125,6 +131,9 @@ namespace AzFramework
         void InsertCatalogEntry(AZStd::shared_ptr<AzFramework::AssetRegistry> deltaCatalog, size_t catalogIndex);
         // Clear just the registry
         void ResetRegistry();
+        /// Copies a catalog loaded in the binary format into the registry, so it can be modified.
+        /// Must be called with the registry locked before anything changes the registry.
+        void MaterializeBinaryRegistry();
 
         AZStd::string GetAssetPathByIdInternal(const AZ::Data::AssetId& id) const;
         AZ::Data::AssetInfo GetAssetInfoByIdInternal(const AZ::Data::AssetId& id) const;
@@ -136,6 +145,10 @@ namespace AzFramework
         AZStd::unordered_set<AZStd::string> m_extensions;           ///< Valid asset extensions.
         mutable AZStd::recursive_mutex m_registryMutex;
         AZStd::unique_ptr<AssetRegistry> m_registry;
+        //! Catalog loaded in the binary format, which serves the lookups while m_registry is empty until the catalog is first modified.
+        AZStd::shared_ptr<const BinaryAssetRegistry> m_binaryRegistry;
+        //! Dependency closures of the assets that have been requested so far, guarded by m_registryMutex.
+        AZStd::unordered_map<AZ::Data::AssetId, AZStd::shared_ptr<const AZ::Data::LoadBehaviorDependencyClosure>> m_dependencyClosures;
         AZStd::string m_pathBuffer;
         mutable AZStd::recursive_mutex m_baseCatalogNameMutex;
         AZStd::string m_baseCatalogName;
@@ -57,6 +57,15 @@ namespace AzFramework
         m_assetPathToId = AssetPathToIdMap();
     }
 
+    //=========================================================================
+    // AssetRegistry::IsEmpty
+    //=========================================================================
+    bool AssetRegistry::IsEmpty() const
+    {
+        return m_assetIdToInfo.empty() && m_assetDependencies.empty() && m_assetPathToId.empty() &&
+            m_legacyAssetIdToRealAssetId.empty() && m_realAssetIdToLegacyAssetIdMap.empty();
+    }
+
     //=========================================================================
     // AssetRegistry::ReflectSerialize
     //=========================================================================
@@ -19,6 +19,12 @@ namespace AZ
     class SerializeContext;
 }
 
+namespace AssetRegistryInternal
+{
+    //! Creates the key the registry maps a relative path to an asset id with.
+    AZ::Uuid CreateUUIDForName(AZStd::string_view name);
+}
+
 namespace AzFramework
 {
     /**
@@ -28,6 +34,7 @@ namespace AzFramework
     class AssetRegistry
     {
         friend class AssetCatalog;
+        friend class BinaryAssetRegistry;
     public:
         AZ_TYPE_INFO(AssetRegistry, "{5DBC20D9-7143-48B3-ADEE-CCBD2FA6D443}");
         AZ_CLASS_ALLOCATOR(AssetRegistry, AZ::SystemAllocator);
@@ -58,6 +65,9 @@ namespace AzFramework
 
         void Clear();
 
+        //! Returns true if the registry holds no asset info, dependency, path or legacy id.
+        bool IsEmpty() const;
+
         // O3DE_DEPRECATION_NOTICE(GHI-17861)
         // see if the asset ID has been remapped to a new Id:
         AZ::Data::AssetId GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const;
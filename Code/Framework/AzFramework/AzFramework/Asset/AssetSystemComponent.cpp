@@ -51,6 +51,10 @@ namespace AzFramework
         AZ_CONSOLEFREEFUNC(BenchmarkLoadAllAssets, AZ::ConsoleFunctorFlags::Null, "Time the loading of all assets in the catalog");
         AZ_CONSOLEFREEFUNC(BenchmarkLoadAllAssetsSynchronous, AZ::ConsoleFunctorFlags::Null,
             "Time the loading of all assets in the catalog synchronously");
+
+        AZ_CONSOLEFREEFUNC(BenchmarkLoadSyntheticAssetGraph, AZ::ConsoleFunctorFlags::Null,
+            "Generate a synthetic graph of benchmark assets, load it and report the time spent in each load stage. "
+            "Parameters: [depth] [dependencies per asset] [bytes per asset]");
     }
 
     namespace AssetSystem
@@ -7,9 +7,19 @@
  */
 
 #include <AzFramework/Asset/Benchmark/BenchmarkCommands.h>
+#include <AzFramework/Asset/Benchmark/BenchmarkAsset.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
+#include <AzCore/Debug/PerformanceCollector.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/chrono/chrono.h>
 
@@ -32,6 +42,14 @@ namespace AzFramework::AssetBenchmark
     AZ_CVAR(AZ::CVarFixedString, benchmarkLoadAssetLogLabel, "BenchmarkLoadAsset", nullptr, AZ::ConsoleFunctorFlags::Null,
         "Provide a log label for tagging the BenchmarkLoadAsset* outputs to make it easier to distinguish different benchmark runs.");
 
+    //! Folder that BenchmarkLoadSyntheticAssetGraph generates its assets in. The folder is removed when the benchmark completes.
+    AZ_CVAR(AZ::CVarFixedString, benchmarkSyntheticAssetGraphFolder, "@user@/AssetLoadBenchmark", nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Folder that the BenchmarkLoadSyntheticAssetGraph command generates its assets in");
+
+    //! Optionally write the per-stage load times of BenchmarkLoadSyntheticAssetGraph to a Performance_*.json file.
+    AZ_CVAR(bool, benchmarkLoadAssetWritePerformanceLog, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Controls whether or not BenchmarkLoadSyntheticAssetGraph writes the load time of every stage of every asset to a performance log");
+
     static AZStd::vector<AZStd::pair<AZ::Data::AssetId, AZ::Data::AssetType>> s_benchmarkAssetList;
 
     // Given a list of assets, load them and time the results.
@@ -286,6 +304,328 @@ namespace AzFramework::AssetBenchmark
     }
 
 
+    // Upper limit on the number of assets BenchmarkLoadSyntheticAssetGraph generates, to catch typos in the parameters.
+    static constexpr size_t MaxSyntheticAssetCount = 100000;
+
+    struct SyntheticAssetNode
+    {
+        AZ::Data::AssetId m_assetId;
+        AZStd::vector<size_t> m_dependencies;
+    };
+
+    // The steps between two load stages that BenchmarkLoadSyntheticAssetGraph reports.
+    struct SyntheticAssetLoadStep
+    {
+        const char* m_name;
+        AZ::Data::AssetLoadStage m_from;
+        AZ::Data::AssetLoadStage m_to;
+    };
+
+    static constexpr SyntheticAssetLoadStep SyntheticAssetLoadSteps[] = {
+        { "StreamRead", AZ::Data::AssetLoadStage::Queued, AZ::Data::AssetLoadStage::StreamRead },
+        { "JobQueue", AZ::Data::AssetLoadStage::StreamRead, AZ::Data::AssetLoadStage::LoadStarted },
+        { "LoadAssetData", AZ::Data::AssetLoadStage::LoadStarted, AZ::Data::AssetLoadStage::DataLoaded },
+        { "DependencyWait", AZ::Data::AssetLoadStage::DataLoaded, AZ::Data::AssetLoadStage::PostLoad },
+        { "Notify", AZ::Data::AssetLoadStage::PostLoad, AZ::Data::AssetLoadStage::Ready },
+    };
+
+    // Recursively add an asset and its dependencies to the graph. The assets are added in pre-order,
+    // so dependencies always have a higher index than the assets that reference them.
+    static size_t AddSyntheticAssetNodes(
+        AZStd::vector<SyntheticAssetNode>& nodes, const AZ::Uuid& graphId, uint32_t depth, uint32_t dependenciesPerAsset)
+    {
+        const size_t index = nodes.size();
+        nodes.emplace_back();
+        nodes[index].m_assetId = AZ::Data::AssetId(graphId, aznumeric_cast<AZ::u32>(index + 1));
+
+        if (depth > 0)
+        {
+            for (uint32_t dependency = 0; dependency < dependenciesPerAsset; ++dependency)
+            {
+                const size_t dependencyIndex = AddSyntheticAssetNodes(nodes, graphId, depth - 1, dependenciesPerAsset);
+                nodes[index].m_dependencies.push_back(dependencyIndex);
+            }
+        }
+        return index;
+    }
+
+    // Write a BenchmarkAsset for the node to disk and register it with the asset catalog.
+    static bool GenerateSyntheticAsset(
+        const AZStd::vector<SyntheticAssetNode>& nodes, size_t index, uint64_t assetByteSize, const AZ::IO::FixedMaxPath& folder)
+    {
+        const SyntheticAssetNode& node = nodes[index];
+
+        AzFramework::BenchmarkAsset asset;
+        asset.m_bufferSize = assetByteSize;
+        asset.m_buffer.resize(assetByteSize);
+
+        // Fill the buffer with random data so that it's representative of asset data that doesn't compress well.
+        AZ::SimpleLcgRandom random(node.m_assetId.m_subId);
+        for (uint8_t& value : asset.m_buffer)
+        {
+            value = static_cast<uint8_t>(random.GetRandom());
+        }
+
+        for (size_t dependencyIndex : node.m_dependencies)
+        {
+            AZ::Data::Asset<AzFramework::BenchmarkAsset> dependentAsset(
+                nodes[dependencyIndex].m_assetId, azrtti_typeid<AzFramework::BenchmarkAsset>());
+            dependentAsset.SetAutoLoadBehavior(AZ::Data::AssetLoadBehavior::PreLoad);
+            asset.m_assetReferences.emplace_back(dependentAsset);
+        }
+
+        const AZ::IO::FixedMaxPath assetPath =
+            folder / AZ::IO::FixedMaxPathString::format("%u.%s", node.m_assetId.m_subId, s_benchmarkAssetExtension);
+        if (!AZ::Utils::SaveObjectToFile<AzFramework::BenchmarkAsset>(assetPath.c_str(), AZ::DataStream::ST_BINARY, &asset))
+        {
+            AZ_Error("AssetBenchmark", false, "Failed to write synthetic benchmark asset '%s'", assetPath.c_str());
+            return false;
+        }
+
+        AZ::Data::AssetInfo assetInfo;
+        assetInfo.m_assetType = azrtti_typeid<AzFramework::BenchmarkAsset>();
+        assetInfo.m_relativePath = assetPath.c_str();
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::RegisterAsset, node.m_assetId, assetInfo);
+        return true;
+    }
+
+    // Print the throughput, the average time spent in each load stage and the critical path through the graph.
+    static void ReportSyntheticAssetGraphResults(
+        const AZStd::vector<SyntheticAssetNode>& nodes, const AZ::Uuid& graphId, uint64_t assetByteSize)
+    {
+        [[maybe_unused]] const AZ::CVarFixedString logLabel = benchmarkLoadAssetLogLabel;
+
+        // Match the recorded timelines to the nodes in the graph. The sub id of each asset is its node index + 1.
+        AZStd::vector<AZ::Data::AssetLoadTimeline> timelines(nodes.size());
+        size_t recordedCount = 0;
+        for (AZ::Data::AssetLoadTimeline& timeline : AZ::Data::AssetManager::Instance().GetLoadTimelineRecorder().GetCompletedTimelines())
+        {
+            if (timeline.m_assetId.m_guid == graphId && timeline.m_succeeded && timeline.m_assetId.m_subId > 0 &&
+                timeline.m_assetId.m_subId <= nodes.size())
+            {
+                timelines[timeline.m_assetId.m_subId - 1] = AZStd::move(timeline);
+                ++recordedCount;
+            }
+        }
+
+        if (recordedCount == 0)
+        {
+            AZ_TracePrintf(logLabel.c_str(), "No load timelines were recorded for the synthetic asset graph.\n");
+            return;
+        }
+
+        constexpr size_t stepCount = AZ_ARRAY_SIZE(SyntheticAssetLoadSteps);
+        AZStd::array<AZStd::chrono::microseconds, stepCount> stepTotals{};
+        AZ::Data::AssetLoadTimeline::TimePoint firstQueued = AZ::Data::AssetLoadTimeline::TimePoint::max();
+        AZ::Data::AssetLoadTimeline::TimePoint lastReady = AZ::Data::AssetLoadTimeline::TimePoint::min();
+        for (const AZ::Data::AssetLoadTimeline& timeline : timelines)
+        {
+            if (!timeline.HasStage(AZ::Data::AssetLoadStage::Ready))
+            {
+                continue;
+            }
+
+            firstQueued = AZStd::min(firstQueued, timeline.m_stageTimes[static_cast<size_t>(AZ::Data::AssetLoadStage::Queued)]);
+            lastReady = AZStd::max(lastReady, timeline.m_stageTimes[static_cast<size_t>(AZ::Data::AssetLoadStage::Ready)]);
+            for (size_t step = 0; step < stepCount; ++step)
+            {
+                stepTotals[step] += timeline.GetDuration(SyntheticAssetLoadSteps[step].m_from, SyntheticAssetLoadSteps[step].m_to);
+            }
+        }
+
+        const auto loadTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(lastReady - firstQueued);
+        [[maybe_unused]] const double loadSeconds = AZStd::max<AZ::s64>(loadTime.count(), 1) / 1000000.0;
+        [[maybe_unused]] const double loadedMegabytes = static_cast<double>(recordedCount * assetByteSize) / (1024.0 * 1024.0);
+        AZ_TracePrintf(logLabel.c_str(), "Throughput: %zu assets in %lld us, %.1f assets/s, %.2f MB/s\n",
+            recordedCount, static_cast<long long>(loadTime.count()), recordedCount / loadSeconds, loadedMegabytes / loadSeconds);
+
+        for (size_t step = 0; step < stepCount; ++step)
+        {
+            AZ_TracePrintf(logLabel.c_str(), "Average %s: %lld us\n", SyntheticAssetLoadSteps[step].m_name,
+                static_cast<long long>(stepTotals[step].count() / aznumeric_cast<AZ::s64>(recordedCount)));
+        }
+
+        // The critical path follows, from the root, the dependency whose subtree finished loading last.
+        // Dependencies have higher indices than the assets that reference them, so walking backwards visits them first.
+        constexpr size_t noDependency = AZStd::numeric_limits<size_t>::max();
+        AZStd::vector<AZ::Data::AssetLoadTimeline::TimePoint> subtreeReady(nodes.size());
+        AZStd::vector<size_t> criticalDependency(nodes.size(), noDependency);
+        for (size_t index = nodes.size(); index-- > 0;)
+        {
+            subtreeReady[index] = timelines[index].m_stageTimes[static_cast<size_t>(AZ::Data::AssetLoadStage::Ready)];
+            for (size_t dependencyIndex : nodes[index].m_dependencies)
+            {
+                if (subtreeReady[dependencyIndex] > subtreeReady[index])
+                {
+                    subtreeReady[index] = subtreeReady[dependencyIndex];
+                    criticalDependency[index] = dependencyIndex;
+                }
+            }
+        }
+
+        if (!timelines[0].HasStage(AZ::Data::AssetLoadStage::Queued))
+        {
+            AZ_TracePrintf(logLabel.c_str(), "No load timeline was recorded for the root asset, skipping the critical path.\n");
+            return;
+        }
+
+        [[maybe_unused]] const auto criticalPathTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            subtreeReady[0] - timelines[0].m_stageTimes[static_cast<size_t>(AZ::Data::AssetLoadStage::Queued)]);
+        AZ_TracePrintf(logLabel.c_str(), "Critical path: %lld us\n", static_cast<long long>(criticalPathTime.count()));
+        for (size_t index = 0; index != noDependency; index = criticalDependency[index])
+        {
+            const AZ::Data::AssetLoadTimeline& timeline = timelines[index];
+            AZStd::string stepTimes;
+            for (const SyntheticAssetLoadStep& step : SyntheticAssetLoadSteps)
+            {
+                stepTimes += AZStd::string::format(
+                    " %s=%lld", step.m_name, static_cast<long long>(timeline.GetDuration(step.m_from, step.m_to).count()));
+            }
+            AZ_TracePrintf(logLabel.c_str(), "  %s: Total=%lld us%s\n", nodes[index].m_assetId.ToString<AZStd::string>().c_str(),
+                static_cast<long long>(timeline.GetTotalDuration().count()), stepTimes.c_str());
+        }
+    }
+
+    // Console command:  Generate a synthetic asset graph, load it and report the time spent in each load stage.
+    void BenchmarkLoadSyntheticAssetGraph(const AZ::ConsoleCommandContainer& parameters)
+    {
+        uint32_t depth = 2;
+        uint32_t dependenciesPerAsset = 5;
+        uint64_t assetByteSize = 1024;
+        if ((parameters.size() > 0 && !AZ::ConsoleTypeHelpers::StringToValue(depth, parameters[0])) ||
+            (parameters.size() > 1 && !AZ::ConsoleTypeHelpers::StringToValue(dependenciesPerAsset, parameters[1])) ||
+            (parameters.size() > 2 && !AZ::ConsoleTypeHelpers::StringToValue(assetByteSize, parameters[2])))
+        {
+            AZ_Error("AssetBenchmark", false, "Usage: BenchmarkLoadSyntheticAssetGraph [depth] [dependencies per asset] [bytes per asset]");
+            return;
+        }
+
+        size_t assetCount = 0;
+        size_t assetsAtDepth = 1;
+        for (uint32_t level = 0; level <= depth && assetCount <= MaxSyntheticAssetCount; ++level)
+        {
+            assetCount += assetsAtDepth;
+            assetsAtDepth *= dependenciesPerAsset;
+        }
+        if (assetCount > MaxSyntheticAssetCount)
+        {
+            AZ_Error("AssetBenchmark", false, "A graph of depth %u with %u dependencies per asset has more than %zu assets.",
+                depth, dependenciesPerAsset, MaxSyntheticAssetCount);
+            return;
+        }
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::IO::FixedMaxPath folder;
+        if (!fileIO || !fileIO->ResolvePath(folder, static_cast<AZ::CVarFixedString>(benchmarkSyntheticAssetGraphFolder).c_str()) ||
+            !fileIO->CreatePath(folder.c_str()))
+        {
+            AZ_Error("AssetBenchmark", false, "Failed to create the synthetic asset graph folder '%s'",
+                static_cast<AZ::CVarFixedString>(benchmarkSyntheticAssetGraphFolder).c_str());
+            return;
+        }
+
+        // Generate the assets on the calling thread, since registering them with the catalog sends catalog notifications.
+        const AZ::Uuid graphId = AZ::Uuid::CreateRandom();
+        AZStd::vector<SyntheticAssetNode> nodes;
+        nodes.reserve(assetCount);
+        AddSyntheticAssetNodes(nodes, graphId, depth, dependenciesPerAsset);
+
+        for (size_t index = 0; index < nodes.size(); ++index)
+        {
+            if (!GenerateSyntheticAsset(nodes, index, assetByteSize, folder))
+            {
+                for (size_t generatedIndex = 0; generatedIndex < index; ++generatedIndex)
+                {
+                    AZ::Data::AssetCatalogRequestBus::Broadcast(
+                        &AZ::Data::AssetCatalogRequestBus::Events::UnregisterAsset, nodes[generatedIndex].m_assetId);
+                }
+                fileIO->DestroyPath(folder.c_str());
+                return;
+            }
+        }
+
+        AZ_TracePrintf(static_cast<AZ::CVarFixedString>(benchmarkLoadAssetLogLabel).c_str(),
+            "Generated %zu synthetic assets of %llu bytes in '%s'\n", nodes.size(), static_cast<unsigned long long>(assetByteSize),
+            folder.c_str());
+
+        // Run the load on its own thread so that the main thread can continue ticking along.
+        AZStd::thread benchmarkThread([nodes = AZStd::move(nodes), graphId, assetByteSize, folder]()
+        {
+            AZ::Data::AssetLoadTimelineRecorder& recorder = AZ::Data::AssetManager::Instance().GetLoadTimelineRecorder();
+            const bool wasRecording = recorder.IsEnabled();
+            recorder.SetMaxCompletedTimelines(AZStd::max(AZ::Data::AssetLoadTimelineRecorder::DefaultMaxCompletedTimelines, nodes.size()));
+            recorder.SetEnabled(true);
+
+            AZStd::unique_ptr<AZ::Debug::PerformanceCollector> performanceCollector;
+            if (benchmarkLoadAssetWritePerformanceLog)
+            {
+                performanceCollector = AZStd::make_unique<AZ::Debug::PerformanceCollector>(
+                    "AssetLoadBenchmark", AZ::Data::AssetLoadTimelineRecorder::GetMetricNames(), []([[maybe_unused]] AZ::u32 pendingBatchCount) {});
+                performanceCollector->UpdateDataLogType(AZ::Debug::PerformanceCollector::DataLogType::LogAllSamples);
+                performanceCollector->UpdateFrameCountPerCaptureBatch(1);
+                performanceCollector->UpdateWaitTimeBeforeEachBatch(AZStd::chrono::seconds(0));
+                performanceCollector->UpdateNumberOfCaptureBatches(1);
+
+                // Drop any timelines that completed before the benchmark, then start the capture.
+                recorder.ReportSamples(*performanceCollector);
+                performanceCollector->FrameTick();
+            }
+
+            AZStd::vector<AZ::Data::Asset<AZ::Data::AssetData>> requestedAssets;
+            requestedAssets.reserve(nodes.size());
+            for (const SyntheticAssetNode& node : nodes)
+            {
+                requestedAssets.emplace_back(AZ::Data::AssetManager::Instance().GetAsset(
+                    node.m_assetId, azrtti_typeid<AzFramework::BenchmarkAsset>(), AZ::Data::AssetLoadBehavior::Default));
+            }
+
+            const auto start = AZStd::chrono::steady_clock::now();
+            const AZStd::chrono::milliseconds maxWaitMs{ benchmarkLoadAssetTimeoutMs };
+            AZStd::chrono::milliseconds runMs{ 0 };
+            size_t pendingAssets = requestedAssets.size();
+            while (pendingAssets > 0 && runMs < maxWaitMs)
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(benchmarkLoadAssetPollMs));
+                pendingAssets = AZStd::count_if(requestedAssets.begin(), requestedAssets.end(),
+                    [](const AZ::Data::Asset<AZ::Data::AssetData>& asset)
+                    {
+                        return !asset.IsReady() && !asset.IsError();
+                    });
+                runMs = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - start);
+            }
+
+            if (pendingAssets > 0)
+            {
+                AZ_TracePrintf(static_cast<AZ::CVarFixedString>(benchmarkLoadAssetLogLabel).c_str(),
+                    "Request timed out, %zu of %zu synthetic assets didn't load.\n", pendingAssets, requestedAssets.size());
+            }
+
+            ReportSyntheticAssetGraphResults(nodes, graphId, assetByteSize);
+
+            if (performanceCollector)
+            {
+                // Completes the capture batch, which writes the samples to the performance log.
+                recorder.ReportSamples(*performanceCollector);
+                performanceCollector->FrameTick();
+            }
+
+            // Clean up the generated assets and restore the recorder.
+            requestedAssets.clear();
+            for (const SyntheticAssetNode& node : nodes)
+            {
+                AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::UnregisterAsset, node.m_assetId);
+            }
+            AZ::IO::FileIOBase::GetInstance()->DestroyPath(folder.c_str());
+
+            recorder.SetEnabled(wasRecording);
+            recorder.SetMaxCompletedTimelines(AZ::Data::AssetLoadTimelineRecorder::DefaultMaxCompletedTimelines);
+
+            AZ_TracePrintf(static_cast<AZ::CVarFixedString>(benchmarkLoadAssetLogLabel).c_str(), "Benchmark run complete.\n");
+        });
+        benchmarkThread.detach();
+    }
+
+
     // Normally, the commands above would be registered by AZ_CONSOLEFREEFUNC here.  They specifically have been moved from
     // here to AssetSystemComponent.cpp to circumvent dead code stripping.  If they appear here, then the only references
     // to code within this file is self-contained to the file.  The C++ standard (3.6.2, 3.7.1) only guarantees that
@@ -39,4 +39,10 @@ namespace AzFramework::AssetBenchmark
     //! @param parameters The set of console command parameters that were passed in
     void BenchmarkLoadAllAssetsSynchronous(const AZ::ConsoleCommandContainer& parameters);
 
+    //! Generate a synthetic graph of BenchmarkAssets, load it and report the time spent in each load stage,
+    //! along with the throughput and the critical path through the graph.
+    //! @param parameters The set of console command parameters that were passed in:
+    //!                   [depth] [dependencies per asset] [bytes per asset]
+    void BenchmarkLoadSyntheticAssetGraph(const AZ::ConsoleCommandContainer& parameters);
+
 }// namespace AzFramework::AssetBenchmark
@@ -0,0 +1,708 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Asset/BinaryAssetRegistry.h>
+#include <AzFramework/Asset/AssetRegistry.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace AzFramework
+{
+    namespace BinaryAssetRegistryFormat
+    {
+        // Every section starts at a multiple of the largest alignment of the records, so they can be used in place.
+        static constexpr size_t SectionAlignment = 8;
+        static constexpr char Signature[8] = { 'O', '3', 'D', 'E', 'C', 'A', 'T', 'B' };
+        static constexpr AZ::u32 Version = 1;
+        // Saved in the byte order of the platform that wrote the catalog, so catalogs of another byte order are rejected.
+        static constexpr AZ::u32 ByteOrderMark = 0x01020304;
+
+        static constexpr AZ::u32 AssetHasInfo = 1 << 0;
+        static constexpr AZ::u32 AssetHasDependencies = 1 << 1;
+
+        static constexpr AZ::u32 EmptySlot = AZStd::numeric_limits<AZ::u32>::max();
+        static constexpr AZ::u32 MaxDisplacement = 1 << 16;
+
+        struct SectionInfo
+        {
+            AZ::u64 m_offset;
+            AZ::u64 m_count;
+        };
+
+        struct IndexInfo
+        {
+            SectionInfo m_displacements;
+            SectionInfo m_slots;
+        };
+
+        struct Header
+        {
+            char m_signature[8];
+            AZ::u32 m_version;
+            AZ::u32 m_byteOrderMark;
+            SectionInfo m_assets;
+            SectionInfo m_dependencies;
+            SectionInfo m_paths;
+            SectionInfo m_legacyToRealIds;
+            SectionInfo m_realToLegacyIds;
+            SectionInfo m_strings;
+            IndexInfo m_assetIndex;
+            IndexInfo m_pathIndex;
+            IndexInfo m_legacyIndex;
+        };
+
+        struct StoredAssetId
+        {
+            AZ::u8 m_guid[16];
+            AZ::u32 m_subId;
+        };
+
+        struct AssetRecord
+        {
+            AZ::u64 m_sizeBytes;
+            AZ::u8 m_assetType[16];
+            StoredAssetId m_assetId;
+            AZ::u32 m_pathOffset; //!< Offset of the relative path in the string pool.
+            AZ::u32 m_pathLength;
+            AZ::u32 m_firstDependency;
+            AZ::u32 m_dependencyCount;
+            AZ::u32 m_flags;
+        };
+
+        struct DependencyRecord
+        {
+            AZ::u64 m_flags;
+            StoredAssetId m_assetId;
+            AZ::u32 m_padding;
+        };
+
+        //! Entry of AssetRegistry's map from the hash of relative paths to asset ids.
+        struct PathRecord
+        {
+            AZ::u8 m_pathUuid[16];
+            StoredAssetId m_assetId;
+        };
+
+        struct AssetIdPairRecord
+        {
+            StoredAssetId m_first;
+            StoredAssetId m_second;
+        };
+
+        // The layout of the records is part of the format.
+        static_assert(sizeof(Header) == 16 + 6 * sizeof(SectionInfo) + 3 * sizeof(IndexInfo));
+        static_assert(sizeof(StoredAssetId) == 20);
+        static_assert(sizeof(AssetRecord) == 64);
+        static_assert(sizeof(DependencyRecord) == 32);
+        static_assert(sizeof(PathRecord) == 36);
+        static_assert(sizeof(AssetIdPairRecord) == 40);
+
+        static StoredAssetId StoreAssetId(const AZ::Data::AssetId& id)
+        {
+            StoredAssetId storedId{};
+            memcpy(storedId.m_guid, id.m_guid.begin(), sizeof(storedId.m_guid));
+            storedId.m_subId = id.m_subId;
+            return storedId;
+        }
+
+        static AZ::Data::AssetId LoadAssetId(const StoredAssetId& storedId)
+        {
+            AZ::Data::AssetId id;
+            memcpy(id.m_guid.begin(), storedId.m_guid, sizeof(storedId.m_guid));
+            id.m_subId = storedId.m_subId;
+            return id;
+        }
+
+        static AZ::Uuid LoadUuid(const AZ::u8 (&data)[16])
+        {
+            AZ::Uuid uuid;
+            memcpy(uuid.begin(), data, sizeof(data));
+            return uuid;
+        }
+
+        static bool IsSameAssetId(const StoredAssetId& lhs, const StoredAssetId& rhs)
+        {
+            return lhs.m_subId == rhs.m_subId && memcmp(lhs.m_guid, rhs.m_guid, sizeof(lhs.m_guid)) == 0;
+        }
+
+        static bool IsLessAssetId(const StoredAssetId& lhs, const StoredAssetId& rhs)
+        {
+            const int guidOrder = memcmp(lhs.m_guid, rhs.m_guid, sizeof(lhs.m_guid));
+            return guidOrder < 0 || (guidOrder == 0 && lhs.m_subId < rhs.m_subId);
+        }
+
+        // FNV-1a, which unlike AZStd::hash gives the same value on every platform, since the indexes are built by the tools.
+        static AZ::u64 HashBytes(const void* data, size_t size)
+        {
+            AZ::u64 hash = 14695981039346656037ull;
+            for (const AZ::u8* byte = static_cast<const AZ::u8*>(data); size > 0; ++byte, --size)
+            {
+                hash = (hash ^ *byte) * 1099511628211ull;
+            }
+            return hash;
+        }
+
+        static AZ::u64 HashAssetId(const StoredAssetId& storedId)
+        {
+            AZ::u8 key[sizeof(storedId.m_guid) + sizeof(storedId.m_subId)];
+            memcpy(key, storedId.m_guid, sizeof(storedId.m_guid));
+            memcpy(key + sizeof(storedId.m_guid), &storedId.m_subId, sizeof(storedId.m_subId));
+            return HashBytes(key, sizeof(key));
+        }
+
+        static size_t GetBucket(AZ::u64 keyHash, size_t bucketCount)
+        {
+            return aznumeric_cast<size_t>((keyHash >> 32) % bucketCount);
+        }
+
+        static size_t GetSlot(AZ::u64 keyHash, AZ::u32 displacement, size_t slotCount)
+        {
+            // splitmix64 finalizer, so that every displacement gives an unrelated slot.
+            AZ::u64 value = keyHash ^ (displacement * 0x9E3779B97F4A7C15ull);
+            value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+            value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+            value = value ^ (value >> 31);
+            return aznumeric_cast<size_t>(value % slotCount);
+        }
+
+        //! Builds a hash and displace index over the keys, which are spread over buckets by the upper half of their hash.
+        //! Buckets are placed from the largest to the smallest, each with the first displacement that sends all of its keys
+        //! to free slots. Looking up a key then only takes reading the displacement of its bucket and the slot it leads to.
+        //! @return False if the keys couldn't be placed, which only happens if keys have the same hash.
+        static bool BuildIndex(const AZStd::vector<AZ::u64>& keyHashes, AZStd::vector<AZ::u32>& displacements, AZStd::vector<AZ::u32>& slots)
+        {
+            const size_t keyCount = keyHashes.size();
+            if (keyCount >= EmptySlot)
+            {
+                return false;
+            }
+            const size_t slotCount = AZStd::max<size_t>(keyCount + keyCount / 4, 1);
+
+            // Start with an average of four keys per bucket, and use smaller buckets if that doesn't work out.
+            for (size_t keysPerBucket = 4; keysPerBucket > 0; keysPerBucket /= 2)
+            {
+                const size_t bucketCount = AZStd::max<size_t>(keyCount / keysPerBucket, 1);
+                AZStd::vector<AZStd::vector<AZ::u32>> buckets(bucketCount);
+                for (AZ::u32 key = 0; key < keyCount; ++key)
+                {
+                    buckets[GetBucket(keyHashes[key], bucketCount)].push_back(key);
+                }
+
+                AZStd::vector<AZ::u32> bucketOrder;
+                bucketOrder.reserve(bucketCount);
+                for (AZ::u32 bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+                {
+                    bucketOrder.push_back(bucketIndex);
+                }
+                AZStd::sort(bucketOrder.begin(), bucketOrder.end(),
+                    [&buckets](AZ::u32 lhs, AZ::u32 rhs)
+                    {
+                        return buckets[lhs].size() != buckets[rhs].size() ? buckets[lhs].size() > buckets[rhs].size() : lhs < rhs;
+                    });
+
+                displacements.assign(bucketCount, 0);
+                slots.assign(slotCount, EmptySlot);
+                AZStd::vector<size_t> bucketSlots;
+                bool isComplete = true;
+                for (AZ::u32 bucketIndex : bucketOrder)
+                {
+                    const AZStd::vector<AZ::u32>& bucket = buckets[bucketIndex];
+                    if (bucket.empty())
+                    {
+                        break;
+                    }
+
+                    bool isPlaced = false;
+                    for (AZ::u32 displacement = 0; displacement < MaxDisplacement && !isPlaced; ++displacement)
+                    {
+                        bucketSlots.clear();
+                        isPlaced = true;
+                        for (AZ::u32 key : bucket)
+                        {
+                            const size_t slot = GetSlot(keyHashes[key], displacement, slotCount);
+                            if (slots[slot] != EmptySlot || AZStd::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+                            {
+                                isPlaced = false;
+                                break;
+                            }
+                            bucketSlots.push_back(slot);
+                        }
+
+                        if (isPlaced)
+                        {
+                            displacements[bucketIndex] = displacement;
+                            for (size_t i = 0; i < bucket.size(); ++i)
+                            {
+                                slots[bucketSlots[i]] = bucket[i];
+                            }
+                        }
+                    }
+
+                    if (!isPlaced)
+                    {
+                        isComplete = false;
+                        break;
+                    }
+                }
+
+                if (isComplete)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<typename Record>
+        static bool GetSection(AZStd::span<const char> data, const SectionInfo& section, const Record*& records)
+        {
+            if (section.m_offset % SectionAlignment != 0 || section.m_offset > data.size() ||
+                section.m_count > (data.size() - section.m_offset) / sizeof(Record))
+            {
+                return false;
+            }
+            records = reinterpret_cast<const Record*>(data.data() + section.m_offset);
+            return true;
+        }
+    } // namespace BinaryAssetRegistryFormat
+
+    using namespace BinaryAssetRegistryFormat;
+
+    bool BinaryAssetRegistry::IsBinaryAssetRegistry(AZStd::span<const char> data)
+    {
+        return data.size() >= sizeof(Signature) && memcmp(data.data(), Signature, sizeof(Signature)) == 0;
+    }
+
+    bool BinaryAssetRegistry::Write(const AssetRegistry& registry, AZStd::vector<char>& output)
+    {
+        // There's a record for every asset with either an info or a dependency entry.
+        AZStd::vector<StoredAssetId> assetIds;
+        assetIds.reserve(registry.m_assetIdToInfo.size());
+        for (const auto& [assetId, assetInfo] : registry.m_assetIdToInfo)
+        {
+            assetIds.push_back(StoreAssetId(assetId));
+        }
+        for (const auto& [assetId, dependencies] : registry.m_assetDependencies)
+        {
+            if (registry.m_assetIdToInfo.find(assetId) == registry.m_assetIdToInfo.end())
+            {
+                assetIds.push_back(StoreAssetId(assetId));
+            }
+        }
+        AZStd::sort(assetIds.begin(), assetIds.end(), &IsLessAssetId);
+
+        AZStd::vector<AssetRecord> assets;
+        assets.reserve(assetIds.size());
+        AZStd::vector<DependencyRecord> dependencies;
+        AZStd::vector<char> strings;
+        AZStd::unordered_map<AZStd::string_view, AZ::u32> stringOffsets;
+        for (const StoredAssetId& storedId : assetIds)
+        {
+            const AZ::Data::AssetId assetId = LoadAssetId(storedId);
+            AssetRecord& record = assets.emplace_back(AssetRecord{});
+            record.m_assetId = storedId;
+
+            if (auto assetInfo = registry.m_assetIdToInfo.find(assetId); assetInfo != registry.m_assetIdToInfo.end())
+            {
+                const AZStd::string_view relativePath = assetInfo->second.m_relativePath;
+                auto stringOffset = stringOffsets.find(relativePath);
+                if (stringOffset == stringOffsets.end())
+                {
+                    stringOffset = stringOffsets.emplace(relativePath, aznumeric_cast<AZ::u32>(strings.size())).first;
+                    strings.insert(strings.end(), relativePath.begin(), relativePath.end());
+                }
+
+                record.m_flags |= AssetHasInfo;
+                record.m_sizeBytes = assetInfo->second.m_sizeBytes;
+                memcpy(record.m_assetType, assetInfo->second.m_assetType.begin(), sizeof(record.m_assetType));
+                record.m_pathOffset = stringOffset->second;
+                record.m_pathLength = aznumeric_cast<AZ::u32>(relativePath.size());
+            }
+
+            if (auto assetDependencies = registry.m_assetDependencies.find(assetId); assetDependencies != registry.m_assetDependencies.end())
+            {
+                record.m_flags |= AssetHasDependencies;
+                record.m_firstDependency = aznumeric_cast<AZ::u32>(dependencies.size());
+                record.m_dependencyCount = aznumeric_cast<AZ::u32>(assetDependencies->second.size());
+                for (const AZ::Data::ProductDependency& dependency : assetDependencies->second)
+                {
+                    DependencyRecord& dependencyRecord = dependencies.emplace_back(DependencyRecord{});
+                    dependencyRecord.m_flags = dependency.m_flags.to_ullong();
+                    dependencyRecord.m_assetId = StoreAssetId(dependency.m_assetId);
+                }
+            }
+
+            // Offsets and counts are stored in 32 bits.
+            if (strings.size() >= EmptySlot || dependencies.size() >= EmptySlot)
+            {
+                return false;
+            }
+        }
+
+        AZStd::vector<PathRecord> paths;
+        paths.reserve(registry.m_assetPathToId.size());
+        for (const auto& [pathUuid, assetId] : registry.m_assetPathToId)
+        {
+            PathRecord& record = paths.emplace_back(PathRecord{});
+            memcpy(record.m_pathUuid, pathUuid.begin(), sizeof(record.m_pathUuid));
+            record.m_assetId = StoreAssetId(assetId);
+        }
+        AZStd::sort(paths.begin(), paths.end(),
+            [](const PathRecord& lhs, const PathRecord& rhs)
+            {
+                return memcmp(lhs.m_pathUuid, rhs.m_pathUuid, sizeof(lhs.m_pathUuid)) < 0;
+            });
+
+        auto SortPairs = [](AZStd::vector<AssetIdPairRecord>& pairs)
+        {
+            AZStd::sort(pairs.begin(), pairs.end(),
+                [](const AssetIdPairRecord& lhs, const AssetIdPairRecord& rhs)
+                {
+                    return IsLessAssetId(lhs.m_first, rhs.m_first) ||
+                        (IsSameAssetId(lhs.m_first, rhs.m_first) && IsLessAssetId(lhs.m_second, rhs.m_second));
+                });
+        };
+        AZStd::vector<AssetIdPairRecord> legacyToRealIds;
+        legacyToRealIds.reserve(registry.m_legacyAssetIdToRealAssetId.size());
+        for (const auto& [legacyId, realId] : registry.m_legacyAssetIdToRealAssetId)
+        {
+            legacyToRealIds.push_back({ StoreAssetId(legacyId), StoreAssetId(realId) });
+        }
+        SortPairs(legacyToRealIds);
+        AZStd::vector<AssetIdPairRecord> realToLegacyIds;
+        realToLegacyIds.reserve(registry.m_realAssetIdToLegacyAssetIdMap.size());
+        for (const auto& [realId, legacyId] : registry.m_realAssetIdToLegacyAssetIdMap)
+        {
+            realToLegacyIds.push_back({ StoreAssetId(realId), StoreAssetId(legacyId) });
+        }
+        SortPairs(realToLegacyIds);
+
+        AZStd::vector<AZ::u64> keyHashes;
+        AZStd::vector<AZ::u32> assetDisplacements, assetSlots, pathDisplacements, pathSlots, legacyDisplacements, legacySlots;
+        keyHashes.reserve(assets.size());
+        for (const AssetRecord& record : assets)
+        {
+            keyHashes.push_back(HashAssetId(record.m_assetId));
+        }
+        if (!BuildIndex(keyHashes, assetDisplacements, assetSlots))
+        {
+            return false;
+        }
+        keyHashes.clear();
+        for (const PathRecord& record : paths)
+        {
+            keyHashes.push_back(HashBytes(record.m_pathUuid, sizeof(record.m_pathUuid)));
+        }
+        if (!BuildIndex(keyHashes, pathDisplacements, pathSlots))
+        {
+            return false;
+        }
+        keyHashes.clear();
+        for (const AssetIdPairRecord& record : legacyToRealIds)
+        {
+            keyHashes.push_back(HashAssetId(record.m_first));
+        }
+        if (!BuildIndex(keyHashes, legacyDisplacements, legacySlots))
+        {
+            return false;
+        }
+
+        Header header{};
+        memcpy(header.m_signature, Signature, sizeof(Signature));
+        header.m_version = Version;
+        header.m_byteOrderMark = ByteOrderMark;
+
+        size_t size = sizeof(Header);
+        auto AddSection = [&size](const auto& records, SectionInfo& section)
+        {
+            size = AZ::SizeAlignUp(size, SectionAlignment);
+            section.m_offset = size;
+            section.m_count = records.size();
+            size += records.size() * sizeof(records[0]);
+        };
+        AddSection(assets, header.m_assets);
+        AddSection(dependencies, header.m_dependencies);
+        AddSection(paths, header.m_paths);
+        AddSection(legacyToRealIds, header.m_legacyToRealIds);
+        AddSection(realToLegacyIds, header.m_realToLegacyIds);
+        AddSection(assetDisplacements, header.m_assetIndex.m_displacements);
+        AddSection(assetSlots, header.m_assetIndex.m_slots);
+        AddSection(pathDisplacements, header.m_pathIndex.m_displacements);
+        AddSection(pathSlots, header.m_pathIndex.m_slots);
+        AddSection(legacyDisplacements, header.m_legacyIndex.m_displacements);
+        AddSection(legacySlots, header.m_legacyIndex.m_slots);
+        AddSection(strings, header.m_strings);
+
+        output.clear();
+        output.resize(size, 0);
+        memcpy(output.data(), &header, sizeof(header));
+        auto CopySection = [&output](const auto& records, const SectionInfo& section)
+        {
+            if (!records.empty())
+            {
+                memcpy(output.data() + section.m_offset, records.data(), records.size() * sizeof(records[0]));
+            }
+        };
+        CopySection(assets, header.m_assets);
+        CopySection(dependencies, header.m_dependencies);
+        CopySection(paths, header.m_paths);
+        CopySection(legacyToRealIds, header.m_legacyToRealIds);
+        CopySection(realToLegacyIds, header.m_realToLegacyIds);
+        CopySection(assetDisplacements, header.m_assetIndex.m_displacements);
+        CopySection(assetSlots, header.m_assetIndex.m_slots);
+        CopySection(pathDisplacements, header.m_pathIndex.m_displacements);
+        CopySection(pathSlots, header.m_pathIndex.m_slots);
+        CopySection(legacyDisplacements, header.m_legacyIndex.m_displacements);
+        CopySection(legacySlots, header.m_legacyIndex.m_slots);
+        CopySection(strings, header.m_strings);
+        return true;
+    }
+
+    AZStd::unique_ptr<BinaryAssetRegistry> BinaryAssetRegistry::Create(AZStd::vector<char>&& data)
+    {
+        AZStd::unique_ptr<BinaryAssetRegistry> registry(aznew BinaryAssetRegistry());
+        registry->m_buffer = AZStd::move(data);
+        if (!registry->Attach(registry->m_buffer))
+        {
+            return {};
+        }
+        return registry;
+    }
+
+    bool BinaryAssetRegistry::Read(AZStd::span<const char> data, AssetRegistry& registry)
+    {
+        BinaryAssetRegistry view;
+        if (reinterpret_cast<uintptr_t>(data.data()) % SectionAlignment != 0)
+        {
+            // The records can only be used in place from aligned memory.
+            view.m_buffer.assign(data.begin(), data.end());
+            data = view.m_buffer;
+        }
+        if (!view.Attach(data))
+        {
+            return false;
+        }
+        view.CopyTo(registry);
+        return true;
+    }
+
+    bool BinaryAssetRegistry::Attach(AZStd::span<const char> data)
+    {
+        if (data.size() < sizeof(Header) || !IsBinaryAssetRegistry(data) ||
+            reinterpret_cast<uintptr_t>(data.data()) % SectionAlignment != 0)
+        {
+            return false;
+        }
+
+        Header header;
+        memcpy(&header, data.data(), sizeof(header));
+        if (header.m_byteOrderMark != ByteOrderMark)
+        {
+            AZ_Warning("AssetCatalog", false, "Binary asset catalog was saved on a platform of another byte order.");
+            return false;
+        }
+        if (header.m_version != Version)
+        {
+            AZ_Warning("AssetCatalog", false, "Binary asset catalog version %u is not supported, expected version %u.", header.m_version, Version);
+            return false;
+        }
+
+        const char* strings = nullptr;
+        if (!GetSection(data, header.m_assets, m_assets) ||
+            !GetSection(data, header.m_dependencies, m_dependencies) ||
+            !GetSection(data, header.m_paths, m_paths) ||
+            !GetSection(data, header.m_legacyToRealIds, m_legacyToRealIds) ||
+            !GetSection(data, header.m_realToLegacyIds, m_realToLegacyIds) ||
+            !GetSection(data, header.m_strings, strings))
+        {
+            return false;
+        }
+        m_assetCount = aznumeric_cast<size_t>(header.m_assets.m_count);
+        m_dependencyCount = aznumeric_cast<size_t>(header.m_dependencies.m_count);
+        m_pathCount = aznumeric_cast<size_t>(header.m_paths.m_count);
+        m_legacyToRealIdCount = aznumeric_cast<size_t>(header.m_legacyToRealIds.m_count);
+        m_realToLegacyIdCount = aznumeric_cast<size_t>(header.m_realToLegacyIds.m_count);
+        m_strings = AZStd::span<const char>(strings, aznumeric_cast<size_t>(header.m_strings.m_count));
+
+        if (!AttachIndex(data, header.m_assetIndex, m_assetCount, m_assetIndex) ||
+            !AttachIndex(data, header.m_pathIndex, m_pathCount, m_pathIndex) ||
+            !AttachIndex(data, header.m_legacyIndex, m_legacyToRealIdCount, m_legacyIndex))
+        {
+            return false;
+        }
+
+        // Checking the ranges once here saves checking them on every lookup.
+        m_assetInfoCount = 0;
+        for (const AssetRecord& record : AZStd::span<const AssetRecord>(m_assets, m_assetCount))
+        {
+            if (AZ::u64(record.m_pathOffset) + record.m_pathLength > m_strings.size() ||
+                AZ::u64(record.m_firstDependency) + record.m_dependencyCount > m_dependencyCount)
+            {
+                return false;
+            }
+            if (record.m_flags & AssetHasInfo)
+            {
+                ++m_assetInfoCount;
+            }
+        }
+        return true;
+    }
+
+    bool BinaryAssetRegistry::AttachIndex(AZStd::span<const char> data, const IndexInfo& indexInfo, size_t recordCount, Index& index)
+    {
+        const AZ::u32* displacements = nullptr;
+        const AZ::u32* slots = nullptr;
+        if (indexInfo.m_displacements.m_count == 0 || indexInfo.m_slots.m_count == 0 ||
+            !GetSection(data, indexInfo.m_displacements, displacements) || !GetSection(data, indexInfo.m_slots, slots))
+        {
+            return false;
+        }
+        index.m_displacements = AZStd::span<const AZ::u32>(displacements, aznumeric_cast<size_t>(indexInfo.m_displacements.m_count));
+        index.m_slots = AZStd::span<const AZ::u32>(slots, aznumeric_cast<size_t>(indexInfo.m_slots.m_count));
+
+        return AZStd::all_of(index.m_slots.begin(), index.m_slots.end(),
+            [recordCount](AZ::u32 slot)
+            {
+                return slot == EmptySlot || slot < recordCount;
+            });
+    }
+
+    AZ::u32 BinaryAssetRegistry::FindInIndex(const Index& index, AZ::u64 keyHash)
+    {
+        const AZ::u32 displacement = index.m_displacements[GetBucket(keyHash, index.m_displacements.size())];
+        return index.m_slots[GetSlot(keyHash, displacement, index.m_slots.size())];
+    }
+
+    auto BinaryAssetRegistry::FindAssetRecord(const AZ::Data::AssetId& id) const -> const AssetRecord*
+    {
+        const StoredAssetId storedId = StoreAssetId(id);
+        const AZ::u32 recordIndex = FindInIndex(m_assetIndex, HashAssetId(storedId));
+        if (recordIndex < m_assetCount && IsSameAssetId(m_assets[recordIndex].m_assetId, storedId))
+        {
+            return &m_assets[recordIndex];
+        }
+        return nullptr;
+    }
+
+    AZ::Data::AssetInfo BinaryAssetRegistry::ToAssetInfo(const AssetRecord& record) const
+    {
+        AZ::Data::AssetInfo assetInfo;
+        assetInfo.m_assetId = LoadAssetId(record.m_assetId);
+        assetInfo.m_assetType = LoadUuid(record.m_assetType);
+        assetInfo.m_sizeBytes = record.m_sizeBytes;
+        assetInfo.m_relativePath.assign(m_strings.data() + record.m_pathOffset, record.m_pathLength);
+        return assetInfo;
+    }
+
+    size_t BinaryAssetRegistry::GetAssetCount() const
+    {
+        return m_assetInfoCount;
+    }
+
+    bool BinaryAssetRegistry::GetAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const
+    {
+        const AssetRecord* record = FindAssetRecord(id);
+        if (!record || !(record->m_flags & AssetHasInfo))
+        {
+            return false;
+        }
+        assetInfo = ToAssetInfo(*record);
+        return true;
+    }
+
+    AZ::Data::AssetId BinaryAssetRegistry::GetAssetIdByPath(AZStd::string_view assetPath) const
+    {
+        if (assetPath.empty())
+        {
+            // the empty path has no asset ID.
+            return AZ::Data::AssetId();
+        }
+
+        const AZ::Uuid pathUuid = AssetRegistryInternal::CreateUUIDForName(assetPath);
+        const AZ::u32 recordIndex = FindInIndex(m_pathIndex, HashBytes(pathUuid.begin(), pathUuid.size()));
+        if (recordIndex < m_pathCount && LoadUuid(m_paths[recordIndex].m_pathUuid) == pathUuid)
+        {
+            return LoadAssetId(m_paths[recordIndex].m_assetId);
+        }
+        return AZ::Data::AssetId();
+    }
+
+    AZ::Data::AssetId BinaryAssetRegistry::GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const
+    {
+        const StoredAssetId storedId = StoreAssetId(legacyAssetId);
+        const AZ::u32 recordIndex = FindInIndex(m_legacyIndex, HashAssetId(storedId));
+        if (recordIndex < m_legacyToRealIdCount && IsSameAssetId(m_legacyToRealIds[recordIndex].m_first, storedId))
+        {
+            return LoadAssetId(m_legacyToRealIds[recordIndex].m_second);
+        }
+        return AZ::Data::AssetId();
+    }
+
+    bool BinaryAssetRegistry::GetAssetDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const
+    {
+        const AssetRecord* record = FindAssetRecord(id);
+        if (!record || !(record->m_flags & AssetHasDependencies))
+        {
+            return false;
+        }
+
+        dependencies.clear();
+        dependencies.reserve(record->m_dependencyCount);
+        for (const DependencyRecord& dependency : AZStd::span<const DependencyRecord>(m_dependencies + record->m_firstDependency, record->m_dependencyCount))
+        {
+            dependencies.emplace_back(LoadAssetId(dependency.m_assetId), AZStd::bitset<64>(dependency.m_flags));
+        }
+        return true;
+    }
+
+    void BinaryAssetRegistry::EnumerateAssets(const AZStd::function<void(const AZ::Data::AssetInfo&)>& callback) const
+    {
+        for (const AssetRecord& record : AZStd::span<const AssetRecord>(m_assets, m_assetCount))
+        {
+            if (record.m_flags & AssetHasInfo)
+            {
+                callback(ToAssetInfo(record));
+            }
+        }
+    }
+
+    void BinaryAssetRegistry::CopyTo(AssetRegistry& registry) const
+    {
+        registry.m_assetIdToInfo.reserve(registry.m_assetIdToInfo.size() + m_assetInfoCount);
+        for (const AssetRecord& record : AZStd::span<const AssetRecord>(m_assets, m_assetCount))
+        {
+            const AZ::Data::AssetId assetId = LoadAssetId(record.m_assetId);
+            if (record.m_flags & AssetHasInfo)
+            {
+                registry.m_assetIdToInfo[assetId] = ToAssetInfo(record);
+            }
+            if (record.m_flags & AssetHasDependencies)
+            {
+                GetAssetDependencies(assetId, registry.m_assetDependencies[assetId]);
+            }
+        }
+
+        registry.m_assetPathToId.reserve(registry.m_assetPathToId.size() + m_pathCount);
+        for (const PathRecord& record : AZStd::span<const PathRecord>(m_paths, m_pathCount))
+        {
+            registry.m_assetPathToId[LoadUuid(record.m_pathUuid)] = LoadAssetId(record.m_assetId);
+        }
+        for (const AssetIdPairRecord& record : AZStd::span<const AssetIdPairRecord>(m_legacyToRealIds, m_legacyToRealIdCount))
+        {
+            registry.m_legacyAssetIdToRealAssetId[LoadAssetId(record.m_first)] = LoadAssetId(record.m_second);
+        }
+        for (const AssetIdPairRecord& record : AZStd::span<const AssetIdPairRecord>(m_realToLegacyIds, m_realToLegacyIdCount))
+        {
+            registry.m_realAssetIdToLegacyAssetIdMap.emplace(LoadAssetId(record.m_first), LoadAssetId(record.m_second));
+        }
+    }
+} // namespace AzFramework
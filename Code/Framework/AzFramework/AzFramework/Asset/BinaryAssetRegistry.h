@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AzFramework
+{
+    class AssetRegistry;
+
+    //! Records of the binary catalog format, which are defined along with the format.
+    namespace BinaryAssetRegistryFormat
+    {
+        struct AssetRecord;
+        struct DependencyRecord;
+        struct PathRecord;
+        struct AssetIdPairRecord;
+        struct IndexInfo;
+    } // namespace BinaryAssetRegistryFormat
+
+    //! Read only view of an asset registry saved in the binary catalog format.
+    //! Loading a catalog saved through the ObjectStream deserializes every entry into the hash maps and strings of an
+    //! AssetRegistry, which costs time and memory in proportion to the size of the project in every process that loads it.
+    //! The binary format instead stores the registry as arrays of fixed size records sorted by asset id, a pool for the
+    //! relative paths, and minimal perfect hash indexes over the asset ids, the relative paths and the legacy asset ids,
+    //! so lookups are served straight from the buffer the file was read into.
+    class BinaryAssetRegistry
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BinaryAssetRegistry, AZ::SystemAllocator);
+
+        //! Settings registry key which, when true, makes the Asset Processor and the asset bundler save their catalogs
+        //! in the binary format instead of through the ObjectStream.
+        static constexpr const char* SaveBinaryCatalogKey = "/O3DE/AzFramework/AssetCatalog/SaveBinaryCatalog";
+
+        //! Returns true if the data starts with the signature of the binary catalog format.
+        static bool IsBinaryAssetRegistry(AZStd::span<const char> data);
+
+        //! Saves a registry in the binary catalog format.
+        //! @param registry The registry to save.
+        //! @param output Buffer the catalog is written to, replacing its content.
+        //! @return False if the registry can't be stored in the binary format, in which case it has to be saved through the ObjectStream.
+        static bool Write(const AssetRegistry& registry, AZStd::vector<char>& output);
+
+        //! Creates a view over a catalog in the binary format.
+        //! @param data The catalog, which is owned by the view from then on.
+        //! @return The view, or null if the data isn't a valid binary catalog.
+        static AZStd::unique_ptr<BinaryAssetRegistry> Create(AZStd::vector<char>&& data);
+
+        //! Copies a catalog in the binary format into a registry, for catalogs that are modified after they're loaded.
+        //! @return False if the data isn't a valid binary catalog.
+        static bool Read(AZStd::span<const char> data, AssetRegistry& registry);
+
+        //! Returns the number of assets the registry holds the info of.
+        size_t GetAssetCount() const;
+
+        //! Retrieves the info of an asset.
+        //! @return False if the registry doesn't hold the info of the asset.
+        bool GetAssetInfo(const AZ::Data::AssetId& id, AZ::Data::AssetInfo& assetInfo) const;
+
+        //! Behaves as AssetRegistry::GetAssetIdByPath.
+        AZ::Data::AssetId GetAssetIdByPath(AZStd::string_view assetPath) const;
+
+        //! Behaves as AssetRegistry::GetAssetIdByLegacyAssetId.
+        AZ::Data::AssetId GetAssetIdByLegacyAssetId(const AZ::Data::AssetId& legacyAssetId) const;
+
+        //! Retrieves the product dependencies of an asset.
+        //! @return False if the registry has no dependency entry for the asset, which isn't the same as an empty one.
+        bool GetAssetDependencies(const AZ::Data::AssetId& id, AZStd::vector<AZ::Data::ProductDependency>& dependencies) const;
+
+        //! Invokes the callback with the info of every asset in the registry, in asset id order.
+        void EnumerateAssets(const AZStd::function<void(const AZ::Data::AssetInfo&)>& callback) const;
+
+        //! Adds the whole content of the view to a registry, which makes it modifiable.
+        void CopyTo(AssetRegistry& registry) const;
+
+    private:
+        using AssetRecord = BinaryAssetRegistryFormat::AssetRecord;
+        using DependencyRecord = BinaryAssetRegistryFormat::DependencyRecord;
+        using PathRecord = BinaryAssetRegistryFormat::PathRecord;
+        using AssetIdPairRecord = BinaryAssetRegistryFormat::AssetIdPairRecord;
+        using IndexInfo = BinaryAssetRegistryFormat::IndexInfo;
+
+        //! Hash and displace index mapping each key to the index of its record.
+        struct Index
+        {
+            AZStd::span<const AZ::u32> m_displacements; //!< Displacement of each bucket of keys.
+            AZStd::span<const AZ::u32> m_slots; //!< Record index stored in each slot.
+        };
+
+        BinaryAssetRegistry() = default;
+
+        //! Points the view at a catalog, validating every section and record of it.
+        bool Attach(AZStd::span<const char> data);
+        static bool AttachIndex(AZStd::span<const char> data, const IndexInfo& indexInfo, size_t recordCount, Index& index);
+
+        //! Looks up the record index a key was stored at in a perfect hash index.
+        //! @return The record index, which has to be compared against the key, or an out of range index if the key isn't stored.
+        static AZ::u32 FindInIndex(const Index& index, AZ::u64 keyHash);
+        const AssetRecord* FindAssetRecord(const AZ::Data::AssetId& id) const;
+        AZ::Data::AssetInfo ToAssetInfo(const AssetRecord& record) const;
+
+        AZStd::vector<char> m_buffer; //!< The catalog when it's owned by the view.
+        // The records are only declared here, so the sections are kept as pointers and counts rather than spans.
+        const AssetRecord* m_assets = nullptr;
+        size_t m_assetCount = 0;
+        const DependencyRecord* m_dependencies = nullptr;
+        size_t m_dependencyCount = 0;
+        const PathRecord* m_paths = nullptr;
+        size_t m_pathCount = 0;
+        const AssetIdPairRecord* m_legacyToRealIds = nullptr;
+        size_t m_legacyToRealIdCount = 0;
+        const AssetIdPairRecord* m_realToLegacyIds = nullptr;
+        size_t m_realToLegacyIdCount = 0;
+        AZStd::span<const char> m_strings;
+        Index m_assetIndex;
+        Index m_pathIndex;
+        Index m_legacyIndex;
+        size_t m_assetInfoCount = 0;
+    };
+} // namespace AzFramework
@@ -31,6 +31,7 @@ namespace AzPhysics
                 ->Field("EnableActiveActors", &SceneConfiguration::m_enableActiveActors)
                 ->Field("EnablePcm", &SceneConfiguration::m_enablePcm)
                 ->Field("BounceThresholdVelocity", &SceneConfiguration::m_bounceThresholdVelocity)
+                ->Field("FixedTimestep", &SceneConfiguration::m_fixedTimestep)
                 ;
 
             if (auto* editContext = serializeContext->GetEditContext())
@@ -57,6 +58,11 @@ namespace AzPhysics
                     ->DataElement(AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_bounceThresholdVelocity,
                         "Bounce Threshold Velocity", "Relative velocity below which colliding objects will not bounce")
                     ->Attribute(AZ::Edit::Attributes::Min, 0.01f)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &SceneConfiguration::m_fixedTimestep,
+                        "Fixed Time Step (sec)", "Fixed time step in seconds for this scene. 0 uses the fixed time step of the physics system")
+                    ->Attribute(AZ::Edit::Attributes::Min, 0.0f)
+                    ->Attribute(AZ::Edit::Attributes::Decimals, 8)
+                    ->Attribute(AZ::Edit::Attributes::DisplayDecimals, 8)
                     ;
             }
         }
@@ -79,6 +85,7 @@ namespace AzPhysics
             && m_customUserData == other.m_customUserData
             && m_maxCcdPasses == other.m_maxCcdPasses
             && AZ::IsClose(m_bounceThresholdVelocity, other.m_bounceThresholdVelocity)
+            && AZ::IsClose(m_fixedTimestep, other.m_fixedTimestep)
             && m_gravity.IsClose(other.m_gravity)
             && m_worldBounds == other.m_worldBounds
         ;
@@ -47,6 +47,10 @@ namespace AzPhysics
         bool m_kinematicStaticFiltering = true; //!< Enables filtering between kinematic/static objects.
         float m_bounceThresholdVelocity = 2.0f; //!< Relative velocity below which colliding objects will not bounce.
 
+        //! Fixed timestep in seconds used to step this scene, with its own time accumulator.
+        //! A value of 0 steps the scene with the system configuration's fixed timestep, see SystemConfiguration::m_fixedTimestep.
+        float m_fixedTimestep = 0.0f;
+
         bool operator==(const SceneConfiguration& other) const;
         bool operator!=(const SceneConfiguration& other) const;
 
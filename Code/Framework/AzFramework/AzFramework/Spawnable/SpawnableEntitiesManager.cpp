@@ -8,6 +8,7 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -44,12 +45,35 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            settingsRegistry->Get(m_parallelSpawnThreshold, "/O3DE/AzFramework/Spawnables/ParallelSpawnThreshold");
+
+            AZ::u64 activationBudget = 0;
+            settingsRegistry->Get(activationBudget, "/O3DE/AzFramework/Spawnables/ActivationBudgetMicroseconds");
+            m_activationBudget = AZStd::chrono::microseconds(activationBudget);
         }
     }
 
     SpawnableEntitiesManager::~SpawnableEntitiesManager()
     {
         AZ_Assert(m_totalTickets == 0, "Shutting down the Spawnable Entities Manager while there are still active Spawnable Tickets.");
+
+        // Requests that are still cloning on task graph workers wait for their clones on destruction, which has to happen while the
+        // entity cloner they use is still around.
+        m_highPriorityQueue.m_delayed.clear();
+        m_regularPriorityQueue.m_delayed.clear();
+    }
+
+    SpawnableEntitiesManager::SpawnAllEntitiesProgress::~SpawnAllEntitiesProgress()
+    {
+        if (m_isCloning)
+        {
+            m_cloneEvent.Wait();
+        }
+        for (AZ::Entity* clone : m_clones)
+        {
+            delete clone;
+        }
     }
 
     void SpawnableEntitiesManager::SpawnAllEntities(EntitySpawnTicket& ticket, SpawnAllEntitiesOptionalArgs optionalArgs)
@@ -212,6 +236,8 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessQueue(CommandQueuePriority priority) -> CommandQueueStatus
     {
+        m_activationDeadline = AZStd::chrono::steady_clock::now() + m_activationBudget;
+
         CommandQueueStatus result = CommandQueueStatus::NoCommandsLeft;
         if ((priority & CommandQueuePriority::High) == CommandQueuePriority::High)
         {
@@ -345,11 +371,7 @@ namespace AzFramework
     AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityPrototype,
         EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
     {
-        // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
-        constexpr bool allowDuplicateIds = false;
-
-        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-            &entityPrototype, prototypeToCloneMap, &serializeContext);
+        return m_entityCloner.CloneEntity(entityPrototype, prototypeToCloneMap, serializeContext);
     }
 
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
@@ -446,6 +468,11 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessRequest(SpawnAllEntitiesCommand& request) -> CommandResult
     {
+        if (request.m_progress)
+        {
+            return ContinueSpawnAllEntities(request);
+        }
+
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
@@ -478,6 +505,14 @@ namespace AzFramework
                 auto aliasEnd = aliases.end();
                 if (aliasIt == aliasEnd)
                 {
+                    if (ShouldCloneInParallel(entitiesToSpawnSize))
+                    {
+                        // The request continues once the clones have been made, see ContinueSpawnAllEntities.
+                        CloneEntitiesInParallel(entitiesToSpawn, ticket, request);
+                        request.m_progress->m_firstNewEntity = spawnedEntitiesInitialCount;
+                        return CommandResult::Requeue;
+                    }
+
                     for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                     {
                         // If this entity has previously been spawned, give it a new id in the reference map
@@ -529,35 +564,156 @@ namespace AzFramework
                 // a new set are not added so it no longer holds exactly the number of entities.
                 ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
 
-                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount;
-                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
                 // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
                 if (request.m_preInsertionCallback)
                 {
-                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
-                }
-
-                // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
-                {
-                    AZ::Entity* clone = (*it);
-                    clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    request.m_preInsertionCallback(
+                        request.m_ticketId,
+                        SpawnableEntityContainerView(spawnedEntities.begin() + spawnedEntitiesInitialCount, spawnedEntities.end()));
                 }
 
-                // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
-                if (request.m_completionCallback)
+                size_t nextEntityToAdd = spawnedEntitiesInitialCount;
+                if (!AddSpawnedEntitiesToGameContext(request, nextEntityToAdd))
                 {
-                    request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+                    request.m_progress = AZStd::make_shared<SpawnAllEntitiesProgress>();
+                    request.m_progress->m_firstNewEntity = spawnedEntitiesInitialCount;
+                    request.m_progress->m_nextEntityToAdd = nextEntityToAdd;
+                    return CommandResult::Requeue;
                 }
 
-                ticket.m_currentRequestId++;
+                CompleteSpawnAllEntities(request, spawnedEntitiesInitialCount);
                 return CommandResult::Executed;
             }
         }
         return CommandResult::Requeue;
     }
 
+    auto SpawnableEntitiesManager::ContinueSpawnAllEntities(SpawnAllEntitiesCommand& request) -> CommandResult
+    {
+        Ticket& ticket = *request.m_ticket;
+        SpawnAllEntitiesProgress& progress = *request.m_progress;
+        if (progress.m_isCloning)
+        {
+            if (!progress.m_cloneEvent.IsSignaled())
+            {
+                return CommandResult::Requeue;
+            }
+            progress.m_isCloning = false;
+
+            // Hand the clones over to the ticket, from here on the request continues as if the entities were cloned on this thread.
+            uint32_t entityIndex = 0;
+            for (AZ::Entity* clone : progress.m_clones)
+            {
+                ticket.m_spawnedEntities.emplace_back(clone);
+                ticket.m_spawnedEntityIndices.push_back(entityIndex++);
+            }
+            progress.m_clones.clear();
+
+            ticket.m_loadAll = progress.m_firstNewEntity == 0;
+
+            if (request.m_preInsertionCallback)
+            {
+                request.m_preInsertionCallback(
+                    request.m_ticketId,
+                    SpawnableEntityContainerView(
+                        ticket.m_spawnedEntities.begin() + progress.m_firstNewEntity, ticket.m_spawnedEntities.end()));
+            }
+            progress.m_nextEntityToAdd = progress.m_firstNewEntity;
+        }
+
+        if (!AddSpawnedEntitiesToGameContext(request, progress.m_nextEntityToAdd))
+        {
+            return CommandResult::Requeue;
+        }
+
+        CompleteSpawnAllEntities(request, progress.m_firstNewEntity);
+        return CommandResult::Executed;
+    }
+
+    bool SpawnableEntitiesManager::AddSpawnedEntitiesToGameContext(SpawnAllEntitiesCommand& request, size_t& nextEntityToAdd)
+    {
+        AZStd::vector<AZ::Entity*>& spawnedEntities = request.m_ticket->m_spawnedEntities;
+        const bool isBudgeted = m_activationBudget.count() > 0;
+        while (nextEntityToAdd < spawnedEntities.size())
+        {
+            // Add to the game context, now the entities are active
+            AZ::Entity* clone = spawnedEntities[nextEntityToAdd++];
+            clone->SetEntitySpawnTicketId(request.m_ticketId);
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+
+            if (isBudgeted && AZStd::chrono::steady_clock::now() >= m_activationDeadline)
+            {
+                return nextEntityToAdd == spawnedEntities.size();
+            }
+        }
+        return true;
+    }
+
+    void SpawnableEntitiesManager::CompleteSpawnAllEntities(SpawnAllEntitiesCommand& request, size_t firstNewEntity)
+    {
+        Ticket& ticket = *request.m_ticket;
+
+        // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
+        if (request.m_completionCallback)
+        {
+            request.m_completionCallback(
+                request.m_ticketId,
+                SpawnableConstEntityContainerView(ticket.m_spawnedEntities.begin() + firstNewEntity, ticket.m_spawnedEntities.end()));
+        }
+
+        ticket.m_currentRequestId++;
+    }
+
+    bool SpawnableEntitiesManager::ShouldCloneInParallel(size_t entityCount) const
+    {
+        if (m_parallelSpawnThreshold == 0 || entityCount < m_parallelSpawnThreshold)
+        {
+            return false;
+        }
+        AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        return taskGraphActive && taskGraphActive->IsTaskGraphActive();
+    }
+
+    void SpawnableEntitiesManager::CloneEntitiesInParallel(
+        const Spawnable::EntityList& entities, Ticket& ticket, SpawnAllEntitiesCommand& request)
+    {
+        // Number of entities cloned by a single task, enough to amortize the cost of scheduling the task.
+        constexpr size_t CloneBatchSize = 64;
+
+        // Mark every entity as spawned up front, after which the id map is only read while the entities are cloned.
+        for (const auto& entity : entities)
+        {
+            RefreshEntityIdMapping(entity->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+        }
+
+        request.m_progress = AZStd::make_shared<SpawnAllEntitiesProgress>();
+        SpawnAllEntitiesProgress& progress = *request.m_progress;
+        progress.m_clones.resize(entities.size(), nullptr);
+
+        // The prototypes and the id map are owned by the ticket, which doesn't accept other requests until this one completes.
+        const EntityIdMap& idMap = ticket.m_entityIdReferenceMap;
+        AZ::SerializeContext* serializeContext = request.m_serializeContext;
+        AZ::Entity** clones = progress.m_clones.data();
+
+        AZ::TaskGraph taskGraph("Spawnable Entity Cloning");
+        for (size_t begin = 0; begin < entities.size(); begin += CloneBatchSize)
+        {
+            const size_t end = AZStd::min(begin + CloneBatchSize, entities.size());
+            taskGraph.AddTask(
+                AZ::TaskDescriptor{ "Clone Spawnable Entities", "Spawnables" },
+                [this, &entities, &idMap, serializeContext, clones, begin, end]()
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        clones[i] = m_entityCloner.CloneEntity(*entities[i], idMap, *serializeContext);
+                    }
+                });
+        }
+        taskGraph.Detach();
+        taskGraph.Submit(&progress.m_cloneEvent);
+        progress.m_isCloning = true;
+    }
+
     auto SpawnableEntitiesManager::ProcessRequest(SpawnEntitiesCommand& request) -> CommandResult
     {
         Ticket& ticket = *request.m_ticket;
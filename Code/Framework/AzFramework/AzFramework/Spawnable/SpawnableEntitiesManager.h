@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
@@ -16,7 +18,9 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+#include <AzFramework/Spawnable/SpawnableEntityCloner.h>
 
 namespace AZ
 {
@@ -126,6 +130,22 @@ namespace AzFramework
             bool m_loadAll{ true };
         };
 
+        //! State of a SpawnAllEntities request that takes more than one update to complete, either because its entities are cloned
+        //! on task graph workers or because adding them to the game context exceeded the activation budget.
+        struct SpawnAllEntitiesProgress final
+        {
+            AZ_CLASS_ALLOCATOR(SpawnAllEntitiesProgress, AZ::SystemAllocator);
+
+            ~SpawnAllEntitiesProgress();
+
+            //! Clones made on task graph workers, only handed over to the ticket once all of them are done.
+            AZStd::vector<AZ::Entity*> m_clones;
+            AZ::TaskGraphEvent m_cloneEvent{ "Spawnable entity cloning" };
+            size_t m_firstNewEntity{ 0 }; //!< Index in the ticket of the first entity spawned by the request.
+            size_t m_nextEntityToAdd{ 0 }; //!< Index in the ticket of the next entity to add to the game context.
+            bool m_isCloning{ false }; //!< True while the clones are being made on task graph workers.
+        };
+
         struct SpawnAllEntitiesCommand final
         {
             EntitySpawnCallback m_completionCallback;
@@ -134,6 +154,7 @@ namespace AzFramework
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            AZStd::shared_ptr<SpawnAllEntitiesProgress> m_progress; //!< Only set once the request has been requeued.
         };
         struct SpawnEntitiesCommand final
         {
@@ -279,6 +300,13 @@ namespace AzFramework
             AZ::SerializeContext& serializeContext);
         
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
+        CommandResult ContinueSpawnAllEntities(SpawnAllEntitiesCommand& request);
+        //! Adds the entities of a SpawnAllEntities request to the game context until the activation budget of the update runs out.
+        //! @return True if all the entities of the request have been added.
+        bool AddSpawnedEntitiesToGameContext(SpawnAllEntitiesCommand& request, size_t& nextEntityToAdd);
+        void CompleteSpawnAllEntities(SpawnAllEntitiesCommand& request, size_t firstNewEntity);
+        bool ShouldCloneInParallel(size_t entityCount) const;
+        void CloneEntitiesInParallel(const Spawnable::EntityList& entities, Ticket& ticket, SpawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(SpawnEntitiesCommand& request);
         CommandResult ProcessRequest(DespawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(DespawnEntityCommand& request);
@@ -306,11 +334,25 @@ namespace AzFramework
         Queue m_regularPriorityQueue;
 
         AZ::SerializeContext* m_defaultSerializeContext { nullptr };
+        //! Clones the prototype entities, reusing the entity id fix ups of their component types across spawns.
+        SpawnableEntityCloner m_entityCloner;
         //! The threshold used to determine if a request goes in the regular (if bigger than the value) or high priority queue (if smaller
         //! or equal to this value). The starting value of 64 is chosen as it's between default values SpawnablePriority_High and
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The minimum number of entities a SpawnAllEntities request needs to have for its entities to be cloned on task graph workers
+        //! instead of the thread processing the queue. Entities are always added to the game context from the thread processing the
+        //! queue. Parallel cloning is disabled when set to 0, which is the default, and otherwise requires the task graph to be active.
+        //! This value can be configured through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/ParallelSpawnThreshold".
+        AZ::u64 m_parallelSpawnThreshold { 0 };
+        //! The time spent adding spawned entities to the game context per queue update before the remaining entities are left for the
+        //! next update. At least one entity is added per request and update. No limit is applied when set to 0, which is the default.
+        //! This value can be configured through the Settings Registry under the key
+        //! "/O3DE/AzFramework/Spawnables/ActivationBudgetMicroseconds".
+        AZStd::chrono::microseconds m_activationBudget { 0 };
+        //! The time at which the activation budget of the current queue update runs out.
+        AZStd::chrono::steady_clock::time_point m_activationDeadline;
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/DynamicSerializableField.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzFramework/Spawnable/SpawnableEntityCloner.h>
+
+namespace AzFramework
+{
+    AZ::Entity* SpawnableEntityCloner::CloneEntity(
+        const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
+        constexpr bool allowDuplicateIds = false;
+
+        AZStd::vector<const ComponentClonePlan*> plans;
+        if (!GetComponentClonePlans(entityPrototype, plans, serializeContext))
+        {
+            return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                &entityPrototype, prototypeToCloneMap, &serializeContext);
+        }
+
+        AZ::Entity* clone = serializeContext.CloneObject(&entityPrototype);
+        if (!clone)
+        {
+            return nullptr;
+        }
+
+        auto cloneId = prototypeToCloneMap.find(entityPrototype.GetId());
+        if (cloneId == prototypeToCloneMap.end())
+        {
+            cloneId = prototypeToCloneMap.emplace(entityPrototype.GetId(), AZ::Entity::MakeId()).first;
+        }
+        clone->SetId(cloneId->second);
+
+        PatchEntityIds(*clone, plans, prototypeToCloneMap);
+        return clone;
+    }
+
+    AZ::Entity* SpawnableEntityCloner::CloneEntity(
+        const AZ::Entity& entityPrototype, const EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext)
+    {
+        auto cloneId = prototypeToCloneMap.find(entityPrototype.GetId());
+        AZ_Assert(cloneId != prototypeToCloneMap.end(), "No id has been generated for the clone of entity '%s'.",
+            entityPrototype.GetName().c_str());
+
+        AZStd::vector<const ComponentClonePlan*> plans;
+        const bool isPatchable = GetComponentClonePlans(entityPrototype, plans, serializeContext);
+
+        AZ::Entity* clone = serializeContext.CloneObject(&entityPrototype);
+        if (!clone)
+        {
+            return nullptr;
+        }
+
+        if (isPatchable)
+        {
+            clone->SetId(cloneId->second);
+            PatchEntityIds(*clone, plans, prototypeToCloneMap);
+        }
+        else
+        {
+            // Unlike the remapper's clone function, this only looks up ids, so the map is never written to.
+            AZ::IdUtils::Remapper<AZ::EntityId>::RemapIdsAndIdRefs(
+                clone,
+                [&prototypeToCloneMap](const AZ::EntityId& originalId) -> AZ::EntityId
+                {
+                    auto mappedId = prototypeToCloneMap.find(originalId);
+                    return mappedId != prototypeToCloneMap.end() ? mappedId->second : originalId;
+                },
+                &serializeContext);
+        }
+        return clone;
+    }
+
+    bool SpawnableEntityCloner::GetComponentClonePlans(
+        const AZ::Entity& entity, AZStd::vector<const ComponentClonePlan*>& plans, AZ::SerializeContext& serializeContext)
+    {
+        const AZ::Entity::ComponentArrayType& components = entity.GetComponents();
+        plans.reserve(components.size());
+        for (const AZ::Component* component : components)
+        {
+            const ComponentClonePlan& plan = GetComponentClonePlan(azrtti_typeid(component), serializeContext);
+            if (!plan.m_isPatchable)
+            {
+                return false;
+            }
+            plans.push_back(&plan);
+        }
+        return true;
+    }
+
+    void SpawnableEntityCloner::PatchEntityIds(
+        AZ::Entity& clone, const AZStd::vector<const ComponentClonePlan*>& plans, const EntityIdMap& prototypeToCloneMap)
+    {
+        const AZ::Entity::ComponentArrayType& clonedComponents = clone.GetComponents();
+        AZ_Assert(clonedComponents.size() == plans.size(), "Cloned entity '%s' doesn't have the components of its prototype.",
+            clone.GetName().c_str());
+        for (size_t i = 0; i < clonedComponents.size(); ++i)
+        {
+            AZ::Component* component = clonedComponents[i];
+            // The offsets are relative to the most derived type, which may not start at the same address as its AZ::Component base.
+            char* componentAddress = reinterpret_cast<char*>(component->RTTI_AddressOf(azrtti_typeid(component)));
+            for (size_t offset : plans[i]->m_entityIdOffsets)
+            {
+                AZ::EntityId& entityId = *reinterpret_cast<AZ::EntityId*>(componentAddress + offset);
+                if (auto mappedId = prototypeToCloneMap.find(entityId); mappedId != prototypeToCloneMap.end())
+                {
+                    entityId = mappedId->second;
+                }
+            }
+        }
+    }
+
+    auto SpawnableEntityCloner::GetComponentClonePlan(const AZ::TypeId& componentType, AZ::SerializeContext& serializeContext)
+        -> const ComponentClonePlan&
+    {
+        static const ComponentClonePlan UnpatchablePlan;
+
+        {
+            AZStd::shared_lock lock(m_planMutex);
+            if (m_planSerializeContext == &serializeContext)
+            {
+                if (auto it = m_componentClonePlans.find(componentType); it != m_componentClonePlans.end())
+                {
+                    return it->second;
+                }
+            }
+        }
+
+        AZStd::scoped_lock lock(m_planMutex);
+        if (m_planSerializeContext == nullptr)
+        {
+            m_planSerializeContext = &serializeContext;
+        }
+        else if (m_planSerializeContext != &serializeContext)
+        {
+            // Plans are only kept for the first serialize context, which is the application's one unless a request overrides it.
+            return UnpatchablePlan;
+        }
+
+        auto it = m_componentClonePlans.find(componentType);
+        if (it == m_componentClonePlans.end())
+        {
+            it = m_componentClonePlans.emplace(componentType, BuildComponentClonePlan(componentType, serializeContext)).first;
+        }
+        return it->second;
+    }
+
+    auto SpawnableEntityCloner::BuildComponentClonePlan(const AZ::TypeId& componentType, AZ::SerializeContext& serializeContext)
+        -> ComponentClonePlan
+    {
+        ComponentClonePlan plan;
+        if (const AZ::SerializeContext::ClassData* classData = serializeContext.FindClassData(componentType))
+        {
+            plan.m_isPatchable = GatherEntityIdOffsets(*classData, 0, plan, serializeContext);
+        }
+        if (!plan.m_isPatchable)
+        {
+            plan.m_entityIdOffsets.clear();
+        }
+        return plan;
+    }
+
+    bool SpawnableEntityCloner::GatherEntityIdOffsets(
+        const AZ::SerializeContext::ClassData& classData, size_t classOffset, ComponentClonePlan& plan, AZ::SerializeContext& serializeContext)
+    {
+        // The remapper signals the write events of every class it enumerates, which may have side effects.
+        if (classData.m_eventHandler || classData.m_typeId == azrtti_typeid<AZ::DynamicSerializableField>())
+        {
+            return false;
+        }
+
+        if (classData.m_container)
+        {
+            // Elements live in storage owned by the container, so they can't be reached from a fixed offset.
+            bool isAffected = false;
+            classData.m_container->EnumTypes(
+                [this, &isAffected, &serializeContext](const AZ::Uuid& elementTypeId, const AZ::SerializeContext::ClassElement*)
+                {
+                    isAffected = IsAffectedByRemapping(elementTypeId, serializeContext);
+                    return !isAffected;
+                });
+            return !isAffected;
+        }
+
+        for (const AZ::SerializeContext::ClassElement& element : classData.m_elements)
+        {
+            if (element.m_flags & AZ::SerializeContext::ClassElement::FLG_DYNAMIC_FIELD)
+            {
+                return false;
+            }
+
+            if (element.m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER)
+            {
+                // The pointer may point to a derived type, which can store anything.
+                if (element.m_azRtti || IsAffectedByRemapping(element.m_typeId, serializeContext))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            if (element.m_typeId == azrtti_typeid<AZ::EntityId>())
+            {
+                // Ids with a generator are replaced by new ids instead of being looked up, which the plan doesn't cover.
+                if (element.FindAttribute(AZ::Edit::Attributes::IdGeneratorFunction))
+                {
+                    return false;
+                }
+                plan.m_entityIdOffsets.push_back(classOffset + element.m_offset);
+                continue;
+            }
+
+            const AZ::SerializeContext::ClassData* elementClassData = element.m_genericClassInfo
+                ? element.m_genericClassInfo->GetClassData()
+                : serializeContext.FindClassData(element.m_typeId, &classData, element.m_nameCrc);
+            if (elementClassData && !GatherEntityIdOffsets(*elementClassData, classOffset + element.m_offset, plan, serializeContext))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool SpawnableEntityCloner::IsAffectedByRemapping(const AZ::TypeId& typeId, AZ::SerializeContext& serializeContext)
+    {
+        if (typeId == azrtti_typeid<AZ::EntityId>() || typeId == azrtti_typeid<AZ::DynamicSerializableField>())
+        {
+            return true;
+        }
+
+        if (auto it = m_typesAffectedByRemapping.find(typeId); it != m_typesAffectedByRemapping.end())
+        {
+            return it->second;
+        }
+        // Assume the worst while the type is being inspected, in case it contains itself.
+        m_typesAffectedByRemapping[typeId] = true;
+
+        bool isAffected = false;
+        if (const AZ::SerializeContext::ClassData* classData = serializeContext.FindClassData(typeId))
+        {
+            if (classData->m_eventHandler)
+            {
+                isAffected = true;
+            }
+            else if (classData->m_container)
+            {
+                classData->m_container->EnumTypes(
+                    [this, &isAffected, &serializeContext](const AZ::Uuid& elementTypeId, const AZ::SerializeContext::ClassElement*)
+                    {
+                        isAffected = IsAffectedByRemapping(elementTypeId, serializeContext);
+                        return !isAffected;
+                    });
+            }
+            else
+            {
+                for (const AZ::SerializeContext::ClassElement& element : classData->m_elements)
+                {
+                    if ((element.m_flags & AZ::SerializeContext::ClassElement::FLG_DYNAMIC_FIELD) ||
+                        ((element.m_flags & AZ::SerializeContext::ClassElement::FLG_POINTER) && element.m_azRtti) ||
+                        IsAffectedByRemapping(element.m_typeId, serializeContext))
+                    {
+                        isAffected = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        m_typesAffectedByRemapping[typeId] = isAffected;
+        return isAffected;
+    }
+} // namespace AzFramework
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfoSimple.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AZ
+{
+    class Entity;
+}
+
+namespace AzFramework
+{
+    //! Clones spawnable entities and remaps their entity ids, with a clone plan built once per component type.
+    //! Cloning through AZ::IdUtils::Remapper enumerates the reflected data of every clone twice after copying it, once to assign
+    //! the new entity id and once to fix up the references to other entities. The clone plan of a component type instead lists
+    //! the offsets at which the type stores entity ids, so the references in a clone are fixed up without enumerating it.
+    //! Entities with a component that may store entity ids out of reach of a fixed offset, such as in containers or behind
+    //! pointers, or that relies on serialize events when it's written to, are cloned through the remapper instead.
+    class SpawnableEntityCloner
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableEntityCloner, AZ::SystemAllocator);
+
+        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+
+        //! Clones an entity, assigning it a new id and remapping its references to other entities.
+        //! Behaves as AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs.
+        //! This function is thread safe.
+        //! @param entityPrototype The entity to clone.
+        //! @param prototypeToCloneMap Map of prototype ids to clone ids. The id of the clone is taken from the map if the prototype
+        //!        id is already mapped, otherwise a new id is generated and added to the map.
+        //! @param serializeContext The serialize context the entity and its components are reflected to.
+        //! @return The cloned entity.
+        AZ::Entity* CloneEntity(const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+
+        //! Clones an entity with a map that already holds the id of its clone, without modifying the map.
+        //! This allows the entities of a batch to be cloned concurrently with the same map, once the ids of all the clones in the
+        //! batch have been generated. Entity ids that aren't in the map are left unchanged, including ids that would be replaced with
+        //! a generated id when cloning with a modifiable map.
+        //! This function is thread safe.
+        //! @param entityPrototype The entity to clone.
+        //! @param prototypeToCloneMap Map of prototype ids to clone ids, which has to contain the id of the entity prototype.
+        //! @param serializeContext The serialize context the entity and its components are reflected to.
+        //! @return The cloned entity.
+        AZ::Entity* CloneEntity(
+            const AZ::Entity& entityPrototype, const EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+
+    private:
+        struct ComponentClonePlan
+        {
+            AZStd::vector<size_t> m_entityIdOffsets; //!< Offsets of the entity ids from the start of the component.
+            bool m_isPatchable = false; //!< False if the component has to be cloned through the remapper.
+        };
+
+        //! Collects the clone plans of the components of an entity.
+        //! @return False if any of the components has to be cloned through the remapper.
+        bool GetComponentClonePlans(
+            const AZ::Entity& entity, AZStd::vector<const ComponentClonePlan*>& plans, AZ::SerializeContext& serializeContext);
+        //! Remaps the entity ids of a clone listed by the clone plans of its components.
+        static void PatchEntityIds(
+            AZ::Entity& clone, const AZStd::vector<const ComponentClonePlan*>& plans, const EntityIdMap& prototypeToCloneMap);
+
+        const ComponentClonePlan& GetComponentClonePlan(const AZ::TypeId& componentType, AZ::SerializeContext& serializeContext);
+        ComponentClonePlan BuildComponentClonePlan(const AZ::TypeId& componentType, AZ::SerializeContext& serializeContext);
+
+        //! Adds the offsets of the entity ids stored in a class to the plan.
+        //! @return False if the class stores entity ids that can't be reached from a fixed offset.
+        bool GatherEntityIdOffsets(
+            const AZ::SerializeContext::ClassData& classData, size_t classOffset, ComponentClonePlan& plan, AZ::SerializeContext& serializeContext);
+
+        //! Returns true if instances of the type may hold entity ids or rely on serialize events when they're written to.
+        bool IsAffectedByRemapping(const AZ::TypeId& typeId, AZ::SerializeContext& serializeContext);
+
+        AZStd::unordered_map<AZ::TypeId, ComponentClonePlan> m_componentClonePlans;
+        AZStd::unordered_map<AZ::TypeId, bool> m_typesAffectedByRemapping; //!< Only accessed while building plans.
+        AZ::SerializeContext* m_planSerializeContext = nullptr; //!< The serialize context the plans were built from.
+        AZStd::shared_mutex m_planMutex;
+    };
+} // namespace AzFramework
@@ -56,6 +56,8 @@ set(FILES
     Asset/AssetProcessorMessages.h
     Asset/AssetRegistry.h
     Asset/AssetRegistry.cpp
+    Asset/BinaryAssetRegistry.h
+    Asset/BinaryAssetRegistry.cpp
     Asset/AssetSeedList.cpp
     Asset/AssetSeedList.h
     Asset/AssetSystemComponent.cpp
@@ -370,6 +372,8 @@ set(FILES
     Spawnable/SpawnableEntitiesInterface.cpp
     Spawnable/SpawnableEntitiesManager.h
     Spawnable/SpawnableEntitiesManager.cpp
+    Spawnable/SpawnableEntityCloner.h
+    Spawnable/SpawnableEntityCloner.cpp
     Spawnable/SpawnableMetaData.cpp
     Spawnable/SpawnableMetaData.h
     Spawnable/SpawnableMonitor.h
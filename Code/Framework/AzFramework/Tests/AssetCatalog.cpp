@@ -250,6 +250,43 @@ namespace UnitTest
         CheckAllDependencies(asset1, { asset2, asset3, asset5 });
     }
 
+    TEST_F(AssetCatalogDependencyTest, LoadBehaviorDependencyClosure_DependencyTree_DepthsAreDistancesFromAsset)
+    {
+        AZStd::shared_ptr<const AZ::Data::LoadBehaviorDependencyClosure> closure;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(closure, &AZ::Data::AssetCatalogRequestBus::Events::GetLoadBehaviorDependencyClosure, asset1);
+        ASSERT_NE(closure, nullptr);
+        ASSERT_EQ(closure->m_dependencies.size(), 4);
+        ASSERT_EQ(closure->m_depths.size(), closure->m_dependencies.size());
+
+        AZStd::unordered_map<AZ::Data::AssetId, AZ::u32> depths;
+        for (size_t i = 0; i < closure->m_dependencies.size(); ++i)
+        {
+            depths[closure->m_dependencies[i].m_assetId] = closure->m_depths[i];
+        }
+        EXPECT_EQ(depths[asset2], 1);
+        EXPECT_EQ(depths[asset3], 2);
+        EXPECT_EQ(depths[asset4], 2);
+        EXPECT_EQ(depths[asset5], 3);
+        EXPECT_EQ(closure->m_maxDepth, 3);
+    }
+
+    TEST_F(AssetCatalogDependencyTest, LoadBehaviorDependencyClosure_AssetUnregistered_ClosureIsRebuilt)
+    {
+        AZStd::shared_ptr<const AZ::Data::LoadBehaviorDependencyClosure> closure;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(closure, &AZ::Data::AssetCatalogRequestBus::Events::GetLoadBehaviorDependencyClosure, asset1);
+        ASSERT_NE(closure, nullptr);
+        EXPECT_EQ(closure->m_dependencies.size(), 4);
+
+        AZ::Data::AssetCatalogRequestBus::Broadcast(&AZ::Data::AssetCatalogRequestBus::Events::UnregisterAsset, asset4);
+
+        AZStd::shared_ptr<const AZ::Data::LoadBehaviorDependencyClosure> rebuiltClosure;
+        AZ::Data::AssetCatalogRequestBus::BroadcastResult(rebuiltClosure, &AZ::Data::AssetCatalogRequestBus::Events::GetLoadBehaviorDependencyClosure, asset1);
+        ASSERT_NE(rebuiltClosure, nullptr);
+        EXPECT_NE(rebuiltClosure, closure);
+        EXPECT_EQ(rebuiltClosure->m_dependencies.size(), 3);
+        EXPECT_FALSE(Search(rebuiltClosure->m_dependencies, asset4));
+    }
+
     class AssetCatalogDeltaTest :
         public LeakDetectionFixture
     {
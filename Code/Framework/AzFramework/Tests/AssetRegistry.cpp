@@ -8,6 +8,7 @@
 
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzFramework/Asset/AssetRegistry.h>
+#include <AzFramework/Asset/BinaryAssetRegistry.h>
 
 namespace UnitTest
 {
@@ -51,4 +52,128 @@ namespace UnitTest
 
         EXPECT_THAT(id2Set, ::testing::UnorderedElementsAre());
     }
+
+    TEST_F(AssetRegistry, BinaryAssetRegistry_WrittenRegistry_LookupsMatchRegistry)
+    {
+        using namespace ::testing;
+
+        AzFramework::AssetRegistry registry;
+
+        AZ::Data::AssetId assetId1("{4B8A9C6E-1D2F-4E3A-9B7C-5D6E7F8A9B0C}", 0);
+        AZ::Data::AssetId assetId2("{4B8A9C6E-1D2F-4E3A-9B7C-5D6E7F8A9B0C}", 1);
+        AZ::Data::AssetId assetId3("{0E1F2A3B-4C5D-4E6F-8A9B-0C1D2E3F4A5B}", 7);
+        AZ::Data::AssetId dependencyOnlyId("{9A8B7C6D-5E4F-4A3B-8C1D-0E9F8A7B6C5D}", 2);
+        AZ::Data::AssetId legacyId("{C94A4B65-5F1E-48C6-9704-42BB6CF61E11}", 3);
+        AZ::Data::AssetType assetType("{D6A8C2B4-3E5F-4A7B-9C1D-2E3F4A5B6C7D}");
+
+        AZ::Data::AssetInfo assetInfo1;
+        assetInfo1.m_assetId = assetId1;
+        assetInfo1.m_assetType = assetType;
+        assetInfo1.m_relativePath = "textures/rock.png.streamingimage";
+        assetInfo1.m_sizeBytes = 1024;
+        AZ::Data::AssetInfo assetInfo2 = assetInfo1;
+        assetInfo2.m_assetId = assetId2;
+        assetInfo2.m_relativePath = "textures/rock_normal.png.streamingimage";
+        AZ::Data::AssetInfo assetInfo3 = assetInfo1;
+        assetInfo3.m_assetId = assetId3;
+        assetInfo3.m_relativePath = "materials/rock.azmaterial";
+        assetInfo3.m_sizeBytes = 0;
+
+        registry.RegisterAsset(assetId1, assetInfo1);
+        registry.RegisterAsset(assetId2, assetInfo2);
+        registry.RegisterAsset(assetId3, assetInfo3);
+        registry.SetAssetDependencies(assetId3, { AZ::Data::ProductDependency(assetId1, 1), AZ::Data::ProductDependency(assetId2, 5) });
+        registry.SetAssetDependencies(assetId1, {});
+        registry.SetAssetDependencies(dependencyOnlyId, { AZ::Data::ProductDependency(assetId3, 0) });
+        registry.RegisterLegacyAssetMapping(legacyId, assetId3);
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(AzFramework::BinaryAssetRegistry::Write(registry, data));
+        EXPECT_TRUE(AzFramework::BinaryAssetRegistry::IsBinaryAssetRegistry(data));
+        AZStd::unique_ptr<AzFramework::BinaryAssetRegistry> binaryRegistry = AzFramework::BinaryAssetRegistry::Create(AZStd::move(data));
+        ASSERT_NE(binaryRegistry, nullptr);
+
+        EXPECT_EQ(binaryRegistry->GetAssetCount(), 3);
+        AZ::Data::AssetInfo assetInfo;
+        ASSERT_TRUE(binaryRegistry->GetAssetInfo(assetId2, assetInfo));
+        EXPECT_EQ(assetInfo.m_assetId, assetId2);
+        EXPECT_EQ(assetInfo.m_assetType, assetType);
+        EXPECT_EQ(assetInfo.m_relativePath, assetInfo2.m_relativePath);
+        EXPECT_EQ(assetInfo.m_sizeBytes, assetInfo2.m_sizeBytes);
+        EXPECT_FALSE(binaryRegistry->GetAssetInfo(dependencyOnlyId, assetInfo));
+        EXPECT_FALSE(binaryRegistry->GetAssetInfo(legacyId, assetInfo));
+
+        // Paths are looked up the same way as in the registry, regardless of case and slash direction.
+        EXPECT_EQ(binaryRegistry->GetAssetIdByPath("Materials\\Rock.azmaterial"), assetId3);
+        EXPECT_EQ(binaryRegistry->GetAssetIdByPath("materials/rock.azmaterial"), registry.GetAssetIdByPath("materials/rock.azmaterial"));
+        EXPECT_FALSE(binaryRegistry->GetAssetIdByPath("materials/missing.azmaterial").IsValid());
+        EXPECT_FALSE(binaryRegistry->GetAssetIdByPath("").IsValid());
+
+        EXPECT_EQ(binaryRegistry->GetAssetIdByLegacyAssetId(legacyId), assetId3);
+        EXPECT_FALSE(binaryRegistry->GetAssetIdByLegacyAssetId(assetId3).IsValid());
+
+        AZStd::vector<AZ::Data::ProductDependency> dependencies;
+        ASSERT_TRUE(binaryRegistry->GetAssetDependencies(assetId3, dependencies));
+        ASSERT_EQ(dependencies.size(), 2);
+        EXPECT_EQ(dependencies[0].m_assetId, assetId1);
+        EXPECT_EQ(dependencies[0].m_flags, AZStd::bitset<64>(1));
+        EXPECT_EQ(dependencies[1].m_assetId, assetId2);
+        EXPECT_EQ(dependencies[1].m_flags, AZStd::bitset<64>(5));
+        EXPECT_TRUE(binaryRegistry->GetAssetDependencies(assetId1, dependencies));
+        EXPECT_TRUE(dependencies.empty());
+        EXPECT_TRUE(binaryRegistry->GetAssetDependencies(dependencyOnlyId, dependencies));
+        EXPECT_FALSE(binaryRegistry->GetAssetDependencies(assetId2, dependencies));
+
+        AzFramework::AssetRegistry copiedRegistry;
+        binaryRegistry->CopyTo(copiedRegistry);
+        EXPECT_EQ(copiedRegistry.m_assetIdToInfo.size(), registry.m_assetIdToInfo.size());
+        EXPECT_EQ(copiedRegistry.m_assetDependencies.size(), registry.m_assetDependencies.size());
+        EXPECT_EQ(copiedRegistry.GetAssetIdByPath("textures/rock.png.streamingimage"), assetId1);
+        EXPECT_EQ(copiedRegistry.GetAssetIdByLegacyAssetId(legacyId), assetId3);
+        EXPECT_THAT(copiedRegistry.GetLegacyMappingSubsetFromRealIds({ assetId3 }), UnorderedElementsAre(Pair(legacyId, assetId3)));
+    }
+
+    TEST_F(AssetRegistry, BinaryAssetRegistry_ManyAssets_EveryAssetIsFound)
+    {
+        constexpr AZ::u32 AssetCount = 10000;
+
+        AzFramework::AssetRegistry registry;
+        AZStd::vector<AZ::Data::AssetId> assetIds;
+        for (AZ::u32 i = 0; i < AssetCount; ++i)
+        {
+            AZ::Data::AssetInfo assetInfo;
+            assetInfo.m_assetId = AZ::Data::AssetId(AZ::Uuid::CreateRandom(), i % 4);
+            assetInfo.m_relativePath = AZStd::string::format("assets/asset%u.bin", i);
+            registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+            assetIds.push_back(assetInfo.m_assetId);
+        }
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(AzFramework::BinaryAssetRegistry::Write(registry, data));
+        AZStd::unique_ptr<AzFramework::BinaryAssetRegistry> binaryRegistry = AzFramework::BinaryAssetRegistry::Create(AZStd::move(data));
+        ASSERT_NE(binaryRegistry, nullptr);
+
+        EXPECT_EQ(binaryRegistry->GetAssetCount(), AssetCount);
+        for (AZ::u32 i = 0; i < AssetCount; ++i)
+        {
+            AZ::Data::AssetInfo assetInfo;
+            ASSERT_TRUE(binaryRegistry->GetAssetInfo(assetIds[i], assetInfo));
+            EXPECT_EQ(assetInfo.m_relativePath, AZStd::string::format("assets/asset%u.bin", i));
+            EXPECT_EQ(binaryRegistry->GetAssetIdByPath(assetInfo.m_relativePath), assetIds[i]);
+        }
+    }
+
+    TEST_F(AssetRegistry, BinaryAssetRegistry_TruncatedData_IsRejected)
+    {
+        AzFramework::AssetRegistry registry;
+        AZ::Data::AssetInfo assetInfo;
+        assetInfo.m_assetId = AZ::Data::AssetId(AZ::Uuid::CreateRandom(), 0);
+        assetInfo.m_relativePath = "assets/asset.bin";
+        registry.RegisterAsset(assetInfo.m_assetId, assetInfo);
+
+        AZStd::vector<char> data;
+        ASSERT_TRUE(AzFramework::BinaryAssetRegistry::Write(registry, data));
+        data.resize(data.size() / 2);
+        EXPECT_EQ(AzFramework::BinaryAssetRegistry::Create(AZStd::move(data)), nullptr);
+    }
 }
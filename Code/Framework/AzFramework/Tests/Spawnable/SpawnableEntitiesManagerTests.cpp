@@ -6,14 +6,25 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Serialization/IdUtils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Spawnable/SpawnableAssetHandler.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
+#include <AzFramework/Spawnable/SpawnableEntityCloner.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzTest/AzTest.h>
 
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
 namespace UnitTest
 {
     class TestApplication : public AzFramework::Application
@@ -55,6 +66,33 @@ namespace UnitTest
         AZ::EntityId m_entityReference;
     };
 
+    // Test component that stores its entity references in a container, which can't be fixed up through a clone plan.
+    class ComponentWithEntityReferenceList : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithEntityReferenceList, "{5C0B8D4E-7E07-4F5B-A1C2-3E9A4B6F1D27}");
+
+        void Activate() override
+        {
+        }
+
+        void Deactivate() override
+        {
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithEntityReferenceList, AZ::Component>()
+                    ->Field("EntityReferences", &ComponentWithEntityReferenceList::m_entityReferences)
+                    ;
+            }
+        }
+
+        AZStd::vector<AZ::EntityId> m_entityReferences;
+    };
+
     class SourceSpawnableComponent : public AZ::Component
     {
     public:
@@ -108,11 +146,13 @@ namespace UnitTest
             LeakDetectionFixture::SetUp();
 
             m_application = new TestApplication();
+            ConfigureSettingsRegistry(*AZ::SettingsRegistry::Get());
             AZ::ComponentApplication::Descriptor descriptor;
             AZ::ComponentApplication::StartupParameters startupParameters;
             startupParameters.m_loadSettingsRegistry = false;
             m_application->Start(descriptor, startupParameters);
             m_application->RegisterComponentDescriptor(ComponentWithEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithEntityReferenceList::CreateDescriptor());
             m_application->RegisterComponentDescriptor(SourceSpawnableComponent::CreateDescriptor());
             m_application->RegisterComponentDescriptor(TargetSpawnableComponent::CreateDescriptor());
 
@@ -151,6 +191,11 @@ namespace UnitTest
             LeakDetectionFixture::TearDown();
         }
 
+        //! Called before the application starts, so settings read while the system components are created can be changed.
+        virtual void ConfigureSettingsRegistry([[maybe_unused]] AZ::SettingsRegistryInterface& settingsRegistry)
+        {
+        }
+
         void ProcessQueueTillEmtpy()
         {
             for (size_t i=0; i<1000; ++i) // Don't do this indefinitely to avoid deadlocking on a failing test.
@@ -581,6 +626,83 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ReferencesInContainerAndField_EntityIdsAreMappedCorrectly)
+    {
+        // The first entity stores its references in a container, so it's cloned through the remapper, while the others store a
+        // single reference in a field and are cloned through a clone plan. Both have to map the references to the same clones.
+        static constexpr size_t NumEntities = 3;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceLast);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        auto listComponent = entities[0]->CreateComponent<ComponentWithEntityReferenceList>();
+        listComponent->m_entityReferences = { entities[1]->GetId(), entities[2]->GetId(), AZ::EntityId(1) };
+
+        auto callback = [](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView spawned)
+        {
+            ASSERT_EQ(NumEntities, spawned.size());
+
+            auto component = spawned[0]->FindComponent<ComponentWithEntityReferenceList>();
+            ASSERT_NE(nullptr, component);
+            ASSERT_EQ(3u, component->m_entityReferences.size());
+            EXPECT_EQ(spawned[1]->GetId(), component->m_entityReferences[0]);
+            EXPECT_EQ(spawned[2]->GetId(), component->m_entityReferences[1]);
+            // References to entities outside of the spawnable are left untouched.
+            EXPECT_EQ(AZ::EntityId(1), component->m_entityReferences[2]);
+
+            for (size_t i = 0; i < NumEntities; ++i)
+            {
+                auto referenceComponent = spawned[i]->FindComponent<ComponentWithEntityReference>();
+                ASSERT_NE(nullptr, referenceComponent);
+                EXPECT_EQ(spawned[NumEntities - 1]->GetId(), referenceComponent->m_entityReference);
+            }
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnableEntityCloner_CloneWithPreGeneratedIds_EntityIdsAreMappedWithoutChangingTheMap)
+    {
+        // Cloning with a const map is what allows entities to be cloned on multiple threads, so both the clone plan and the remapper
+        // fallback have to map the ids while leaving the map untouched.
+        static constexpr size_t NumEntities = 3;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceLast);
+        AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+        auto listComponent = entities[0]->CreateComponent<ComponentWithEntityReferenceList>();
+        listComponent->m_entityReferences = { entities[1]->GetId(), AZ::EntityId(1) };
+
+        AzFramework::SpawnableEntityCloner::EntityIdMap idMap;
+        for (const auto& entity : entities)
+        {
+            idMap.emplace(entity->GetId(), AZ::Entity::MakeId());
+        }
+        const AzFramework::SpawnableEntityCloner::EntityIdMap& constIdMap = idMap;
+
+        AzFramework::SpawnableEntityCloner cloner;
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> clones;
+        for (const auto& entity : entities)
+        {
+            clones.emplace_back(cloner.CloneEntity(*entity, constIdMap, *m_application->GetSerializeContext()));
+            ASSERT_NE(nullptr, clones.back());
+            EXPECT_EQ(idMap[entity->GetId()], clones.back()->GetId());
+        }
+        EXPECT_EQ(NumEntities, idMap.size());
+
+        auto component = clones[0]->FindComponent<ComponentWithEntityReferenceList>();
+        ASSERT_NE(nullptr, component);
+        ASSERT_EQ(2u, component->m_entityReferences.size());
+        EXPECT_EQ(clones[1]->GetId(), component->m_entityReferences[0]);
+        EXPECT_EQ(AZ::EntityId(1), component->m_entityReferences[1]);
+        for (const auto& clone : clones)
+        {
+            auto referenceComponent = clone->FindComponent<ComponentWithEntityReference>();
+            ASSERT_NE(nullptr, referenceComponent);
+            EXPECT_EQ(clones[NumEntities - 1]->GetId(), referenceComponent->m_entityReference);
+        }
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllEntitiesReferenceOtherEntities_EntityIdsOnlyReferWithinASingleCall)
     {
         // This tests that entity id references get mapped correctly with multiple SpawnAllEntities calls.  Each call should only map
@@ -1543,4 +1665,388 @@ namespace UnitTest
 
         EXPECT_LT(defaultPriorityCallId, highPriorityCallId);
     }
+
+    //
+    // Parallel cloning and activation budget
+    //
+
+    class SpawnableEntitiesManagerParallelSpawnTest : public SpawnableEntitiesManagerTest
+    {
+    public:
+        static constexpr AZ::u64 ParallelSpawnThreshold = 8;
+        static constexpr AZ::u64 ActivationBudgetMicroseconds = 1;
+
+        void SetUp() override
+        {
+            SpawnableEntitiesManagerTest::SetUp();
+            ASSERT_NE(nullptr, AZ::Interface<AZ::TaskGraphActiveInterface>::Get());
+            SetTaskGraphActive(true);
+        }
+
+        void TearDown() override
+        {
+            SetTaskGraphActive(false);
+            SpawnableEntitiesManagerTest::TearDown();
+        }
+
+        void ConfigureSettingsRegistry(AZ::SettingsRegistryInterface& settingsRegistry) override
+        {
+            settingsRegistry.Set("/O3DE/AzFramework/Spawnables/ParallelSpawnThreshold", ParallelSpawnThreshold);
+            settingsRegistry.Set("/O3DE/AzFramework/Spawnables/ActivationBudgetMicroseconds", ActivationBudgetMicroseconds);
+        }
+
+        static void SetTaskGraphActive(bool active)
+        {
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("cl_activateTaskGraph", { active ? "true" : "false" });
+        }
+
+        bool ProcessQueue()
+        {
+            return m_manager->ProcessQueue(
+                       AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High |
+                       AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular) ==
+                AzFramework::SpawnableEntitiesManager::CommandQueueStatus::HasCommandsLeft;
+        }
+
+        //! Unlike ProcessQueueTillEmtpy, keeps processing the queue while entities are being cloned on task graph workers.
+        void ProcessQueueUntilEmpty()
+        {
+            const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(10);
+            while (ProcessQueue() && AZStd::chrono::steady_clock::now() < timeout)
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+
+        struct SpawnResult
+        {
+            AZStd::vector<AZ::EntityId> m_entityIds;
+            //! For every spawned entity, the position in m_entityIds of the entity its ComponentWithEntityReference points to.
+            AZStd::vector<size_t> m_referencedEntities;
+            //! For every spawned entity, the index of the entity in the spawnable it was cloned from.
+            AZStd::vector<size_t> m_spawnableIndices;
+            //! Whether the entities were cloned during the update that picked up the request.
+            bool m_clonedOnFirstUpdate{ false };
+        };
+
+        SpawnResult SpawnAllEntities(AzFramework::EntitySpawnTicket& ticket)
+        {
+            SpawnResult result;
+            bool cloned = false;
+
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_preInsertionCallback = [&cloned](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableEntityContainerView)
+            {
+                cloned = true;
+            };
+            optionalArgs.m_completionCallback =
+                [&result](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                for (const AZ::Entity* entity : entities)
+                {
+                    result.m_entityIds.push_back(entity->GetId());
+                }
+                for (const AZ::Entity* entity : entities)
+                {
+                    auto component = entity->FindComponent<ComponentWithEntityReference>();
+                    auto referenced = component
+                        ? AZStd::find(result.m_entityIds.begin(), result.m_entityIds.end(), component->m_entityReference)
+                        : result.m_entityIds.end();
+                    result.m_referencedEntities.push_back(static_cast<size_t>(AZStd::distance(result.m_entityIds.begin(), referenced)));
+                }
+            };
+            m_manager->SpawnAllEntities(ticket, AZStd::move(optionalArgs));
+            m_manager->ListIndicesAndEntities(
+                ticket,
+                [&result](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstIndexEntityContainerView entities)
+                {
+                    for (auto&& indexEntityPair : entities)
+                    {
+                        result.m_spawnableIndices.push_back(indexEntityPair.GetIndex());
+                    }
+                });
+
+            ProcessQueue();
+            result.m_clonedOnFirstUpdate = cloned;
+            ProcessQueueUntilEmpty();
+            return result;
+        }
+    };
+
+    TEST_F(SpawnableEntitiesManagerParallelSpawnTest, SpawnAllEntities_ParallelSpawnThresholdReached_MatchesSerialSpawn)
+    {
+        // Enough entities for the clones to be spread over multiple tasks.
+        static constexpr size_t NumEntities = 200;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+
+        SpawnResult parallelResult = SpawnAllEntities(*m_ticket);
+
+        SetTaskGraphActive(false);
+        AzFramework::EntitySpawnTicket serialTicket(*m_spawnableAsset);
+        SpawnResult serialResult = SpawnAllEntities(serialTicket);
+
+        // Cloning on the task graph takes at least one more update, while the serial path clones right away.
+        EXPECT_FALSE(parallelResult.m_clonedOnFirstUpdate);
+        EXPECT_TRUE(serialResult.m_clonedOnFirstUpdate);
+
+        ASSERT_EQ(NumEntities, parallelResult.m_entityIds.size());
+        ASSERT_EQ(NumEntities, serialResult.m_entityIds.size());
+        EXPECT_EQ(serialResult.m_spawnableIndices, parallelResult.m_spawnableIndices);
+        EXPECT_EQ(serialResult.m_referencedEntities, parallelResult.m_referencedEntities);
+
+        const AzFramework::Spawnable::EntityList& prototypes = m_spawnable->GetEntities();
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            // Every clone gets a new id, and references point to the clone of the referenced entity in the same batch.
+            EXPECT_NE(prototypes[i]->GetId(), parallelResult.m_entityIds[i]);
+            EXPECT_NE(serialResult.m_entityIds[i], parallelResult.m_entityIds[i]);
+            EXPECT_EQ((i + 1) % NumEntities, parallelResult.m_referencedEntities[i]);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerParallelSpawnTest, SpawnAllEntities_SpawnTwiceInParallel_SecondBatchGetsNewIds)
+    {
+        static constexpr size_t NumEntities = ParallelSpawnThreshold;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceFirst);
+
+        SpawnResult firstResult = SpawnAllEntities(*m_ticket);
+        SpawnResult secondResult = SpawnAllEntities(*m_ticket);
+
+        EXPECT_FALSE(firstResult.m_clonedOnFirstUpdate);
+        EXPECT_FALSE(secondResult.m_clonedOnFirstUpdate);
+
+        // The second batch is appended to the ticket, so its entities are listed after the first batch.
+        ASSERT_EQ(NumEntities, firstResult.m_entityIds.size());
+        ASSERT_EQ(NumEntities, secondResult.m_entityIds.size());
+        ASSERT_EQ(NumEntities * 2, secondResult.m_spawnableIndices.size());
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            EXPECT_EQ(i, secondResult.m_spawnableIndices[i]);
+            EXPECT_EQ(i, secondResult.m_spawnableIndices[NumEntities + i]);
+            EXPECT_NE(firstResult.m_entityIds[i], secondResult.m_entityIds[i]);
+            EXPECT_EQ(0u, firstResult.m_referencedEntities[i]);
+            EXPECT_EQ(0u, secondResult.m_referencedEntities[i]);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerParallelSpawnTest, SpawnAllEntities_BelowParallelSpawnThreshold_ClonedSerially)
+    {
+        static constexpr size_t NumEntities = ParallelSpawnThreshold - 1;
+        FillSpawnable(NumEntities);
+
+        SpawnResult result = SpawnAllEntities(*m_ticket);
+
+        EXPECT_TRUE(result.m_clonedOnFirstUpdate);
+        EXPECT_EQ(NumEntities, result.m_entityIds.size());
+    }
+
+    TEST_F(SpawnableEntitiesManagerParallelSpawnTest, SpawnAllEntities_ActivationBudgetExceeded_RemainingEntitiesAddedOnLaterUpdates)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+
+        AZStd::vector<AZ::Entity*> spawnedEntities;
+        size_t completedEntityCount = 0;
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_preInsertionCallback =
+            [&spawnedEntities](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableEntityContainerView entities)
+        {
+            spawnedEntities.assign(entities.begin(), entities.end());
+            // Use up the activation budget of this update, so only the first entity is added to the game context.
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        };
+        optionalArgs.m_completionCallback =
+            [&completedEntityCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            completedEntityCount = entities.size();
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+
+        EXPECT_TRUE(ProcessQueue());
+        ASSERT_EQ(NumEntities, spawnedEntities.size());
+        EXPECT_EQ(0u, completedEntityCount);
+        EXPECT_EQ(m_ticket->GetId(), spawnedEntities.front()->GetEntitySpawnTicketId());
+        EXPECT_NE(m_ticket->GetId(), spawnedEntities.back()->GetEntitySpawnTicketId());
+
+        ProcessQueueUntilEmpty();
+
+        EXPECT_EQ(NumEntities, completedEntityCount);
+        for (const AZ::Entity* entity : spawnedEntities)
+        {
+            EXPECT_EQ(m_ticket->GetId(), entity->GetEntitySpawnTicketId());
+        }
+    }
 } // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Spawns many instances of a prefab sized spawnable, such as projectiles or crowd members.
+    class SpawnableEntitiesManagerBenchmarkFixture : public benchmark::Fixture
+    {
+    public:
+        static constexpr size_t EntitiesPerSpawnable = 50;
+        static constexpr size_t InstancesToSpawn = 1000;
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        void internalSetUp()
+        {
+            m_application = new UnitTest::TestApplication();
+            AZ::ComponentApplication::Descriptor descriptor;
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application->Start(descriptor, startupParameters);
+            m_application->RegisterComponentDescriptor(UnitTest::ComponentWithEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(UnitTest::TargetSpawnableComponent::CreateDescriptor());
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            m_spawnable = aznew AzFramework::Spawnable(
+                AZ::Data::AssetId::CreateString("{0B6B8A5E-3F0A-4D4B-9E5C-2A1F7C3D8E91}:0"), AZ::Data::AssetData::AssetStatus::Ready);
+            m_spawnableAsset = new AZ::Data::Asset<AzFramework::Spawnable>(m_spawnable, AZ::Data::AssetLoadBehavior::Default);
+
+            // Every entity points to its parent and to the root of the spawnable.
+            AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+            entities.reserve(EntitiesPerSpawnable);
+            for (size_t i = 0; i < EntitiesPerSpawnable; ++i)
+            {
+                auto entity = AZStd::make_unique<AZ::Entity>();
+                entity->SetId(AZ::EntityId(UnitTest::SpawnableEntitiesManagerTest::EntityIdStartId + i));
+                const AZ::EntityId parentId = i == 0 ? AZ::EntityId() : entities[(i - 1) / 2]->GetId();
+                entity->AddComponent(aznew UnitTest::TargetSpawnableComponent(parentId));
+                auto rootReference = entity->CreateComponent<UnitTest::ComponentWithEntityReference>();
+                rootReference->m_entityReference = i == 0 ? entity->GetId() : entities[0]->GetId();
+                entities.push_back(AZStd::move(entity));
+            }
+
+            m_manager = azrtti_cast<AzFramework::SpawnableEntitiesManager*>(AzFramework::SpawnableEntitiesInterface::Get());
+            AZ::ComponentApplicationBus::BroadcastResult(m_serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
+        }
+
+        void internalTearDown()
+        {
+            ProcessQueueTillEmpty();
+
+            delete m_spawnableAsset;
+            m_spawnableAsset = nullptr;
+            m_spawnable = nullptr;
+
+            delete m_application;
+            m_application = nullptr;
+        }
+
+        void ProcessQueueTillEmpty()
+        {
+            while (m_manager->ProcessQueue(
+                       AzFramework::SpawnableEntitiesManager::CommandQueuePriority::High |
+                       AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular) !=
+                   AzFramework::SpawnableEntitiesManager::CommandQueueStatus::NoCommandsLeft)
+            {
+            }
+        }
+
+        template<typename CloneFunction>
+        void CloneAllInstances(benchmark::State& state, CloneFunction cloneFunction)
+        {
+            const AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+            AzFramework::SpawnableEntitiesManager::EntityIdMap idMap;
+            AZStd::vector<AZ::Entity*> clones;
+            clones.reserve(EntitiesPerSpawnable * InstancesToSpawn);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t instance = 0; instance < InstancesToSpawn; ++instance)
+                {
+                    idMap.clear();
+                    for (const auto& entity : entities)
+                    {
+                        idMap.emplace(entity->GetId(), AZ::Entity::MakeId());
+                    }
+                    for (const auto& entity : entities)
+                    {
+                        clones.push_back(cloneFunction(*entity, idMap));
+                    }
+                }
+
+                state.PauseTiming();
+                for (AZ::Entity* clone : clones)
+                {
+                    delete clone;
+                }
+                clones.clear();
+                state.ResumeTiming();
+            }
+            state.SetItemsProcessed(state.iterations() * EntitiesPerSpawnable * InstancesToSpawn);
+        }
+
+        UnitTest::TestApplication* m_application = nullptr;
+        AzFramework::Spawnable* m_spawnable = nullptr;
+        AZ::Data::Asset<AzFramework::Spawnable>* m_spawnableAsset = nullptr;
+        AzFramework::SpawnableEntitiesManager* m_manager = nullptr;
+        AZ::SerializeContext* m_serializeContext = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(SpawnableEntitiesManagerBenchmarkFixture, BM_SpawnAllEntities_Instances)(benchmark::State& state)
+    {
+        AZStd::vector<AZStd::unique_ptr<AzFramework::EntitySpawnTicket>> tickets;
+        tickets.reserve(InstancesToSpawn);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t instance = 0; instance < InstancesToSpawn; ++instance)
+            {
+                auto& ticket = tickets.emplace_back(AZStd::make_unique<AzFramework::EntitySpawnTicket>(*m_spawnableAsset));
+                m_manager->SpawnAllEntities(*ticket);
+            }
+            ProcessQueueTillEmpty();
+
+            state.PauseTiming();
+            tickets.clear();
+            ProcessQueueTillEmpty();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * EntitiesPerSpawnable * InstancesToSpawn);
+    }
+    BENCHMARK_REGISTER_F(SpawnableEntitiesManagerBenchmarkFixture, BM_SpawnAllEntities_Instances)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SpawnableEntitiesManagerBenchmarkFixture, BM_CloneEntities_Remapper)(benchmark::State& state)
+    {
+        CloneAllInstances(state,
+            [this](const AZ::Entity& entity, AzFramework::SpawnableEntitiesManager::EntityIdMap& idMap)
+            {
+                return AZ::IdUtils::Remapper<AZ::EntityId, false>::CloneObjectAndGenerateNewIdsAndFixRefs(&entity, idMap, m_serializeContext);
+            });
+    }
+    BENCHMARK_REGISTER_F(SpawnableEntitiesManagerBenchmarkFixture, BM_CloneEntities_Remapper)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(SpawnableEntitiesManagerBenchmarkFixture, BM_CloneEntities_ClonePlan)(benchmark::State& state)
+    {
+        AzFramework::SpawnableEntityCloner cloner;
+        CloneAllInstances(state,
+            [this, &cloner](const AZ::Entity& entity, AzFramework::SpawnableEntitiesManager::EntityIdMap& idMap)
+            {
+                return cloner.CloneEntity(entity, idMap, *m_serializeContext);
+            });
+    }
+    BENCHMARK_REGISTER_F(SpawnableEntitiesManagerBenchmarkFixture, BM_CloneEntities_ClonePlan)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
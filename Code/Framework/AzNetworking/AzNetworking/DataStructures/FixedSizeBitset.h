@@ -80,6 +80,18 @@ namespace AzNetworking
         //! @return boolean true if the bit is set, false otherwise
         bool GetBit(uint32_t index) const override;
 
+        //! Writes the low bitCount bits of value starting at the specified bit, a whole element at a time.
+        //! @param startIndex index of the first bit to write
+        //! @param bitCount   number of bits to write, at most 32
+        //! @param value      value holding the bits to write
+        void SetBits(uint32_t startIndex, uint32_t bitCount, uint32_t value);
+
+        //! Reads bitCount bits starting at the specified bit, a whole element at a time.
+        //! @param startIndex index of the first bit to read
+        //! @param bitCount   number of bits to read, at most 32
+        //! @return the bits read, packed into the low bits of the result
+        uint32_t GetBits(uint32_t startIndex, uint32_t bitCount) const;
+
         //! Returns true if any of the bits are set.
         //! @return boolean true if any bit is set, false otherwise
         bool AnySet() const override;
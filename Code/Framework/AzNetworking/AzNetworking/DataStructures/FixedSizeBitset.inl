@@ -103,6 +103,43 @@ namespace AzNetworking
         return (static_cast<ElementType>(m_container[element] >> offset) & static_cast<ElementType>(0x01)) ? true : false;
     }
 
+    template <AZStd::size_t SIZE, typename ElementType>
+    inline void FixedSizeBitset<SIZE, ElementType>::SetBits(uint32_t startIndex, uint32_t bitCount, uint32_t value)
+    {
+        AZ_Assert((bitCount <= 32) && (startIndex + bitCount <= SIZE), "Out of bounds access (requested %u bits at %u, size %u)", bitCount, startIndex, SIZE);
+        uint32_t bitsWritten = 0;
+        while (bitsWritten < bitCount)
+        {
+            const uint32_t    index     = startIndex + bitsWritten;
+            const uint32_t    element   = index / ElementTypeBits;
+            const uint32_t    offset    = index % ElementTypeBits;
+            const uint32_t    chunkBits = AZStd::min<uint32_t>(static_cast<uint32_t>(ElementTypeBits) - offset, bitCount - bitsWritten);
+            const ElementType mask      = static_cast<ElementType>(((static_cast<uint64_t>(1) << chunkBits) - 1) << offset);
+            const ElementType chunk     = static_cast<ElementType>((static_cast<uint64_t>(value) >> bitsWritten) << offset);
+            m_container[element] = (m_container[element] & static_cast<ElementType>(~mask)) | (chunk & mask);
+            bitsWritten += chunkBits;
+        }
+    }
+
+    template <AZStd::size_t SIZE, typename ElementType>
+    inline uint32_t FixedSizeBitset<SIZE, ElementType>::GetBits(uint32_t startIndex, uint32_t bitCount) const
+    {
+        AZ_Assert((bitCount <= 32) && (startIndex + bitCount <= SIZE), "Out of bounds access (requested %u bits at %u, size %u)", bitCount, startIndex, SIZE);
+        uint64_t result = 0;
+        uint32_t bitsRead = 0;
+        while (bitsRead < bitCount)
+        {
+            const uint32_t index     = startIndex + bitsRead;
+            const uint32_t element   = index / ElementTypeBits;
+            const uint32_t offset    = index % ElementTypeBits;
+            const uint32_t chunkBits = AZStd::min<uint32_t>(static_cast<uint32_t>(ElementTypeBits) - offset, bitCount - bitsRead);
+            const uint64_t chunk     = (static_cast<uint64_t>(m_container[element]) >> offset) & ((static_cast<uint64_t>(1) << chunkBits) - 1);
+            result |= chunk << bitsRead;
+            bitsRead += chunkBits;
+        }
+        return static_cast<uint32_t>(result);
+    }
+
     template <AZStd::size_t SIZE, typename ElementType>
     inline bool FixedSizeBitset<SIZE, ElementType>::AnySet() const
     {
@@ -33,6 +33,37 @@ namespace AzNetworking
         return *this;
     }
 
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator ==(const SelfType& rhs) const
+    {
+        if (GetSize() != rhs.GetSize())
+        {
+            return false;
+        }
+        const uint32_t fullElementSize = static_cast<uint32_t>(GetSize() / BitsetType::ElementTypeBits);
+        for (uint32_t i = 0; i < fullElementSize; ++i)
+        {
+            if (m_bitset.GetContainer()[i] != rhs.m_bitset.GetContainer()[i])
+            {
+                return false;
+            }
+        }
+        // Bits past the current size in the trailing element may hold stale values, so mask them out
+        const uint32_t trailingBits = static_cast<uint32_t>(GetSize() % BitsetType::ElementTypeBits);
+        if (trailingBits > 0)
+        {
+            const ElementType mask = static_cast<ElementType>((ElementType(1) << trailingBits) - 1);
+            return (m_bitset.GetContainer()[fullElementSize] & mask) == (rhs.m_bitset.GetContainer()[fullElementSize] & mask);
+        }
+        return true;
+    }
+
+    template <AZStd::size_t CAPACITY, typename ElementType>
+    inline bool FixedSizeVectorBitset<CAPACITY, ElementType>::operator !=(const SelfType& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
     template <AZStd::size_t CAPACITY, typename ElementType>
     inline void FixedSizeVectorBitset<CAPACITY, ElementType>::SetBit(uint32_t index, bool value)
     {
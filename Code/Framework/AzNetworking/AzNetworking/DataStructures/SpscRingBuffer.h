@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AzNetworking
+{
+    //! @class SpscRingBuffer
+    //! @brief statically sized lock-free ring buffer for handing items from a single producer thread to a single consumer thread.
+    //! Push methods may only be invoked by the producer thread and pop methods may only be invoked by the consumer thread.
+    template <typename TYPE, uint32_t SIZE>
+    class SpscRingBuffer
+    {
+        static_assert((SIZE > 0) && ((SIZE & (SIZE - 1)) == 0), "SpscRingBuffer size must be a power of two");
+
+    public:
+
+        SpscRingBuffer() = default;
+        ~SpscRingBuffer() = default;
+
+        //! Pushes a new item onto the end of the ring buffer, may only be invoked from the producer thread.
+        //! @param value the item to push
+        //! @return boolean true on success, false if the ring buffer is full
+        bool TryPush(const TYPE& value);
+
+        //! Pops the oldest item off the ring buffer, may only be invoked from the consumer thread.
+        //! @param outValue on success, the popped item
+        //! @return boolean true on success, false if the ring buffer is empty
+        bool TryPop(TYPE& outValue);
+
+        //! Returns true if the ring buffer is empty, only exact when invoked from the consumer thread.
+        //! @return boolean true if the ring buffer is empty
+        bool IsEmpty() const;
+
+        //! Returns true if the ring buffer is full, only exact when invoked from the producer thread.
+        //! @return boolean true if the ring buffer is full
+        bool IsFull() const;
+
+        //! Returns the number of items currently in the ring buffer, this is a snapshot that may be stale by the time it returns.
+        //! @return the number of items currently in the ring buffer
+        uint32_t GetSize() const;
+
+        //! Returns the maximum number of items the ring buffer can hold.
+        //! @return the maximum number of items the ring buffer can hold
+        static constexpr uint32_t GetCapacity();
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(SpscRingBuffer);
+
+        static constexpr uint32_t IndexMask = SIZE - 1;
+        static constexpr uint32_t CacheLineSize = 64;
+
+        // Indices increase monotonically and are masked on access, keep them on separate cache lines so the
+        // producer and consumer threads don't contend on the same line
+        alignas(CacheLineSize) AZStd::atomic<uint32_t> m_writeIndex = 0;
+        alignas(CacheLineSize) AZStd::atomic<uint32_t> m_readIndex = 0;
+        alignas(CacheLineSize) AZStd::array<TYPE, SIZE> m_items;
+    };
+}
+
+#include <AzNetworking/DataStructures/SpscRingBuffer.inl>
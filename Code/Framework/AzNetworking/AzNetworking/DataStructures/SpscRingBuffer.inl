@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    template <typename TYPE, uint32_t SIZE>
+    inline bool SpscRingBuffer<TYPE, SIZE>::TryPush(const TYPE& value)
+    {
+        const uint32_t writeIndex = m_writeIndex.load(AZStd::memory_order_relaxed);
+        if (writeIndex - m_readIndex.load(AZStd::memory_order_acquire) >= SIZE)
+        {
+            return false;
+        }
+
+        m_items[writeIndex & IndexMask] = value;
+        m_writeIndex.store(writeIndex + 1, AZStd::memory_order_release);
+        return true;
+    }
+
+    template <typename TYPE, uint32_t SIZE>
+    inline bool SpscRingBuffer<TYPE, SIZE>::TryPop(TYPE& outValue)
+    {
+        const uint32_t readIndex = m_readIndex.load(AZStd::memory_order_relaxed);
+        if (readIndex == m_writeIndex.load(AZStd::memory_order_acquire))
+        {
+            return false;
+        }
+
+        outValue = AZStd::move(m_items[readIndex & IndexMask]);
+        m_readIndex.store(readIndex + 1, AZStd::memory_order_release);
+        return true;
+    }
+
+    template <typename TYPE, uint32_t SIZE>
+    inline bool SpscRingBuffer<TYPE, SIZE>::IsEmpty() const
+    {
+        return GetSize() == 0;
+    }
+
+    template <typename TYPE, uint32_t SIZE>
+    inline bool SpscRingBuffer<TYPE, SIZE>::IsFull() const
+    {
+        return GetSize() >= SIZE;
+    }
+
+    template <typename TYPE, uint32_t SIZE>
+    inline uint32_t SpscRingBuffer<TYPE, SIZE>::GetSize() const
+    {
+        // Load the read index first, it can only ever trail the write index loaded after it
+        const uint32_t readIndex = m_readIndex.load(AZStd::memory_order_acquire);
+        return m_writeIndex.load(AZStd::memory_order_acquire) - readIndex;
+    }
+
+    template <typename TYPE, uint32_t SIZE>
+    inline constexpr uint32_t SpscRingBuffer<TYPE, SIZE>::GetCapacity()
+    {
+        return SIZE;
+    }
+}
@@ -7,6 +7,7 @@
  */
 
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Framework/PacketReplay.h>
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzCore/Interface/Interface.h>
@@ -18,6 +19,8 @@
 namespace AzNetworking
 {
     AZ_CVAR(bool, net_validateSerializedTypes, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Validate that all serialized types are correct");
+    AZ_CVAR(AZ::CVarFixedString, net_PacketCapturePath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If set, all packets received by network interfaces created afterwards are captured to <path>_<interface name>.azpcap");
 
     void NetworkingSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -53,6 +56,7 @@ namespace AzNetworking
     {
         // Delete all our network interfaces first so they can unregister from the reader and listen threads
         m_networkInterfaces.clear();
+        m_captureListeners.clear();
 
         m_compressorFactories.clear();
 
@@ -88,14 +92,28 @@ namespace AzNetworking
     {
         AZ_Assert(RetrieveNetworkInterface(name) == nullptr, "A network interface with this name already exists");
 
+        IConnectionListener* interfaceListener = &listener;
+        const AZ::CVarFixedString capturePath = net_PacketCapturePath;
+        if (!capturePath.empty())
+        {
+            // Interpose a capture listener that records everything the interface hands to the application listener
+            AZStd::unique_ptr<PacketCaptureListener> captureListener = AZStd::make_unique<PacketCaptureListener>(listener);
+            const AZStd::string captureFile = AZStd::string::format("%s_%s.azpcap", capturePath.c_str(), name.GetCStr());
+            if (captureListener->Open(captureFile.c_str()))
+            {
+                interfaceListener = captureListener.get();
+                m_captureListeners[name] = AZStd::move(captureListener);
+            }
+        }
+
         AZStd::unique_ptr<INetworkInterface> result = nullptr;
         switch (protocolType)
         {
         case ProtocolType::Tcp:
-            result = AZStd::make_unique<TcpNetworkInterface>(name, listener, trustZone, *m_listenThread);
+            result = AZStd::make_unique<TcpNetworkInterface>(name, *interfaceListener, trustZone, *m_listenThread);
             break;
         case ProtocolType::Udp:
-            result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, *m_readerThread, *m_heartbeatThread);
+            result = AZStd::make_unique<UdpNetworkInterface>(name, *interfaceListener, trustZone, *m_readerThread, *m_heartbeatThread);
             break;
         }
         INetworkInterface* returnResult = result.get();
@@ -118,7 +136,9 @@ namespace AzNetworking
 
     bool NetworkingSystemComponent::DestroyNetworkInterface(const AZ::Name& name)
     {
-        return m_networkInterfaces.erase(name) > 0;
+        const bool result = m_networkInterfaces.erase(name) > 0;
+        m_captureListeners.erase(name);
+        return result;
     }
 
     void NetworkingSystemComponent::RegisterCompressorFactory(ICompressorFactory* factory)
@@ -207,4 +227,36 @@ namespace AzNetworking
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
         }
     }
+
+    void NetworkingSystemComponent::ReplayPacketCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("ReplayPacketCapture requires a network interface name and a capture file");
+            return;
+        }
+
+        INetworkInterface* networkInterface = RetrieveNetworkInterface(AZ::Name(arguments[0]));
+        if (networkInterface == nullptr)
+        {
+            AZLOG_WARN("ReplayPacketCapture failed, no network interface named %.*s", AZ_STRING_ARG(arguments[0]));
+            return;
+        }
+
+        PacketCaptureReader reader;
+        if (!reader.Open(AZStd::string(arguments[1]).c_str()))
+        {
+            return;
+        }
+
+        const PacketReplayMode mode = ((arguments.size() > 2) && (arguments[2] == "realtime")) ? PacketReplayMode::RealTime : PacketReplayMode::FullSpeed;
+        PacketReplayDriver replayDriver(networkInterface->GetConnectionListener());
+        const PacketReplayStats stats = replayDriver.Replay(reader, mode);
+
+        AZLOG_INFO("Replayed %u records into %s", stats.m_records, networkInterface->GetName().GetCStr());
+        AZLOG_INFO(" - Dispatched packets: %u (%u failed)", stats.m_dispatchedPackets, stats.m_failedPackets);
+        AZLOG_INFO(" - Dispatched payload bytes: %llu", aznumeric_cast<AZ::u64>(stats.m_payloadBytes));
+        AZLOG_INFO(" - Packets per second: %.0f", stats.GetPacketsPerSecond());
+        AZLOG_INFO(" - Nanoseconds per packet: %.1f", stats.GetNanosecondsPerPacket());
+    }
 }
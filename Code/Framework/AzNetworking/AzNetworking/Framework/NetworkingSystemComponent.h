@@ -12,6 +12,7 @@
 #include <AzNetworking/Framework/ICompressor.h>
 #include <AzNetworking/Framework/INetworking.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzNetworking/Framework/PacketCapture.h>
 #include <AzNetworking/TcpTransport/TcpListenThread.h>
 #include <AzNetworking/UdpTransport/UdpHeartbeatThread.h>
 #include <AzNetworking/UdpTransport/UdpReaderThread.h>
@@ -70,11 +71,18 @@ namespace AzNetworking
         //! Console commands.
         //! @{
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+        void ReplayPacketCapture(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
     private:
 
         AZ_CONSOLEFUNC(NetworkingSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dumps stats for all instantiated network interfaces");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, ReplayPacketCapture, AZ::ConsoleFunctorFlags::Null,
+            "Replays a packet capture into the connection listener of a network interface: <interface name> <capture file> [realtime]");
+
+        // Declared ahead of the network interfaces so capture listeners outlive the interfaces forwarding to them
+        using CaptureListeners = AZStd::unordered_map<AZ::Name, AZStd::unique_ptr<PacketCaptureListener>>;
+        CaptureListeners m_captureListeners;
 
         NetworkInterfaces m_networkInterfaces;
         AZStd::unique_ptr<TcpListenThread> m_listenThread;
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Framework/PacketCapture.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/containers/array.h>
+
+namespace AzNetworking
+{
+    // Worst case encoded size of a single record, a full payload plus the fixed size record fields
+    static constexpr uint32_t MaxRecordBytes = MaxPacketSize + 64;
+
+    bool PacketCaptureRecord::Serialize(ISerializer& serializer)
+    {
+        uint8_t eventType = aznumeric_cast<uint8_t>(m_eventType);
+        AZ::u64 timestampUs = static_cast<AZ::u64>(m_timestampUs);
+        uint32_t connectionId = static_cast<uint32_t>(m_connectionId);
+
+        serializer.Serialize(eventType, "EventType", 0, aznumeric_cast<uint8_t>(PacketCaptureEventType::Disconnect));
+        serializer.Serialize(timestampUs, "TimestampUs");
+        serializer.Serialize(connectionId, "ConnectionId");
+
+        m_eventType = static_cast<PacketCaptureEventType>(eventType);
+        m_timestampUs = static_cast<AZ::TimeUs>(timestampUs);
+        m_connectionId = static_cast<ConnectionId>(connectionId);
+
+        if ((m_eventType == PacketCaptureEventType::ValidateConnect) || (m_eventType == PacketCaptureEventType::Connect))
+        {
+            serializer.Serialize(m_remoteAddress, "RemoteAddress");
+        }
+
+        if ((m_eventType == PacketCaptureEventType::ValidateConnect) || (m_eventType == PacketCaptureEventType::Packet))
+        {
+            uint16_t packetType = static_cast<uint16_t>(m_packetType);
+            serializer.Serialize(packetType, "PacketType");
+            serializer.Serialize(m_packetId, "PacketId");
+            serializer.Serialize(m_compressed, "Compressed");
+            serializer.Serialize(m_payload, "Payload");
+            m_packetType = static_cast<PacketType>(packetType);
+        }
+
+        if (m_eventType == PacketCaptureEventType::Disconnect)
+        {
+            uint8_t disconnectReason = aznumeric_cast<uint8_t>(m_disconnectReason);
+            uint8_t terminationEndpoint = aznumeric_cast<uint8_t>(m_terminationEndpoint);
+            serializer.Serialize(disconnectReason, "DisconnectReason", 0, aznumeric_cast<uint8_t>(DisconnectReason::MAX));
+            serializer.Serialize(terminationEndpoint, "TerminationEndpoint", 0, aznumeric_cast<uint8_t>(TerminationEndpoint::Remote));
+            m_disconnectReason = static_cast<DisconnectReason>(disconnectReason);
+            m_terminationEndpoint = static_cast<TerminationEndpoint>(terminationEndpoint);
+        }
+
+        return serializer.IsValid();
+    }
+
+    PacketCaptureWriter::~PacketCaptureWriter()
+    {
+        Close();
+    }
+
+    bool PacketCaptureWriter::Open(const char* filePath)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_file.IsOpen())
+        {
+            AZLOG_WARN("Packet capture already open, ignoring request to capture to %s", filePath);
+            return false;
+        }
+
+        const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+        if (!m_file.Open(filePath, openMode))
+        {
+            AZLOG_ERROR("Failed to open packet capture file %s", filePath);
+            return false;
+        }
+
+        uint32_t magic = CaptureFileMagic;
+        uint32_t version = CaptureFileVersion;
+        AZStd::array<uint8_t, sizeof(magic) + sizeof(version)> headerBuffer;
+        NetworkInputSerializer networkSerializer(headerBuffer.data(), static_cast<uint32_t>(headerBuffer.size()));
+        ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+        serializer.Serialize(magic, "Magic");
+        serializer.Serialize(version, "Version");
+
+        m_pendingBytes.clear();
+        m_pendingBytes.insert(m_pendingBytes.end(), headerBuffer.data(), headerBuffer.data() + serializer.GetSize());
+        m_startTimeUs = AZ::GetElapsedTimeUs();
+        m_recordCount = 0;
+        AZLOG_INFO("Capturing packets to %s", filePath);
+        return true;
+    }
+
+    void PacketCaptureWriter::Close()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_file.IsOpen())
+        {
+            Flush();
+            m_file.Close();
+        }
+    }
+
+    bool PacketCaptureWriter::IsOpen() const
+    {
+        return m_file.IsOpen();
+    }
+
+    bool PacketCaptureWriter::WriteRecord(PacketCaptureRecord& record)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (!m_file.IsOpen())
+        {
+            return false;
+        }
+
+        record.m_timestampUs = AZ::GetElapsedTimeUs() - m_startTimeUs;
+
+        // Encode straight into the pending write buffer, then trim off whatever the record didn't use
+        const size_t recordOffset = m_pendingBytes.size();
+        m_pendingBytes.resize_no_construct(recordOffset + MaxRecordBytes);
+        NetworkInputSerializer serializer(m_pendingBytes.data() + recordOffset, MaxRecordBytes);
+        if (!record.Serialize(serializer))
+        {
+            m_pendingBytes.resize_no_construct(recordOffset);
+            return false;
+        }
+        m_pendingBytes.resize_no_construct(recordOffset + serializer.GetSize());
+        ++m_recordCount;
+
+        if (m_pendingBytes.size() >= FlushThresholdBytes)
+        {
+            Flush();
+        }
+        return true;
+    }
+
+    uint32_t PacketCaptureWriter::GetRecordCount() const
+    {
+        return m_recordCount;
+    }
+
+    void PacketCaptureWriter::Flush()
+    {
+        if (!m_pendingBytes.empty())
+        {
+            m_file.Write(m_pendingBytes.data(), m_pendingBytes.size());
+            m_pendingBytes.clear();
+        }
+    }
+
+    bool PacketCaptureReader::Open(const char* filePath)
+    {
+        const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(filePath);
+        if (fileSize == 0)
+        {
+            AZLOG_ERROR("Failed to open packet capture file %s", filePath);
+            return false;
+        }
+
+        AZStd::vector<uint8_t> captureBytes;
+        captureBytes.resize_no_construct(fileSize);
+        if (AZ::IO::SystemFile::Read(filePath, captureBytes.data(), fileSize) != fileSize)
+        {
+            AZLOG_ERROR("Failed to read packet capture file %s", filePath);
+            return false;
+        }
+
+        return Open(AZStd::move(captureBytes));
+    }
+
+    bool PacketCaptureReader::Open(AZStd::vector<uint8_t>&& captureBytes)
+    {
+        m_captureBytes = AZStd::move(captureBytes);
+        m_readOffset = 0;
+        m_headerSize = 0;
+
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        NetworkOutputSerializer networkSerializer(m_captureBytes.data(), static_cast<uint32_t>(m_captureBytes.size()));
+        ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+        serializer.Serialize(magic, "Magic");
+        serializer.Serialize(version, "Version");
+        if (!serializer.IsValid() || (magic != PacketCaptureWriter::CaptureFileMagic) || (version != PacketCaptureWriter::CaptureFileVersion))
+        {
+            AZLOG_ERROR("Invalid packet capture, unrecognized header (magic 0x%08x, version %u)", magic, version);
+            m_captureBytes.clear();
+            return false;
+        }
+
+        m_headerSize = networkSerializer.GetReadSize();
+        m_readOffset = m_headerSize;
+        return true;
+    }
+
+    bool PacketCaptureReader::ReadRecord(PacketCaptureRecord& outRecord)
+    {
+        const uint32_t captureSize = static_cast<uint32_t>(m_captureBytes.size());
+        if (m_readOffset >= captureSize)
+        {
+            return false;
+        }
+
+        NetworkOutputSerializer serializer(m_captureBytes.data() + m_readOffset, captureSize - m_readOffset);
+        if (!outRecord.Serialize(serializer))
+        {
+            AZLOG_WARN("Truncated or corrupt packet capture record at offset %u", m_readOffset);
+            m_readOffset = captureSize;
+            return false;
+        }
+
+        m_readOffset += serializer.GetReadSize();
+        return true;
+    }
+
+    void PacketCaptureReader::Rewind()
+    {
+        m_readOffset = m_headerSize;
+    }
+
+    PacketCaptureListener::PacketCaptureListener(IConnectionListener& listener)
+        : m_listener(listener)
+    {
+        ;
+    }
+
+    bool PacketCaptureListener::Open(const char* filePath)
+    {
+        return m_writer.Open(filePath);
+    }
+
+    ConnectResult PacketCaptureListener::ValidateConnect(const IpAddress& remoteAddress, const IPacketHeader& packetHeader, ISerializer& serializer)
+    {
+        m_record.m_eventType = PacketCaptureEventType::ValidateConnect;
+        m_record.m_connectionId = InvalidConnectionId;
+        m_record.m_remoteAddress = remoteAddress;
+        CapturePacket(m_record, packetHeader, serializer);
+        return m_listener.ValidateConnect(remoteAddress, packetHeader, serializer);
+    }
+
+    void PacketCaptureListener::OnConnect(IConnection* connection)
+    {
+        m_record.m_eventType = PacketCaptureEventType::Connect;
+        m_record.m_connectionId = connection->GetConnectionId();
+        m_record.m_remoteAddress = connection->GetRemoteAddress();
+        m_writer.WriteRecord(m_record);
+        m_listener.OnConnect(connection);
+    }
+
+    PacketDispatchResult PacketCaptureListener::OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
+    {
+        m_record.m_eventType = PacketCaptureEventType::Packet;
+        m_record.m_connectionId = connection->GetConnectionId();
+        CapturePacket(m_record, packetHeader, serializer);
+        return m_listener.OnPacketReceived(connection, packetHeader, serializer);
+    }
+
+    void PacketCaptureListener::OnPacketLost(IConnection* connection, PacketId packetId)
+    {
+        m_listener.OnPacketLost(connection, packetId);
+    }
+
+    void PacketCaptureListener::OnDisconnect(IConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint)
+    {
+        m_record.m_eventType = PacketCaptureEventType::Disconnect;
+        m_record.m_connectionId = connection->GetConnectionId();
+        m_record.m_disconnectReason = reason;
+        m_record.m_terminationEndpoint = endpoint;
+        m_writer.WriteRecord(m_record);
+        m_listener.OnDisconnect(connection, reason, endpoint);
+    }
+
+    void PacketCaptureListener::CapturePacket(PacketCaptureRecord& record, const IPacketHeader& packetHeader, const ISerializer& serializer)
+    {
+        // The transport has already consumed the packet header, only capture the unread payload
+        const uint32_t payloadOffset = serializer.GetSize();
+        const uint32_t payloadSize = serializer.GetCapacity() - payloadOffset;
+        if (payloadSize > record.m_payload.GetCapacity())
+        {
+            return;
+        }
+
+        record.m_packetType = packetHeader.GetPacketType();
+        record.m_packetId = packetHeader.GetPacketId();
+        // The header's Compressed flag describes the wire format, the payload handed to the listener has already been decompressed
+        record.m_compressed = false;
+        record.m_payload.Resize(payloadSize);
+        memcpy(record.m_payload.GetBuffer(), serializer.GetBuffer() + payloadOffset, payloadSize);
+        m_writer.WriteRecord(record);
+    }
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Time/ITime.h>
+
+namespace AzNetworking
+{
+    AZ_ENUM_CLASS(PacketCaptureEventType
+        , ValidateConnect
+        , Connect
+        , Packet
+        , Disconnect
+    );
+
+    //! @struct PacketCaptureRecord
+    //! @brief a single timestamped connection event or received packet within a packet capture.
+    struct PacketCaptureRecord
+    {
+        PacketCaptureEventType m_eventType = PacketCaptureEventType::Packet;
+        AZ::TimeUs m_timestampUs = AZ::Time::ZeroTimeUs; //!< Time since the capture was started
+        ConnectionId m_connectionId = InvalidConnectionId;
+        IpAddress m_remoteAddress;
+        PacketType m_packetType = PacketType{ 0 };
+        PacketId m_packetId = InvalidPacketId;
+        bool m_compressed = false; //!< Whether m_payload is compressed, always false for captured payloads which are stored decoded
+        PacketEncodingBuffer m_payload; //!< Decoded packet payload, as handed to the connection listener
+        DisconnectReason m_disconnectReason = DisconnectReason::None;
+        TerminationEndpoint m_terminationEndpoint = TerminationEndpoint::Local;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+    };
+
+    //! @class PacketCaptureWriter
+    //! @brief writes connection events and received packets to a compact binary capture file.
+    //!
+    //! Records are encoded with a NetworkInputSerializer and buffered in memory, the buffer is flushed to disk
+    //! whenever it exceeds FlushThresholdBytes and when the writer is closed.
+    class PacketCaptureWriter
+    {
+    public:
+
+        static constexpr uint32_t CaptureFileMagic = 0x50434E41; // 'ANCP'
+        static constexpr uint32_t CaptureFileVersion = 1;
+        static constexpr uint32_t FlushThresholdBytes = 64 * 1024;
+
+        PacketCaptureWriter() = default;
+        ~PacketCaptureWriter();
+
+        //! Opens a new capture file for writing, truncating any existing file.
+        //! @param filePath path of the capture file to write
+        //! @return boolean true on success, false if the file could not be opened
+        bool Open(const char* filePath);
+
+        //! Flushes any buffered records and closes the capture file.
+        void Close();
+
+        //! Returns true if the capture file is open for writing.
+        //! @return boolean true if the capture file is open for writing
+        bool IsOpen() const;
+
+        //! Appends a record to the capture, the record timestamp is assigned by the writer.
+        //! @param record the record to append
+        //! @return boolean true on success
+        bool WriteRecord(PacketCaptureRecord& record);
+
+        //! Returns the number of records written since the capture file was opened.
+        //! @return the number of records written since the capture file was opened
+        uint32_t GetRecordCount() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PacketCaptureWriter);
+
+        void Flush();
+
+        AZStd::mutex m_mutex;
+        AZ::IO::SystemFile m_file;
+        AZStd::vector<uint8_t> m_pendingBytes;
+        AZ::TimeUs m_startTimeUs = AZ::Time::ZeroTimeUs;
+        uint32_t m_recordCount = 0;
+    };
+
+    //! @class PacketCaptureReader
+    //! @brief reads back the records of a capture file written by PacketCaptureWriter.
+    class PacketCaptureReader
+    {
+    public:
+
+        PacketCaptureReader() = default;
+
+        //! Loads an entire capture file into memory.
+        //! @param filePath path of the capture file to read
+        //! @return boolean true on success, false if the file could not be read or is not a valid capture
+        bool Open(const char* filePath);
+
+        //! Takes ownership of an in-memory capture, as produced by reading a capture file.
+        //! @param captureBytes the raw capture bytes
+        //! @return boolean true on success, false if the data is not a valid capture
+        bool Open(AZStd::vector<uint8_t>&& captureBytes);
+
+        //! Reads the next record in the capture.
+        //! @param outRecord on success, the next record in the capture
+        //! @return boolean true if a record was read, false at the end of the capture or on error
+        bool ReadRecord(PacketCaptureRecord& outRecord);
+
+        //! Rewinds the reader to the first record in the capture.
+        void Rewind();
+
+    private:
+
+        AZStd::vector<uint8_t> m_captureBytes;
+        uint32_t m_readOffset = 0;
+        uint32_t m_headerSize = 0;
+    };
+
+    //! @class PacketCaptureListener
+    //! @brief connection listener that records every connection event and received packet before forwarding it to the wrapped listener.
+    class PacketCaptureListener final
+        : public IConnectionListener
+    {
+    public:
+
+        //! Constructor.
+        //! @param listener the connection listener to forward all events to
+        PacketCaptureListener(IConnectionListener& listener);
+        ~PacketCaptureListener() override = default;
+
+        //! Opens the capture file all events are recorded to.
+        //! @param filePath path of the capture file to write
+        //! @return boolean true on success
+        bool Open(const char* filePath);
+
+        //! IConnectionListener interface
+        //! @{
+        ConnectResult ValidateConnect(const IpAddress& remoteAddress, const IPacketHeader& packetHeader, ISerializer& serializer) override;
+        void OnConnect(IConnection* connection) override;
+        PacketDispatchResult OnPacketReceived(IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer) override;
+        void OnPacketLost(IConnection* connection, PacketId packetId) override;
+        void OnDisconnect(IConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint) override;
+        //! @}
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PacketCaptureListener);
+
+        void CapturePacket(PacketCaptureRecord& record, const IPacketHeader& packetHeader, const ISerializer& serializer);
+
+        IConnectionListener& m_listener;
+        PacketCaptureWriter m_writer;
+        PacketCaptureRecord m_record;
+    };
+}
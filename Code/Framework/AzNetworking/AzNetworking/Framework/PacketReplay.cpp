@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Framework/PacketReplay.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AzNetworking
+{
+    //! Packet header handed to the listener for replayed packets, carries the captured header fields
+    class PacketReplayHeader final
+        : public IPacketHeader
+    {
+    public:
+
+        PacketReplayHeader(const PacketCaptureRecord& record)
+            : m_packetType(record.m_packetType)
+            , m_packetId(record.m_packetId)
+        {
+            m_packetFlags.SetBit(aznumeric_cast<uint32_t>(PacketFlag::Compressed), record.m_compressed);
+        }
+
+        PacketType GetPacketType() const override
+        {
+            return m_packetType;
+        }
+
+        PacketId GetPacketId() const override
+        {
+            return m_packetId;
+        }
+
+        bool IsPacketFlagSet(PacketFlag flag) const override
+        {
+            return m_packetFlags.GetBit(aznumeric_cast<uint32_t>(flag));
+        }
+
+        void SetPacketFlag(PacketFlag flag, bool value) override
+        {
+            m_packetFlags.SetBit(aznumeric_cast<uint32_t>(flag), value);
+        }
+
+    private:
+
+        PacketType m_packetType;
+        PacketId m_packetId;
+        PacketFlagBitset m_packetFlags;
+    };
+
+    PacketReplayConnection::PacketReplayConnection(ConnectionId connectionId, const IpAddress& remoteAddress)
+        : IConnection(connectionId, remoteAddress)
+    {
+        ;
+    }
+
+    bool PacketReplayConnection::SendReliablePacket([[maybe_unused]] const IPacket& packet)
+    {
+        ++m_sentPackets;
+        return m_state == ConnectionState::Connected;
+    }
+
+    PacketId PacketReplayConnection::SendUnreliablePacket([[maybe_unused]] const IPacket& packet)
+    {
+        return PacketId{ m_sentPackets++ };
+    }
+
+    bool PacketReplayConnection::WasPacketAcked([[maybe_unused]] PacketId packetId) const
+    {
+        return true;
+    }
+
+    ConnectionState PacketReplayConnection::GetConnectionState() const
+    {
+        return m_state;
+    }
+
+    ConnectionRole PacketReplayConnection::GetConnectionRole() const
+    {
+        return ConnectionRole::Acceptor;
+    }
+
+    bool PacketReplayConnection::Disconnect([[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint)
+    {
+        m_state = ConnectionState::Disconnected;
+        return true;
+    }
+
+    void PacketReplayConnection::SetConnectionMtu([[maybe_unused]] uint32_t connectionMtu)
+    {
+        ; // do nothing, unsupported on replay connections
+    }
+
+    uint32_t PacketReplayConnection::GetConnectionMtu() const
+    {
+        return 0;
+    }
+
+    uint32_t PacketReplayConnection::GetSentPacketCount() const
+    {
+        return m_sentPackets;
+    }
+
+    double PacketReplayStats::GetPacketsPerSecond() const
+    {
+        const double elapsedSeconds = static_cast<double>(m_elapsedTimeUs) / 1000000.0;
+        return (elapsedSeconds > 0.0) ? static_cast<double>(m_dispatchedPackets) / elapsedSeconds : 0.0;
+    }
+
+    double PacketReplayStats::GetNanosecondsPerPacket() const
+    {
+        return (m_dispatchedPackets > 0) ? static_cast<double>(m_elapsedTimeUs) * 1000.0 / static_cast<double>(m_dispatchedPackets) : 0.0;
+    }
+
+    PacketReplayDriver::PacketReplayDriver(IConnectionListener& listener)
+        : m_listener(listener)
+    {
+        ;
+    }
+
+    PacketReplayDriver::~PacketReplayDriver()
+    {
+        Reset();
+    }
+
+    PacketReplayStats PacketReplayDriver::Replay(PacketCaptureReader& reader, PacketReplayMode mode)
+    {
+        PacketReplayStats stats;
+        PacketCaptureRecord record;
+
+        const AZ::TimeUs startTimeUs = AZ::GetRealElapsedTimeUs();
+        while (reader.ReadRecord(record))
+        {
+            if (mode == PacketReplayMode::RealTime)
+            {
+                const AZ::TimeUs elapsedTimeUs = AZ::GetRealElapsedTimeUs() - startTimeUs;
+                if (record.m_timestampUs > elapsedTimeUs)
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::microseconds(static_cast<int64_t>(record.m_timestampUs - elapsedTimeUs)));
+                }
+            }
+
+            ++stats.m_records;
+            switch (record.m_eventType)
+            {
+            case PacketCaptureEventType::ValidateConnect:
+            {
+                PacketReplayHeader header(record);
+                NetworkOutputSerializer serializer(record.m_payload.GetBuffer(), static_cast<uint32_t>(record.m_payload.GetSize()));
+                m_listener.ValidateConnect(record.m_remoteAddress, header, serializer);
+                break;
+            }
+            case PacketCaptureEventType::Connect:
+            {
+                bool created = false;
+                PacketReplayConnection* connection = FindOrCreateConnection(record.m_connectionId, record.m_remoteAddress, created);
+                if (created)
+                {
+                    m_listener.OnConnect(connection);
+                }
+                break;
+            }
+            case PacketCaptureEventType::Packet:
+            {
+                // Captures may begin mid session, in which case connections are created on their first packet
+                bool created = false;
+                PacketReplayConnection* connection = FindOrCreateConnection(record.m_connectionId, record.m_remoteAddress, created);
+                PacketReplayHeader header(record);
+                NetworkOutputSerializer serializer(record.m_payload.GetBuffer(), static_cast<uint32_t>(record.m_payload.GetSize()));
+                if (m_listener.OnPacketReceived(connection, header, serializer) == PacketDispatchResult::Failure)
+                {
+                    ++stats.m_failedPackets;
+                }
+                ++stats.m_dispatchedPackets;
+                stats.m_payloadBytes += record.m_payload.GetSize();
+                break;
+            }
+            case PacketCaptureEventType::Disconnect:
+            {
+                auto iter = m_connections.find(record.m_connectionId);
+                if (iter != m_connections.end())
+                {
+                    iter->second->Disconnect(record.m_disconnectReason, record.m_terminationEndpoint);
+                    m_listener.OnDisconnect(iter->second.get(), record.m_disconnectReason, record.m_terminationEndpoint);
+                    m_connections.erase(iter);
+                }
+                break;
+            }
+            }
+        }
+
+        stats.m_elapsedTimeUs = AZ::GetRealElapsedTimeUs() - startTimeUs;
+        return stats;
+    }
+
+    void PacketReplayDriver::Reset()
+    {
+        for (auto& [connectionId, connection] : m_connections)
+        {
+            connection->Disconnect(DisconnectReason::ConnectionDeleted, TerminationEndpoint::Local);
+            m_listener.OnDisconnect(connection.get(), DisconnectReason::ConnectionDeleted, TerminationEndpoint::Local);
+        }
+        m_connections.clear();
+    }
+
+    PacketReplayConnection* PacketReplayDriver::FindOrCreateConnection(ConnectionId connectionId, const IpAddress& remoteAddress, bool& outCreated)
+    {
+        auto iter = m_connections.find(connectionId);
+        if (iter != m_connections.end())
+        {
+            outCreated = false;
+            return iter->second.get();
+        }
+
+        outCreated = true;
+        AZStd::unique_ptr<PacketReplayConnection> connection = AZStd::make_unique<PacketReplayConnection>(connectionId, remoteAddress);
+        PacketReplayConnection* result = connection.get();
+        m_connections.emplace(connectionId, AZStd::move(connection));
+        return result;
+    }
+}
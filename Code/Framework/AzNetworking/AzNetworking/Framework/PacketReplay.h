@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/Framework/PacketCapture.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    //! @class PacketReplayConnection
+    //! @brief loopback connection standing in for a captured remote endpoint, anything sent on it is counted and discarded.
+    class PacketReplayConnection final
+        : public IConnection
+    {
+    public:
+
+        PacketReplayConnection(ConnectionId connectionId, const IpAddress& remoteAddress);
+        ~PacketReplayConnection() override = default;
+
+        //! IConnection interface
+        //! @{
+        bool SendReliablePacket(const IPacket& packet) override;
+        PacketId SendUnreliablePacket(const IPacket& packet) override;
+        bool WasPacketAcked(PacketId packetId) const override;
+        ConnectionState GetConnectionState() const override;
+        ConnectionRole GetConnectionRole() const override;
+        bool Disconnect(DisconnectReason reason, TerminationEndpoint endpoint) override;
+        void SetConnectionMtu(uint32_t connectionMtu) override;
+        uint32_t GetConnectionMtu() const override;
+        //! @}
+
+        //! Returns the number of packets the application layer has sent on this connection.
+        //! @return the number of packets the application layer has sent on this connection
+        uint32_t GetSentPacketCount() const;
+
+    private:
+
+        ConnectionState m_state = ConnectionState::Connected;
+        uint32_t m_sentPackets = 0;
+    };
+
+    enum class PacketReplayMode
+    {
+        FullSpeed, //!< Dispatch records back to back, for measuring throughput
+        RealTime   //!< Dispatch records with their originally captured spacing
+    };
+
+    //! @struct PacketReplayStats
+    //! @brief totals gathered while replaying a packet capture.
+    struct PacketReplayStats
+    {
+        uint32_t m_records = 0;
+        uint32_t m_dispatchedPackets = 0;
+        uint32_t m_failedPackets = 0;
+        AZ::u64 m_payloadBytes = 0;
+        AZ::TimeUs m_elapsedTimeUs = AZ::Time::ZeroTimeUs;
+
+        //! Returns the number of packets dispatched per second of replay.
+        //! @return the number of packets dispatched per second of replay
+        double GetPacketsPerSecond() const;
+
+        //! Returns the average time spent per dispatched packet in nanoseconds.
+        //! @return the average time spent per dispatched packet in nanoseconds
+        double GetNanosecondsPerPacket() const;
+    };
+
+    //! @class PacketReplayDriver
+    //! @brief feeds the records of a packet capture back through a connection listener's packet dispatch, without any transport.
+    //!
+    //! Each captured connection is replaced by a PacketReplayConnection, so the application layer sees the same sequence
+    //! of connects, packets and disconnects it originally saw, and anything it sends in response is discarded.
+    class PacketReplayDriver
+    {
+    public:
+
+        //! Constructor.
+        //! @param listener the connection listener to replay the capture into
+        PacketReplayDriver(IConnectionListener& listener);
+        ~PacketReplayDriver();
+
+        //! Replays all remaining records of the provided capture.
+        //! @param reader the capture to replay
+        //! @param mode   whether to replay at full speed or with the originally captured timing
+        //! @return totals gathered while replaying the capture
+        PacketReplayStats Replay(PacketCaptureReader& reader, PacketReplayMode mode);
+
+        //! Disconnects and deletes all replay connections that are still open.
+        void Reset();
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(PacketReplayDriver);
+
+        PacketReplayConnection* FindOrCreateConnection(ConnectionId connectionId, const IpAddress& remoteAddress, bool& outCreated);
+
+        IConnectionListener& m_listener;
+        AZStd::unordered_map<ConnectionId, AZStd::unique_ptr<PacketReplayConnection>> m_connections;
+    };
+}
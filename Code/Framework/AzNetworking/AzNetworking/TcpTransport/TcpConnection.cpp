@@ -21,6 +21,8 @@
 namespace AzNetworking
 {
     AZ_CVAR(AZ::CVarFixedString, net_TcpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "TCP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
+    AZ_CVAR(uint32_t, net_TcpMaxRecvBytesPerUpdate, 256 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum bytes to read from a single TCP socket per update, any remaining data is read on the next update");
 
     TcpConnection::TcpConnection
     (
@@ -124,8 +126,18 @@ namespace AzNetworking
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         GetMetrics().LogPacketRecv(0, startTimeMs);
 
-        // Read new data off the input socket
+        // Sockets may be registered edge triggered (epoll), so keep reading until the socket would block or the receive budget runs out
+        // A connection that runs out of budget is flagged as pending and read again next update, since the socket won't be reported again
+        m_recvPending = false;
+        uint32_t totalReceivedBytes = 0;
+        while (m_state != ConnectionState::Disconnected)
         {
+            if (totalReceivedBytes >= net_TcpMaxRecvBytesPerUpdate)
+            {
+                m_recvPending = true;
+                break;
+            }
+
             uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
             if (srcData == nullptr)
             {
@@ -137,8 +149,8 @@ namespace AzNetworking
             const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
             if (receivedBytes == 0)
             {
-                // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
+                // No more data on the socket
+                break;
             }
 
             const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
@@ -148,43 +160,68 @@ namespace AzNetworking
                 return true;
             }
             m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
+            totalReceivedBytes += aznumeric_cast<uint32_t>(receivedBytes);
             m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
             m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
+
+            // Process complete packets between reads so the ringbuffer only ever holds a partial packet plus the latest read
+            ProcessReceivedPackets(startTimeMs);
+        }
+
+        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+        return true;
+    }
+
+    bool TcpConnection::HandleFramedPacket(TcpPacketHeader& header, const uint8_t* payload, uint16_t payloadSize, AZ::TimeMs currentTimeMs)
+    {
+        TcpPacketEncodingBuffer buffer;
+        if (!DecodePacket(header, payload, payloadSize, buffer))
+        {
+            return false;
         }
 
-        // Process received packets
+        GetMetrics().LogPacketRecv(static_cast<uint32_t>(buffer.GetSize()), currentTimeMs);
+        m_networkInterface.GetMetrics().m_recvPackets++;
+        DispatchPacket(header, buffer);
+        return true;
+    }
+
+    void TcpConnection::ProcessReceivedPackets(AZ::TimeMs currentTimeMs)
+    {
         for (;;)
         {
             TcpPacketHeader header(PacketType(0), 0);
             TcpPacketEncodingBuffer buffer;
 
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
+            if (!ReceivePacketInternal(header, buffer, currentTimeMs))
             {
                 break;
             }
 
-            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
-            if (m_state == ConnectionState::Connecting)
+            DispatchPacket(header, buffer);
+        }
+    }
+
+    void TcpConnection::DispatchPacket(TcpPacketHeader& header, TcpPacketEncodingBuffer& buffer)
+    {
+        NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+        if (m_state == ConnectionState::Connecting)
+        {
+            const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
+            if (connectResult == ConnectResult::Rejected)
             {
-                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
-                if (connectResult == ConnectResult::Rejected)
-                {
-                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
-                }
-                else
-                {
-                    m_state = ConnectionState::Connected;
-                }
+                Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
             }
-
-            if (m_state == ConnectionState::Connected)
+            else
             {
-                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+                m_state = ConnectionState::Connected;
             }
         }
 
-        m_networkInterface.GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
-        return true;
+        if (m_state == ConnectionState::Connected)
+        {
+            m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+        }
     }
 
     bool TcpConnection::SendReliablePacket(const IPacket& packet)
@@ -357,41 +394,45 @@ namespace AzNetworking
             return false;
         }
 
-        uint16_t packetSize = outHeader.GetPacketSize();
+        const uint16_t transmittedPacketSize = outHeader.GetPacketSize();
         const uint32_t unreadSize = serializer.GetUnreadSize();
-        if (packetSize > unreadSize)
+        if (transmittedPacketSize > unreadSize)
         {
             // We don't have all the data required for this packet yet
             return false;
         }
 
-        if (packetSize > outBuffer.GetCapacity())
+        if (!DecodePacket(outHeader, serializer.GetUnreadData(), transmittedPacketSize, outBuffer))
+        {
+            return false;
+        }
+
+        m_recvRingbuffer.AdvanceReadBuffer(serializer.GetReadSize() + transmittedPacketSize);
+        GetMetrics().LogPacketRecv(static_cast<uint32_t>(outBuffer.GetSize()), currentTimeMs);
+        m_networkInterface.GetMetrics().m_recvPackets++;
+        return true;
+    }
+
+    bool TcpConnection::DecodePacket(const TcpPacketHeader& header, const uint8_t* payload, uint16_t payloadSize, TcpPacketEncodingBuffer& outBuffer) const
+    {
+        if (payloadSize > outBuffer.GetCapacity())
         {
             // If we can't fit the packet, do not allow the copy to proceed as that would overwrite invalid memory
             return false;
         }
 
-        const uint16_t transmittedPacketSize = packetSize;
-        const uint8_t* srcData = serializer.GetUnreadData();
-        if (m_compressor && outHeader.IsPacketFlagSet(PacketFlag::Compressed))
+        if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
         {
-            if (!DecompressPacket(srcData, packetSize, outBuffer))
+            if (!DecompressPacket(payload, payloadSize, outBuffer))
             {
                 AZLOG_WARN("Failed to decompress packet!");
                 return false;
             }
-            srcData = outBuffer.GetBuffer();
-            packetSize = aznumeric_cast<uint16_t>(outBuffer.GetSize());
+            return true;
         }
 
-        outBuffer.Resize(packetSize);
-
-        uint8_t* dstData = outBuffer.GetBuffer();
-        memcpy(dstData, srcData, packetSize);
-
-        m_recvRingbuffer.AdvanceReadBuffer(serializer.GetReadSize() + transmittedPacketSize);
-        GetMetrics().LogPacketRecv(packetSize, currentTimeMs);
-        m_networkInterface.GetMetrics().m_recvPackets++;
+        outBuffer.Resize(payloadSize);
+        memcpy(outBuffer.GetBuffer(), payload, payloadSize);
         return true;
     }
 
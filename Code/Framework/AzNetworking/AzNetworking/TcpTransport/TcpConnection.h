@@ -83,6 +83,18 @@ namespace AzNetworking
         //! @return boolean true if the socket is still active, false if it has been remotely terminated
         bool UpdateRecv();
 
+        //! Returns true if the last receive update ran out of budget and left data unread on the socket.
+        //! @return boolean true if UpdateRecv should be invoked again without waiting for a socket event
+        bool HasPendingRecv() const;
+
+        //! Handles a packet that was already framed off the incoming stream, used when receiving on a TcpReceiveThread.
+        //! @param header        header of the received packet
+        //! @param payload       the transmitted, possibly compressed, packet payload
+        //! @param payloadSize   size of the transmitted packet payload in bytes
+        //! @param currentTimeMs current process time in milliseconds
+        //! @return boolean true if the packet was decoded and dispatched
+        bool HandleFramedPacket(TcpPacketHeader& header, const uint8_t* payload, uint16_t payloadSize, AZ::TimeMs currentTimeMs);
+
         //! IConnection interface.
         // @{
         bool SendReliablePacket(const IPacket& packet) override;
@@ -119,6 +131,23 @@ namespace AzNetworking
         //! @return boolean true if a packet has been received, false otherwise
         bool ReceivePacketInternal(TcpPacketHeader& outHeader, TcpPacketEncodingBuffer& outBuffer, AZ::TimeMs currentTimeMs);
 
+        //! Receives and dispatches every complete packet in the receive ringbuffer.
+        //! @param currentTimeMs current process time in milliseconds
+        void ProcessReceivedPackets(AZ::TimeMs currentTimeMs);
+
+        //! Dispatches a decoded packet to the connection listener.
+        //! @param header header of the received packet
+        //! @param buffer decoded buffer of the received packet
+        void DispatchPacket(TcpPacketHeader& header, TcpPacketEncodingBuffer& buffer);
+
+        //! Decodes a transmitted packet payload, decompressing it if required.
+        //! @param header      header of the received packet
+        //! @param payload     the transmitted packet payload
+        //! @param payloadSize size of the transmitted packet payload in bytes
+        //! @param outBuffer   the decoded packet payload
+        //! @return boolean true on success, false on failure
+        bool DecodePacket(const TcpPacketHeader& header, const uint8_t* payload, uint16_t payloadSize, TcpPacketEncodingBuffer& outBuffer) const;
+
         //! Decompresses an incoming packet data buffer.
         //! @param packetBuffer    the compressed packet buffer to decode
         //! @param packetSize      the size of the compressed packet buffer
@@ -137,6 +166,7 @@ namespace AzNetworking
         ConnectionState m_state = ConnectionState::Disconnected;
         ConnectionRole  m_connectionRole = ConnectionRole::Connector;
         SocketFd        m_registeredSocketFd;
+        bool            m_recvPending = false;
 
         static const uint32_t SendRingbufferSize = 1024 * 1024; // 1 MB send buffer
         TcpRingBuffer<SendRingbufferSize> m_sendRingbuffer;
@@ -29,4 +29,9 @@ namespace AzNetworking
     {
         return m_registeredSocketFd;
     }
+
+    inline bool TcpConnection::HasPendingRecv() const
+    {
+        return m_recvPending;
+    }
 }
@@ -20,6 +20,8 @@ namespace AzNetworking
 #else
     static const bool net_TcpUseEncryption = false;
 #endif
+    AZ_CVAR(bool, net_TcpReceiveThread, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Receive and frame Tcp traffic on a dedicated thread per network interface, handing complete packets to the main thread update. Ignored if encryption is enabled");
 
     TcpNetworkInterface::TcpNetworkInterface(const AZ::Name& name, IConnectionListener& connectionListener, TrustZone trustZone, TcpListenThread& listenThread)
         : m_name(name)
@@ -27,11 +29,24 @@ namespace AzNetworking
         , m_connectionListener(connectionListener)
         , m_listenThread(listenThread)
     {
-        ;
+        // Tls sockets are not safe to read and write from separate threads
+        if (net_TcpReceiveThread && !net_TcpUseEncryption)
+        {
+            m_receiveThread = AZStd::make_unique<TcpReceiveThread>();
+            m_receiveThread->Start();
+        }
     }
 
     TcpNetworkInterface::~TcpNetworkInterface()
     {
+        // Join the receive thread first, any sockets it still holds are safe to close once it has stopped
+        m_receiveThread.reset();
+        for (SocketFd socketFd : m_removingSockets)
+        {
+            DeleteConnection(socketFd);
+        }
+        m_removingSockets.clear();
+
         FlushQueuedRemoves();
         StopListening();
     }
@@ -98,6 +113,11 @@ namespace AzNetworking
             return InvalidConnectionId;
         }
 
+        if (m_receiveThread != nullptr)
+        {
+            m_receiveThread->AddSocket(*tcpSocket);
+        }
+
         AZLOG_INFO("Adding new socket %d", static_cast<int32_t>(tcpSocket->GetSocketFd()));
         connection->SendReliablePacket(CorePackets::InitiateConnectionPacket());
         m_connectionListener.OnConnect(connection.get());
@@ -111,7 +131,23 @@ namespace AzNetworking
 
         AcceptNewConnections();
 
-        auto readCallback = [this, startTimeMs](SocketFd socketFd) { HandleConnectionRecv(socketFd, startTimeMs); };
+        if (m_receiveThread != nullptr)
+        {
+            HandleReceivedPackets(startTimeMs);
+        }
+        else
+        {
+            HandlePendingRecvs();
+        }
+
+        auto readCallback = [this, startTimeMs](SocketFd socketFd)
+        {
+            // Reads are handled by the receive thread if it's enabled
+            if (m_receiveThread == nullptr)
+            {
+                HandleConnectionRecv(socketFd, startTimeMs);
+            }
+        };
         auto writeCallback = [this](SocketFd socketFd) { HandleConnectionSend(socketFd); };
         m_tcpSocketManager.ProcessEvents(AZ::Time::ZeroTimeMs, readCallback, writeCallback);
 
@@ -200,6 +236,11 @@ namespace AzNetworking
         {
             return false;
         }
+        if (connection->HasPendingRecv())
+        {
+            // Already read up to its budget by HandlePendingRecvs this update
+            return true;
+        }
         const bool result = connection->UpdateRecv();
         if (!result)
         {
@@ -208,6 +249,58 @@ namespace AzNetworking
         return result;
     }
 
+    void TcpNetworkInterface::HandlePendingRecvs()
+    {
+        m_connectionSet.VisitConnections([](IConnection& connection)
+        {
+            TcpConnection& tcpConnection = static_cast<TcpConnection&>(connection);
+            if (tcpConnection.HasPendingRecv() && !tcpConnection.UpdateRecv())
+            {
+                tcpConnection.Disconnect(DisconnectReason::RemoteHostClosedConnection, TerminationEndpoint::Remote);
+            }
+        });
+    }
+
+    void TcpNetworkInterface::HandleReceivedPackets(AZ::TimeMs currentTimeMs)
+    {
+        TcpReceiveThread::ReceivedPacket* packet = nullptr;
+        while (m_receiveThread->PopReceivedPacket(packet))
+        {
+            const SocketFd socketFd = packet->m_socketFd;
+            switch (packet->m_type)
+            {
+            case TcpReceiveThread::ReceivedPacketType::Packet:
+                if (TcpConnection* connection = m_connectionSet.GetConnection(socketFd))
+                {
+                    GetMetrics().m_recvBytes += packet->m_receivedBytes;
+                    GetMetrics().m_recvBytesUncompressed += packet->m_receivedBytes;
+                    const uint16_t payloadSize = aznumeric_cast<uint16_t>(packet->m_payload.GetSize());
+                    if (!connection->HandleFramedPacket(packet->m_header, packet->m_payload.GetBuffer(), payloadSize, currentTimeMs))
+                    {
+                        AZLOG_WARN("Failed to decode packet received on socket %d", static_cast<int32_t>(socketFd));
+                        connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+                    }
+                }
+                break;
+            case TcpReceiveThread::ReceivedPacketType::Disconnected:
+                if (TcpConnection* connection = m_connectionSet.GetConnection(socketFd))
+                {
+                    connection->Disconnect(packet->m_reason, TerminationEndpoint::Remote);
+                }
+                break;
+            case TcpReceiveThread::ReceivedPacketType::Removed:
+                if (m_removingSockets.erase(socketFd) > 0)
+                {
+                    DeleteConnection(socketFd);
+                }
+                break;
+            }
+            m_receiveThread->ReleaseReceivedPacket(packet);
+        }
+
+        GetMetrics().m_recvTimeMs += AZ::GetElapsedTimeMs() - currentTimeMs;
+    }
+
     bool TcpNetworkInterface::HandleConnectionSend(SocketFd socketFd)
     {
         TcpConnection* connection = m_connectionSet.GetConnection(socketFd);
@@ -269,6 +362,11 @@ namespace AzNetworking
         AZLOG(NET_TcpTraffic, "Adding new socket %d", static_cast<int32_t>(tcpSocket.GetSocketFd()));
         AZStd::unique_ptr<TcpConnection> connection = AZStd::make_unique<TcpConnection>(connectionId, remoteAddress, *this, tcpSocket);
         AZ_Assert(connection->GetConnectionRole() == ConnectionRole::Acceptor, "Invalid role for connection");
+        if (m_receiveThread != nullptr)
+        {
+            // The connection takes ownership of the socket, so register the connection's copy with the receive thread
+            m_receiveThread->AddSocket(*connection->GetTcpSocket());
+        }
         GetConnectionListener().OnConnect(connection.get());
         m_connectionSet.AddConnection(AZStd::move(connection));
     }
@@ -286,14 +384,30 @@ namespace AzNetworking
                 continue;
             }
 
+            if (m_receiveThread != nullptr)
+            {
+                // The receive thread may still be reading from the socket, so defer deleting the connection until it releases it
+                if (m_removingSockets.insert(socketFd).second)
+                {
+                    AZLOG_INFO("Removing socket %d due to %s", static_cast<int32_t>(socketFd), AZStd::string(ToString(reason)).c_str());
+                    m_receiveThread->RemoveSocket(socketFd);
+                }
+                continue;
+            }
+
             AZLOG_INFO("Removing socket %d due to %s", static_cast<int32_t>(socketFd), AZStd::string(ToString(reason)).c_str());
-            m_tcpSocketManager.ClearSocket(socketFd);
-            m_connectionSet.DeleteConnection(socketFd);
+            DeleteConnection(socketFd);
         }
 
         m_pendingRemoves.resize_no_construct(0);
     }
 
+    void TcpNetworkInterface::DeleteConnection(SocketFd socketFd)
+    {
+        m_tcpSocketManager.ClearSocket(socketFd);
+        m_connectionSet.DeleteConnection(socketFd);
+    }
+
     TcpNetworkInterface::PendingConnection::PendingConnection(SocketFd socketFd, uint32_t remoteIpAddress, uint16_t remotePort, uint16_t listenPort)
         : m_socketFd(socketFd)
         , m_remoteIpAddress(remoteIpAddress)
@@ -11,8 +11,10 @@
 #include <AzNetworking/TcpTransport/TcpPacketHeader.h>
 #include <AzNetworking/TcpTransport/TcpConnectionSet.h>
 #include <AzNetworking/TcpTransport/TcpListenThread.h>
+#include <AzNetworking/TcpTransport/TcpReceiveThread.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
 
 namespace AzNetworking
@@ -116,6 +118,13 @@ namespace AzNetworking
         //! @param currentTimeMs current time in milliseconds for metrics management
         bool HandleConnectionRecv(SocketFd socketFd, AZ::TimeMs currentTimeMs);
 
+        //! Performs connection receive updates for every connection that ran out of receive budget on the previous update.
+        void HandlePendingRecvs();
+
+        //! Handles all packets and socket events framed by the receive thread since the last update.
+        //! @param currentTimeMs current time in milliseconds for metrics management
+        void HandleReceivedPackets(AZ::TimeMs currentTimeMs);
+
         //! Performs connection send updates for a single socket.
         //! @param socketFd socket descriptor to send data to
         bool HandleConnectionSend(SocketFd socketFd);
@@ -137,6 +146,10 @@ namespace AzNetworking
         //! Deletes all connections queued for removal from the network interface.
         void FlushQueuedRemoves();
 
+        //! Deletes a connection and releases its socket from the socket manager.
+        //! @param socketFd the socket file descriptor of the connection to delete
+        void DeleteConnection(SocketFd socketFd);
+
         AZ_DISABLE_COPY_MOVE(TcpNetworkInterface);
 
         struct PendingRemove
@@ -156,6 +169,12 @@ namespace AzNetworking
         AZStd::vector<PendingRemove> m_pendingRemoves;
         TcpListenThread& m_listenThread;
 
+        //! Only created if net_TcpReceiveThread is enabled, receives and frames traffic off the main thread
+        AZStd::unique_ptr<TcpReceiveThread> m_receiveThread;
+
+        //! Sockets waiting on the receive thread to release them before their connections can be deleted
+        AZStd::unordered_set<SocketFd> m_removingSockets;
+
         friend class TcpConnection; // For access to private RequestDisconnect() method
     };
 }
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/TcpTransport/TcpReceiveThread.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR_EXTERNED(uint32_t, net_TcpMaxRecvBytesPerUpdate);
+
+    static constexpr AZ::TimeMs ReceiveThreadUpdateRateMs{ 10 };
+
+    TcpReceiveThread::TcpReceiveThread()
+        : TimedThread("AzNetworking::TcpReceiveThread", ReceiveThreadUpdateRateMs)
+    {
+        ;
+    }
+
+    TcpReceiveThread::~TcpReceiveThread()
+    {
+        Stop();
+        Join();
+
+        ReceivedPacket* packet = nullptr;
+        while (m_receivedPackets.TryPop(packet))
+        {
+            delete packet;
+        }
+        while (m_freePackets.TryPop(packet))
+        {
+            delete packet;
+        }
+        for (ReceivedPacket* backlogPacket : m_backlog)
+        {
+            delete backlogPacket;
+        }
+    }
+
+    void TcpReceiveThread::AddSocket(TcpSocket& tcpSocket)
+    {
+        m_socketCommands.PushBackItem(SocketCommand{ &tcpSocket, tcpSocket.GetSocketFd() });
+    }
+
+    void TcpReceiveThread::RemoveSocket(SocketFd socketFd)
+    {
+        m_socketCommands.PushBackItem(SocketCommand{ nullptr, socketFd });
+    }
+
+    bool TcpReceiveThread::PopReceivedPacket(ReceivedPacket*& outPacket)
+    {
+        return m_receivedPackets.TryPop(outPacket);
+    }
+
+    void TcpReceiveThread::ReleaseReceivedPacket(ReceivedPacket* packet)
+    {
+        if (!m_freePackets.TryPush(packet))
+        {
+            delete packet;
+        }
+    }
+
+    AZ::TimeMs TcpReceiveThread::GetUpdateTimeMs() const
+    {
+        return m_updateTimeMs;
+    }
+
+    void TcpReceiveThread::OnStart()
+    {
+        AZLOG_INFO("Starting TcpReceiveThread");
+    }
+
+    void TcpReceiveThread::OnStop()
+    {
+        AZLOG_INFO("Stopping TcpReceiveThread");
+    }
+
+    void TcpReceiveThread::OnUpdate(AZ::TimeMs updateRateMs)
+    {
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        const AZ::TimeMs endTimeMs = startTimeMs + updateRateMs;
+
+        auto readCallback = [this](SocketFd socketFd)
+        {
+            auto iter = m_receiveSockets.find(socketFd);
+            if (iter != m_receiveSockets.end())
+            {
+                iter->second->m_readPending = true;
+            }
+        };
+        auto writeCallback = [](SocketFd) {};
+
+        // Block on socket events for the remainder of the update rather than sleeping, so new data is framed as soon as it arrives
+        for (AZ::TimeMs currentTimeMs = startTimeMs; currentTimeMs < endTimeMs && IsRunning(); currentTimeMs = AZ::GetElapsedTimeMs())
+        {
+            ProcessSocketCommands();
+
+            if (!FlushBacklog())
+            {
+                // The network interface has fallen behind, yield until it catches up
+                break;
+            }
+
+            bool hasPendingReads = false;
+            for (auto& [socketFd, receiveSocket] : m_receiveSockets)
+            {
+                if (receiveSocket->m_readPending && !receiveSocket->m_disconnected)
+                {
+                    DrainSocket(socketFd, *receiveSocket);
+                    hasPendingReads |= receiveSocket->m_readPending;
+                }
+            }
+
+            const AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs();
+            const AZ::TimeMs maxBlockMs = (hasPendingReads || elapsedTimeMs >= endTimeMs) ? AZ::Time::ZeroTimeMs : endTimeMs - elapsedTimeMs;
+            m_tcpSocketManager.ProcessEvents(maxBlockMs, readCallback, writeCallback);
+        }
+
+        m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
+    }
+
+    void TcpReceiveThread::ProcessSocketCommands()
+    {
+        AZ::ThreadSafeDeque<SocketCommand>::DequeType socketCommands;
+        m_socketCommands.Swap(socketCommands);
+
+        for (const SocketCommand& socketCommand : socketCommands)
+        {
+            if (socketCommand.m_tcpSocket != nullptr)
+            {
+                AZStd::unique_ptr<ReceiveSocket> receiveSocket = AZStd::make_unique<ReceiveSocket>();
+                receiveSocket->m_tcpSocket = socketCommand.m_tcpSocket;
+                ReceiveSocket& receiveSocketRef = *receiveSocket;
+                m_receiveSockets[socketCommand.m_socketFd] = AZStd::move(receiveSocket);
+
+                if (!m_tcpSocketManager.AddSocket(socketCommand.m_socketFd))
+                {
+                    AZLOG_ERROR("Failed to bind socket %d to the receive thread", static_cast<int32_t>(socketCommand.m_socketFd));
+                    DisconnectSocket(socketCommand.m_socketFd, receiveSocketRef, DisconnectReason::TransportError);
+                }
+                continue;
+            }
+
+            auto iter = m_receiveSockets.find(socketCommand.m_socketFd);
+            if (iter != m_receiveSockets.end())
+            {
+                if (!iter->second->m_disconnected)
+                {
+                    m_tcpSocketManager.ClearSocket(socketCommand.m_socketFd);
+                }
+                m_receiveSockets.erase(iter);
+            }
+
+            // Always acknowledge, the network interface defers closing the socket until it sees this event
+            ReceivedPacket* packet = AcquireReceivedPacket();
+            packet->m_type = ReceivedPacketType::Removed;
+            packet->m_socketFd = socketCommand.m_socketFd;
+            packet->m_receivedBytes = 0;
+            packet->m_reason = DisconnectReason::None;
+            QueueReceivedPacket(packet);
+        }
+    }
+
+    void TcpReceiveThread::DrainSocket(SocketFd socketFd, ReceiveSocket& receiveSocket)
+    {
+        // Sockets may be registered edge triggered (epoll), so keep reading until the socket would block
+        // Stop at the receive budget with the read still pending, so a single busy socket can't starve the others
+        uint32_t totalReceivedBytes = 0;
+        while (!receiveSocket.m_disconnected && totalReceivedBytes < net_TcpMaxRecvBytesPerUpdate)
+        {
+            if (!m_backlog.empty())
+            {
+                // Leave the read pending and resume once the backlog has been flushed
+                return;
+            }
+
+            uint8_t* dstData = receiveSocket.m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
+            if (dstData == nullptr)
+            {
+                AZLOG_ERROR("Receive ringbuffer full, dropped connection");
+                DisconnectSocket(socketFd, receiveSocket, DisconnectReason::StreamError);
+                return;
+            }
+
+            const int32_t receivedBytes = receiveSocket.m_tcpSocket->Receive(dstData, MaxPacketSize);
+            if (receivedBytes == 0)
+            {
+                // No more data on the socket
+                receiveSocket.m_readPending = false;
+                return;
+            }
+
+            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
+            if (disconnectReason != DisconnectReason::MAX)
+            {
+                DisconnectSocket(socketFd, receiveSocket, disconnectReason);
+                return;
+            }
+
+            receiveSocket.m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
+            totalReceivedBytes += aznumeric_cast<uint32_t>(receivedBytes);
+            if (!FramePackets(socketFd, receiveSocket))
+            {
+                AZLOG_WARN("Received malformed packet stream on socket %d, dropped connection", static_cast<int32_t>(socketFd));
+                DisconnectSocket(socketFd, receiveSocket, DisconnectReason::StreamError);
+                return;
+            }
+        }
+    }
+
+    bool TcpReceiveThread::FramePackets(SocketFd socketFd, ReceiveSocket& receiveSocket)
+    {
+        for (;;)
+        {
+            NetworkOutputSerializer serializer(receiveSocket.m_recvRingbuffer.GetReadBufferData(), receiveSocket.m_recvRingbuffer.GetReadBufferSize());
+            TcpPacketHeader header(PacketType(0), 0);
+            if (!header.Serialize(serializer))
+            {
+                return true;
+            }
+
+            const uint16_t payloadSize = header.GetPacketSize();
+            if (payloadSize > serializer.GetUnreadSize())
+            {
+                // We don't have all the data required for this packet yet
+                return true;
+            }
+
+            if (payloadSize > TcpPacketEncodingBuffer::GetCapacity())
+            {
+                return false;
+            }
+
+            ReceivedPacket* packet = AcquireReceivedPacket();
+            packet->m_type = ReceivedPacketType::Packet;
+            packet->m_socketFd = socketFd;
+            packet->m_header = header;
+            packet->m_payload.Resize(payloadSize);
+            memcpy(packet->m_payload.GetBuffer(), serializer.GetUnreadData(), payloadSize);
+            packet->m_receivedBytes = serializer.GetReadSize() + payloadSize;
+            packet->m_reason = DisconnectReason::None;
+
+            receiveSocket.m_recvRingbuffer.AdvanceReadBuffer(packet->m_receivedBytes);
+            QueueReceivedPacket(packet);
+        }
+    }
+
+    void TcpReceiveThread::DisconnectSocket(SocketFd socketFd, ReceiveSocket& receiveSocket, DisconnectReason reason)
+    {
+        receiveSocket.m_disconnected = true;
+        receiveSocket.m_readPending = false;
+        m_tcpSocketManager.ClearSocket(socketFd);
+
+        ReceivedPacket* packet = AcquireReceivedPacket();
+        packet->m_type = ReceivedPacketType::Disconnected;
+        packet->m_socketFd = socketFd;
+        packet->m_receivedBytes = 0;
+        packet->m_reason = reason;
+        QueueReceivedPacket(packet);
+    }
+
+    TcpReceiveThread::ReceivedPacket* TcpReceiveThread::AcquireReceivedPacket()
+    {
+        ReceivedPacket* packet = nullptr;
+        if (!m_freePackets.TryPop(packet))
+        {
+            packet = new ReceivedPacket();
+        }
+        return packet;
+    }
+
+    void TcpReceiveThread::QueueReceivedPacket(ReceivedPacket* packet)
+    {
+        // Preserve ordering, nothing may bypass packets already waiting in the backlog
+        if (!m_backlog.empty() || !m_receivedPackets.TryPush(packet))
+        {
+            m_backlog.push_back(packet);
+        }
+    }
+
+    bool TcpReceiveThread::FlushBacklog()
+    {
+        while (!m_backlog.empty())
+        {
+            if (!m_receivedPackets.TryPush(m_backlog.front()))
+            {
+                return false;
+            }
+            m_backlog.pop_front();
+        }
+        return true;
+    }
+}
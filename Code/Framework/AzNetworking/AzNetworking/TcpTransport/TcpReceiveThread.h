@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/TcpTransport/TcpSocket.h>
+#include <AzNetworking/TcpTransport/TcpSocketManager.h>
+#include <AzNetworking/TcpTransport/TcpPacketHeader.h>
+#include <AzNetworking/TcpTransport/TcpRingBuffer.h>
+#include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/DataStructures/SpscRingBuffer.h>
+#include <AzNetworking/Utilities/TimedThread.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Threading/ThreadSafeDeque.h>
+
+namespace AzNetworking
+{
+    //! @class TcpReceiveThread
+    //! @brief A class for reading and framing TCP traffic for a single network interface off the main thread.
+    //!
+    //! Registered sockets are drained until they would block, and complete packets are framed off the stream
+    //! and handed to the owning network interface through a lock-free single producer single consumer queue.
+    //! Packets are handed off still compressed, decompression remains on the thread that consumes them.
+    //! Sockets must stay open until their removal has been acknowledged by a ReceivedPacketType::Removed event.
+    class TcpReceiveThread final
+        : public TimedThread
+    {
+    public:
+
+        enum class ReceivedPacketType
+        {
+            Packet,       //!< A complete packet was received on the socket
+            Disconnected, //!< The socket encountered an error or was closed by the remote endpoint
+            Removed       //!< The socket has been released by the receive thread and may safely be closed
+        };
+
+        //! @struct ReceivedPacket
+        //! @brief a single event handed from the receive thread to the owning network interface.
+        struct ReceivedPacket
+        {
+            ReceivedPacketType m_type = ReceivedPacketType::Packet;
+            SocketFd m_socketFd = InvalidSocketFd;
+            TcpPacketHeader m_header = TcpPacketHeader(PacketType(0), 0);
+            TcpPacketEncodingBuffer m_payload;
+            uint32_t m_receivedBytes = 0; //!< Bytes read off the socket for this packet, including the packet header
+            DisconnectReason m_reason = DisconnectReason::None;
+        };
+
+        TcpReceiveThread();
+        ~TcpReceiveThread() override;
+
+        //! Starts receiving on the provided socket, the socket must outlive its registration.
+        //! @param tcpSocket the socket to receive on
+        void AddSocket(TcpSocket& tcpSocket);
+
+        //! Stops receiving on the provided socket, a ReceivedPacketType::Removed event is queued once the socket is released.
+        //! @param socketFd the socket file descriptor to stop receiving on
+        void RemoveSocket(SocketFd socketFd);
+
+        //! Pops the oldest received event, may only be invoked from the thread owning the network interface.
+        //! @param outPacket on success, the popped event which must be returned through ReleaseReceivedPacket
+        //! @return boolean true if an event was popped, false if none are pending
+        bool PopReceivedPacket(ReceivedPacket*& outPacket);
+
+        //! Returns a popped event to the receive thread for reuse.
+        //! @param packet the event to release
+        void ReleaseReceivedPacket(ReceivedPacket* packet);
+
+        //! Gets the total elapsed time spent updating the background thread in milliseconds
+        //! @return the total elapsed time spent updating the background thread in milliseconds
+        AZ::TimeMs GetUpdateTimeMs() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(TcpReceiveThread);
+
+        static constexpr uint32_t ReceivedPacketQueueSize = 4096;
+        static constexpr uint32_t RecvRingbufferSize = 1024 * 1024; // 1 MB recv buffer, matches TcpConnection
+
+        struct SocketCommand
+        {
+            TcpSocket* m_tcpSocket = nullptr;
+            SocketFd m_socketFd = InvalidSocketFd;
+        };
+
+        struct ReceiveSocket
+        {
+            TcpSocket* m_tcpSocket = nullptr;
+            TcpRingBuffer<RecvRingbufferSize> m_recvRingbuffer;
+            bool m_readPending = true;
+            bool m_disconnected = false;
+        };
+
+        void OnStart() override;
+        void OnStop() override;
+        void OnUpdate(AZ::TimeMs updateRateMs) override;
+
+        //! Applies all queued socket additions and removals.
+        void ProcessSocketCommands();
+
+        //! Reads from a single socket until it would block or the outgoing queue backs up.
+        //! @param socketFd      the socket file descriptor to read from
+        //! @param receiveSocket the receive state of the socket
+        void DrainSocket(SocketFd socketFd, ReceiveSocket& receiveSocket);
+
+        //! Frames every complete packet in the socket's receive ringbuffer.
+        //! @param socketFd      the socket file descriptor the data was read from
+        //! @param receiveSocket the receive state of the socket
+        //! @return boolean false if the stream is malformed and the socket must be disconnected
+        bool FramePackets(SocketFd socketFd, ReceiveSocket& receiveSocket);
+
+        //! Marks a socket as disconnected and notifies the owning network interface.
+        //! @param socketFd      the socket file descriptor that disconnected
+        //! @param receiveSocket the receive state of the socket
+        //! @param reason        reason for the disconnect
+        void DisconnectSocket(SocketFd socketFd, ReceiveSocket& receiveSocket, DisconnectReason reason);
+
+        //! Returns a pooled event, allocating a new one if the pool is empty.
+        //! @return pointer to an event ready to be filled in
+        ReceivedPacket* AcquireReceivedPacket();
+
+        //! Queues an event for the owning network interface.
+        //! @param packet the event to queue
+        void QueueReceivedPacket(ReceivedPacket* packet);
+
+        //! Pushes as much of the overflow backlog as possible onto the outgoing queue.
+        //! @return boolean true if the backlog has been fully flushed
+        bool FlushBacklog();
+
+        TcpSocketManager m_tcpSocketManager;
+        AZ::ThreadSafeDeque<SocketCommand> m_socketCommands;
+        AZStd::unordered_map<SocketFd, AZStd::unique_ptr<ReceiveSocket>> m_receiveSockets;
+        AZStd::deque<ReceivedPacket*> m_backlog;
+        SpscRingBuffer<ReceivedPacket*, ReceivedPacketQueueSize> m_receivedPackets;
+        SpscRingBuffer<ReceivedPacket*, ReceivedPacketQueueSize> m_freePackets;
+        AZ::TimeMs m_updateTimeMs = AZ::Time::ZeroTimeMs;
+    };
+}
@@ -9,6 +9,8 @@
 #include <AzNetworking/TcpTransport/TcpSocketManager.h>
 #include <AzCore/Console/ILogger.h>
 
+// Currently dormant, AZ_TRAIT_USE_SOCKET_SERVER_EPOLL is 0 on every platform so all platforms use TcpSocketManager_Select.cpp
+// Enable the trait in the platform's AzNetworking_Traits_Platform.h and run the AzNetworking TCP tests before relying on this path
 #if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
 
 namespace AzNetworking
@@ -52,6 +54,8 @@ namespace AzNetworking
 
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
+        // Closing the socket would also remove it, but the socket may be shared with another socket manager and outlive this registration
+        epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), nullptr);
         ClearSocketHelper(socketFd);
         return true;
     }
@@ -59,7 +63,8 @@ namespace AzNetworking
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
+        // Never block indefinitely, the network interface update polls with a zero timeout from the main thread
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
         if (numEpollEvents < 0)
         {
             const int32_t error = GetLastNetworkError();
@@ -90,6 +90,20 @@ namespace AzNetworking
         return true;
     }
 
+    uint16_t GetSocketBoundPort(SocketFd socketFd)
+    {
+        sockaddr_in boundAddress;
+        socklen_t boundAddressLength = sizeof(boundAddress);
+        if (::getsockname(int32_t(socketFd), (sockaddr*)&boundAddress, &boundAddressLength) != SocketOpResultSuccess)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_ERROR("Failed to retrieve the bound port of socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return 0;
+        }
+
+        return ntohs(boundAddress.sin_port);
+    }
+
     void CloseSocket(SocketFd socketFd)
     {
         if (int32_t(socketFd) <= 0)
@@ -82,6 +82,11 @@ namespace AzNetworking
     //! @return boolean true on success
     bool SetSocketBufferSizes(SocketFd socketFd, int32_t sendSize, int32_t recvSize);
 
+    //! Returns the local port the provided socket is bound to, useful for sockets opened on port 0.
+    //! @param socketFd identifier of the bound socket to query
+    //! @return the local port in host byte order, or 0 on failure
+    uint16_t GetSocketBoundPort(SocketFd socketFd);
+
     //! Closes the provided socket.
     //! @param socketFd identifier of socket to close
     void CloseSocket(SocketFd socketFd);
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/DataStructures/FixedSizeBitset.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! @class QuantizedQuaternion
+    //! @brief unit quaternion replicated using smallest three compression.
+    //!
+    //! The largest magnitude component is dropped and reconstructed from the unit length constraint on decode. The sign of the
+    //! quaternion is flipped if required so the dropped component is always positive, which leaves the remaining three components
+    //! within [-1/sqrt(2), 1/sqrt(2)]. Those are range quantized to BITS_PER_COMPONENT bits each and packed alongside a two bit
+    //! index of the dropped component, 47 bits (6 bytes) for the default precision versus 16 bytes for a full quaternion.
+    //! The value is quantized on assignment, so both endpoints always observe identical values.
+    template <uint32_t BITS_PER_COMPONENT = 15>
+    class QuantizedQuaternion
+    {
+    public:
+
+        static_assert((BITS_PER_COMPONENT >= 4) && (BITS_PER_COMPONENT <= 24), "Unsupported quaternion component precision");
+
+        static constexpr uint32_t PackedBitCount = 2 + 3 * BITS_PER_COMPONENT;
+
+        using SelfType = QuantizedQuaternion<BITS_PER_COMPONENT>;
+        using PackedType = FixedSizeBitset<PackedBitCount, uint8_t>;
+
+        //! Default constructor, initializes to identity.
+        QuantizedQuaternion();
+
+        //! Construct from quaternion, intentionally implicit so this can stand in for AZ::Quaternion as a network property type.
+        //! @param value quaternion to construct from, expected to be normalized
+        QuantizedQuaternion(const AZ::Quaternion& value);
+
+        QuantizedQuaternion(const SelfType&) = default;
+        SelfType& operator =(const SelfType&) = default;
+
+        //! Assignment from quaternion.
+        //! @param rhs quaternion to assign from, expected to be normalized
+        SelfType& operator =(const AZ::Quaternion& rhs);
+
+        //! Const underlying type operator.
+        //! @return the quantized quaternion
+        operator const AZ::Quaternion&() const;
+
+        //! Returns the quantized quaternion.
+        //! @return the quantized quaternion
+        const AZ::Quaternion& GetQuaternion() const;
+
+        //! Returns the packed representation sent over the network.
+        //! @return the packed representation sent over the network
+        const PackedType& GetPackedBits() const;
+
+        //! Equality operator, compares the quantized representations.
+        //! @param rhs instance to compare against
+        //! @return boolean true if this == rhs
+        bool operator ==(const SelfType& rhs) const;
+
+        //! Inequality operator, compares the quantized representations.
+        //! @param rhs instance to compare against
+        //! @return boolean true if this != rhs
+        bool operator !=(const SelfType& rhs) const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+        //! Quantizes an array of quaternions.
+        //! @param values       the quaternions to quantize
+        //! @param outQuantized the output quantized values, must hold count elements
+        //! @param count        the number of quaternions to quantize
+        static void QuantizeBatch(const AZ::Quaternion* values, SelfType* outQuantized, AZStd::size_t count);
+
+    private:
+
+        void Set(const AZ::Quaternion& value);
+        void Decode();
+
+        AZ::Quaternion m_value;
+        PackedType m_packedBits;
+    };
+
+    //! @class QuantizedVector3
+    //! @brief Vector3 replicated using per axis range quantization to an arbitrary number of bits.
+    //!
+    //! Each axis is clamped to [MIN_VALUE, MAX_VALUE] and quantized to BITS_PER_AXIS bits, so unlike QuantizedValues the packed
+    //! size is not restricted to whole bytes per element. The value is quantized on assignment, so both endpoints always observe
+    //! identical values.
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    class QuantizedVector3
+    {
+    public:
+
+        static_assert((BITS_PER_AXIS >= 2) && (BITS_PER_AXIS <= 24), "Unsupported axis precision, use an unquantized AZ::Vector3 instead");
+        static_assert(MIN_VALUE < MAX_VALUE, "Invalid quantization range");
+
+        static constexpr uint32_t PackedBitCount = 3 * BITS_PER_AXIS;
+
+        using SelfType = QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>;
+        using PackedType = FixedSizeBitset<PackedBitCount, uint8_t>;
+
+        //! Default constructor, initializes to the zero vector (clamped to the quantization range).
+        QuantizedVector3();
+
+        //! Construct from vector, intentionally implicit so this can stand in for AZ::Vector3 as a network property type.
+        //! @param value vector to construct from
+        QuantizedVector3(const AZ::Vector3& value);
+
+        QuantizedVector3(const SelfType&) = default;
+        SelfType& operator =(const SelfType&) = default;
+
+        //! Assignment from vector.
+        //! @param rhs vector to assign from
+        SelfType& operator =(const AZ::Vector3& rhs);
+
+        //! Const underlying type operator.
+        //! @return the quantized vector
+        operator const AZ::Vector3&() const;
+
+        //! Returns the quantized vector.
+        //! @return the quantized vector
+        const AZ::Vector3& GetVector() const;
+
+        //! Returns the packed representation sent over the network.
+        //! @return the packed representation sent over the network
+        const PackedType& GetPackedBits() const;
+
+        //! Equality operator, compares the quantized representations.
+        //! @param rhs instance to compare against
+        //! @return boolean true if this == rhs
+        bool operator ==(const SelfType& rhs) const;
+
+        //! Inequality operator, compares the quantized representations.
+        //! @param rhs instance to compare against
+        //! @return boolean true if this != rhs
+        bool operator !=(const SelfType& rhs) const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+        //! Quantizes an array of vectors, four at a time in structure of arrays form.
+        //! @param values       the vectors to quantize
+        //! @param outQuantized the output quantized values, must hold count elements
+        //! @param count        the number of vectors to quantize
+        static void QuantizeBatch(const AZ::Vector3* values, SelfType* outQuantized, AZStd::size_t count);
+
+    private:
+
+        void Set(const AZ::Vector3& value);
+        void Decode();
+
+        AZ::Vector3 m_value;
+        PackedType m_packedBits;
+    };
+}
+
+#include <AzNetworking/Utilities/QuantizedTransforms.inl>
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+
+namespace AzNetworking
+{
+    template <uint32_t BITS_PER_COMPONENT>
+    struct SmallestThreeConstants
+    {
+        static constexpr float ComponentRange = 0.707106781f; // 1 / sqrt(2), the largest magnitude any non-dropped component can have
+        // One code is left unused so the quantized range has an exact midpoint and zero components decode exactly
+        static constexpr float MaxQuantizedValue = static_cast<float>((1u << BITS_PER_COMPONENT) - 2);
+        static constexpr float EncodeScale = MaxQuantizedValue / (2.0f * ComponentRange);
+        static constexpr float DecodeScale = (2.0f * ComponentRange) / MaxQuantizedValue;
+    };
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline QuantizedQuaternion<BITS_PER_COMPONENT>::QuantizedQuaternion()
+    {
+        Set(AZ::Quaternion::CreateIdentity());
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline QuantizedQuaternion<BITS_PER_COMPONENT>::QuantizedQuaternion(const AZ::Quaternion& value)
+    {
+        Set(value);
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline QuantizedQuaternion<BITS_PER_COMPONENT>& QuantizedQuaternion<BITS_PER_COMPONENT>::operator =(const AZ::Quaternion& rhs)
+    {
+        Set(rhs);
+        return *this;
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline QuantizedQuaternion<BITS_PER_COMPONENT>::operator const AZ::Quaternion&() const
+    {
+        return m_value;
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline const AZ::Quaternion& QuantizedQuaternion<BITS_PER_COMPONENT>::GetQuaternion() const
+    {
+        return m_value;
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline const typename QuantizedQuaternion<BITS_PER_COMPONENT>::PackedType& QuantizedQuaternion<BITS_PER_COMPONENT>::GetPackedBits() const
+    {
+        return m_packedBits;
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline bool QuantizedQuaternion<BITS_PER_COMPONENT>::operator ==(const SelfType& rhs) const
+    {
+        return m_packedBits == rhs.m_packedBits;
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline bool QuantizedQuaternion<BITS_PER_COMPONENT>::operator !=(const SelfType& rhs) const
+    {
+        return m_packedBits != rhs.m_packedBits;
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline bool QuantizedQuaternion<BITS_PER_COMPONENT>::Serialize(ISerializer& serializer)
+    {
+        const bool success = m_packedBits.Serialize(serializer);
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            Decode();
+        }
+        return success;
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline void QuantizedQuaternion<BITS_PER_COMPONENT>::QuantizeBatch(const AZ::Quaternion* values, SelfType* outQuantized, AZStd::size_t count)
+    {
+        // Each quaternion already fills a full simd register, so there is nothing further to gain from transposing
+        for (AZStd::size_t i = 0; i < count; ++i)
+        {
+            outQuantized[i].Set(values[i]);
+        }
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline void QuantizedQuaternion<BITS_PER_COMPONENT>::Set(const AZ::Quaternion& value)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using Constants = SmallestThreeConstants<BITS_PER_COMPONENT>;
+
+        Vec4::FloatType components = value.GetSimdValue();
+        float magnitudes[4];
+        Vec4::StoreUnaligned(magnitudes, Vec4::Abs(components));
+
+        uint32_t largestIndex = 0;
+        for (uint32_t i = 1; i < 4; ++i)
+        {
+            if (magnitudes[i] > magnitudes[largestIndex])
+            {
+                largestIndex = i;
+            }
+        }
+
+        // q and -q are the same rotation, flip so the dropped component is positive and need not be sent
+        if (value.GetElement(static_cast<int32_t>(largestIndex)) < 0.0f)
+        {
+            components = Vec4::Sub(Vec4::ZeroFloat(), components);
+        }
+
+        const Vec4::FloatType range = Vec4::Splat(Constants::ComponentRange);
+        const Vec4::FloatType clamped = Vec4::Clamp(components, Vec4::Sub(Vec4::ZeroFloat(), range), range);
+        const Vec4::FloatType scaled = Vec4::Mul(Vec4::Add(clamped, range), Vec4::Splat(Constants::EncodeScale));
+        int32_t quantized[4];
+        Vec4::StoreUnaligned(quantized, Vec4::ConvertToIntNearest(scaled));
+
+        m_packedBits.SetBits(0, 2, largestIndex);
+        uint32_t bitIndex = 2;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i != largestIndex)
+            {
+                m_packedBits.SetBits(bitIndex, BITS_PER_COMPONENT, static_cast<uint32_t>(quantized[i]));
+                bitIndex += BITS_PER_COMPONENT;
+            }
+        }
+
+        Decode();
+    }
+
+    template <uint32_t BITS_PER_COMPONENT>
+    inline void QuantizedQuaternion<BITS_PER_COMPONENT>::Decode()
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using Constants = SmallestThreeConstants<BITS_PER_COMPONENT>;
+
+        const uint32_t largestIndex = m_packedBits.GetBits(0, 2);
+        int32_t quantized[4] = { 0, 0, 0, 0 };
+        uint32_t bitIndex = 2;
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i != largestIndex)
+            {
+                quantized[i] = static_cast<int32_t>(m_packedBits.GetBits(bitIndex, BITS_PER_COMPONENT));
+                bitIndex += BITS_PER_COMPONENT;
+            }
+        }
+
+        const Vec4::FloatType decoded = Vec4::Sub
+        (
+            Vec4::Mul(Vec4::ConvertToFloat(Vec4::LoadUnaligned(quantized)), Vec4::Splat(Constants::DecodeScale)),
+            Vec4::Splat(Constants::ComponentRange)
+        );
+
+        float components[4];
+        Vec4::StoreUnaligned(components, decoded);
+        components[largestIndex] = 0.0f;
+        const float lengthSq = components[0] * components[0] + components[1] * components[1] + components[2] * components[2] + components[3] * components[3];
+        components[largestIndex] = AZ::Sqrt(AZ::GetMax(0.0f, 1.0f - lengthSq));
+        m_value = AZ::Quaternion::CreateFromFloat4(components);
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    struct RangeQuantizationConstants
+    {
+        static constexpr float MinValue = static_cast<float>(MIN_VALUE);
+        static constexpr float MaxValue = static_cast<float>(MAX_VALUE);
+        // One code is left unused so symmetric ranges have an exact midpoint and zero decodes exactly
+        static constexpr float MaxQuantizedValue = static_cast<float>((1u << BITS_PER_AXIS) - 2);
+        static constexpr float EncodeScale = MaxQuantizedValue / (MaxValue - MinValue);
+        static constexpr float DecodeScale = (MaxValue - MinValue) / MaxQuantizedValue;
+
+        static AZ::Simd::Vec4::Int32Type Encode(AZ::Simd::Vec4::FloatArgType values)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            const Vec4::FloatType minValue = Vec4::Splat(MinValue);
+            const Vec4::FloatType clamped = Vec4::Clamp(values, minValue, Vec4::Splat(MaxValue));
+            return Vec4::ConvertToIntNearest(Vec4::Mul(Vec4::Sub(clamped, minValue), Vec4::Splat(EncodeScale)));
+        }
+
+        static AZ::Simd::Vec4::FloatType Decode(AZ::Simd::Vec4::Int32ArgType quantized)
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            return Vec4::Madd(Vec4::ConvertToFloat(quantized), Vec4::Splat(DecodeScale), Vec4::Splat(MinValue));
+        }
+    };
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::QuantizedVector3()
+    {
+        Set(AZ::Vector3::CreateZero());
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::QuantizedVector3(const AZ::Vector3& value)
+    {
+        Set(value);
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>& QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::operator =(const AZ::Vector3& rhs)
+    {
+        Set(rhs);
+        return *this;
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::operator const AZ::Vector3&() const
+    {
+        return m_value;
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline const AZ::Vector3& QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::GetVector() const
+    {
+        return m_value;
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline const typename QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::PackedType& QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::GetPackedBits() const
+    {
+        return m_packedBits;
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline bool QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::operator ==(const SelfType& rhs) const
+    {
+        return m_packedBits == rhs.m_packedBits;
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline bool QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::operator !=(const SelfType& rhs) const
+    {
+        return m_packedBits != rhs.m_packedBits;
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline bool QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::Serialize(ISerializer& serializer)
+    {
+        const bool success = m_packedBits.Serialize(serializer);
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            Decode();
+        }
+        return success;
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline void QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::QuantizeBatch(const AZ::Vector3* values, SelfType* outQuantized, AZStd::size_t count)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using Constants = RangeQuantizationConstants<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>;
+
+        AZStd::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            // Transpose four vectors into x, y and z registers so each axis is quantized four values at a time
+            const Vec4::FloatType rows[4] =
+            {
+                Vec4::FromVec3(values[i + 0].GetSimdValue()),
+                Vec4::FromVec3(values[i + 1].GetSimdValue()),
+                Vec4::FromVec3(values[i + 2].GetSimdValue()),
+                Vec4::FromVec3(values[i + 3].GetSimdValue())
+            };
+            Vec4::FloatType axes[4];
+            Vec4::Mat4x4Transpose(rows, axes);
+
+            int32_t quantized[3][4];
+            Vec4::FloatType decodedAxes[4];
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                const Vec4::Int32Type quantizedAxis = Constants::Encode(axes[axis]);
+                Vec4::StoreUnaligned(quantized[axis], quantizedAxis);
+                decodedAxes[axis] = Constants::Decode(quantizedAxis);
+            }
+            decodedAxes[3] = Vec4::ZeroFloat();
+
+            Vec4::FloatType decodedRows[4];
+            Vec4::Mat4x4Transpose(decodedAxes, decodedRows);
+            for (uint32_t lane = 0; lane < 4; ++lane)
+            {
+                SelfType& output = outQuantized[i + lane];
+                for (uint32_t axis = 0; axis < 3; ++axis)
+                {
+                    output.m_packedBits.SetBits(axis * BITS_PER_AXIS, BITS_PER_AXIS, static_cast<uint32_t>(quantized[axis][lane]));
+                }
+                output.m_value = AZ::Vector3(Vec4::ToVec3(decodedRows[lane]));
+            }
+        }
+
+        for (; i < count; ++i)
+        {
+            outQuantized[i].Set(values[i]);
+        }
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline void QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::Set(const AZ::Vector3& value)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using Constants = RangeQuantizationConstants<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>;
+
+        const Vec4::Int32Type quantizedVector = Constants::Encode(Vec4::FromVec3(value.GetSimdValue()));
+        int32_t quantized[4];
+        Vec4::StoreUnaligned(quantized, quantizedVector);
+        for (uint32_t axis = 0; axis < 3; ++axis)
+        {
+            m_packedBits.SetBits(axis * BITS_PER_AXIS, BITS_PER_AXIS, static_cast<uint32_t>(quantized[axis]));
+        }
+        m_value = AZ::Vector3(Vec4::ToVec3(Constants::Decode(quantizedVector)));
+    }
+
+    template <uint32_t BITS_PER_AXIS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline void QuantizedVector3<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>::Decode()
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using Constants = RangeQuantizationConstants<BITS_PER_AXIS, MIN_VALUE, MAX_VALUE>;
+
+        const Vec4::Int32Type quantized = Vec4::LoadImmediate
+        (
+            static_cast<int32_t>(m_packedBits.GetBits(0 * BITS_PER_AXIS, BITS_PER_AXIS)),
+            static_cast<int32_t>(m_packedBits.GetBits(1 * BITS_PER_AXIS, BITS_PER_AXIS)),
+            static_cast<int32_t>(m_packedBits.GetBits(2 * BITS_PER_AXIS, BITS_PER_AXIS)),
+            0
+        );
+        m_value = AZ::Vector3(Vec4::ToVec3(Constants::Decode(quantized)));
+    }
+}
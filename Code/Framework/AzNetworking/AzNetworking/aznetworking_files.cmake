@@ -36,6 +36,8 @@ set(FILES
     DataStructures/IBitset.h
     DataStructures/RingBufferBitset.h
     DataStructures/RingBufferBitset.inl
+    DataStructures/SpscRingBuffer.h
+    DataStructures/SpscRingBuffer.inl
     DataStructures/TimeoutQueue.cpp
     DataStructures/TimeoutQueue.h
     DataStructures/TimeoutQueue.inl
@@ -45,6 +47,10 @@ set(FILES
     Framework/NetworkingSystemComponent.cpp
     Framework/NetworkingSystemComponent.h
     Framework/NetworkInterfaceMetrics.h
+    Framework/PacketCapture.cpp
+    Framework/PacketCapture.h
+    Framework/PacketReplay.cpp
+    Framework/PacketReplay.h
     PacketLayer/IPacket.h
     PacketLayer/IPacketHeader.h
     Serialization/AbstractValue.h
@@ -93,6 +99,8 @@ set(FILES
     TcpTransport/TcpListenThread.h
     TcpTransport/TcpNetworkInterface.cpp
     TcpTransport/TcpNetworkInterface.h
+    TcpTransport/TcpReceiveThread.cpp
+    TcpTransport/TcpReceiveThread.h
     UdpTransport/DtlsEndpoint.cpp
     UdpTransport/DtlsEndpoint.h
     UdpTransport/DtlsSocket.cpp
@@ -136,6 +144,8 @@ set(FILES
     Utilities/NetworkCommon.h
     Utilities/NetworkCommon.inl
     Utilities/NetworkIncludes.h
+    Utilities/QuantizedTransforms.h
+    Utilities/QuantizedTransforms.inl
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
     Utilities/TimedThread.cpp
@@ -59,4 +59,41 @@ namespace UnitTest
         unusedBitTest.SetBit(0, true);
         EXPECT_TRUE(unusedBitTest.AnySet());
     }
+
+    TEST(FixedSizeBitset, TestSetBits)
+    {
+        AzNetworking::FixedSizeBitset<47, uint8_t> test;
+        test.SetBits(0, 2, 0x3);
+        test.SetBits(2, 15, 0x5A5A);
+        test.SetBits(17, 15, 0x7FFF);
+        test.SetBits(32, 15, 0x1234);
+
+        EXPECT_EQ(test.GetBits(0, 2), 0x3u);
+        EXPECT_EQ(test.GetBits(2, 15), 0x5A5Au & 0x7FFFu);
+        EXPECT_EQ(test.GetBits(17, 15), 0x7FFFu);
+        EXPECT_EQ(test.GetBits(32, 15), 0x1234u);
+
+        // Packed bits must agree with the single bit accessors
+        for (uint32_t i = 0; i < 15; ++i)
+        {
+            EXPECT_EQ(test.GetBit(17 + i), true);
+        }
+
+        // Overwriting a field must leave its neighbours untouched
+        test.SetBits(17, 15, 0);
+        EXPECT_EQ(test.GetBits(2, 15), 0x5A5Au & 0x7FFFu);
+        EXPECT_EQ(test.GetBits(17, 15), 0u);
+        EXPECT_EQ(test.GetBits(32, 15), 0x1234u);
+    }
+
+    TEST(FixedSizeBitset, TestSetBitsFullWidth)
+    {
+        AzNetworking::FixedSizeBitset<96> test;
+        test.SetBits(16, 32, 0xDEADBEEF);
+        test.SetBits(48, 32, 0xFFFFFFFF);
+        EXPECT_EQ(test.GetBits(16, 32), 0xDEADBEEFu);
+        EXPECT_EQ(test.GetBits(48, 32), 0xFFFFFFFFu);
+        EXPECT_EQ(test.GetBits(0, 16), 0u);
+        EXPECT_EQ(test.GetBits(80, 16), 0u);
+    }
 }
@@ -11,4 +11,32 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<32> lhs;
+        AzNetworking::FixedSizeVectorBitset<32> rhs;
+        lhs.Resize(12);
+        rhs.Resize(12);
+        EXPECT_TRUE(lhs == rhs);
+
+        lhs.SetBit(3, true);
+        EXPECT_TRUE(lhs != rhs);
+
+        rhs.SetBit(3, true);
+        EXPECT_TRUE(lhs == rhs);
+
+        rhs.Resize(13);
+        EXPECT_TRUE(lhs != rhs);
+    }
+
+    TEST(FixedSizeVectorBitset, TestEqualityIgnoresBitsPastSize)
+    {
+        AzNetworking::FixedSizeVectorBitset<32> lhs;
+        AzNetworking::FixedSizeVectorBitset<32> rhs;
+        lhs.Resize(12);
+        lhs.SetBit(10, true);
+        lhs.Resize(9);
+        rhs.Resize(9);
+        EXPECT_TRUE(lhs == rhs);
+    }
 }
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/SpscRingBuffer.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    TEST(SpscRingBuffer, PushPopInOrder)
+    {
+        AzNetworking::SpscRingBuffer<uint32_t, 4> ringBuffer;
+        EXPECT_TRUE(ringBuffer.IsEmpty());
+
+        uint32_t value = 0;
+        EXPECT_FALSE(ringBuffer.TryPop(value));
+
+        EXPECT_TRUE(ringBuffer.TryPush(1));
+        EXPECT_TRUE(ringBuffer.TryPush(2));
+        EXPECT_EQ(ringBuffer.GetSize(), 2);
+
+        EXPECT_TRUE(ringBuffer.TryPop(value));
+        EXPECT_EQ(value, 1);
+        EXPECT_TRUE(ringBuffer.TryPop(value));
+        EXPECT_EQ(value, 2);
+        EXPECT_TRUE(ringBuffer.IsEmpty());
+    }
+
+    TEST(SpscRingBuffer, FullRejectsPushUntilPopped)
+    {
+        AzNetworking::SpscRingBuffer<uint32_t, 4> ringBuffer;
+        for (uint32_t i = 0; i < ringBuffer.GetCapacity(); ++i)
+        {
+            EXPECT_TRUE(ringBuffer.TryPush(i));
+        }
+        EXPECT_TRUE(ringBuffer.IsFull());
+        EXPECT_FALSE(ringBuffer.TryPush(100));
+
+        uint32_t value = 0;
+        EXPECT_TRUE(ringBuffer.TryPop(value));
+        EXPECT_EQ(value, 0);
+        EXPECT_TRUE(ringBuffer.TryPush(100));
+
+        // Wraps around the end of the storage
+        for (uint32_t expected : { 1u, 2u, 3u, 100u })
+        {
+            EXPECT_TRUE(ringBuffer.TryPop(value));
+            EXPECT_EQ(value, expected);
+        }
+        EXPECT_TRUE(ringBuffer.IsEmpty());
+    }
+
+    TEST(SpscRingBuffer, ProducerConsumerThreads)
+    {
+        constexpr uint32_t ItemCount = 100000;
+        AzNetworking::SpscRingBuffer<uint32_t, 64> ringBuffer;
+
+        AZStd::thread producer([&ringBuffer]()
+        {
+            for (uint32_t i = 0; i < ItemCount; ++i)
+            {
+                while (!ringBuffer.TryPush(i))
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        });
+
+        // Every item is popped even if one arrives out of order, otherwise the producer never finishes and can't be joined.
+        uint32_t poppedCount = 0;
+        uint32_t outOfOrderCount = 0;
+        while (poppedCount < ItemCount)
+        {
+            uint32_t value = 0;
+            if (ringBuffer.TryPop(value))
+            {
+                if (value != poppedCount)
+                {
+                    ++outOfOrderCount;
+                }
+                ++poppedCount;
+            }
+            else
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+
+        producer.join();
+        EXPECT_EQ(outOfOrderCount, 0u);
+        EXPECT_TRUE(ringBuffer.IsEmpty());
+    }
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Framework/PacketCapture.h>
+#include <AzNetworking/Framework/PacketReplay.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class TestCapturePacketHeader
+        : public IPacketHeader
+    {
+    public:
+        TestCapturePacketHeader(PacketType packetType, PacketId packetId)
+            : m_packetType(packetType)
+            , m_packetId(packetId)
+        {
+            ;
+        }
+
+        PacketType GetPacketType() const override { return m_packetType; }
+        PacketId GetPacketId() const override { return m_packetId; }
+        bool IsPacketFlagSet(PacketFlag flag) const override { return m_packetFlags.GetBit(static_cast<uint32_t>(flag)); }
+        void SetPacketFlag(PacketFlag flag, bool value) override { m_packetFlags.SetBit(static_cast<uint32_t>(flag), value); }
+
+    private:
+        PacketType m_packetType;
+        PacketId m_packetId;
+        PacketFlagBitset m_packetFlags;
+    };
+
+    class TestCaptureConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            ++m_validateCount;
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect([[maybe_unused]] IConnection* connection) override
+        {
+            ++m_connectCount;
+        }
+
+        PacketDispatchResult OnPacketReceived([[maybe_unused]] IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer) override
+        {
+            ++m_packetCount;
+            m_lastPacketType = packetHeader.GetPacketType();
+            m_payloadBytes += serializer.GetCapacity() - serializer.GetSize();
+            return PacketDispatchResult::Success;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+            ;
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            ++m_disconnectCount;
+            m_lastDisconnectReason = reason;
+        }
+
+        uint32_t m_validateCount = 0;
+        uint32_t m_connectCount = 0;
+        uint32_t m_packetCount = 0;
+        uint32_t m_disconnectCount = 0;
+        uint32_t m_payloadBytes = 0;
+        PacketType m_lastPacketType = PacketType{ 0 };
+        DisconnectReason m_lastDisconnectReason = DisconnectReason::None;
+    };
+
+    class PacketCaptureTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AZ::NameDictionary::Create();
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_capturePath = m_tempDirectory.Resolve("Capture.azpcap");
+        }
+
+        void TearDown() override
+        {
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+            AZ::NameDictionary::Destroy();
+        }
+
+        // Writes a capture holding a single connection that receives packetCount packets before disconnecting
+        void WriteCapture(uint32_t packetCount)
+        {
+            TestCaptureConnectionListener forwardListener;
+            PacketCaptureListener captureListener(forwardListener);
+            ASSERT_TRUE(captureListener.Open(m_capturePath.c_str()));
+
+            PacketReplayConnection connection(ConnectionId{ 7 }, IpAddress(127, 0, 0, 1, 12345));
+            captureListener.OnConnect(&connection);
+
+            AZStd::array<uint8_t, 32> payload;
+            for (uint32_t packetIndex = 0; packetIndex < packetCount; ++packetIndex)
+            {
+                payload.fill(static_cast<uint8_t>(packetIndex));
+                TestCapturePacketHeader header(PacketType{ 100 }, PacketId{ packetIndex });
+                // Listeners receive decompressed payloads, the flag only says the packet was compressed on the wire
+                header.SetPacketFlag(PacketFlag::Compressed, true);
+                NetworkOutputSerializer serializer(payload.data(), static_cast<uint32_t>(payload.size()));
+                EXPECT_EQ(captureListener.OnPacketReceived(&connection, header, serializer), PacketDispatchResult::Success);
+            }
+
+            captureListener.OnDisconnect(&connection, DisconnectReason::RemoteHostClosedConnection, TerminationEndpoint::Remote);
+
+            // Every event should have been forwarded untouched
+            EXPECT_EQ(forwardListener.m_connectCount, 1u);
+            EXPECT_EQ(forwardListener.m_packetCount, packetCount);
+            EXPECT_EQ(forwardListener.m_disconnectCount, 1u);
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        AZ::IO::Path m_capturePath;
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+    };
+
+    TEST_F(PacketCaptureTests, CaptureRoundTrip)
+    {
+        WriteCapture(3);
+
+        PacketCaptureReader reader;
+        ASSERT_TRUE(reader.Open(m_capturePath.c_str()));
+
+        PacketCaptureRecord record;
+        ASSERT_TRUE(reader.ReadRecord(record));
+        EXPECT_EQ(record.m_eventType, PacketCaptureEventType::Connect);
+        EXPECT_EQ(record.m_connectionId, ConnectionId{ 7 });
+        EXPECT_EQ(record.m_remoteAddress, IpAddress(127, 0, 0, 1, 12345));
+
+        for (uint32_t packetIndex = 0; packetIndex < 3; ++packetIndex)
+        {
+            ASSERT_TRUE(reader.ReadRecord(record));
+            EXPECT_EQ(record.m_eventType, PacketCaptureEventType::Packet);
+            EXPECT_EQ(record.m_connectionId, ConnectionId{ 7 });
+            EXPECT_EQ(record.m_packetType, PacketType{ 100 });
+            EXPECT_EQ(record.m_packetId, PacketId{ packetIndex });
+            EXPECT_FALSE(record.m_compressed);
+            ASSERT_EQ(record.m_payload.GetSize(), 32u);
+            EXPECT_EQ(record.m_payload.GetBuffer()[31], static_cast<uint8_t>(packetIndex));
+        }
+
+        ASSERT_TRUE(reader.ReadRecord(record));
+        EXPECT_EQ(record.m_eventType, PacketCaptureEventType::Disconnect);
+        EXPECT_EQ(record.m_disconnectReason, DisconnectReason::RemoteHostClosedConnection);
+        EXPECT_EQ(record.m_terminationEndpoint, TerminationEndpoint::Remote);
+
+        EXPECT_FALSE(reader.ReadRecord(record));
+    }
+
+    TEST_F(PacketCaptureTests, ReplayDispatchesCapturedEvents)
+    {
+        WriteCapture(16);
+
+        PacketCaptureReader reader;
+        ASSERT_TRUE(reader.Open(m_capturePath.c_str()));
+
+        TestCaptureConnectionListener replayListener;
+        PacketReplayDriver replayDriver(replayListener);
+        const PacketReplayStats stats = replayDriver.Replay(reader, PacketReplayMode::FullSpeed);
+
+        EXPECT_EQ(stats.m_records, 18u);
+        EXPECT_EQ(stats.m_dispatchedPackets, 16u);
+        EXPECT_EQ(stats.m_failedPackets, 0u);
+        EXPECT_EQ(stats.m_payloadBytes, 16u * 32u);
+        EXPECT_EQ(replayListener.m_connectCount, 1u);
+        EXPECT_EQ(replayListener.m_packetCount, 16u);
+        EXPECT_EQ(replayListener.m_payloadBytes, 16u * 32u);
+        EXPECT_EQ(replayListener.m_lastPacketType, PacketType{ 100 });
+        EXPECT_EQ(replayListener.m_disconnectCount, 1u);
+        EXPECT_EQ(replayListener.m_lastDisconnectReason, DisconnectReason::RemoteHostClosedConnection);
+
+        // A rewound capture replays identically
+        reader.Rewind();
+        const PacketReplayStats rewoundStats = replayDriver.Replay(reader, PacketReplayMode::FullSpeed);
+        EXPECT_EQ(rewoundStats.m_dispatchedPackets, 16u);
+        EXPECT_EQ(replayListener.m_packetCount, 32u);
+    }
+
+    TEST_F(PacketCaptureTests, RejectsInvalidCapture)
+    {
+        AZStd::vector<uint8_t> garbage = { 0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x00, 0x00, 0x01 };
+        PacketCaptureReader reader;
+        EXPECT_FALSE(reader.Open(AZStd::move(garbage)));
+
+        PacketCaptureRecord record;
+        EXPECT_FALSE(reader.ReadRecord(record));
+    }
+}
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Framework/PacketCapture.h>
+#include <AzNetworking/Framework/PacketReplay.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    // Name of the compressor factory registered by the benchmark fixture
+    static constexpr const char* CompressorFactoryName = "BenchmarkCompressor";
+    static constexpr uint32_t EntitiesPerPacket = 32;
+    static constexpr uint32_t CapturedPackets = 1024;
+
+    //! Stand-in for a typical entity update packet payload, a handful of quantized transforms and property values per entity
+    struct BenchmarkEntityUpdate
+    {
+        uint32_t m_entityId = 0;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZ::Quaternion m_rotation = AZ::Quaternion::CreateIdentity();
+        uint16_t m_health = 100;
+        uint8_t m_state = 0;
+
+        bool Serialize(ISerializer& serializer)
+        {
+            return serializer.Serialize(m_entityId, "EntityId")
+                && serializer.Serialize(m_position, "Position")
+                && serializer.Serialize(m_rotation, "Rotation")
+                && serializer.Serialize(m_health, "Health")
+                && serializer.Serialize(m_state, "State");
+        }
+    };
+
+    //! Run length encoder registered by the fixture, so the compression path can be measured without depending on a compression gem.
+    //! Every run is written as its length followed by the repeated byte.
+    class BenchmarkCompressor
+        : public ICompressor
+    {
+    public:
+        bool Init() override
+        {
+            return true;
+        }
+
+        CompressorType GetType() const override
+        {
+            return static_cast<CompressorType>(static_cast<AZ::u32>(AZ_CRC_CE("BenchmarkCompressor")));
+        }
+
+        AZStd::size_t GetMaxChunkSize(AZStd::size_t maxCompSize) const override
+        {
+            return maxCompSize / 2;
+        }
+
+        AZStd::size_t GetMaxCompressedBufferSize(AZStd::size_t uncompSize) const override
+        {
+            return uncompSize * 2;
+        }
+
+        CompressorError Compress(const void* uncompData, AZStd::size_t uncompSize, void* compData, AZStd::size_t compDataSize, AZStd::size_t& compSize) override
+        {
+            if (compDataSize < GetMaxCompressedBufferSize(uncompSize))
+            {
+                return CompressorError::InsufficientBuffer;
+            }
+
+            const uint8_t* input = static_cast<const uint8_t*>(uncompData);
+            uint8_t* output = static_cast<uint8_t*>(compData);
+            compSize = 0;
+            for (AZStd::size_t index = 0; index < uncompSize;)
+            {
+                const uint8_t value = input[index];
+                AZStd::size_t runLength = 1;
+                while (index + runLength < uncompSize && runLength < UINT8_MAX && input[index + runLength] == value)
+                {
+                    ++runLength;
+                }
+                output[compSize++] = static_cast<uint8_t>(runLength);
+                output[compSize++] = value;
+                index += runLength;
+            }
+            return CompressorError::Ok;
+        }
+
+        CompressorError Decompress(const void* compData, AZStd::size_t compDataSize, void* uncompData, AZStd::size_t uncompDataSize, AZStd::size_t& consumedSize, AZStd::size_t& uncompSize) override
+        {
+            const uint8_t* input = static_cast<const uint8_t*>(compData);
+            uint8_t* output = static_cast<uint8_t*>(uncompData);
+            consumedSize = 0;
+            uncompSize = 0;
+            for (; consumedSize + 1 < compDataSize; consumedSize += 2)
+            {
+                const AZStd::size_t runLength = input[consumedSize];
+                if (uncompSize + runLength > uncompDataSize)
+                {
+                    return CompressorError::InsufficientBuffer;
+                }
+                memset(output + uncompSize, input[consumedSize + 1], runLength);
+                uncompSize += runLength;
+            }
+            return CompressorError::Ok;
+        }
+    };
+
+    class BenchmarkCompressorFactory
+        : public ICompressorFactory
+    {
+    public:
+        AZStd::unique_ptr<ICompressor> Create() override
+        {
+            return AZStd::make_unique<BenchmarkCompressor>();
+        }
+
+        const AZStd::string_view GetFactoryName() const override
+        {
+            return CompressorFactoryName;
+        }
+    };
+
+    class BenchmarkConnectionListener
+        : public IConnectionListener
+    {
+    public:
+        ConnectResult ValidateConnect([[maybe_unused]] const IpAddress& remoteAddress, [[maybe_unused]] const IPacketHeader& packetHeader, [[maybe_unused]] ISerializer& serializer) override
+        {
+            return ConnectResult::Accepted;
+        }
+
+        void OnConnect([[maybe_unused]] IConnection* connection) override
+        {
+            ;
+        }
+
+        PacketDispatchResult OnPacketReceived([[maybe_unused]] IConnection* connection, [[maybe_unused]] const IPacketHeader& packetHeader, ISerializer& serializer) override
+        {
+            // Decode the payload the same way an application layer handler would
+            BenchmarkEntityUpdate update;
+            for (uint32_t entityIndex = 0; entityIndex < EntitiesPerPacket; ++entityIndex)
+            {
+                update.Serialize(serializer);
+            }
+            return serializer.IsValid() ? PacketDispatchResult::Success : PacketDispatchResult::Failure;
+        }
+
+        void OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId) override
+        {
+            ;
+        }
+
+        void OnDisconnect([[maybe_unused]] IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint) override
+        {
+            ;
+        }
+    };
+
+    class PacketThroughputBenchmark
+        : public benchmark::Fixture
+        , public UnitTest::LeakDetectionBase
+    {
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        void internalSetUp()
+        {
+            AZ::NameDictionary::Create();
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            m_networkingSystemComponent = AZStd::make_unique<NetworkingSystemComponent>();
+            // Ownership of the factory is taken by the networking system component
+            m_networkingSystemComponent->RegisterCompressorFactory(new BenchmarkCompressorFactory());
+            m_payloadSize = EncodePayload(m_payload, 0);
+        }
+
+        void internalTearDown()
+        {
+            m_networkingSystemComponent.reset();
+            m_timeSystem.reset();
+            m_loggerComponent.reset();
+            AZ::NameDictionary::Destroy();
+        }
+
+        static uint32_t EncodePayload(UdpPacketEncodingBuffer& buffer, uint32_t sequence)
+        {
+            buffer.Resize(buffer.GetCapacity());
+            NetworkInputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            ISerializer& serializer = networkSerializer; // To get the default typeinfo parameters in ISerializer
+            BenchmarkEntityUpdate update;
+            for (uint32_t entityIndex = 0; entityIndex < EntitiesPerPacket; ++entityIndex)
+            {
+                update.m_entityId = entityIndex;
+                update.m_position = AZ::Vector3(static_cast<float>(entityIndex), static_cast<float>(sequence), 1.0f);
+                update.m_state = static_cast<uint8_t>(sequence);
+                update.Serialize(serializer);
+            }
+            buffer.Resize(serializer.GetSize());
+            return serializer.GetSize();
+        }
+
+        static void SetPacketCounters(benchmark::State& state, uint32_t bytesPerPacket)
+        {
+            state.counters["PacketsPerSecond"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+            state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * bytesPerPacket);
+        }
+
+        UdpPacketEncodingBuffer m_payload;
+        uint32_t m_payloadSize = 0;
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<NetworkingSystemComponent> m_networkingSystemComponent;
+    };
+
+    BENCHMARK_DEFINE_F(PacketThroughputBenchmark, Serialize)(benchmark::State& state)
+    {
+        UdpPacketEncodingBuffer buffer;
+        uint32_t sequence = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(EncodePayload(buffer, ++sequence));
+        }
+        SetPacketCounters(state, m_payloadSize);
+    }
+
+    BENCHMARK_DEFINE_F(PacketThroughputBenchmark, Compress)(benchmark::State& state)
+    {
+        AZStd::unique_ptr<ICompressor> compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(CompressorFactoryName);
+        if (compressor == nullptr || !compressor->Init())
+        {
+            state.SkipWithError("Failed to create the benchmark compressor");
+            return;
+        }
+
+        AZStd::vector<uint8_t> compressedBuffer;
+        compressedBuffer.resize_no_construct(compressor->GetMaxCompressedBufferSize(m_payloadSize));
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::size_t compressedSize = 0;
+            compressor->Compress(m_payload.GetBuffer(), m_payloadSize, compressedBuffer.data(), compressedBuffer.size(), compressedSize);
+            benchmark::DoNotOptimize(compressedSize);
+        }
+        SetPacketCounters(state, m_payloadSize);
+    }
+
+    BENCHMARK_DEFINE_F(PacketThroughputBenchmark, LoopbackSend)(benchmark::State& state)
+    {
+        // Bound to any available port so the benchmark doesn't collide with other processes using a fixed port
+        UdpSocket socket;
+        if (!socket.Open(0, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer))
+        {
+            state.SkipWithError("Failed to open loopback socket");
+            return;
+        }
+
+        const uint16_t loopbackPort = GetSocketBoundPort(socket.GetSocketFd());
+        if (loopbackPort == 0)
+        {
+            state.SkipWithError("Failed to retrieve the port of the loopback socket");
+            return;
+        }
+
+        // Unencrypted, encryption requires provisioned certificates and a completed DTLS handshake
+        const IpAddress loopbackAddress(127, 0, 0, 1, loopbackPort);
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        IpAddress receiveAddress;
+        UdpPacketEncodingBuffer receiveBuffer;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            socket.Send(loopbackAddress, m_payload.GetBuffer(), m_payloadSize, false, dtlsEndpoint, connectionQuality);
+            benchmark::DoNotOptimize(socket.Receive(receiveAddress, receiveBuffer.GetBuffer(), static_cast<uint32_t>(receiveBuffer.GetCapacity())));
+        }
+        socket.Close();
+        SetPacketCounters(state, m_payloadSize);
+    }
+
+    BENCHMARK_DEFINE_F(PacketThroughputBenchmark, ReplayDispatch)(benchmark::State& state)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZ::IO::Path capturePath = tempDirectory.Resolve("Benchmark.azpcap");
+
+        BenchmarkConnectionListener listener;
+        {
+            PacketCaptureWriter writer;
+            writer.Open(capturePath.c_str());
+            PacketCaptureRecord record;
+            record.m_eventType = PacketCaptureEventType::Packet;
+            record.m_connectionId = ConnectionId{ 1 };
+            record.m_packetType = PacketType{ 100 };
+            for (uint32_t packetIndex = 0; packetIndex < CapturedPackets; ++packetIndex)
+            {
+                record.m_packetId = PacketId{ packetIndex };
+                record.m_payload.Resize(EncodePayload(m_payload, packetIndex));
+                memcpy(record.m_payload.GetBuffer(), m_payload.GetBuffer(), record.m_payload.GetSize());
+                writer.WriteRecord(record);
+            }
+        }
+
+        PacketCaptureReader reader;
+        if (!reader.Open(capturePath.c_str()))
+        {
+            state.SkipWithError("Failed to read back the benchmark capture");
+            return;
+        }
+
+        PacketReplayDriver replayDriver(listener);
+        AZ::u64 payloadBytes = 0;
+        int64_t dispatchedPackets = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            reader.Rewind();
+            const PacketReplayStats stats = replayDriver.Replay(reader, PacketReplayMode::FullSpeed);
+            payloadBytes += stats.m_payloadBytes;
+            dispatchedPackets += stats.m_dispatchedPackets;
+        }
+
+        // Each iteration replays the whole capture, so report per packet rates rather than per iteration
+        state.counters["PacketsPerSecond"] = benchmark::Counter(static_cast<double>(dispatchedPackets), benchmark::Counter::kIsRate);
+        state.counters["TimePerPacket"] = benchmark::Counter(static_cast<double>(dispatchedPackets), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+        state.SetBytesProcessed(static_cast<int64_t>(payloadBytes));
+    }
+
+    BENCHMARK_REGISTER_F(PacketThroughputBenchmark, Serialize);
+    BENCHMARK_REGISTER_F(PacketThroughputBenchmark, Compress);
+    BENCHMARK_REGISTER_F(PacketThroughputBenchmark, LoopbackSend);
+    BENCHMARK_REGISTER_F(PacketThroughputBenchmark, ReplayDispatch);
+}
+
+#endif
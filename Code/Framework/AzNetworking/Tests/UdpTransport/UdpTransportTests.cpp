@@ -9,6 +9,8 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -136,6 +138,14 @@ namespace UnitTest
         EXPECT_EQ(tracker.GetNextPacketId(), PacketId(SEQUENCE_BOUNDARY + 1));
     }
 
+    TEST_F(UdpTransportTests, SocketBoundToAnyPort)
+    {
+        UdpSocket socket;
+        ASSERT_TRUE(socket.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        EXPECT_NE(GetSocketBoundPort(socket.GetSocketFd()), 0);
+        socket.Close();
+    }
+
     TEST_F(UdpTransportTests, AckReplication)
     {
         static const SequenceId TestReliableSequenceId = InvalidSequenceId;
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedTransforms.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    // Rotations are compared by the angle between them, since q and -q represent the same rotation
+    static float AngleBetween(const AZ::Quaternion& a, const AZ::Quaternion& b)
+    {
+        return 2.0f * AZ::Acos(AZ::GetMin(1.0f, AZ::Abs(a.Dot(b))));
+    }
+
+    TEST(QuantizedTransforms, QuantizedQuaternionIdentity)
+    {
+        AzNetworking::QuantizedQuaternion<> test;
+        EXPECT_TRUE(test.GetQuaternion().IsClose(AZ::Quaternion::CreateIdentity(), 0.0001f));
+        EXPECT_EQ(AzNetworking::QuantizedQuaternion<>::PackedBitCount, 47u);
+    }
+
+    TEST(QuantizedTransforms, QuantizedQuaternionSerialize)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer  inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        for (uint32_t i = 0; i < 64; ++i)
+        {
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateFromEulerAnglesRadians(AZ::Vector3(
+                random.GetRandomFloat() * AZ::Constants::TwoPi, random.GetRandomFloat() * AZ::Constants::TwoPi, random.GetRandomFloat() * AZ::Constants::TwoPi));
+
+            AzNetworking::QuantizedQuaternion<> testIn(rotation);
+            AzNetworking::QuantizedQuaternion<> testOut;
+            EXPECT_LT(AngleBetween(testIn, rotation), 0.002f);
+
+            const uint32_t sizeBefore = inputSerializer.GetSize();
+            testIn.Serialize(inputSerializer);
+            EXPECT_EQ(inputSerializer.GetSize() - sizeBefore, 6u);
+            testOut.Serialize(outputSerializer);
+            EXPECT_EQ(testIn, testOut);
+            EXPECT_TRUE(testIn.GetQuaternion().IsClose(testOut.GetQuaternion(), 0.0001f));
+        }
+    }
+
+    TEST(QuantizedTransforms, QuantizedQuaternionNegatedIsEquivalent)
+    {
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationY(1.0f);
+        AzNetworking::QuantizedQuaternion<> positive(rotation);
+        AzNetworking::QuantizedQuaternion<> negative(-rotation);
+        EXPECT_EQ(positive, negative);
+    }
+
+    TEST(QuantizedTransforms, QuantizedQuaternionBatch)
+    {
+        AZ::SimpleLcgRandom random(5678);
+        AZStd::vector<AZ::Quaternion> rotations;
+        for (uint32_t i = 0; i < 13; ++i)
+        {
+            rotations.push_back(AZ::Quaternion::CreateRotationZ(random.GetRandomFloat() * AZ::Constants::TwoPi));
+        }
+
+        AZStd::vector<AzNetworking::QuantizedQuaternion<>> quantized(rotations.size());
+        AzNetworking::QuantizedQuaternion<>::QuantizeBatch(rotations.data(), quantized.data(), rotations.size());
+        for (AZStd::size_t i = 0; i < rotations.size(); ++i)
+        {
+            EXPECT_EQ(quantized[i], AzNetworking::QuantizedQuaternion<>(rotations[i]));
+        }
+    }
+
+    TEST(QuantizedTransforms, QuantizedVector3Serialize)
+    {
+        using QuantizedType = AzNetworking::QuantizedVector3<20, -1024, 1024>;
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer  inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        QuantizedType testIn(AZ::Vector3(-512.25f, 0.5f, 1000.0f));
+        QuantizedType testOut;
+        EXPECT_TRUE(testIn.GetVector().IsClose(AZ::Vector3(-512.25f, 0.5f, 1000.0f), 0.002f));
+
+        testIn.Serialize(inputSerializer);
+        EXPECT_EQ(inputSerializer.GetSize(), 8u); // 60 bits
+        testOut.Serialize(outputSerializer);
+        EXPECT_EQ(testIn, testOut);
+        EXPECT_TRUE(testIn.GetVector().IsClose(testOut.GetVector(), 0.0f));
+    }
+
+    TEST(QuantizedTransforms, QuantizedVector3Clamps)
+    {
+        AzNetworking::QuantizedVector3<10, -1, 1> test(AZ::Vector3(-5.0f, 0.0f, 5.0f));
+        EXPECT_TRUE(test.GetVector().IsClose(AZ::Vector3(-1.0f, 0.0f, 1.0f), 0.002f));
+    }
+
+    TEST(QuantizedTransforms, QuantizedVector3Batch)
+    {
+        using QuantizedType = AzNetworking::QuantizedVector3<16, -100, 100>;
+        AZ::SimpleLcgRandom random(4321);
+        AZStd::vector<AZ::Vector3> values;
+        for (uint32_t i = 0; i < 11; ++i)
+        {
+            values.push_back(AZ::Vector3(random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f));
+        }
+
+        // The batched path must produce exactly the same results as quantizing one value at a time
+        AZStd::vector<QuantizedType> quantized(values.size());
+        QuantizedType::QuantizeBatch(values.data(), quantized.data(), values.size());
+        for (AZStd::size_t i = 0; i < values.size(); ++i)
+        {
+            const QuantizedType expected(values[i]);
+            EXPECT_EQ(quantized[i], expected);
+            EXPECT_TRUE(quantized[i].GetVector().IsClose(expected.GetVector(), 0.0f));
+        }
+    }
+}
@@ -14,7 +14,10 @@ set(FILES
     DataStructures/FixedSizeBitsetViewTests.cpp
     DataStructures/FixedSizeVectorBitsetTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
+    DataStructures/SpscRingBufferTests.cpp
     DataStructures/TimeoutQueueTests.cpp
+    Framework/PacketCaptureTests.cpp
+    Framework/PacketThroughputBenchmarks.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
     Serialization/NetworkInputOutputSerializerTests.cpp
@@ -26,5 +29,6 @@ set(FILES
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
+    Utilities/QuantizedTransformsTests.cpp
     Utilities/QuantizedValuesTests.cpp
 )
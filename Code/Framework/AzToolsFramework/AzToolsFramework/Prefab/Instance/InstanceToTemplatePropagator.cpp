@@ -229,7 +229,11 @@ namespace AzToolsFramework
                     (result.GetOutcome() != AZ::JsonSerializationResult::Outcomes::PartialSkip),
                     "Some of the patches were not successfully applied.");
                 m_prefabSystemComponentInterface->SetTemplateDirtyFlag(templateId, true);
-                m_prefabSystemComponentInterface->PropagateTemplateChanges(templateId, instanceToExclude);
+
+                // Only the values the patches touched need to be propagated.
+                PrefabDomModifiedPaths modifiedPaths;
+                PrefabDomUtils::MarkPatchPathsAsModified(modifiedPaths, providedPatch);
+                m_prefabSystemComponentInterface->PropagateTemplateChanges(templateId, modifiedPaths, instanceToExclude);
                 return true;
             }
         }
@@ -11,6 +11,7 @@
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <AzToolsFramework/Entity/PrefabEditorEntityOwnershipInterface.h>
@@ -179,31 +180,43 @@ namespace AzToolsFramework
                     // Even though we potentially initialized the batch size to the queue, it's possible for the queue size to shrink
                     // during instance processing if the instance gets deleted and it was queued multiple times.  To handle this, we
                     // make sure to end the loop once the queue is empty, regardless of what the initial size was.
-                    for (int i = 0; (i < instanceCountToUpdateInBatch) && !m_instancesUpdateQueue.empty(); ++i)
+                    int remainingInstanceCount = instanceCountToUpdateInBatch;
+                    AZStd::vector<Instance*> instancesToUpdate;
+                    AZStd::vector<PrefabDom> instanceDoms;
+                    while ((remainingInstanceCount > 0) && !m_instancesUpdateQueue.empty())
                     {
                         updatedInstances = true;
-                        Instance* instanceToUpdate = m_instancesUpdateQueue.front();
-                        m_instancesUpdateQueue.pop_front();
-                        AZ_Assert(instanceToUpdate != nullptr, "Invalid instance on update queue.");
-                        m_uniqueInstancesForPropagation.erase(instanceToUpdate);
 
-                        TemplateId instanceTemplateId = instanceToUpdate->GetTemplateId();
+                        // The queue is grouped by template, so the consecutive instances of the same template are updated together.
+                        instancesToUpdate.clear();
+                        const TemplateId instanceTemplateId = m_instancesUpdateQueue.front()->GetTemplateId();
+                        while ((remainingInstanceCount > 0) && !m_instancesUpdateQueue.empty() &&
+                               m_instancesUpdateQueue.front()->GetTemplateId() == instanceTemplateId)
+                        {
+                            Instance* instanceToUpdate = m_instancesUpdateQueue.front();
+                            m_instancesUpdateQueue.pop_front();
+                            AZ_Assert(instanceToUpdate != nullptr, "Invalid instance on update queue.");
+                            m_uniqueInstancesForPropagation.erase(instanceToUpdate);
+                            instancesToUpdate.push_back(instanceToUpdate);
+                            --remainingInstanceCount;
+                        }
+
                         if (currentTemplateId != instanceTemplateId)
                         {
                             currentTemplateId = instanceTemplateId;
                             currentTemplateReference = m_prefabSystemComponentInterface->FindTemplate(currentTemplateId);
-                            if (!currentTemplateReference.has_value())
-                            {
-                                AZ_Error(
-                                    "Prefab", false,
-                                    "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
-                                    "Could not find Template using Id '%llu'. Unable to update Instance.",
-                                    currentTemplateId);
+                        }
+                        if (!currentTemplateReference.has_value())
+                        {
+                            AZ_Error(
+                                "Prefab", false,
+                                "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
+                                "Could not find Template using Id '%llu'. Unable to update Instance.",
+                                currentTemplateId);
 
-                                // Remove the instance from update queue if its corresponding template couldn't be found
-                                isUpdateSuccessful = false;
-                                continue;
-                            }
+                            // Remove the instances from update queue if their corresponding template couldn't be found
+                            isUpdateSuccessful = false;
+                            continue;
                         }
 
                         auto findInstancesResult = m_templateInstanceMapperInterface->FindInstancesOwnedByTemplate(instanceTemplateId);
@@ -211,68 +224,87 @@ namespace AzToolsFramework
                             findInstancesResult.has_value(), "Prefab Instances corresponding to template with id %llu couldn't be found.",
                             instanceTemplateId);
 
-                        if (findInstancesResult == AZStd::nullopt ||
-                            findInstancesResult->get().find(instanceToUpdate) == findInstancesResult->get().end())
+                        // Since nested instances get reconstructed during propagation, remove any nested instance that no longer
+                        // maps to a template.
+                        const size_t queuedInstanceCount = instancesToUpdate.size();
+                        AZStd::erase_if(
+                            instancesToUpdate,
+                            [&findInstancesResult](Instance* instanceToUpdate)
+                            {
+                                return findInstancesResult == AZStd::nullopt ||
+                                    findInstancesResult->get().find(instanceToUpdate) == findInstancesResult->get().end();
+                            });
+                        if (instancesToUpdate.size() != queuedInstanceCount)
                         {
-                            // Since nested instances get reconstructed during propagation, remove any nested instance that no longer
-                            // maps to a template.
                             isUpdateSuccessful = false;
-                            continue;
                         }
 
-                        // Gets a copy of instance DOM from focused or root prefab template.
-                        PrefabDom instanceDom;
-                        m_instanceDomGeneratorInterface->GetInstanceDomFromTemplate(instanceDom, *instanceToUpdate);
-
-                        if (!instanceDom.IsObject())
-                        {
-                            AZ_Assert(
-                                false,
-                                "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
-                                "Could not load Instance DOM from the given Instance.");
-
-                            isUpdateSuccessful = false;
-                            continue;
-                        }
+                        // Gets copies of the instance DOMs from focused or root prefab template.
+                        GenerateInstanceDoms(instancesToUpdate, instanceDoms);
 
-                        // Loads instance object from the generated instance DOM.
+                        // Loading instances registers their entities, which isn't thread safe, so it stays on this thread.
                         EntityList newEntities;
-                        if (PrefabDomUtils::LoadInstanceFromPrefabDom(*instanceToUpdate, newEntities, instanceDom,
-                            PrefabDomUtils::LoadFlags::UseSelectiveDeserialization))
+                        bool isRootPrefabInstanceLoaded = false;
+                        Template& currentTemplate = currentTemplateReference->get();
+                        for (size_t instanceIndex = 0; instanceIndex < instancesToUpdate.size(); ++instanceIndex)
                         {
-                            Template& currentTemplate = currentTemplateReference->get();
-                            instanceToUpdate->GetNestedInstances([&](AZStd::unique_ptr<Instance>& nestedInstance) 
+                            Instance* instanceToUpdate = instancesToUpdate[instanceIndex];
+                            PrefabDom& instanceDom = instanceDoms[instanceIndex];
+                            if (!instanceDom.IsObject())
                             {
-                                if (!nestedInstance || nestedInstance->GetLinkId() != InvalidLinkId)
-                                {
-                                    return;
-                                }
+                                AZ_Assert(
+                                    false,
+                                    "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
+                                    "Could not load Instance DOM from the given Instance.");
 
-                                for (auto linkId : currentTemplate.GetLinks())
+                                isUpdateSuccessful = false;
+                                continue;
+                            }
+
+                            // Loads instance object from the generated instance DOM.
+                            if (PrefabDomUtils::LoadInstanceFromPrefabDom(*instanceToUpdate, newEntities, instanceDom,
+                                PrefabDomUtils::LoadFlags::UseSelectiveDeserialization))
+                            {
+                                instanceToUpdate->GetNestedInstances([&](AZStd::unique_ptr<Instance>& nestedInstance) 
                                 {
-                                    LinkReference nestedLink = m_prefabSystemComponentInterface->FindLink(linkId);
-                                    if (!nestedLink.has_value())
+                                    if (!nestedInstance || nestedInstance->GetLinkId() != InvalidLinkId)
                                     {
-                                        continue;
+                                        return;
                                     }
 
-                                    if (nestedLink->get().GetInstanceName() == nestedInstance->GetInstanceAlias())
+                                    for (auto linkId : currentTemplate.GetLinks())
                                     {
-                                        nestedInstance->SetLinkId(linkId);
-                                        break;
+                                        LinkReference nestedLink = m_prefabSystemComponentInterface->FindLink(linkId);
+                                        if (!nestedLink.has_value())
+                                        {
+                                            continue;
+                                        }
+
+                                        if (nestedLink->get().GetInstanceName() == nestedInstance->GetInstanceAlias())
+                                        {
+                                            nestedInstance->SetLinkId(linkId);
+                                            break;
+                                        }
                                     }
-                                }
-                            });
+                                });
 
+                                isRootPrefabInstanceLoaded = isRootPrefabInstanceLoaded ||
+                                    (!m_isRootPrefabInstanceLoaded &&
+                                     instanceToUpdate->GetTemplateSourcePath() == m_rootPrefabInstanceSourcePath);
+                            }
+                        }
+
+                        // The entities of all the instances of the template are added to the editor in one go.
+                        if (!newEntities.empty())
+                        {
                             AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
                                 &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, newEntities);
+                        }
 
-                            if (!m_isRootPrefabInstanceLoaded &&
-                                instanceToUpdate->GetTemplateSourcePath() == m_rootPrefabInstanceSourcePath)
-                            {
-                                PrefabPublicNotificationBus::Broadcast(&PrefabPublicNotifications::OnRootPrefabInstanceLoaded);
-                                m_isRootPrefabInstanceLoaded = true;
-                            }
+                        if (isRootPrefabInstanceLoaded)
+                        {
+                            PrefabPublicNotificationBus::Broadcast(&PrefabPublicNotifications::OnRootPrefabInstanceLoaded);
+                            m_isRootPrefabInstanceLoaded = true;
                         }
                     }
                     for (auto entityIdIterator = selectedEntityIds.begin(); entityIdIterator != selectedEntityIds.end(); entityIdIterator++)
@@ -305,6 +337,40 @@ namespace AzToolsFramework
             return isUpdateSuccessful;
         }
 
+        void InstanceUpdateExecutor::GenerateInstanceDoms(const AZStd::vector<Instance*>& instances, AZStd::vector<PrefabDom>& instanceDoms) const
+        {
+            AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+            instanceDoms.clear();
+            instanceDoms.resize(instances.size());
+
+            AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            if (instances.size() < 2 || !taskGraphActive || !taskGraphActive->IsTaskGraphActive())
+            {
+                for (size_t instanceIndex = 0; instanceIndex < instances.size(); ++instanceIndex)
+                {
+                    m_instanceDomGeneratorInterface->GetInstanceDomFromTemplate(instanceDoms[instanceIndex], *instances[instanceIndex]);
+                }
+                return;
+            }
+
+            // Generating the DOMs only reads the templates and the instance hierarchy, which don't change until the instances are
+            // loaded, so the instance DOMs are copied out of the templates in parallel.
+            AZ::TaskGraph taskGraph("Prefab Instance DOM Generation");
+            for (size_t instanceIndex = 0; instanceIndex < instances.size(); ++instanceIndex)
+            {
+                taskGraph.AddTask(
+                    AZ::TaskDescriptor{ "Generate Prefab Instance DOM", "Prefab" },
+                    [this, &instances, &instanceDoms, instanceIndex]()
+                    {
+                        m_instanceDomGeneratorInterface->GetInstanceDomFromTemplate(instanceDoms[instanceIndex], *instances[instanceIndex]);
+                    });
+            }
+            AZ::TaskGraphEvent finishedEvent{ "Prefab Instance DOM Generation Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+
         void InstanceUpdateExecutor::QueueRootPrefabLoadedNotificationForNextPropagation()
         {
             m_isRootPrefabInstanceLoaded = false;
@@ -54,6 +54,9 @@ namespace AzToolsFramework
 
             void AddInstanceToQueue(Instance* instance);
 
+            //! Generates the DOMs of instances from the focused or root template, on the task graph if there are several of them.
+            void GenerateInstanceDoms(const AZStd::vector<Instance*>& instances, AZStd::vector<PrefabDom>& instanceDoms) const;
+
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
             TemplateInstanceMapperInterface* m_templateInstanceMapperInterface = nullptr;
             InstanceDomGeneratorInterface* m_instanceDomGeneratorInterface = nullptr;
@@ -232,6 +232,190 @@ namespace AzToolsFramework
             return true;
         }
 
+        bool Link::UpdateTarget(const PrefabDomModifiedPaths& modifiedSourcePaths, PrefabDomModifiedPaths& modifiedTargetPaths)
+        {
+            AZ_PROFILE_FUNCTION(PrefabSystem);
+
+            AZ::Dom::Path instancePath;
+            instancePath.Push(AZStd::string_view(PrefabDomUtils::InstancesName));
+            instancePath.Push(AZStd::string_view(m_instanceName));
+
+            // Collects the regions of the linked instance DOM to rebuild. Reapplying a patch overwrites everything under its path,
+            // so a region starts at the topmost patch above the modified value, if there is one.
+            // The trees are only read here, which also picks the overloads of VisitPath for const visitors.
+            const auto& linkPatchesTree = m_linkPatchesTree;
+            PrefabDomModifiedPaths regionsToRebuild;
+            bool requiresFullUpdate = false;
+            modifiedSourcePaths.VisitPath(
+                AZ::Dom::Path(),
+                [&linkPatchesTree, &regionsToRebuild, &requiresFullUpdate](const AZ::Dom::Path& modifiedPath, const bool&)
+                {
+                    AZ::Dom::Path regionPath = modifiedPath;
+                    linkPatchesTree.VisitPath(
+                        modifiedPath,
+                        [&regionPath](const AZ::Dom::Path& patchPath, const PrefabOverrideMetadata&)
+                        {
+                            regionPath = patchPath;
+                            return false;
+                        },
+                        AZ::Dom::PrefixTreeTraversalFlags::ExcludeExactPath | AZ::Dom::PrefixTreeTraversalFlags::ExcludeChildPaths |
+                            AZ::Dom::PrefixTreeTraversalFlags::TraverseLeastToMostSpecific);
+
+                    if (regionPath.IsEmpty())
+                    {
+                        requiresFullUpdate = true;
+                        return false;
+                    }
+                    PrefabDomUtils::MarkPathAsModified(regionsToRebuild, regionPath);
+                    return true;
+                },
+                AZ::Dom::PrefixTreeTraversalFlags::None);
+
+            auto comparePatchIndices = [](const PrefabOverrideMetadata* lhs, const PrefabOverrideMetadata* rhs)
+            {
+                return lhs->m_patchIndex < rhs->m_patchIndex;
+            };
+            AZStd::set<const PrefabOverrideMetadata*, decltype(comparePatchIndices)> patchesToReapply(comparePatchIndices);
+            AZStd::vector<AZ::Dom::Path> regionPaths;
+            if (!requiresFullUpdate)
+            {
+                static_cast<const PrefabDomModifiedPaths&>(regionsToRebuild).VisitPath(
+                    AZ::Dom::Path(),
+                    [&linkPatchesTree, &patchesToReapply, &regionPaths, &requiresFullUpdate](const AZ::Dom::Path& regionPath, const bool&)
+                    {
+                        regionPaths.push_back(regionPath);
+                        linkPatchesTree.VisitPath(
+                            regionPath,
+                            [&patchesToReapply, &requiresFullUpdate](const AZ::Dom::Path&, const PrefabOverrideMetadata& overrideMetadata)
+                            {
+                                // Moves and copies read values from outside of the region, which may not be up to date yet.
+                                requiresFullUpdate = PrefabDomUtils::FindPrefabDomValue(overrideMetadata.m_patch, "from").has_value();
+                                patchesToReapply.emplace(&overrideMetadata);
+                                return !requiresFullUpdate;
+                            },
+                            AZ::Dom::PrefixTreeTraversalFlags::ExcludeParentPaths);
+                        return !requiresFullUpdate;
+                    },
+                    AZ::Dom::PrefixTreeTraversalFlags::None);
+            }
+
+            if (requiresFullUpdate)
+            {
+                PrefabDom linkedInstanceDomBeforeUpdate;
+                linkedInstanceDomBeforeUpdate.CopyFrom(GetLinkedInstanceDom(), linkedInstanceDomBeforeUpdate.GetAllocator());
+                const bool isUpdateSuccessful = UpdateTarget();
+                if (AZ::JsonSerialization::Compare(linkedInstanceDomBeforeUpdate, GetLinkedInstanceDom()) !=
+                    AZ::JsonSerializerCompareResult::Equal)
+                {
+                    PrefabDomUtils::MarkPathAsModified(modifiedTargetPaths, instancePath);
+                }
+                return isUpdateSuccessful;
+            }
+
+            PrefabDomValue& linkedInstanceDom = GetLinkedInstanceDom();
+            PrefabDom& targetTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_targetTemplateId);
+            const PrefabDom& sourceTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_sourceTemplateId);
+            PrefabDomAllocator& allocator = targetTemplatePrefabDom.GetAllocator();
+
+            struct RegionUpdate
+            {
+                PrefabDomPath m_domPath;
+                PrefabDom m_previousValue; //!< The value of the region before the update, which stays null if it didn't exist.
+                bool m_existed = false;
+            };
+            AZStd::vector<RegionUpdate> regionUpdates;
+            regionUpdates.reserve(regionPaths.size());
+
+            for (const AZ::Dom::Path& regionPath : regionPaths)
+            {
+                RegionUpdate& regionUpdate = regionUpdates.emplace_back();
+                regionUpdate.m_domPath = PrefabDomPath(regionPath.ToString().c_str());
+
+                PrefabDomValue* targetValue = regionUpdate.m_domPath.Get(linkedInstanceDom);
+                if (targetValue)
+                {
+                    regionUpdate.m_previousValue.CopyFrom(*targetValue, regionUpdate.m_previousValue.GetAllocator());
+                    regionUpdate.m_existed = true;
+                }
+
+                // Copies the source value over the region, the patches of the region are reapplied on top of it afterwards.
+                const PrefabDomValue* sourceValue = regionUpdate.m_domPath.Get(sourceTemplatePrefabDom);
+                if (sourceValue && targetValue)
+                {
+                    targetValue->CopyFrom(*sourceValue, allocator);
+                }
+                else if (sourceValue)
+                {
+                    AZ::Dom::Path parentPath = regionPath;
+                    parentPath.Pop();
+                    PrefabDomValue* parentValue =
+                        parentPath.IsEmpty() ? &linkedInstanceDom : PrefabDomPath(parentPath.ToString().c_str()).Get(linkedInstanceDom);
+                    if (!parentValue || !parentValue->IsObject() || !regionPath.Back().IsKey())
+                    {
+                        // The region was moved by a patch outside of it, so everything is rebuilt instead.
+                        PrefabDomUtils::MarkPathAsModified(modifiedTargetPaths, instancePath);
+                        return UpdateTarget();
+                    }
+
+                    AZStd::string_view memberName = regionPath.Back().GetKey().GetStringView();
+                    parentValue->AddMember(
+                        PrefabDomValue(memberName.data(), static_cast<rapidjson::SizeType>(memberName.size()), allocator),
+                        PrefabDomValue(*sourceValue, allocator),
+                        allocator);
+                }
+                else if (targetValue)
+                {
+                    regionUpdate.m_domPath.Erase(linkedInstanceDom);
+                }
+            }
+
+            if (!patchesToReapply.empty())
+            {
+                PrefabDom patchesDom;
+                patchesDom.SetArray();
+                for (const PrefabOverrideMetadata* overrideMetadata : patchesToReapply)
+                {
+                    PrefabDomValue patch(overrideMetadata->m_patch, patchesDom.GetAllocator());
+                    patchesDom.PushBack(patch.Move(), patchesDom.GetAllocator());
+                }
+
+                AZ::JsonSerializationResult::ResultCode applyPatchResult =
+                    PrefabDomUtils::ApplyPatches(linkedInstanceDom, allocator, patchesDom);
+                if (applyPatchResult.GetProcessing() != AZ::JsonSerializationResult::Processing::Completed)
+                {
+                    AZ_Error(
+                        "Prefab", false,
+                        "Link::UpdateTarget - ApplyPatches failed for Prefab DOM from source Template '%u' and target Template '%u'.",
+                        m_sourceTemplateId, m_targetTemplateId);
+                    return false;
+                }
+                AZ_Warning(
+                    "Prefab",
+                    applyPatchResult.GetOutcome() != AZ::JsonSerializationResult::Outcomes::PartialSkip &&
+                        applyPatchResult.GetOutcome() != AZ::JsonSerializationResult::Outcomes::Skipped,
+                    "Link::UpdateTarget - Some of the patches couldn't be applied on the source template '%u' present under the "
+                    "target Template '%u'.",
+                    m_sourceTemplateId, m_targetTemplateId);
+            }
+
+            AddLinkIdToInstanceDom(linkedInstanceDom, allocator);
+
+            // Only the regions whose value differs from before the update modify the target template.
+            for (size_t regionIndex = 0; regionIndex < regionUpdates.size(); ++regionIndex)
+            {
+                const RegionUpdate& regionUpdate = regionUpdates[regionIndex];
+                const PrefabDomValue* updatedValue = regionUpdate.m_domPath.Get(linkedInstanceDom);
+                const bool isChanged = (updatedValue && regionUpdate.m_existed)
+                    ? AZ::JsonSerialization::Compare(regionUpdate.m_previousValue, *updatedValue) != AZ::JsonSerializerCompareResult::Equal
+                    : (updatedValue != nullptr) != regionUpdate.m_existed;
+                if (isChanged)
+                {
+                    PrefabDomUtils::MarkPathAsModified(modifiedTargetPaths, instancePath / regionPaths[regionIndex]);
+                }
+            }
+            return true;
+        }
+
         PrefabDomValue& Link::GetLinkedInstanceDom()
         {
             AZ_Assert(IsValid(), "Link::GetLinkedInstanceDom - Trying to get DOM of an invalid link.");
@@ -143,6 +143,14 @@ namespace AzToolsFramework
 
             bool UpdateTarget();
 
+            //! Updates the linked instance DOM in the target template with the modified values of the source template.
+            //! Only the modified values, and the values that the patches of the link overwrite along with them, are copied and
+            //! patched again, instead of rebuilding the whole linked instance DOM.
+            //! @param modifiedSourcePaths The paths of the values that were modified in the source template DOM.
+            //! @param[out] modifiedTargetPaths Gets the paths of the values of the target template DOM that the update changed.
+            //! @return Whether the update was successful.
+            bool UpdateTarget(const PrefabDomModifiedPaths& modifiedSourcePaths, PrefabDomModifiedPaths& modifiedTargetPaths);
+
             /**
              * Get the DOM of the instance that the link points to.
              * 
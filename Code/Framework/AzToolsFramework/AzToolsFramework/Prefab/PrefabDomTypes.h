@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/DOM/DomPrefixTree.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/std/containers/vector.h>
@@ -28,6 +29,9 @@ namespace AzToolsFramework
         using PrefabDomValueReference = AZStd::optional<AZStd::reference_wrapper<PrefabDomValue>>;
         using PrefabDomValueConstReference = AZStd::optional<AZStd::reference_wrapper<const PrefabDomValue>>;
 
+        // The paths of the values of a prefab DOM that were modified, which limits propagation to the parts of the DOMs that changed.
+        using PrefabDomModifiedPaths = AZ::Dom::DomPrefixTree<bool>;
+
     } // namespace Prefab
 } // namespace AzToolsFramework
 
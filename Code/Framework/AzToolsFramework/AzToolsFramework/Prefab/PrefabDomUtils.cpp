@@ -525,6 +525,94 @@ namespace AzToolsFramework
                 return AZStd::move(patchesMetadata);
             }
 
+            void MarkPathAsModified(PrefabDomModifiedPaths& modifiedPaths, const AZ::Dom::Path& path)
+            {
+                AZ::Dom::Path modifiedPath;
+                for (const AZ::Dom::PathEntry& entry : path)
+                {
+                    if (!entry.IsKey())
+                    {
+                        break;
+                    }
+                    modifiedPath.Push(entry);
+                }
+
+                if (modifiedPaths.ValueAtPath(modifiedPath, AZ::Dom::PrefixTreeMatch::PathAndParents) != nullptr)
+                {
+                    return;
+                }
+
+                // The paths under the modified path are covered by it from now on.
+                if (modifiedPath.IsEmpty())
+                {
+                    modifiedPaths.Clear();
+                }
+                else
+                {
+                    modifiedPaths.EraseValue(modifiedPath, true);
+                }
+                modifiedPaths.SetValue(modifiedPath, true);
+            }
+
+            void MarkPatchPathsAsModified(PrefabDomModifiedPaths& modifiedPaths, const PrefabDomValue& patches)
+            {
+                if (!patches.IsArray())
+                {
+                    MarkPathAsModified(modifiedPaths, AZ::Dom::Path());
+                    return;
+                }
+
+                for (const PrefabDomValue& patchEntry : patches.GetArray())
+                {
+                    PrefabDomValueConstReference patchPath =
+                        patchEntry.IsObject() ? FindPrefabDomValue(patchEntry, "path") : PrefabDomValueConstReference();
+                    if (!patchPath.has_value() || !patchPath->get().IsString())
+                    {
+                        // The patch can't be located, so anything may have been modified.
+                        MarkPathAsModified(modifiedPaths, AZ::Dom::Path());
+                        return;
+                    }
+                    MarkPathAsModified(
+                        modifiedPaths, AZ::Dom::Path(AZStd::string_view(patchPath->get().GetString(), patchPath->get().GetStringLength())));
+
+                    PrefabDomValueConstReference patchFromPath = FindPrefabDomValue(patchEntry, "from");
+                    PrefabDomValueConstReference patchOperation = FindPrefabDomValue(patchEntry, "op");
+                    if (patchFromPath.has_value() && patchFromPath->get().IsString() && patchOperation.has_value() &&
+                        patchOperation->get().IsString() && AZStd::string_view(patchOperation->get().GetString()) == "move")
+                    {
+                        MarkPathAsModified(
+                            modifiedPaths,
+                            AZ::Dom::Path(AZStd::string_view(patchFromPath->get().GetString(), patchFromPath->get().GetStringLength())));
+                    }
+                }
+            }
+
+            void MergeModifiedPaths(PrefabDomModifiedPaths& modifiedPaths, const PrefabDomModifiedPaths& pathsToMerge)
+            {
+                pathsToMerge.VisitPath(
+                    AZ::Dom::Path(),
+                    [&modifiedPaths](const AZ::Dom::Path& path, const bool&)
+                    {
+                        MarkPathAsModified(modifiedPaths, path);
+                        return true;
+                    },
+                    AZ::Dom::PrefixTreeTraversalFlags::None);
+            }
+
+            bool IsPathModified(const PrefabDomModifiedPaths& modifiedPaths, const AZ::Dom::Path& path)
+            {
+                bool isModified = false;
+                modifiedPaths.VisitPath(
+                    path,
+                    [&isModified](const AZ::Dom::Path&, const bool&)
+                    {
+                        isModified = true;
+                        return false;
+                    },
+                    AZ::Dom::PrefixTreeTraversalFlags::None);
+                return isModified;
+            }
+
             void PrintPrefabDomValue(
                 [[maybe_unused]] const AZStd::string_view printMessage,
                 [[maybe_unused]] const PrefabDomValue& prefabDomValue)
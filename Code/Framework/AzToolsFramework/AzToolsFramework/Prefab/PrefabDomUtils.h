@@ -203,6 +203,30 @@ namespace AzToolsFramework
             //! @return PatchesMetada The metadata object indicating which instance members get modified with the provided patches.
             PatchesMetadata IdentifyModifiedInstanceMembers(const PrefabDom& patches);
 
+            //! Marks a path of a prefab DOM as modified, unless one of its parent paths already is.
+            //! Array elements aren't tracked individually since adding or removing an element moves the elements after it, so the
+            //! path is cut at its first array index and the whole array is marked as modified instead.
+            //! @param modifiedPaths The modified paths to add the path to.
+            //! @param path The path of the modified value.
+            void MarkPathAsModified(PrefabDomModifiedPaths& modifiedPaths, const AZ::Dom::Path& path);
+
+            //! Marks the paths of the values modified by patches, including the paths values are moved from.
+            //! @param modifiedPaths The modified paths to add the paths of the patches to.
+            //! @param patches The patches that were applied to the prefab DOM.
+            void MarkPatchPathsAsModified(PrefabDomModifiedPaths& modifiedPaths, const PrefabDomValue& patches);
+
+            //! Marks all the paths of other modified paths as modified.
+            //! @param modifiedPaths The modified paths to add the paths to.
+            //! @param pathsToMerge The modified paths to add.
+            void MergeModifiedPaths(PrefabDomModifiedPaths& modifiedPaths, const PrefabDomModifiedPaths& pathsToMerge);
+
+            //! Checks whether the value at a path may have been modified, which is the case if the path, one of its parent paths
+            //! or a path under it is marked as modified.
+            //! @param modifiedPaths The modified paths to look the path up in.
+            //! @param path The path of the value to check.
+            //! @return true if the value at the path may have been modified.
+            bool IsPathModified(const PrefabDomModifiedPaths& modifiedPaths, const AZ::Dom::Path& path);
+
             /**
              * Prints the contents of the given prefab DOM value to the debug output console in a readable format.
              * @param printMessage The message that will be printed before printing the PrefabDomValue
@@ -18,6 +18,8 @@
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityIdMapper.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceSerializer.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
+#include <AzToolsFramework/Prefab/PrefabFocusInterface.h>
+#include <AzToolsFramework/Prefab/PrefabInstanceUtils.h>
 #include <AzToolsFramework/Prefab/Spawnable/AssetPlatformComponentRemover.h>
 #include <AzToolsFramework/Prefab/Spawnable/EditorInfoRemover.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabCatchmentProcessor.h>
@@ -264,20 +266,32 @@ namespace AzToolsFramework
 
         void PrefabSystemComponent::PropagateTemplateChanges(TemplateId templateId, InstanceOptionalConstReference instanceToExclude)
         {
+            // Without knowing what changed in the template, the whole template DOM is considered as modified.
+            PrefabDomModifiedPaths modifiedPaths;
+            PrefabDomUtils::MarkPathAsModified(modifiedPaths, AZ::Dom::Path());
+            PropagateTemplateChanges(templateId, modifiedPaths, instanceToExclude);
+        }
+
+        void PrefabSystemComponent::PropagateTemplateChanges(
+            TemplateId templateId, const PrefabDomModifiedPaths& modifiedPaths, InstanceOptionalConstReference instanceToExclude)
+        {
+            AZ_PROFILE_FUNCTION(PrefabSystem);
+
             TemplateReference findTemplateResult = FindTemplate(templateId);
-            if (findTemplateResult.has_value())
+            if (findTemplateResult.has_value() && !modifiedPaths.IsEmpty())
             {
+                TargetTemplateIdToLinkIdMap targetTemplateIdToLinkIdMap;
                 auto templateIdToLinkIdsIterator = m_templateToLinkIdsMap.find(templateId);
                 if (templateIdToLinkIdsIterator != m_templateToLinkIdsMap.end())
                 {
                     // We need to initialize a queue here because once all linked instances of a template are updated,
                     // we will find all the linkIds corresponding to the updated template and add them to this queue again.
-                    AZStd::queue<LinkIds> linkIdsToUpdateQueue;
-                    linkIdsToUpdateQueue.push(
-                        LinkIds(templateIdToLinkIdsIterator->second.begin(), templateIdToLinkIdsIterator->second.end()));
-                    UpdateLinkedInstances(linkIdsToUpdateQueue);
+                    AZStd::queue<LinkIdsToUpdate> linkIdsToUpdateQueue;
+                    linkIdsToUpdateQueue.push(LinkIdsToUpdate{
+                        LinkIds(templateIdToLinkIdsIterator->second.begin(), templateIdToLinkIdsIterator->second.end()), modifiedPaths });
+                    UpdateLinkedInstances(linkIdsToUpdateQueue, targetTemplateIdToLinkIdMap);
                 }
-                UpdatePrefabInstances(templateId, instanceToExclude);
+                UpdatePrefabInstances(templateId, modifiedPaths, targetTemplateIdToLinkIdMap, instanceToExclude);
                 m_templatesWhichNeedGarbageCollection.insert(templateId);
             }
         }
@@ -288,12 +302,31 @@ namespace AzToolsFramework
             if (templateToUpdate)
             {
                 PrefabDom& templateDomToUpdate = templateToUpdate->get().GetPrefabDom();
-                if (AZ::JsonSerialization::Compare(templateDomToUpdate, updatedDom) != AZ::JsonSerializerCompareResult::Equal)
+
+                // The patch between the DOMs tells both whether the template changed and which parts of it need to be propagated.
+                PrefabDom templateDomPatch;
+                AZ::JsonSerializationResult::ResultCode createPatchResult = AZ::JsonSerialization::CreatePatch(
+                    templateDomPatch, templateDomPatch.GetAllocator(), templateDomToUpdate, updatedDom,
+                    AZ::JsonMergeApproach::JsonPatch);
+                if (createPatchResult.GetProcessing() == AZ::JsonSerializationResult::Processing::Completed &&
+                    templateDomPatch.IsArray() && templateDomPatch.Empty())
                 {
-                    templateDomToUpdate.CopyFrom(updatedDom, templateDomToUpdate.GetAllocator());
-                    SetTemplateDirtyFlag(templateId, true);
-                    PropagateTemplateChanges(templateId);
+                    return;
                 }
+
+                PrefabDomModifiedPaths modifiedPaths;
+                if (createPatchResult.GetProcessing() == AZ::JsonSerializationResult::Processing::Completed)
+                {
+                    PrefabDomUtils::MarkPatchPathsAsModified(modifiedPaths, templateDomPatch);
+                }
+                else
+                {
+                    PrefabDomUtils::MarkPathAsModified(modifiedPaths, AZ::Dom::Path());
+                }
+
+                templateDomToUpdate.CopyFrom(updatedDom, templateDomToUpdate.GetAllocator());
+                SetTemplateDirtyFlag(templateId, true);
+                PropagateTemplateChanges(templateId, modifiedPaths);
             }
         }
 
@@ -302,22 +335,89 @@ namespace AzToolsFramework
             m_instanceUpdateExecutor.AddTemplateInstancesToQueue(templateId, instanceToExclude);
         }
 
-        void PrefabSystemComponent::UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue)
+        void PrefabSystemComponent::UpdatePrefabInstances(
+            TemplateId templateId,
+            const PrefabDomModifiedPaths& modifiedPaths,
+            const TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
+            InstanceOptionalConstReference instanceToExclude)
+        {
+            InstanceOptionalReference focusedInstance;
+            if (auto prefabFocusInterface = AZ::Interface<PrefabFocusInterface>::Get())
+            {
+                AzFramework::EntityContextId editorEntityContextId = AzFramework::EntityContextId::CreateNull();
+                EditorEntityContextRequestBus::BroadcastResult(
+                    editorEntityContextId, &EditorEntityContextRequestBus::Events::GetEditorEntityContextId);
+                focusedInstance = prefabFocusInterface->GetFocusedPrefabInstance(editorEntityContextId);
+            }
+            auto findInstancesResult = m_templateInstanceMapper.FindInstancesOwnedByTemplate(templateId);
+            if (!focusedInstance.has_value() || !findInstancesResult.has_value())
+            {
+                UpdatePrefabInstances(templateId, instanceToExclude);
+                return;
+            }
+
+            const Instance* instanceToExcludePtr = instanceToExclude.has_value() ? &(instanceToExclude->get()) : nullptr;
+            for (Instance* instance : findInstancesResult->get())
+            {
+                if (instance == instanceToExcludePtr)
+                {
+                    continue;
+                }
+
+                // Instances are loaded from the DOM stored in the focused or root template, so an instance only needs to be
+                // reloaded if its part of that DOM was modified. The focused template overrides the DOM of the instances
+                // containing it, so those are always reloaded.
+                bool isInstanceModified = true;
+                if (!PrefabInstanceUtils::IsDescendantInstance(focusedInstance->get(), *instance))
+                {
+                    const InstanceClimbUpResult climbUpResult =
+                        PrefabInstanceUtils::ClimbUpToTargetOrRootInstance(*instance, &(focusedInstance->get()));
+                    if (climbUpResult.m_reachedInstance)
+                    {
+                        const TemplateId reachedTemplateId = climbUpResult.m_reachedInstance->GetTemplateId();
+                        const PrefabDomModifiedPaths* reachedTemplateModifiedPaths = nullptr;
+                        if (reachedTemplateId == templateId)
+                        {
+                            reachedTemplateModifiedPaths = &modifiedPaths;
+                        }
+                        else if (auto propagationIterator = targetTemplateIdToLinkIdMap.find(reachedTemplateId);
+                                 propagationIterator != targetTemplateIdToLinkIdMap.end())
+                        {
+                            reachedTemplateModifiedPaths = &propagationIterator->second.m_modifiedPaths;
+                        }
+
+                        const AZ::Dom::Path instancePath(
+                            PrefabInstanceUtils::GetRelativePathFromClimbedInstances(climbUpResult.m_climbedInstances));
+                        isInstanceModified = reachedTemplateModifiedPaths &&
+                            PrefabDomUtils::IsPathModified(*reachedTemplateModifiedPaths, instancePath);
+                    }
+                }
+
+                if (isInstanceModified)
+                {
+                    m_instanceUpdateExecutor.AddInstanceToQueue(InstanceOptionalReference(*instance));
+                }
+            }
+        }
+
+        void PrefabSystemComponent::UpdateLinkedInstances(
+            AZStd::queue<LinkIdsToUpdate>& linkIdsQueue, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap)
         {
-            TargetTemplateIdToLinkIdMap targetTemplateIdToLinkIdMap;
+            AZ_PROFILE_FUNCTION(PrefabSystem);
 
             while (!linkIdsQueue.empty())
             {
 
                 // Fetch the list of linkIds at the head of the queue.
-                LinkIds& LinkIdsToUpdate = linkIdsQueue.front();
-                BucketLinkIdsByTargetTemplateId(LinkIdsToUpdate, targetTemplateIdToLinkIdMap);
+                LinkIdsToUpdate& linkIdsToUpdate = linkIdsQueue.front();
+                BucketLinkIdsByTargetTemplateId(linkIdsToUpdate.m_linkIds, targetTemplateIdToLinkIdMap);
 
                 // Update all the linked instances corresponding to the LinkIds before fetching the next set of linkIds.
                 // This will ensure that templates are updated with changes in the same order they are received.
-                for (const LinkId& linkIdToUpdate : LinkIdsToUpdate)
+                for (const LinkId& linkIdToUpdate : linkIdsToUpdate.m_linkIds)
                 {
-                    UpdateLinkedInstance(linkIdToUpdate, targetTemplateIdToLinkIdMap, linkIdsQueue);
+                    UpdateLinkedInstance(
+                        linkIdToUpdate, linkIdsToUpdate.m_modifiedSourcePaths, targetTemplateIdToLinkIdMap, linkIdsQueue);
                 }
 
                 linkIdsQueue.pop();
@@ -325,7 +425,7 @@ namespace AzToolsFramework
 
             for (const auto& element : targetTemplateIdToLinkIdMap)
             {
-                bool wasModified = element.second.second;
+                bool wasModified = !element.second.m_modifiedPaths.IsEmpty();
                 if (wasModified)
                 {
                     m_templatesWhichNeedGarbageCollection.insert(element.first);
@@ -340,72 +440,47 @@ namespace AzToolsFramework
             {
                 Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
                 TemplateId targetTemplateId = linkToUpdate.GetTargetTemplateId();
-                auto templateIdToLinkIdsIterator = targetTemplateIdToLinkIdMap.find(targetTemplateId);
-                if (templateIdToLinkIdsIterator == targetTemplateIdToLinkIdMap.end())
-                {
-                    targetTemplateIdToLinkIdMap.emplace(targetTemplateId, AZStd::make_pair(LinkIdSet{linkIdToUpdate}, false));
-                }
-                else
-                {
-                    targetTemplateIdToLinkIdMap[targetTemplateId].first.insert(linkIdToUpdate);
-                }
+                targetTemplateIdToLinkIdMap[targetTemplateId].m_linkIdsToUpdate.insert(linkIdToUpdate);
             }
         }
 
       
-        void PrefabSystemComponent::UpdateLinkedInstance(const LinkId linkIdToUpdate,
-            TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIds>& linkIdsQueue)
+        void PrefabSystemComponent::UpdateLinkedInstance(const LinkId linkIdToUpdate, const PrefabDomModifiedPaths& modifiedSourcePaths,
+            TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIdsToUpdate>& linkIdsQueue)
         {
             Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
             TemplateId targetTemplateId = linkToUpdate.GetTargetTemplateId();
-            PrefabDomValue& linkedInstanceDom = linkToUpdate.GetLinkedInstanceDom();
-
-            // create an empty Dom to hold the temp allocations so they are cleared when we leave this scope:
-            PrefabDom linkedDomBeforeUpdate; 
-            linkedDomBeforeUpdate.CopyFrom(linkedInstanceDom, linkedDomBeforeUpdate.GetAllocator());
-
-            // the following call modifies the linkedInstanceDom to have the updated changes.
-            // Most of the time, this modifies the actual linkedInstanceDom to have patches.
-            // The only circumstance this doesn't happen is if the linkedInstanceDom happens to already have the values
-            // that the override would have applied, in which case the patches don't do anything to it when applied to it
-            // and 'linkedDomBeforeUpdate == linkedDomAfterUpdate'.
-            linkToUpdate.UpdateTarget();
-
-            // the below chunk of code's job is to determine whether the template actually changed or not from UpdateTarget
-            // if it didn't change, we don't need to recurse into its children and propogate the changes - the propogation
-            // will end at this point in the heirarchy since it will not have any downstream effects.
-
-            // It is expensive to compare a DOM, so once we've compared one, we cache the fact that we compared it and it differed
-            // from before in targetTemplateIdToLinkIdMap[targetTemplateId].second.  This also means that if
-            // targetTemplateIdToLinkIdMap[targetTemplateId].second is true, there is no need to compare it again, as it will have
-            // already added its links to the queue.
-            
-            bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
-            if (!isTemplateUpdated || AZ::JsonSerialization::Compare(linkedDomBeforeUpdate, linkedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
-            {
-                targetTemplateIdToLinkIdMap[targetTemplateId].second = true;
-            }
-
-            if (targetTemplateIdToLinkIdMap.find(targetTemplateId) != targetTemplateIdToLinkIdMap.end())
-            {
-                targetTemplateIdToLinkIdMap[targetTemplateId].first.erase(linkIdToUpdate);
-                UpdateTemplateChangePropagationQueue(targetTemplateIdToLinkIdMap, targetTemplateId, linkIdsQueue);
-            }
+            TargetTemplatePropagation& targetTemplatePropagation = targetTemplateIdToLinkIdMap[targetTemplateId];
+
+            // The following call only rebuilds the parts of the linked instance DOM that the modified source paths reach.
+            // It reports back the paths of the target template it actually changed. If the link overrides all the modified
+            // values, nothing changes and the propagation ends at this point in the hierarchy, since it will not have any
+            // downstream effects.
+            PrefabDomModifiedPaths modifiedTargetPaths;
+            linkToUpdate.UpdateTarget(modifiedSourcePaths, modifiedTargetPaths);
+            PrefabDomUtils::MergeModifiedPaths(targetTemplatePropagation.m_pendingModifiedPaths, modifiedTargetPaths);
+            PrefabDomUtils::MergeModifiedPaths(targetTemplatePropagation.m_modifiedPaths, modifiedTargetPaths);
+
+            targetTemplatePropagation.m_linkIdsToUpdate.erase(linkIdToUpdate);
+            UpdateTemplateChangePropagationQueue(targetTemplateIdToLinkIdMap, targetTemplateId, linkIdsQueue);
         }
 
         void PrefabSystemComponent::UpdateTemplateChangePropagationQueue(
             TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
-            const TemplateId targetTemplateId, AZStd::queue<LinkIds>& linkIdsQueue)
+            const TemplateId targetTemplateId, AZStd::queue<LinkIdsToUpdate>& linkIdsQueue)
         {
-            if (targetTemplateIdToLinkIdMap[targetTemplateId].first.empty() &&
-                targetTemplateIdToLinkIdMap[targetTemplateId].second)
+            TargetTemplatePropagation& targetTemplatePropagation = targetTemplateIdToLinkIdMap[targetTemplateId];
+            if (targetTemplatePropagation.m_linkIdsToUpdate.empty() &&
+                !targetTemplatePropagation.m_pendingModifiedPaths.IsEmpty())
             {
                 auto templateToLinkIter = m_templateToLinkIdsMap.find(targetTemplateId);
                 if (templateToLinkIter != m_templateToLinkIdsMap.end())
                 {
-                    linkIdsQueue.push(LinkIds(templateToLinkIter->second.begin(),
-                        templateToLinkIter->second.end()));
+                    linkIdsQueue.push(LinkIdsToUpdate{
+                        LinkIds(templateToLinkIter->second.begin(), templateToLinkIter->second.end()),
+                        AZStd::move(targetTemplatePropagation.m_pendingModifiedPaths) });
                 }
+                targetTemplatePropagation.m_pendingModifiedPaths.Clear();
             }
         }
 
@@ -58,7 +58,24 @@ namespace AzToolsFramework
         {
         public:
 
-            using TargetTemplateIdToLinkIdMap = AZStd::unordered_map<TemplateId, AZStd::pair<AZStd::unordered_set<LinkId>, bool>>;
+            //! The state of the propagation of changes into a target template through its links.
+            struct TargetTemplatePropagation
+            {
+                //! The links into the target template that are waiting to be updated.
+                LinkIdSet m_linkIdsToUpdate;
+                //! The paths of the target template DOM that were modified and not propagated to its own links yet.
+                PrefabDomModifiedPaths m_pendingModifiedPaths;
+                //! All the paths of the target template DOM that were modified during the propagation.
+                PrefabDomModifiedPaths m_modifiedPaths;
+            };
+            using TargetTemplateIdToLinkIdMap = AZStd::unordered_map<TemplateId, TargetTemplatePropagation>;
+
+            //! A list of links with the same source template to update, along with the paths modified in the source template DOM.
+            struct LinkIdsToUpdate
+            {
+                LinkIds m_linkIds;
+                PrefabDomModifiedPaths m_modifiedSourcePaths;
+            };
 
             AZ_COMPONENT(PrefabSystemComponent, "{27203AE6-A398-4614-881B-4EEB5E9B34E9}");
 
@@ -254,6 +271,10 @@ namespace AzToolsFramework
             void UpdatePrefabTemplate(TemplateId templateId, const PrefabDom& updatedDom) override;
 
             void PropagateTemplateChanges(TemplateId templateId, InstanceOptionalConstReference instanceToExclude = AZStd::nullopt) override;
+            void PropagateTemplateChanges(
+                TemplateId templateId,
+                const PrefabDomModifiedPaths& modifiedPaths,
+                InstanceOptionalConstReference instanceToExclude = AZStd::nullopt) override;
 
             /**
              * Updates all Instances owned by a Template.
@@ -264,6 +285,21 @@ namespace AzToolsFramework
              */
             void UpdatePrefabInstances(TemplateId templateId, InstanceOptionalConstReference instanceToExclude = AZStd::nullopt);
 
+            /**
+             * Updates the Instances owned by a Template whose DOM, as seen from the focused or root template, was modified.
+             *
+             * @param templateId The id of the Template owning Instances to update.
+             * @param modifiedPaths The paths modified in the DOM of the Template.
+             * @param targetTemplateIdToLinkIdMap The paths modified in the DOMs of the templates the changes were propagated to.
+             * @param instanceToExclude An optional reference to an instance of the template being updated that should not be refreshed
+             *        as part of propagation.
+             */
+            void UpdatePrefabInstances(
+                TemplateId templateId,
+                const PrefabDomModifiedPaths& modifiedPaths,
+                const TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
+                InstanceOptionalConstReference instanceToExclude = AZStd::nullopt);
+
         private:
             AZ_DISABLE_COPY_MOVE(PrefabSystemComponent);
 
@@ -288,15 +324,16 @@ namespace AzToolsFramework
              * Queue gets populated with more linkId lists as linked instances are updated. Updating stops when the queue is empty.
              *
              * @param linkIdsQueue A queue of vector of link-Ids to update.
+             * @param targetTemplateIdToLinkIdMap Gets the paths modified in the DOMs of the templates the changes were propagated to.
              */
-            void UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue);
+            void UpdateLinkedInstances(AZStd::queue<LinkIdsToUpdate>& linkIdsQueue, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap);
 
             /**
              * Given a vector of link ids to update, splits them into smaller lists based on the target template id of the links.
              *
              * @param linkIdsToUpdate The list of link ids to update.
-             * @param targetTemplateIdToLinkIdMap The map of target templateIds to a pair of lists of linkIds and a bool flag indicating
-             *                                    whether any of the instances of the target template were updated.
+             * @param targetTemplateIdToLinkIdMap The map of target templateIds to the linkIds to update and the paths of the target
+             *                                    template that were modified.
              */
             void BucketLinkIdsByTargetTemplateId(LinkIds& linkIdsToUpdate,
                 TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap);
@@ -306,24 +343,26 @@ namespace AzToolsFramework
              * template change propagation queue(linkIdsQueue) when necessary.
              *
              * @param linkIdToUpdate The id of the linked instance to update
-             * @param targetTemplateIdToLinkIdMap The map of target templateIds to a pair of lists of linkIds and a bool flag indicating
-             *                                    whether any of the instances of the target template were updated.
+             * @param modifiedSourcePaths The paths modified in the source template of the link.
+             * @param targetTemplateIdToLinkIdMap The map of target templateIds to the linkIds to update and the paths of the target
+             *                                    template that were modified.
              * @param linkIdsQueue A queue of vector of link-Ids to update.
              */
-            void UpdateLinkedInstance(const LinkId linkIdToUpdate, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
-                AZStd::queue<LinkIds>& linkIdsQueue);
+            void UpdateLinkedInstance(const LinkId linkIdToUpdate, const PrefabDomModifiedPaths& modifiedSourcePaths,
+                TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIdsToUpdate>& linkIdsQueue);
 
             /**
              * If all linked instances of a target template are updated and if the content of any of the linked instances changed,
-             * this method fetches all the linked instances sourced by it and adds their corresponding ids to the LinkIdsQueue.
+             * this method fetches all the linked instances sourced by it and adds their corresponding ids to the LinkIdsQueue,
+             * along with the paths of the target template that were modified since its links were last added.
              *
-             * @param targetTemplateIdToLinkIdMap The map of target templateIds to a pair of lists of linkIds and a bool flag indicating
-             *                                    whether any of the instances of the target template were updated.
+             * @param targetTemplateIdToLinkIdMap The map of target templateIds to the linkIds to update and the paths of the target
+             *                                    template that were modified.
              * @param targetTemplateId The id of the template, whose linked instances we need to find if the template was updated.
              * @param linkIdsQueue A queue of vector of link-Ids to update.
              */
             void UpdateTemplateChangePropagationQueue(TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
-                const TemplateId targetTemplateId, AZStd::queue<LinkIds>& linkIdsQueue);
+                const TemplateId targetTemplateId, AZStd::queue<LinkIdsToUpdate>& linkIdsQueue);
 
             /**
             * Takes a prefab instance and generates a new Prefab Template
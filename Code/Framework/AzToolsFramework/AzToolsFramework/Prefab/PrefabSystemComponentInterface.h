@@ -72,6 +72,12 @@ namespace AzToolsFramework
             virtual PrefabDom& FindTemplateDom(TemplateId templateId) = 0;
             virtual void UpdatePrefabTemplate(TemplateId templateId, const PrefabDom& updatedDom) = 0;
             virtual void PropagateTemplateChanges(TemplateId templateId, InstanceOptionalConstReference instanceToExclude = AZStd::nullopt) = 0;
+            //! Propagates the changes of a template to the templates and instances that depend on it, but only to the ones that
+            //! the modified paths of the template DOM affect.
+            virtual void PropagateTemplateChanges(
+                TemplateId templateId,
+                const PrefabDomModifiedPaths& modifiedPaths,
+                InstanceOptionalConstReference instanceToExclude = AZStd::nullopt) = 0;
 
             virtual AZStd::unique_ptr<Instance> InstantiatePrefab(
                 AZ::IO::PathView filePath,
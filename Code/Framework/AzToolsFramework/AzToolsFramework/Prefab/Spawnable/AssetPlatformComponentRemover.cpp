@@ -29,7 +29,21 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 
     void AssetPlatformComponentRemover::Process(PrefabProcessorContext& prefabProcessorContext)
     {
-        AZ::PlatformTagSet platformTags = prefabProcessorContext.GetPlatformTags();
+        prefabProcessorContext.ListPrefabs(
+            [this, &prefabProcessorContext](PrefabDocument& prefab)
+            {
+                ProcessDocument(prefabProcessorContext, prefab);
+            });
+    }
+
+    bool AssetPlatformComponentRemover::ProcessesDocumentsIndependently() const
+    {
+        return true;
+    }
+
+    void AssetPlatformComponentRemover::ProcessDocument(PrefabProcessorContext& prefabProcessorContext, PrefabDocument& prefab)
+    {
+        const AZ::PlatformTagSet& platformTags = prefabProcessorContext.GetPlatformTags();
         AZStd::set<AZ::Uuid> excludedComponents;
         for (const auto& platforms : m_platformExcludedComponents)
         {
@@ -45,48 +59,44 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
             return;
         }
 
-        // Iterate over every entity, in every prefab
-        prefabProcessorContext.ListPrefabs(
-            [&prefabProcessorContext, &excludedComponents](PrefabDocument& prefab) -> void
+        // Iterate over every entity in the prefab
+        prefab.GetInstance().GetAllEntitiesInHierarchy(
+            [&prefab, &prefabProcessorContext, &excludedComponents](AZStd::unique_ptr<AZ::Entity>& entity) -> bool
             {
-                prefab.GetInstance().GetAllEntitiesInHierarchy(
-                    [&prefab, &prefabProcessorContext, &excludedComponents](AZStd::unique_ptr<AZ::Entity>& entity) -> bool
-                    {
-                        (void) prefab;
+                (void) prefab;
 
-                        // Loop over an entity's components backwards and pop-off components that shouldn't exist.
-                        AZStd::vector<AZ::Component*> components = entity->GetComponents();
-                        const auto oldComponentCount = components.size();
-                        for (int i = aznumeric_cast<int>(oldComponentCount) - 1; i >= 0; --i)
-                        {
-                            AZ::Component* component = components[i];
-                            if (excludedComponents.contains(component->GetUnderlyingComponentType()))
-                            {
-                                entity->RemoveComponent(component);
-                                delete component;
-                            }
-                        }
+                // Loop over an entity's components backwards and pop-off components that shouldn't exist.
+                AZStd::vector<AZ::Component*> components = entity->GetComponents();
+                const auto oldComponentCount = components.size();
+                for (int i = aznumeric_cast<int>(oldComponentCount) - 1; i >= 0; --i)
+                {
+                    AZ::Component* component = components[i];
+                    if (excludedComponents.contains(component->GetUnderlyingComponentType()))
+                    {
+                        entity->RemoveComponent(component);
+                        delete component;
+                    }
+                }
 
-                        // Make sure we didn't remove any components that another component dependends on
-                        if (oldComponentCount != entity->GetComponents().size())
-                        {
-                            if (entity->EvaluateDependencies() == AZ::Entity::DependencySortResult::MissingRequiredService)
-                            {
-                                AZ_Error( "AssetPlatformComponentRemover", false,
-                                    "Processing prefab '%s' failed! Removing components on entity '%s' has broken component "
-                                    "dependency. Make sure you also remove any dependent components. If dependent component is actually required, "
-                                    "then keep the provider. Please update Amazon/Tools/Prefab/Processing/PlatformExcludedComponents settings registry (.setreg).",
-                                    prefab.GetName().c_str(),
-                                    entity->GetName().c_str()
-                                );
+                // Make sure we didn't remove any components that another component dependends on
+                if (oldComponentCount != entity->GetComponents().size())
+                {
+                    if (entity->EvaluateDependencies() == AZ::Entity::DependencySortResult::MissingRequiredService)
+                    {
+                        AZ_Error( "AssetPlatformComponentRemover", false,
+                            "Processing prefab '%s' failed! Removing components on entity '%s' has broken component "
+                            "dependency. Make sure you also remove any dependent components. If dependent component is actually required, "
+                            "then keep the provider. Please update Amazon/Tools/Prefab/Processing/PlatformExcludedComponents settings registry (.setreg).",
+                            prefab.GetName().c_str(),
+                            entity->GetName().c_str()
+                        );
 
-                                prefabProcessorContext.ErrorEncountered();
-                            }
-                        }
+                        prefabProcessorContext.ErrorEncountered();
+                    }
+                }
 
-                        // continue iterating over entities...
-                        return true;
-                    });
+                // continue iterating over entities...
+                return true;
             });
     }
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -44,6 +44,8 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         ~AssetPlatformComponentRemover() override = default;
 
         void Process(PrefabProcessorContext& prefabProcessorContext) override;
+        bool ProcessesDocumentsIndependently() const override;
+        void ProcessDocument(PrefabProcessorContext& prefabProcessorContext, PrefabDocument& prefab) override;
 
     private:
         AZStd::map<AZStd::string, AZStd::set<AZ::Uuid>> m_platformExcludedComponents;
@@ -9,6 +9,7 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzToolsFramework/Debug/TraceContext.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabConversionPipeline.h>
 
@@ -51,13 +52,76 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
 
     void PrefabConversionPipeline::ProcessPrefab(PrefabProcessorContext& context)
     {
-        for (auto&& [name, processor] : m_processors)
+        auto it = m_processors.begin();
+        while (it != m_processors.end())
         {
-            AZ_TraceContext("Processor", name);
-            processor->Process(context);
-        } 
+            if (!it->second->ProcessesDocumentsIndependently())
+            {
+                AZ_TraceContext("Processor", it->first);
+                it->second->Process(context);
+                ++it;
+                continue;
+            }
+
+            // Collect the run of consecutive processors that only operate on the document they're given so they can be
+            // chained per document without waiting on the other documents in between.
+            auto runEnd = it;
+            while (runEnd != m_processors.end() && runEnd->second->ProcessesDocumentsIndependently())
+            {
+                ++runEnd;
+            }
+            ProcessDocumentsIndependently(context, it, runEnd);
+            it = runEnd;
+        }
         context.ResolveLinks();
     }
+
+    void PrefabConversionPipeline::ProcessDocumentsIndependently(
+        PrefabProcessorContext& context, PrefabProcessorStack::Iterator begin, PrefabProcessorStack::Iterator end)
+    {
+        // Independent processors don't add documents, so the collected pointers stay valid for the duration of the run.
+        AZStd::vector<PrefabDocument*> documents;
+        context.ListPrefabs(
+            [&documents](PrefabDocument& prefab)
+            {
+                documents.push_back(&prefab);
+            });
+
+        auto processDocument = [&context, begin, end](PrefabDocument& prefab)
+        {
+            for (auto it = begin; it != end; ++it)
+            {
+                AZ_TraceContext("Processor", it->first);
+                it->second->ProcessDocument(context, prefab);
+            }
+        };
+
+        auto* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool useTaskGraph = documents.size() > 1 && taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        if (!useTaskGraph)
+        {
+            for (PrefabDocument* prefab : documents)
+            {
+                processDocument(*prefab);
+            }
+            return;
+        }
+
+        AZ::TaskGraph taskGraph("Prefab conversion");
+        for (PrefabDocument* prefab : documents)
+        {
+            taskGraph.AddTask(
+                AZ::TaskDescriptor{ "Process prefab document", "Prefab conversion" },
+                [&processDocument, prefab]()
+                {
+                    processDocument(*prefab);
+                });
+        }
+        AZ::TaskGraphEvent finished{ "Prefab conversion wait" };
+        taskGraph.Submit(&finished);
+        finished.Wait();
+    }
+
     size_t PrefabConversionPipeline::CalculateProcessorFingerprint(AZ::SerializeContext* context)
     {
         size_t fingerprint = 0;
@@ -37,6 +37,8 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         
     private:
         size_t CalculateProcessorFingerprint(AZ::SerializeContext* context);
+        void ProcessDocumentsIndependently(
+            PrefabProcessorContext& context, PrefabProcessorStack::Iterator begin, PrefabProcessorStack::Iterator end);
 
         PrefabProcessorStack m_processors;
         size_t m_fingerprint{};
@@ -23,5 +23,23 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         virtual ~PrefabProcessor() = default;
 
         virtual void Process(PrefabProcessorContext& context) = 0;
+
+        //! Processors that only touch the document they're given can return true to let the conversion pipeline call
+        //! ProcessDocument for each document instead of Process. Consecutive independent processors are then run as a chain
+        //! per document, with separate documents being processed in parallel.
+        //! Only AssetPlatformComponentRemover opts in so far. EditorInfoRemover keeps per run state in members and initializes
+        //! entities, and the other built in processors register events, aliases or documents on the shared context.
+        virtual bool ProcessesDocumentsIndependently() const
+        {
+            return false;
+        }
+
+        //! Processes a single document. Only called if ProcessesDocumentsIndependently returns true. This can be called
+        //! concurrently for different documents so implementations can't add documents, register aliases, dependencies or
+        //! products, or send events through the context. ErrorEncountered is safe to call.
+        virtual void ProcessDocument([[maybe_unused]] PrefabProcessorContext& context, [[maybe_unused]] PrefabDocument& prefab)
+        {
+            AZ_Assert(false, "PrefabProcessor '%s' is processed per document but doesn't implement ProcessDocument.", RTTI_GetTypeName());
+        }
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -16,6 +16,7 @@
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzFramework/Spawnable/Spawnable.h>
@@ -108,6 +109,6 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         AZ::PlatformTagSet m_platformTags;
         AZ::Uuid m_sourceUuid;
         bool m_isIterating{ false };
-        bool m_completedSuccessfully{ true };
+        AZStd::atomic_bool m_completedSuccessfully{ true };
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
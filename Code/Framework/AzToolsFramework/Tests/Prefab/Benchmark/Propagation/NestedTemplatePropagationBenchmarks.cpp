@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Component/TransformBus.h>
+#include <Prefab/Benchmark/Propagation/NestedTemplatePropagationBenchmarks.h>
+
+#define REGISTER_NESTED_TEMPLATE_PROPAGATION_BENCHMARK(BaseClass, Method)                                                                  \
+    BENCHMARK_REGISTER_F(BaseClass, Method)                                                                                                \
+        ->Args({ 10, 1 })                                                                                                                  \
+        ->Args({ 100, 1 })                                                                                                                 \
+        ->Args({ 10, 10 })                                                                                                                 \
+        ->Args({ 100, 10 })                                                                                                                \
+        ->Args({ 10, 50 })                                                                                                                 \
+        ->ArgNames({ "LeafInstancesInEachPrefab", "DepthOfNesting" })                                                                      \
+        ->Unit(benchmark::kMillisecond);
+
+namespace Benchmark
+{
+    using namespace AzToolsFramework::Prefab;
+
+    void NestedTemplatePropagationBenchmarks::SetupHarness(const benchmark::State& state)
+    {
+        BM_Prefab::SetupHarness(state);
+
+        const unsigned int leafInstancesCountInEachPrefab = static_cast<unsigned int>(state.range(0));
+        const unsigned int depthOfNesting = static_cast<unsigned int>(state.range(1));
+
+        CreateFakePaths(depthOfNesting + 1); // The +1 is for the path of the leaf prefab
+        const auto& leafTemplatePath = m_paths.front();
+
+        // Create the leaf prefab, whose template is changed by the benchmarks.
+        m_entityToModify = CreateEntity("Entity", AZ::EntityId());
+        m_instanceCreated = m_prefabSystemComponent->CreatePrefab({ m_entityToModify, CreateEntity("Entity") }, {}, leafTemplatePath);
+        m_instanceToModify = m_instanceCreated.get();
+        m_leafTemplateId = m_instanceCreated->GetTemplateId();
+
+        // Every prefab of the hierarchy nests instances of the leaf prefab next to the prefab of the level below it, so every
+        // template of the hierarchy depends on the leaf template.
+        AZStd::unique_ptr<Instance> nestedInstance;
+        for (unsigned int depth = 1; depth <= depthOfNesting; depth++)
+        {
+            AZStd::vector<AZStd::unique_ptr<Instance>> nestedInstances;
+            nestedInstances.reserve(leafInstancesCountInEachPrefab + 1);
+            for (unsigned int leafInstanceCounter = 0; leafInstanceCounter < leafInstancesCountInEachPrefab; leafInstanceCounter++)
+            {
+                nestedInstances.emplace_back(m_prefabSystemComponent->InstantiatePrefab(m_leafTemplateId));
+            }
+            if (nestedInstance)
+            {
+                nestedInstances.emplace_back(AZStd::move(nestedInstance));
+            }
+            nestedInstance = m_prefabSystemComponent->CreatePrefab({}, AZStd::move(nestedInstances), m_paths[depth]);
+        }
+        m_instanceToUseForPropagation = AZStd::move(nestedInstance);
+    }
+
+    void NestedTemplatePropagationBenchmarks::TeardownHarness(const benchmark::State& state)
+    {
+        m_instanceToUseForPropagation.reset();
+        m_instanceCreated.reset();
+        BM_Prefab::TeardownHarness(state);
+    }
+
+    void NestedTemplatePropagationBenchmarks::UpdateLeafTemplate(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            float worldX = 0.0f;
+            AZ::TransformBus::EventResult(worldX, m_entityToModify->GetId(), &AZ::TransformInterface::GetWorldX);
+
+            // Move the entity and update the leaf template, which propagates the change through the links of the hierarchy.
+            AZ::TransformBus::Event(m_entityToModify->GetId(), &AZ::TransformInterface::SetWorldX, worldX + 1);
+            PrefabDom updatedLeafPrefabDom;
+            PrefabDomUtils::StoreInstanceInPrefabDom(*m_instanceCreated, updatedLeafPrefabDom);
+            m_prefabSystemComponent->UpdatePrefabTemplate(m_leafTemplateId, updatedLeafPrefabDom);
+
+            m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+        }
+    }
+
+    BENCHMARK_DEFINE_F(NestedTemplatePropagationBenchmarks, PropagateLeafTemplateComponentChange)(benchmark::State& state)
+    {
+        UpdateLeafTemplate(state);
+    }
+    REGISTER_NESTED_TEMPLATE_PROPAGATION_BENCHMARK(NestedTemplatePropagationBenchmarks, PropagateLeafTemplateComponentChange);
+
+} // namespace Benchmark
+#endif
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#if defined(HAVE_BENCHMARK)
+
+#pragma once
+
+#include <Prefab/Benchmark/Propagation/PropagationBenchmarkFixture.h>
+
+namespace Benchmark
+{
+    using namespace AzToolsFramework::Prefab;
+
+    //! This class captures benchmarks for propagating changes of a widely used leaf prefab through the templates of a deeply nested
+    //! prefab hierarchy, from the template update through the links down to the reload of the affected instances.
+    class NestedTemplatePropagationBenchmarks : public PropagationBenchmarkFixture
+    {
+    protected:
+        void SetupHarness(const benchmark::State& state) override;
+        void TeardownHarness(const benchmark::State& state) override;
+
+        void UpdateLeafTemplate(benchmark::State& state);
+
+        TemplateId m_leafTemplateId = InvalidTemplateId;
+    };
+} // namespace Benchmark
+#endif
@@ -6,11 +6,17 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
 #include <AzToolsFramework/Prefab/Spawnable/AssetPlatformComponentRemover.h>
+#include <AzToolsFramework/Prefab/Spawnable/PrefabConversionPipeline.h>
 #include <AzToolsFramework/UnitTest/AzToolsFrameworkTestHelpers.h>
 #include <Prefab/PrefabDomTypes.h>
 #include <Prefab/Spawnable/PrefabProcessorContext.h>
@@ -87,6 +93,64 @@ namespace UnitTest
         }
     };
 
+    //! Appends a suffix to the name of every entity, either per document or serially over all documents.
+    class EntityRenameProcessor
+        : public AzToolsFramework::Prefab::PrefabConversionUtils::PrefabProcessor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(EntityRenameProcessor, AZ::SystemAllocator);
+        AZ_RTTI(UnitTest::EntityRenameProcessor, "{3C0E2B5A-6F0D-4C61-9E4B-2A7D8F1C5B93}",
+            AzToolsFramework::Prefab::PrefabConversionUtils::PrefabProcessor);
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<EntityRenameProcessor, AzToolsFramework::Prefab::PrefabConversionUtils::PrefabProcessor>()
+                    ->Version(1)
+                    ->Field("Suffix", &EntityRenameProcessor::m_suffix)
+                    ->Field("Independent", &EntityRenameProcessor::m_independent);
+            }
+        }
+
+        EntityRenameProcessor() = default;
+        EntityRenameProcessor(AZStd::string suffix, bool independent)
+            : m_suffix(AZStd::move(suffix))
+            , m_independent(independent)
+        {
+        }
+
+        void Process(AzToolsFramework::Prefab::PrefabConversionUtils::PrefabProcessorContext& context) override
+        {
+            context.ListPrefabs(
+                [this, &context](AzToolsFramework::Prefab::PrefabConversionUtils::PrefabDocument& prefab)
+                {
+                    ProcessDocument(context, prefab);
+                });
+        }
+
+        bool ProcessesDocumentsIndependently() const override
+        {
+            return m_independent;
+        }
+
+        void ProcessDocument(
+            [[maybe_unused]] AzToolsFramework::Prefab::PrefabConversionUtils::PrefabProcessorContext& context,
+            AzToolsFramework::Prefab::PrefabConversionUtils::PrefabDocument& prefab) override
+        {
+            prefab.GetInstance().GetAllEntitiesInHierarchy(
+                [this](AZStd::unique_ptr<AZ::Entity>& entity) -> bool
+                {
+                    entity->SetName(entity->GetName() + m_suffix);
+                    return true;
+                });
+        }
+
+    private:
+        AZStd::string m_suffix;
+        bool m_independent = false;
+    };
+
     class PrefabProcessingTestFixture
         : public LeakDetectionFixture
     {
@@ -141,6 +205,28 @@ namespace UnitTest
             return entity;
         }
 
+        //! Returns every entity of every document as "<document>/<entity>", with a marker for each test component it still has.
+        static AZStd::vector<AZStd::string> CollectEntityStates(
+            AzToolsFramework::Prefab::PrefabConversionUtils::PrefabProcessorContext& prefabProcessorContext)
+        {
+            AZStd::vector<AZStd::string> entityStates;
+            prefabProcessorContext.ListPrefabs(
+                [&entityStates](AzToolsFramework::Prefab::PrefabConversionUtils::PrefabDocument& prefab)
+                {
+                    prefab.GetInstance().GetAllEntitiesInHierarchy(
+                        [&entityStates, &prefab](AZStd::unique_ptr<AZ::Entity>& entity) -> bool
+                        {
+                            entityStates.push_back(AZStd::string::format("%s/%s%s%s",
+                                prefab.GetName().c_str(), entity->GetName().c_str(),
+                                entity->FindComponent(Uuid_RemoveThisComponent) ? " remove" : "",
+                                entity->FindComponent(Uuid_KeepThisComponent) ? " keep" : ""));
+                            return true;
+                        });
+                });
+            AZStd::sort(entityStates.begin(), entityStates.end());
+            return entityStates;
+        }
+
         AZStd::unique_ptr<AzToolsFramework::ToolsApplication> m_application = {};
         AzToolsFramework::Prefab::PrefabConversionUtils::AssetPlatformComponentRemover m_processor;
     };
@@ -229,4 +315,129 @@ namespace UnitTest
         AZ_TEST_STOP_TRACE_SUPPRESSION(1); //< Expect 1 error due to missing a component dependency
         ASSERT_FALSE(prefabProcessorContext.HasCompletedSuccessfully());
     }
+
+    TEST_F(PrefabProcessingTestFixture, PrefabProcessorRemoveComponentPerPlatform_ProcessDocumentOnlyChangesGivenDocument)
+    {
+        using namespace AzToolsFramework::Prefab::PrefabConversionUtils;
+
+        PrefabProcessorContext prefabProcessorContext{ AZ::Uuid::CreateRandom() };
+        prefabProcessorContext.SetPlatformTags({ AZ::Crc32(PlatformTag) });
+
+        // Create two documents from the same prefab
+        AzToolsFramework::Prefab::PrefabDom prefabDom;
+        AZStd::vector<AZ::Entity*> entities;
+        entities.emplace_back(CreateSourceEntity(EntityName, { Uuid_RemoveThisComponent, Uuid_KeepThisComponent }));
+        ConvertEntitiesToPrefab(entities, prefabDom);
+
+        PrefabDocument processedDocument("processedPrefab");
+        ASSERT_TRUE(processedDocument.SetPrefabDom(prefabDom));
+        prefabProcessorContext.AddPrefab(AZStd::move(processedDocument));
+        PrefabDocument untouchedDocument("untouchedPrefab");
+        ASSERT_TRUE(untouchedDocument.SetPrefabDom(prefabDom));
+        prefabProcessorContext.AddPrefab(AZStd::move(untouchedDocument));
+
+        // Process only the first document, the same way the conversion pipeline does for independent processors
+        ASSERT_TRUE(m_processor.ProcessesDocumentsIndependently());
+        prefabProcessorContext.ListPrefabs(
+            [this, &prefabProcessorContext](PrefabDocument& prefab) -> void
+            {
+                if (prefab.GetName() == "processedPrefab")
+                {
+                    m_processor.ProcessDocument(prefabProcessorContext, prefab);
+                }
+            }
+        );
+        ASSERT_TRUE(prefabProcessorContext.HasCompletedSuccessfully());
+
+        // Validate the component is only removed from the processed document
+        prefabProcessorContext.ListPrefabs(
+            [](PrefabDocument& prefab) -> void
+            {
+                const bool isProcessed = prefab.GetName() == "processedPrefab";
+                prefab.GetInstance().GetAllEntitiesInHierarchy(
+                    [isProcessed](AZStd::unique_ptr<AZ::Entity>& entity) -> bool
+                    {
+                        if (entity->GetName() == EntityName)
+                        {
+                            EXPECT_EQ(entity->FindComponent(Uuid_RemoveThisComponent) == nullptr, isProcessed);
+                            EXPECT_NE(entity->FindComponent(Uuid_KeepThisComponent), nullptr);
+                        }
+                        return true;
+                    }
+                );
+            }
+        );
+    }
+
+    TEST_F(PrefabProcessingTestFixture, PrefabProcessorRemoveComponentPerPlatform_ConversionPipelineMatchesSerialProcessing)
+    {
+        using namespace AzToolsFramework::Prefab::PrefabConversionUtils;
+
+        EntityRenameProcessor::Reflect(m_application->GetSerializeContext());
+
+        // A stack mixing processors that run per document with one that runs serially over all documents
+        constexpr AZStd::string_view StackSettings = R"({
+            "Amazon": { "Tools": { "Prefab": { "Processing": { "Stack": { "ParallelProcessingTest": {
+                "Component remover": {
+                    "$type": "AzToolsFramework::Prefab::PrefabConversionUtils::AssetPlatformComponentRemover",
+                    "PlatformExcludedComponents": { "platform_1": [ "{6E29CD1C-D2CF-4763-80E1-F45FFA439A6A}" ] }
+                },
+                "First rename": { "$type": "UnitTest::EntityRenameProcessor", "Suffix": "_a", "Independent": true },
+                "Serial rename": { "$type": "UnitTest::EntityRenameProcessor", "Suffix": "_b", "Independent": false },
+                "Last rename": { "$type": "UnitTest::EntityRenameProcessor", "Suffix": "_c", "Independent": true }
+            } } } } }
+        })";
+        ASSERT_TRUE(AZ::SettingsRegistry::Get()->MergeSettings(StackSettings, AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        PrefabConversionPipeline pipeline;
+        ASSERT_TRUE(pipeline.LoadStackProfile("ParallelProcessingTest"));
+
+        AzToolsFramework::Prefab::PrefabDom prefabDom;
+        AZStd::vector<AZ::Entity*> entities;
+        entities.emplace_back(CreateSourceEntity("entity_1", { Uuid_RemoveThisComponent, Uuid_KeepThisComponent }));
+        entities.emplace_back(CreateSourceEntity("entity_2", { Uuid_KeepThisComponent }));
+        ConvertEntitiesToPrefab(entities, prefabDom);
+
+        auto createContext = [&prefabDom](PrefabProcessorContext& prefabProcessorContext)
+        {
+            prefabProcessorContext.SetPlatformTags({ AZ::Crc32(PlatformTag) });
+            for (int i = 0; i < 8; ++i)
+            {
+                PrefabDocument document(AZStd::string::format("prefab_%i", i));
+                EXPECT_TRUE(document.SetPrefabDom(prefabDom));
+                prefabProcessorContext.AddPrefab(AZStd::move(document));
+            }
+        };
+
+        // Run the pipeline with the task graph active so the documents are processed in parallel
+        auto* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        ASSERT_NE(taskGraphActiveInterface, nullptr);
+        AZ::Interface<AZ::IConsole>::Get()->PerformCommand("cl_activateTaskGraph", { "true" });
+        EXPECT_TRUE(taskGraphActiveInterface->IsTaskGraphActive());
+
+        PrefabProcessorContext pipelineContext{ AZ::Uuid::CreateRandom() };
+        createContext(pipelineContext);
+        pipeline.ProcessPrefab(pipelineContext);
+        EXPECT_TRUE(pipelineContext.HasCompletedSuccessfully());
+
+        AZ::Interface<AZ::IConsole>::Get()->PerformCommand("cl_activateTaskGraph", { "false" });
+
+        // Run the same processors serially over all documents, in stack order
+        EntityRenameProcessor firstRename("_a", true);
+        EntityRenameProcessor serialRename("_b", false);
+        EntityRenameProcessor lastRename("_c", true);
+
+        PrefabProcessorContext serialContext{ AZ::Uuid::CreateRandom() };
+        createContext(serialContext);
+        m_processor.Process(serialContext);
+        firstRename.Process(serialContext);
+        serialRename.Process(serialContext);
+        lastRename.Process(serialContext);
+        EXPECT_TRUE(serialContext.HasCompletedSuccessfully());
+
+        const AZStd::vector<AZStd::string> pipelineStates = CollectEntityStates(pipelineContext);
+        EXPECT_EQ(pipelineStates, CollectEntityStates(serialContext));
+        EXPECT_NE(AZStd::find(pipelineStates.begin(), pipelineStates.end(), "prefab_7/entity_1_a_b_c keep"), pipelineStates.end());
+        EXPECT_NE(AZStd::find(pipelineStates.begin(), pipelineStates.end(), "prefab_7/entity_2_a_b_c keep"), pipelineStates.end());
+    }
 } // namespace UnitTest
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzToolsFramework/Entity/PrefabEditorEntityOwnershipInterface.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
 #include <Prefab/PrefabTestComponent.h>
@@ -15,7 +16,75 @@
 
 namespace UnitTest
 {
-    using PrefabUpdateTemplateTest = PrefabTestFixture;
+    class PrefabUpdateTemplateTest
+        : public PrefabTestFixture
+    {
+    protected:
+        //! A wheel prefab with a PrefabTestComponent, nested once under an axle prefab which is nested once under a car prefab.
+        //! The wheel under the axle overrides the IntProperty of the component with OverriddenIntProperty.
+        struct OverriddenWheelHierarchy
+        {
+            PrefabTestComponent* m_prefabTestComponent = nullptr;
+            AZStd::unique_ptr<Instance> m_wheelIsolatedInstance;
+            AZStd::unique_ptr<Instance> m_axleInstance;
+            AZStd::unique_ptr<Instance> m_carInstance;
+            TemplateId m_wheelTemplateId = InvalidTemplateId;
+            TemplateId m_axleTemplateId = InvalidTemplateId;
+            TemplateId m_carTemplateId = InvalidTemplateId;
+            AZStd::vector<InstanceAlias> m_wheelInstanceAliasesUnderAxle;
+            AZStd::vector<InstanceAlias> m_axleInstanceAliasesUnderCar;
+            AZStd::string m_componentPath; //!< Path of the PrefabTestComponent within the wheel template DOM.
+        };
+
+        static constexpr int OverriddenIntProperty = 5;
+
+        void CreateOverriddenWheelHierarchy(OverriddenWheelHierarchy& hierarchy)
+        {
+            // Create a single entity wheel instance with a PrefabTestComponent and create a template out of it.
+            AZ::Entity* wheelEntity = CreateEntity("WheelEntity1", false);
+            hierarchy.m_prefabTestComponent = aznew PrefabTestComponent(true);
+            hierarchy.m_prefabTestComponent->m_intProperty = 1;
+            wheelEntity->AddComponent(hierarchy.m_prefabTestComponent);
+            hierarchy.m_wheelIsolatedInstance = m_prefabSystemComponent->CreatePrefab({ wheelEntity }, {}, WheelPrefabMockFilePath);
+            hierarchy.m_wheelTemplateId = hierarchy.m_wheelIsolatedInstance->GetTemplateId();
+            PrefabDom& wheelTemplateDom = m_prefabSystemComponent->FindTemplateDom(hierarchy.m_wheelTemplateId);
+            const EntityAlias entityAlias = hierarchy.m_wheelIsolatedInstance->GetEntityAliases().front();
+            PrefabDomValue* wheelEntityComponents = PrefabTestDomUtils::GetPrefabDomComponentsPath(entityAlias).Get(wheelTemplateDom);
+            ASSERT_TRUE(wheelEntityComponents != nullptr && wheelEntityComponents->IsObject());
+            hierarchy.m_componentPath = AZStd::string::format(
+                "/%s/%s/%s/%s", PrefabTestDomUtils::EntitiesValueName, entityAlias.c_str(), PrefabTestDomUtils::ComponentsValueName,
+                wheelEntityComponents->MemberBegin()->name.GetString());
+
+            // Create an axle with 0 entities and 1 wheel instance.
+            AZStd::unique_ptr<Instance> wheel1UnderAxle = m_prefabSystemComponent->InstantiatePrefab(hierarchy.m_wheelTemplateId);
+            hierarchy.m_axleInstance = m_prefabSystemComponent->CreatePrefab({},
+                MakeInstanceList(AZStd::move(wheel1UnderAxle)), AxlePrefabMockFilePath);
+            hierarchy.m_axleTemplateId = hierarchy.m_axleInstance->GetTemplateId();
+            hierarchy.m_wheelInstanceAliasesUnderAxle = hierarchy.m_axleInstance->GetNestedInstanceAliases(hierarchy.m_wheelTemplateId);
+            ASSERT_EQ(hierarchy.m_wheelInstanceAliasesUnderAxle.size(), 1);
+
+            // Create a car with 0 entities and 1 axle instance.
+            AZStd::unique_ptr<Instance> axleUnderCar = m_prefabSystemComponent->InstantiatePrefab(hierarchy.m_axleTemplateId);
+            hierarchy.m_carInstance = m_prefabSystemComponent->CreatePrefab({},
+                MakeInstanceList(AZStd::move(axleUnderCar)), CarPrefabMockFilePath);
+            hierarchy.m_carTemplateId = hierarchy.m_carInstance->GetTemplateId();
+            hierarchy.m_axleInstanceAliasesUnderCar = hierarchy.m_carInstance->GetNestedInstanceAliases(hierarchy.m_axleTemplateId);
+
+            // Override the int property of the wheel under the axle and propagate the override.
+            PrefabDom overridePatches;
+            overridePatches.Parse(AZStd::string::format(R"([{ "op": "replace", "path": "%s/IntProperty", "value": %d }])",
+                hierarchy.m_componentPath.c_str(), OverriddenIntProperty).c_str());
+            InstanceOptionalReference wheelInstanceUnderAxle =
+                hierarchy.m_axleInstance->FindNestedInstance(hierarchy.m_wheelInstanceAliasesUnderAxle.front());
+            ASSERT_TRUE(wheelInstanceUnderAxle.has_value());
+            LinkReference wheelLink = m_prefabSystemComponent->FindLink(wheelInstanceUnderAxle->get().GetLinkId());
+            ASSERT_TRUE(wheelLink.has_value());
+            wheelLink->get().AddOverrides(overridePatches);
+            ASSERT_TRUE(wheelLink->get().UpdateTarget());
+            m_prefabSystemComponent->PropagateTemplateChanges(hierarchy.m_axleTemplateId);
+            m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+        }
+    };
 
     /*
         The below tests use an example of car->axle->wheel templates to test that change propagation works correctly within templates.
@@ -417,4 +486,70 @@ namespace UnitTest
         // Validate that the axles under the car have the same DOM as the axle template.
         PrefabTestDomUtils::ValidatePrefabDomInstances(axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
     }
+
+    TEST_F(PrefabUpdateTemplateTest, UpdatePrefabTemplate_ChangeOverriddenComponentProperty_OverrideKeptAndDependentTemplatesUnchanged)
+    {
+        OverriddenWheelHierarchy hierarchy;
+        CreateOverriddenWheelHierarchy(hierarchy);
+        ASSERT_FALSE(HasFatalFailure());
+        PrefabDom& axleTemplateDom = m_prefabSystemComponent->FindTemplateDom(hierarchy.m_axleTemplateId);
+        PrefabDom& carTemplateDom = m_prefabSystemComponent->FindTemplateDom(hierarchy.m_carTemplateId);
+
+        PrefabDom axleTemplateDomBeforeUpdate;
+        axleTemplateDomBeforeUpdate.CopyFrom(axleTemplateDom, axleTemplateDomBeforeUpdate.GetAllocator());
+        PrefabDom carTemplateDomBeforeUpdate;
+        carTemplateDomBeforeUpdate.CopyFrom(carTemplateDom, carTemplateDomBeforeUpdate.GetAllocator());
+
+        // Change the overridden int property of the component from Wheel instance and use it to update the wheel template.
+        hierarchy.m_prefabTestComponent->m_intProperty = 2;
+        PrefabDom updatedWheelInstanceDom;
+        ASSERT_TRUE(PrefabDomUtils::StoreInstanceInPrefabDom(*hierarchy.m_wheelIsolatedInstance, updatedWheelInstanceDom));
+        m_prefabSystemComponent->UpdatePrefabTemplate(hierarchy.m_wheelTemplateId, updatedWheelInstanceDom);
+        m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+
+        // Validate that the wheel under the axle keeps its override, so neither the axle nor the car template changed.
+        PrefabDomValue* wheelInstanceDomUnderAxle =
+            PrefabTestDomUtils::GetPrefabDomInstancePath(hierarchy.m_wheelInstanceAliasesUnderAxle.front()).Get(axleTemplateDom);
+        ASSERT_TRUE(wheelInstanceDomUnderAxle != nullptr);
+        const AZStd::string intPropertyPath = hierarchy.m_componentPath + "/IntProperty";
+        PrefabDomValue* intPropertyValue = PrefabDomPath(intPropertyPath.c_str()).Get(*wheelInstanceDomUnderAxle);
+        ASSERT_TRUE(intPropertyValue != nullptr && intPropertyValue->IsInt());
+        EXPECT_EQ(intPropertyValue->GetInt(), OverriddenIntProperty);
+        EXPECT_EQ(AZ::JsonSerialization::Compare(axleTemplateDomBeforeUpdate, axleTemplateDom), AZ::JsonSerializerCompareResult::Equal);
+        EXPECT_EQ(AZ::JsonSerialization::Compare(carTemplateDomBeforeUpdate, carTemplateDom), AZ::JsonSerializerCompareResult::Equal);
+
+        // Validate that the axles under the car have the same DOM as the axle template.
+        PrefabTestDomUtils::ValidatePrefabDomInstances(hierarchy.m_axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
+    }
+
+    TEST_F(PrefabUpdateTemplateTest, UpdatePrefabTemplate_ChangeComponentPropertyNextToOverride_OverrideKeptAndChangePropagated)
+    {
+        OverriddenWheelHierarchy hierarchy;
+        CreateOverriddenWheelHierarchy(hierarchy);
+        ASSERT_FALSE(HasFatalFailure());
+        PrefabDom& axleTemplateDom = m_prefabSystemComponent->FindTemplateDom(hierarchy.m_axleTemplateId);
+        PrefabDom& carTemplateDom = m_prefabSystemComponent->FindTemplateDom(hierarchy.m_carTemplateId);
+
+        // Change the bool property of the component from Wheel instance and use it to update the wheel template.
+        hierarchy.m_prefabTestComponent->m_boolProperty = false;
+        PrefabDom updatedWheelInstanceDom;
+        ASSERT_TRUE(PrefabDomUtils::StoreInstanceInPrefabDom(*hierarchy.m_wheelIsolatedInstance, updatedWheelInstanceDom));
+        m_prefabSystemComponent->UpdatePrefabTemplate(hierarchy.m_wheelTemplateId, updatedWheelInstanceDom);
+        m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+
+        // Validate that the wheel under the axle got the bool property change and still has its int property override.
+        // The bool property isn't serialized anymore since false is its default value.
+        PrefabDomValue* wheelInstanceDomUnderAxle =
+            PrefabTestDomUtils::GetPrefabDomInstancePath(hierarchy.m_wheelInstanceAliasesUnderAxle.front()).Get(axleTemplateDom);
+        ASSERT_TRUE(wheelInstanceDomUnderAxle != nullptr);
+        PrefabDomValue* componentValue = PrefabDomPath(hierarchy.m_componentPath.c_str()).Get(*wheelInstanceDomUnderAxle);
+        ASSERT_TRUE(componentValue != nullptr && componentValue->IsObject());
+        EXPECT_FALSE(PrefabDomUtils::FindPrefabDomValue(*componentValue, PrefabTestDomUtils::BoolPropertyName).has_value());
+        PrefabDomValueReference intPropertyValue = PrefabDomUtils::FindPrefabDomValue(*componentValue, "IntProperty");
+        ASSERT_TRUE(intPropertyValue.has_value() && intPropertyValue->get().IsInt());
+        EXPECT_EQ(intPropertyValue->get().GetInt(), OverriddenIntProperty);
+
+        // Validate that the axles under the car have the same DOM as the axle template.
+        PrefabTestDomUtils::ValidatePrefabDomInstances(hierarchy.m_axleInstanceAliasesUnderCar, carTemplateDom, axleTemplateDom);
+    }
 }
@@ -78,6 +78,8 @@ set(FILES
     Prefab/Benchmark/PrefabInstantiateBenchmarks.cpp
     Prefab/Benchmark/PrefabLoadBenchmarks.cpp
     Prefab/Benchmark/PrefabUpdateInstancesBenchmarks.cpp
+    Prefab/Benchmark/Propagation/NestedTemplatePropagationBenchmarks.cpp
+    Prefab/Benchmark/Propagation/NestedTemplatePropagationBenchmarks.h
     Prefab/Benchmark/Propagation/PropagationBenchmarkFixture.cpp
     Prefab/Benchmark/Propagation/PropagationBenchmarkFixture.h
     Prefab/Benchmark/Propagation/SingleInstanceMultipleNestedInstancesBenchmarks.cpp
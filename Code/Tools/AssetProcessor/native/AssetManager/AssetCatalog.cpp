@@ -12,6 +12,7 @@
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/std/string/wildcard.h>
 #include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Asset/BinaryAssetRegistry.h>
 #include <AzFramework/FileTag/FileTagBus.h>
 #include <AzFramework/FileTag/FileTag.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
@@ -299,6 +300,12 @@ namespace AssetProcessor
                 AzFramework::AssetRegistry::ReflectSerialize(serializeContext);
             }
 
+            bool saveBinaryCatalog = false;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(saveBinaryCatalog, AzFramework::BinaryAssetRegistry::SaveBinaryCatalogKey);
+            }
+
             // save out a catalog for each platform
             for (const QString& platform : m_platforms)
             {
@@ -306,17 +313,31 @@ namespace AssetProcessor
                 QElapsedTimer timer;
                 timer.start();
                 m_saveBuffer.clear();
-                // allow this to grow by up to 20mb at a time so as not to fragment.
-                // we re-use the save buffer each time to further reduce memory load.
-                AZ::IO::ByteContainerStream<AZStd::vector<char>> catalogFileStream(&m_saveBuffer, 1024 * 1024 * 20);
-
-                // these 3 lines are what writes the entire registry to the memory stream
-                AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&catalogFileStream, *serializeContext, AZ::ObjectStream::ST_BINARY);
+                bool savedBinaryCatalog = false;
+                if (saveBinaryCatalog)
                 {
+                    // The binary catalog is used in place by the runtime, which saves it from deserializing the whole catalog.
                     QMutexLocker locker(&m_registriesMutex);
-                    objStream->WriteClass(&m_registries[platform]);
+                    savedBinaryCatalog = AzFramework::BinaryAssetRegistry::Write(m_registries[platform], m_saveBuffer);
+                    AZ_Warning(AssetProcessor::ConsoleChannel, savedBinaryCatalog,
+                        "Failed to write the %s catalog in the binary format, saving it through the object stream instead.\n", platform.toUtf8().constData());
+                }
+
+                if (!savedBinaryCatalog)
+                {
+                    m_saveBuffer.clear();
+                    // allow this to grow by up to 20mb at a time so as not to fragment.
+                    // we re-use the save buffer each time to further reduce memory load.
+                    AZ::IO::ByteContainerStream<AZStd::vector<char>> catalogFileStream(&m_saveBuffer, 1024 * 1024 * 20);
+
+                    // these 3 lines are what writes the entire registry to the memory stream
+                    AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&catalogFileStream, *serializeContext, AZ::ObjectStream::ST_BINARY);
+                    {
+                        QMutexLocker locker(&m_registriesMutex);
+                        objStream->WriteClass(&m_registries[platform]);
+                    }
+                    objStream->Finalize();
                 }
-                objStream->Finalize();
 
                 // now write the memory stream out to the temp folder
                 QString workSpace;
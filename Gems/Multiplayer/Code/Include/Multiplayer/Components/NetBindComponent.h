@@ -17,6 +17,8 @@
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntitySerializationCache.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntitySnapshot.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/NetworkInput/IMultiplayerComponentInput.h>
@@ -201,6 +203,14 @@ namespace Multiplayer
         void FillReplicationRecord(ReplicationRecord& replicationRecord) const;
         void FillTotalReplicationRecord(ReplicationRecord& replicationRecord) const;
 
+        //! Returns the cache of serialized state deltas shared by every connection replicating this entity.
+        //! @return reference to this entity's serialization cache
+        EntitySerializationCache& GetSerializationCache();
+
+        //! Returns the history of complete proxy state snapshots shared by every connection replicating this entity.
+        //! @return reference to this entity's snapshot history
+        EntitySnapshotHistory& GetSnapshotHistory();
+
     private:
         void PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole);
 
@@ -230,6 +240,8 @@ namespace Multiplayer
         ReplicationRecord m_totalRecord = NetEntityRole::InvalidRole;
         ReplicationRecord m_predictableRecord = NetEntityRole::Autonomous;
         ReplicationRecord m_localNotificationRecord = NetEntityRole::InvalidRole;
+        EntitySerializationCache m_serializationCache;
+        EntitySnapshotHistory m_snapshotHistory;
         PrefabEntityId    m_prefabEntityId;
         AZ::Data::AssetId m_prefabAssetId;
         // It is important that this component map be ordered, as we walk it to generate serialization ordering
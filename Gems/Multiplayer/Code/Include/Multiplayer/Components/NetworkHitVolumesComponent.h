@@ -10,6 +10,8 @@
 
 #include <Source/AutoGen/NetworkHitVolumesComponent.AutoComponent.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <Multiplayer/NetworkTime/LagCompensationScene.h>
 #include <Integration/ActorComponentBus.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
@@ -68,8 +70,11 @@ namespace Multiplayer
 
     private:
         void OnPreRender(float deltaTime);
+        void OnRecordLagCompensation(LagCompensationScene& lagCompensationScene);
+        void UpdateHitVolumes();
         void OnTransformUpdate(const AZ::Transform& transform);
         void OnSyncRewind();
+        void RecordLagCompensationHitVolumes(LagCompensationScene& lagCompensationScene);
 
         void CreateHitVolumes();
         void DestroyHitVolumes();
@@ -93,9 +98,11 @@ namespace Multiplayer
         const Physics::CharacterColliderConfiguration* m_hitDetectionConfig = nullptr;
 
         AZStd::vector<AnimatedHitVolume> m_animatedHitVolumes;
+        AZStd::vector<LagCompensationHitVolume> m_lagCompensationHitVolumes;
 
         Multiplayer::EntitySyncRewindEvent::Handler m_syncRewindHandler;
         Multiplayer::EntityPreRenderEvent::Handler m_preRenderHandler;
+        Multiplayer::LagCompensationRecordEvent::Handler m_lagCompensationRecordHandler;
         AZ::TransformChangedEvent::Handler m_transformChangedHandler;
 
         AzFramework::DebugDisplayRequests* m_debugDisplay = nullptr;
@@ -33,10 +33,15 @@ namespace Multiplayer
         void OnCorrection();
         void OnTransformChanged();
         void OnParentChanged(NetEntityId parentId);
+
+        //! Returns the replicated rotation, reading the quantized property when QuantizeRotation is enabled.
+        AZ::Quaternion GetReplicatedRotation() const;
+        AZ::Quaternion GetReplicatedRotationPrevious() const;
         
         EntityPreRenderEvent::Handler m_entityPreRenderEventHandler;
         EntityCorrectionEvent::Handler m_entityCorrectionEventHandler;
         AZ::Event<AZ::Quaternion>::Handler m_rotationChangedEventHandler;
+        AZ::Event<QuantizedRotation>::Handler m_quantizedRotationChangedEventHandler;
         AZ::Event<AZ::Vector3>::Handler m_translationChangedEventHandler;
         AZ::Event<float>::Handler m_scaleChangedEventHandler;
         AZ::Event<NetEntityId>::Handler m_parentChangedEventHandler;
@@ -42,6 +42,13 @@ namespace Multiplayer
         //! Creates and manages sending updates to the remote endpoint.
         virtual void Update() = 0;
 
+        //! Gathers and serializes the updates for the remote endpoint without sending them.
+        //! Safe to call from a worker thread, pending entities must have been activated beforehand on the main thread.
+        virtual void PrepareUpdate() = 0;
+
+        //! Sends the updates gathered by the last call to PrepareUpdate, must be called from the main thread.
+        virtual void SendPreparedUpdate() = 0;
+
         //! Returns whether update messages can be sent to the connection.
         //! @return true if update messages can be sent
         virtual bool CanSendUpdates() const = 0;
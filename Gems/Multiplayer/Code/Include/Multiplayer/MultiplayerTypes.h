@@ -24,6 +24,7 @@
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Utilities/QuantizedTransforms.h>
 #include <Multiplayer/MultiplayerConstants.h>
 
 namespace Multiplayer
@@ -70,6 +71,13 @@ namespace Multiplayer
     using LongNetworkString = AZ::CVarFixedString;
     using ReliabilityType = AzNetworking::ReliabilityType;
 
+    //! Quantized network property types for replicated transforms, usable as a NetworkProperty Type in AutoComponent xml.
+    //! NetworkTransformComponent only replicates a QuantizedRotation when its QuantizeRotation option is enabled.
+    //! Rotations are smallest three compressed to 47 bits rather than the 128 of a full AZ::Quaternion.
+    using QuantizedRotation = AzNetworking::QuantizedQuaternion<15>;
+    //! Positions are range quantized to roughly millimeter precision, only suitable for worlds within +/- 8km of the origin.
+    using QuantizedPosition = AzNetworking::QuantizedVector3<24, -8192, 8192>;
+
     class NetworkEntityRpcMessage;
     using RpcSendEvent = AZ::Event<NetworkEntityRpcMessage&>;
 
@@ -61,6 +61,14 @@ namespace Multiplayer
 
         void ActivatePendingEntities();
         void SendUpdates();
+
+        //! Generates and serializes all pending entity updates and RPCs without sending them.
+        //! This only touches state owned by this connection, so it may run on a worker thread in parallel with other connections.
+        //! Must be followed by a call to SendPreparedUpdates() on the main thread before the next tick.
+        void PrepareUpdates();
+
+        //! Sends everything gathered by the last call to PrepareUpdates() and records the sent packet ids.
+        void SendPreparedUpdates();
         void Clear(bool forMigration);
 
         bool SetEntityRebasing(NetworkEntityHandle& entityHandle);
@@ -122,8 +130,17 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
-        void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
+        struct PreparedEntityUpdates
+        {
+            NetworkEntityUpdateVector m_entityUpdates;
+            EntityReplicatorList m_replicators;
+        };
+        using PreparedEntityUpdateList = AZStd::vector<PreparedEntityUpdates>;
+        using PreparedEntityRpcList = AZStd::vector<NetworkEntityRpcVector>;
+
+        void PrepareEntityUpdateMessages(EntityReplicatorList& replicatorList);
+        void PrepareEntityRpcs(RpcMessages& rpcMessages, PreparedEntityRpcList& preparedRpcs);
+        void SendEntityRpcs(PreparedEntityRpcList& preparedRpcs, bool reliable);
         void SendEntityResets();
 
         void MigrateEntityInternal(NetEntityId entityId);
@@ -195,6 +212,12 @@ namespace Multiplayer
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
 
+        // Packets built by PrepareUpdates, waiting to be sent by SendPreparedUpdates
+        PreparedEntityUpdateList m_preparedEntityUpdates;
+        PreparedEntityRpcList m_preparedRpcsReliable;
+        PreparedEntityRpcList m_preparedRpcsUnreliable;
+        bool m_hasPreparedUpdates = false;
+
         AZ::Event<NetEntityId> m_autonomousEntityReplicatorCreated;
         EntityExitDomainEvent::Handler m_entityExitDomainEventHandler;
         SendMigrateEntityEvent m_sendMigrateEntityEvent;
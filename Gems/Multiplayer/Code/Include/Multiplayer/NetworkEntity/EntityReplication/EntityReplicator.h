@@ -92,6 +92,7 @@ namespace Multiplayer
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges);
         bool IsPacketIdValid(AzNetworking::PacketId packetId) const;
         AzNetworking::PacketId GetLastReceivedPacketId() const;
+        bool ResolveSnapshotUpdate(AzNetworking::PacketId packetId, const AzNetworking::PacketEncodingBuffer& updateData, AzNetworking::PacketEncodingBuffer& outStateData);
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Multiplayer
+{
+    //! @class EntitySerializationCache
+    //! @brief Caches the serialized state deltas of a single entity for the current host frame.
+    //! Every connection replicating an entity serializes the same property values, and connections that are in sync
+    //! will also serialize the same set of dirty bits. This cache lets those connections share a single serialization.
+    //! Lookups and stores are thread safe so that connection updates may be prepared in parallel.
+    class EntitySerializationCache
+    {
+    public:
+        EntitySerializationCache() = default;
+        ~EntitySerializationCache() = default;
+
+        //! Looks up a cached serialization of the provided replication record.
+        //! @param hostFrameId the host frame the serialization is being generated for
+        //! @param record      the replication record that would be serialized
+        //! @param outData     output buffer the cached serialization is copied into on success
+        //! @return boolean true if a cached serialization was found
+        bool Find(HostFrameId hostFrameId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outData) const;
+
+        //! Stores a serialization of the provided replication record.
+        //! Storing for a new host frame discards everything cached for prior host frames.
+        //! @param hostFrameId the host frame the serialization was generated for
+        //! @param record      the replication record that was serialized
+        //! @param data        the serialized record and entity state
+        void Store(HostFrameId hostFrameId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& data);
+
+        //! Discards all cached serializations, must be called whenever the entity state changes.
+        void Invalidate();
+
+    private:
+        AZ_DISABLE_COPY_MOVE(EntitySerializationCache);
+
+        struct CachedSerialization
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<CachedSerialization> m_cachedSerializations;
+        HostFrameId m_hostFrameId = InvalidHostFrameId;
+    };
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AzNetworking
+{
+    class ISerializer;
+}
+
+namespace Multiplayer
+{
+    class NetBindComponent;
+    class EntitySnapshotHistory;
+
+    //! @class EntitySnapshot
+    //! @brief The complete serialized proxy state of a single entity for a single host frame.
+    //! A snapshot holds a replication record containing every property replicated to clients followed by the property values,
+    //! so applying one on the receiving end is no different from applying any other entity update.
+    //! Snapshots are stored as an array of words so that AzNetworking::DeltaSerializer can encode one against another.
+    class EntitySnapshot
+    {
+    public:
+        //! DeltaSerializer tracks a bounded number of values, one of which is used by the snapshot size.
+        static constexpr uint32_t MaxDeltaWords = 254;
+        static constexpr uint32_t MaxDeltaBytes = MaxDeltaWords * sizeof(uint32_t);
+
+        EntitySnapshot() = default;
+        EntitySnapshot(HostFrameId hostFrameId, const uint8_t* data, uint32_t byteSize);
+
+        //! Serializes the complete proxy state of an entity into a new snapshot.
+        //! @param hostFrameId      the host frame the snapshot is being generated for
+        //! @param netBindComponent the entity to generate a snapshot of
+        //! @return the new snapshot, or nullptr if serialization failed
+        static AZStd::shared_ptr<EntitySnapshot> Create(HostFrameId hostFrameId, NetBindComponent& netBindComponent);
+
+        //! Writes a snapshot update, delta encoded against the baseline if one is provided and both fit in a SerializerDelta.
+        //! @param serializer ISerializer instance to write the update to
+        //! @param snapshot   the snapshot to write
+        //! @param baseline   the snapshot the remote endpoint is known to have, may be nullptr
+        //! @return boolean true for success, false for serialization failure
+        static bool WriteUpdate(AzNetworking::ISerializer& serializer, EntitySnapshot& snapshot, EntitySnapshot* baseline);
+
+        //! Reads a snapshot update written by WriteUpdate, resolving delta encoded updates against the provided history.
+        //! @param serializer ISerializer instance to read the update from
+        //! @param history    previously received snapshots to look up delta baselines in
+        //! @return the reconstructed snapshot, or nullptr if the update was malformed or its baseline is unavailable
+        static AZStd::shared_ptr<EntitySnapshot> ReadUpdate(AzNetworking::ISerializer& serializer, const EntitySnapshotHistory& history);
+
+        //! Returns true if a delta between this snapshot and the provided one fits within a SerializerDelta.
+        //! @param other the other snapshot
+        //! @return boolean true if the two snapshots can be delta encoded against each other
+        bool CanDeltaEncode(const EntitySnapshot& other) const;
+
+        HostFrameId GetHostFrameId() const;
+        uint32_t GetByteSize() const;
+        const uint8_t* GetBuffer() const;
+
+        //! Serializes the snapshot contents one word at a time, used by AzNetworking::DeltaSerializer.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(AzNetworking::ISerializer& serializer);
+
+    private:
+        HostFrameId m_hostFrameId = InvalidHostFrameId;
+        uint32_t m_byteSize = 0;
+        AZStd::vector<uint32_t> m_words;
+    };
+
+    //! @class EntitySnapshotHistory
+    //! @brief A bounded history of the most recent snapshots of a single entity, ordered from most to least recent.
+    //! Publishers use the history to share one snapshot per host frame between every connection and to look up the baseline
+    //! each connection last acknowledged. Subscribers use it to look up the baselines of delta encoded updates.
+    //! All methods are thread safe so that connection updates may be prepared in parallel.
+    class EntitySnapshotHistory
+    {
+    public:
+        EntitySnapshotHistory();
+        ~EntitySnapshotHistory() = default;
+
+        //! Returns the snapshot of the entity for the provided host frame, creating it if this is the first request this frame.
+        //! @param hostFrameId      the current host frame
+        //! @param netBindComponent the entity to generate a snapshot of if required
+        //! @return the snapshot for the host frame, or nullptr if it could not be generated
+        AZStd::shared_ptr<EntitySnapshot> GetOrCreate(HostFrameId hostFrameId, NetBindComponent& netBindComponent);
+
+        //! Returns the stored snapshot for the provided host frame.
+        //! @param hostFrameId the host frame to look up
+        //! @return the snapshot, or nullptr if none is stored for the host frame
+        AZStd::shared_ptr<EntitySnapshot> Find(HostFrameId hostFrameId) const;
+
+        //! Stores a snapshot as the most recent entry, evicting the oldest entry if the history is full.
+        //! @param snapshot the snapshot to store
+        void Store(AZStd::shared_ptr<EntitySnapshot> snapshot);
+
+        //! Discards all stored snapshots.
+        void Clear();
+
+    private:
+        AZ_DISABLE_COPY_MOVE(EntitySnapshotHistory);
+
+        void StoreInternal(AZStd::shared_ptr<EntitySnapshot>&& snapshot);
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::ring_buffer<AZStd::shared_ptr<EntitySnapshot>> m_snapshots;
+    };
+}
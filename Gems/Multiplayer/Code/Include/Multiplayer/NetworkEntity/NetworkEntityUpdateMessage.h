@@ -61,6 +61,14 @@ namespace Multiplayer
         //! @return whether or not the entity was migrated
         bool GetWasMigrated() const;
 
+        //! Sets whether the data holds an entity snapshot rather than a replication record and state delta.
+        //! @param value true if the data holds an entity snapshot
+        void SetIsSnapshot(bool value);
+
+        //! Gets the current value of IsSnapshot.
+        //! @return the current value of IsSnapshot
+        bool GetIsSnapshot() const;
+
         //! Gets the current value of HasValidPrefabId.
         //! @return the current value of HasValidPrefabId
         bool GetHasValidPrefabId() const;
@@ -96,6 +104,7 @@ namespace Multiplayer
         NetEntityId    m_entityId = InvalidNetEntityId;
         bool           m_isDelete = false;
         bool           m_wasMigrated = false;
+        bool           m_isSnapshot = false;
         bool           m_hasValidPrefabId = false;
         PrefabEntityId m_prefabEntityId;
 
@@ -9,23 +9,40 @@
 #pragma once
 
 #include <Multiplayer/NetworkInput/NetworkInput.h>
-#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace Multiplayer
 {
     //! @class NetworkInputHistory
     //! @brief A list of input commands, used for bookkeeping on the client.
+    //! Inputs are stored in a ring buffer of pooled slots. Popped slots retain their component inputs, so pushing an input into a
+    //! previously used slot copies values without allocating. The ring only grows when pushing into a full history.
     class NetworkInputHistory final
     {
     public:
+        NetworkInputHistory() = default;
+        explicit NetworkInputHistory(AZStd::size_t capacity);
+
         AZStd::size_t Size() const;
 
+        //! Returns the number of inputs the history can hold before it needs to grow.
+        //! @return the number of pooled input slots
+        AZStd::size_t GetCapacity() const;
+
+        //! Grows the history so it can hold at least the provided number of inputs without reallocating.
+        //! @param capacity the number of inputs to reserve space for
+        void Reserve(AZStd::size_t capacity);
+
         const NetworkInput& operator[](AZStd::size_t index) const;
         NetworkInput& operator[](AZStd::size_t index);
 
-        void PushBack(NetworkInput& networkInput);
+        void PushBack(const NetworkInput& networkInput);
         void PopFront();
         const NetworkInput& Front() const;
+        const NetworkInput& Back() const;
+
+        //! Discards all inputs, retaining the pooled slots.
+        void Clear();
 
     private:
 
@@ -36,6 +53,10 @@ namespace Multiplayer
             NetworkInput m_networkInput;
         };
 
-        AZStd::deque<Wrapper> m_history;
+        AZStd::size_t GetSlotIndex(AZStd::size_t index) const;
+
+        AZStd::vector<Wrapper> m_slots;
+        AZStd::size_t m_head = 0;
+        AZStd::size_t m_size = 0;
     };
 }
@@ -8,12 +8,18 @@
 
 #pragma once
 
+#include <AzCore/EBus/Event.h>
 #include <AzCore/Time/ITime.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace Multiplayer
 {
+    class LagCompensationScene;
+
+    //! Signaled once per server tick while the lag compensation scene is enabled, for every hit volume owner to record into it.
+    using LagCompensationRecordEvent = AZ::Event<LagCompensationScene&>;
+
     //! @class INetworkTime
     //! @brief This is an AZ::Interface<> for managing multiplayer specific time related operations.
     class INetworkTime
@@ -71,6 +77,16 @@ namespace Multiplayer
         //! Restores all rewound entities to the current application time.
         virtual void ClearRewoundEntities() = 0;
 
+        //! Returns the lag compensation scene holding the recent history of server hit volumes.
+        //! While enabled, hit volumes are no longer rewound inside the physics scene and hit scans should query the lag compensation scene instead.
+        //! @return pointer to the lag compensation scene, nullptr if lag compensation scenes are disabled
+        virtual LagCompensationScene* GetLagCompensationScene() = 0;
+
+        //! Adds a handler recording hit volumes into the lag compensation scene.
+        //! Handlers are invoked from the server tick for every registered entity, independent of rendering and visibility.
+        //! @param handler the handler to add
+        virtual void AddLagCompensationRecordHandler(LagCompensationRecordEvent::Handler& handler) = 0;
+
         AZ_DISABLE_COPY_MOVE(INetworkTime);
     };
 
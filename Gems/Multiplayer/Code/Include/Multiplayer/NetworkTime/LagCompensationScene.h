@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace Multiplayer
+{
+    //! The primitive shapes supported by the lag compensation scene.
+    enum class LagCompensationShapeType : uint8_t
+    {
+        Sphere,  //!< Sphere centered on the hit volume transform, m_halfExtents.GetX() is the radius
+        Capsule, //!< Capsule along the local z-axis, m_halfExtents.GetX() is the radius and m_halfExtents.GetZ() is half the total height
+        Box      //!< Oriented box, m_halfExtents holds the half dimensions along each local axis
+    };
+
+    //! A single hit volume recorded into the lag compensation scene.
+    struct LagCompensationHitVolume
+    {
+        AZ::Transform m_worldTransform = AZ::Transform::CreateIdentity(); //!< World space pose of the hit volume, scale is ignored
+        AZ::Vector3 m_halfExtents = AZ::Vector3::CreateZero();
+        NetEntityId m_netEntityId = InvalidNetEntityId;
+        uint32_t m_hitVolumeIndex = 0; //!< Index of the hit volume within the owning entity, used to match volumes between frames
+        LagCompensationShapeType m_shapeType = LagCompensationShapeType::Sphere;
+    };
+
+    //! Parameters for a ray cast against the lag compensation scene.
+    struct LagCompensationRayCastRequest
+    {
+        AZ::Vector3 m_start = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_direction = AZ::Vector3::CreateAxisY(); //!< Must be normalized
+        float m_distance = 0.0f;
+        NetEntityId m_ignoredNetEntityId = InvalidNetEntityId; //!< Typically the shooter, so a hit scan never hits its own hit volumes
+        bool m_reportMultipleHits = false; //!< If false only the closest hit is reported
+    };
+
+    //! A single ray cast hit against the lag compensation scene.
+    struct LagCompensationHit
+    {
+        NetEntityId m_netEntityId = InvalidNetEntityId;
+        uint32_t m_hitVolumeIndex = 0;
+        float m_distance = 0.0f;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+    };
+
+    //! @class LagCompensationScene
+    //! @brief Per host frame history of server hit volumes, queried directly by backward reconciled hit scans.
+    //!
+    //! Rewinding the physics scene moves every hit volume shape inside the rewind volume twice per query, once to the rewound pose
+    //! and once more to restore it. The lag compensation scene instead keeps a ring of RewindHistorySize snapshots of every hit
+    //! volume in structure of arrays form, each with its own bounding volume hierarchy, so a hit scan for any recent host frame is a
+    //! read only query that never touches the live physics scene.
+    //!
+    //! Each recorded volume stores the index of the same volume in the preceding frame, and hierarchy bounds cover the motion
+    //! between the two, so queries may blend between the requested and preceding host frame the same way rewound values do.
+    //!
+    //! Hit volumes are recorded between BeginFrame and EndFrame, AddHitVolumes may be called concurrently. Queries may run
+    //! concurrently with each other, but not with recording.
+    class LagCompensationScene
+    {
+    public:
+        LagCompensationScene() = default;
+        ~LagCompensationScene() = default;
+
+        //! Starts recording hit volumes for the provided host frame.
+        //! Recording the most recently recorded host frame again replaces its contents.
+        //! @param hostFrameId the host frame being recorded
+        void BeginFrame(HostFrameId hostFrameId);
+
+        //! Adds hit volumes to the frame being recorded, ignored if no frame is being recorded. Thread safe.
+        //! @param hitVolumes the hit volumes to add
+        //! @param count      the number of hit volumes to add
+        void AddHitVolumes(const LagCompensationHitVolume* hitVolumes, uint32_t count);
+
+        //! Finishes recording the current frame and builds its bounding volume hierarchy.
+        void EndFrame();
+
+        //! Discards all recorded frames.
+        void Clear();
+
+        //! Returns true if the scene holds a snapshot for the provided host frame.
+        //! @param hostFrameId the host frame to check
+        //! @return boolean true if the host frame can be queried
+        bool HasFrame(HostFrameId hostFrameId) const;
+
+        //! Returns the number of hit volumes recorded for the provided host frame.
+        //! @param hostFrameId the host frame to check
+        //! @return the number of hit volumes recorded, 0 if the host frame is not available
+        uint32_t GetHitVolumeCount(HostFrameId hostFrameId) const;
+
+        //! Casts a ray against the hit volumes of a past host frame.
+        //! @param hostFrameId the host frame to query
+        //! @param blendFactor the factor used to blend between the preceding and requested host frame, see INetworkTime::GetHostBlendFactor
+        //! @param request     the ray cast parameters
+        //! @param outHits     receives the hits ordered by distance, cleared before the query
+        //! @return boolean true if anything was hit
+        bool RayCast(HostFrameId hostFrameId, float blendFactor, const LagCompensationRayCastRequest& request, AZStd::vector<LagCompensationHit>& outHits) const;
+
+        //! Gathers the entities owning any hit volume whose bounds overlap the provided volume in a past host frame.
+        //! @param hostFrameId     the host frame to query
+        //! @param blendFactor     the factor used to blend between the preceding and requested host frame
+        //! @param volume          the world space volume to test
+        //! @param outNetEntityIds receives the unique overlapping entities, cleared before the query
+        void OverlapAabb(HostFrameId hostFrameId, float blendFactor, const AZ::Aabb& volume, AZStd::vector<NetEntityId>& outNetEntityIds) const;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(LagCompensationScene);
+
+        static constexpr uint32_t InvalidIndex = static_cast<uint32_t>(-1);
+        static constexpr uint32_t MaxLeafSize = 4;
+
+        //! A hierarchy node, leaves reference m_count consecutive hit volumes starting at m_index.
+        //! Interior nodes have an m_count of zero, their left child immediately follows them and m_index is the right child.
+        struct BvhNode
+        {
+            AZ::Aabb m_bounds;
+            uint32_t m_index = 0;
+            uint32_t m_count = 0;
+        };
+
+        //! Hit volumes of a single host frame, stored in hierarchy leaf order.
+        struct Frame
+        {
+            HostFrameId m_hostFrameId = InvalidHostFrameId;
+            AZStd::vector<NetEntityId> m_netEntityIds;
+            AZStd::vector<uint32_t> m_hitVolumeIndices;
+            AZStd::vector<LagCompensationShapeType> m_shapeTypes;
+            AZStd::vector<float> m_positionX;
+            AZStd::vector<float> m_positionY;
+            AZStd::vector<float> m_positionZ;
+            AZStd::vector<AZ::Quaternion> m_rotations;
+            AZStd::vector<float> m_halfExtentX;
+            AZStd::vector<float> m_halfExtentY;
+            AZStd::vector<float> m_halfExtentZ;
+            AZStd::vector<uint32_t> m_previousIndices;
+            AZStd::vector<BvhNode> m_nodes;
+
+            void Clear();
+            void Resize(uint32_t count);
+            uint32_t GetCount() const;
+        };
+
+        //! The pose of a single hit volume after blending between frames.
+        struct BlendedHitVolume
+        {
+            AZ::Vector3 m_position;
+            AZ::Quaternion m_rotation;
+            AZ::Vector3 m_halfExtents;
+            LagCompensationShapeType m_shapeType;
+        };
+
+        const Frame* FindFrame(HostFrameId hostFrameId) const;
+        BlendedHitVolume GetBlendedHitVolume(const Frame& frame, const Frame* previousFrame, uint32_t index, float blendFactor) const;
+        uint32_t BuildNode(uint32_t begin, uint32_t end);
+
+        static AZ::Aabb GetBounds(const AZ::Vector3& position, const AZ::Quaternion& rotation, const AZ::Vector3& halfExtents, LagCompensationShapeType shapeType);
+        static bool RayCastHitVolume(const BlendedHitVolume& hitVolume, const LagCompensationRayCastRequest& request, float& outDistance);
+
+        AZStd::array<Frame, RewindHistorySize> m_frames;
+        Frame* m_recordingFrame = nullptr;
+        HostFrameId m_lastRecordedFrameId = InvalidHostFrameId;
+
+        // Recording scratch space, retained between frames to avoid reallocating
+        AZStd::mutex m_recordingMutex;
+        AZStd::vector<LagCompensationHitVolume> m_pendingHitVolumes;
+        AZStd::vector<AZ::Aabb> m_pendingBounds;
+        AZStd::vector<AZ::Vector3> m_pendingCenters;
+        AZStd::vector<uint32_t> m_pendingOrder;
+        AZStd::vector<uint32_t> m_pendingPreviousIndices;
+        AZStd::unordered_map<AZStd::pair<uint64_t, uint32_t>, uint32_t> m_previousIndexMap;
+    };
+}
@@ -602,6 +602,10 @@ namespace Multiplayer
 
         const uint32_t maxClientInputs = clientInputRateSec > 0.0 ? static_cast<uint32_t>(maxRewindHistory / clientInputRateSec) : 0;
 
+        // The history briefly holds one input past the rewind window before the oldest is popped
+        // Reserving up front lets the ring buffer recycle its pooled inputs instead of growing during play
+        m_inputHistory.Reserve(maxClientInputs + 1);
+
         IMultiplayer* multiplayer = GetMultiplayer();
         INetworkTime* networkTime = GetNetworkTime();
         while (m_moveAccumulator >= clientInputRateSec)
@@ -682,6 +682,16 @@ namespace Multiplayer
         }
     }
 
+    EntitySerializationCache& NetBindComponent::GetSerializationCache()
+    {
+        return m_serializationCache;
+    }
+
+    EntitySnapshotHistory& NetBindComponent::GetSnapshotHistory()
+    {
+        return m_snapshotHistory;
+    }
+
     void NetBindComponent::PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole)
     {
         AZ_Assert(entity != nullptr, "AZ::Entity is null");
@@ -837,6 +847,9 @@ namespace Multiplayer
         }
         m_totalRecord.Append(m_currentRecord);
         m_currentRecord.Clear();
+
+        // Our state has changed, previously serialized deltas can no longer be shared
+        m_serializationCache.Invalidate();
     }
 
     void NetBindComponent::HandleLocalServerRpcMessage(NetworkEntityRpcMessage& message)
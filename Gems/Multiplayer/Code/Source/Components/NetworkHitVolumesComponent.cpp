@@ -23,6 +23,29 @@ namespace Multiplayer
     AZ_CVAR(float, bg_RewindPositionTolerance, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta position is less than this value");
     AZ_CVAR(float, bg_RewindOrientationTolerance, 0.001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Don't sync the physx entity if the square of delta orientation is less than this value");
 
+    static bool GetLagCompensationShape(const Physics::ShapeConfiguration* shapeConfig, LagCompensationShapeType& outShapeType, AZ::Vector3& outHalfExtents)
+    {
+        if (const Physics::SphereShapeConfiguration* sphereCollider = azrtti_cast<const Physics::SphereShapeConfiguration*>(shapeConfig))
+        {
+            outShapeType = LagCompensationShapeType::Sphere;
+            outHalfExtents = AZ::Vector3(sphereCollider->m_radius);
+            return true;
+        }
+        else if (const Physics::CapsuleShapeConfiguration* capsuleCollider = azrtti_cast<const Physics::CapsuleShapeConfiguration*>(shapeConfig))
+        {
+            outShapeType = LagCompensationShapeType::Capsule;
+            outHalfExtents = AZ::Vector3(capsuleCollider->m_radius, capsuleCollider->m_radius, capsuleCollider->m_height * 0.5f);
+            return true;
+        }
+        else if (const Physics::BoxShapeConfiguration* boxCollider = azrtti_cast<const Physics::BoxShapeConfiguration*>(shapeConfig))
+        {
+            outShapeType = LagCompensationShapeType::Box;
+            outHalfExtents = boxCollider->m_dimensions * 0.5f;
+            return true;
+        }
+        return false;
+    }
+
     NetworkHitVolumesComponent::AnimatedHitVolume::AnimatedHitVolume
     (
         AzNetworking::ConnectionId connectionId,
@@ -110,6 +133,7 @@ namespace Multiplayer
     NetworkHitVolumesComponent::NetworkHitVolumesComponent()
         : m_syncRewindHandler([this]() { OnSyncRewind(); })
         , m_preRenderHandler([this](float deltaTime) { OnPreRender(deltaTime); })
+        , m_lagCompensationRecordHandler([this](LagCompensationScene& lagCompensationScene) { OnRecordLagCompensation(lagCompensationScene); })
         , m_transformChangedHandler([this](const AZ::Transform&, const AZ::Transform& worldTm) { OnTransformUpdate(worldTm); })
     {
         ;
@@ -125,6 +149,10 @@ namespace Multiplayer
         EMotionFX::Integration::ActorComponentNotificationBus::Handler::BusConnect(GetEntityId());
         GetNetBindComponent()->AddEntitySyncRewindEventHandler(m_syncRewindHandler);
         GetNetBindComponent()->AddEntityPreRenderEventHandler(m_preRenderHandler);
+        if (IsNetEntityRoleAuthority())
+        {
+            Multiplayer::GetNetworkTime()->AddLagCompensationRecordHandler(m_lagCompensationRecordHandler);
+        }
         GetTransformComponent()->BindTransformChangedEventHandler(m_transformChangedHandler);
         OnTransformUpdate(GetTransformComponent()->GetWorldTM());
 
@@ -149,6 +177,7 @@ namespace Multiplayer
         m_debugDisplay = nullptr;
         m_syncRewindHandler.Disconnect();
         m_preRenderHandler.Disconnect();
+        m_lagCompensationRecordHandler.Disconnect();
         m_transformChangedHandler.Disconnect();
         DestroyHitVolumes();
         Physics::CharacterNotificationBus::Handler::BusDisconnect();
@@ -156,6 +185,23 @@ namespace Multiplayer
     }
 
     void NetworkHitVolumesComponent::OnPreRender([[maybe_unused]] float deltaTime)
+    {
+        UpdateHitVolumes();
+
+        if (bg_DrawArticulatedHitVolumes)
+        {
+            DrawDebugHitVolumes();
+        }
+    }
+
+    void NetworkHitVolumesComponent::OnRecordLagCompensation(LagCompensationScene& lagCompensationScene)
+    {
+        // Pre-render is skipped for entities outside the view, so update the hit volumes here as well before recording them
+        UpdateHitVolumes();
+        RecordLagCompensationHitVolumes(lagCompensationScene);
+    }
+
+    void NetworkHitVolumesComponent::UpdateHitVolumes()
     {
         if (m_animatedHitVolumes.empty())
         {
@@ -169,11 +215,6 @@ namespace Multiplayer
             m_actorComponent->GetJointTransformComponents(hitVolume.m_jointIndex, EMotionFX::Integration::Space::ModelSpace, position, rotation, scale);
             hitVolume.UpdateTransform(AZ::Transform::CreateFromQuaternionAndTranslation(rotation, position) * hitVolume.m_colliderOffSetTransform);
         }
-
-        if (bg_DrawArticulatedHitVolumes)
-        {
-            DrawDebugHitVolumes();
-        }
     }
 
     void NetworkHitVolumesComponent::OnTransformUpdate([[maybe_unused]] const AZ::Transform& transform)
@@ -189,12 +230,41 @@ namespace Multiplayer
             m_physicsCharacter->GetCharacter()->SetFrameId(frameId);
         }
 
+        if (Multiplayer::GetNetworkTime()->GetLagCompensationScene() != nullptr)
+        {
+            // Hit scans query the lag compensation scene, so hit volumes inside the physics scene always stay at their current pose
+            return;
+        }
+
         for (AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
         {
             hitVolume.SyncToCurrentTransform();
         }
     }
 
+    void NetworkHitVolumesComponent::RecordLagCompensationHitVolumes(LagCompensationScene& lagCompensationScene)
+    {
+        const AZ::Transform& worldTransform = GetTransformComponent()->GetWorldTM();
+        const AZ::Transform entityTransform = AZ::Transform::CreateFromQuaternionAndTranslation(worldTransform.GetRotation(), worldTransform.GetTranslation());
+        const NetEntityId netEntityId = GetNetEntityId();
+
+        m_lagCompensationHitVolumes.clear();
+        for (uint32_t hitVolumeIndex = 0; hitVolumeIndex < static_cast<uint32_t>(m_animatedHitVolumes.size()); ++hitVolumeIndex)
+        {
+            const AnimatedHitVolume& hitVolume = m_animatedHitVolumes[hitVolumeIndex];
+            LagCompensationHitVolume lagCompensationHitVolume;
+            if (GetLagCompensationShape(hitVolume.m_shapeConfig, lagCompensationHitVolume.m_shapeType, lagCompensationHitVolume.m_halfExtents))
+            {
+                lagCompensationHitVolume.m_worldTransform = entityTransform * hitVolume.m_transform.Get();
+                lagCompensationHitVolume.m_netEntityId = netEntityId;
+                lagCompensationHitVolume.m_hitVolumeIndex = hitVolumeIndex;
+                m_lagCompensationHitVolumes.push_back(lagCompensationHitVolume);
+            }
+        }
+
+        lagCompensationScene.AddHitVolumes(m_lagCompensationHitVolumes.data(), static_cast<uint32_t>(m_lagCompensationHitVolumes.size()));
+    }
+
     void NetworkHitVolumesComponent::CreateHitVolumes()
     {
         if (m_physicsCharacter == nullptr || m_actorComponent == nullptr)
@@ -66,6 +66,7 @@ namespace Multiplayer
         : m_entityPreRenderEventHandler([this](float deltaTime) { OnPreRender(deltaTime); })
         , m_entityCorrectionEventHandler([this]() { OnCorrection(); })
         , m_rotationChangedEventHandler([this](AZ::Quaternion) { OnTransformChanged(); })
+        , m_quantizedRotationChangedEventHandler([this](QuantizedRotation) { OnTransformChanged(); })
         , m_translationChangedEventHandler([this](AZ::Vector3) { OnTransformChanged(); })
         , m_scaleChangedEventHandler([this](float) { OnTransformChanged(); })
         , m_parentChangedEventHandler([this](NetEntityId parentId) { OnParentChanged(parentId); })
@@ -84,6 +85,7 @@ namespace Multiplayer
         GetNetBindComponent()->AddEntityPreRenderEventHandler(m_entityPreRenderEventHandler);
         GetNetBindComponent()->AddEntityCorrectionEventHandler(m_entityCorrectionEventHandler);
         RotationAddEvent(m_rotationChangedEventHandler);
+        QuantizedRotationAddEvent(m_quantizedRotationChangedEventHandler);
         TranslationAddEvent(m_translationChangedEventHandler);
         ScaleAddEvent(m_scaleChangedEventHandler);
         ParentEntityIdAddEvent(m_parentChangedEventHandler);
@@ -107,14 +109,14 @@ namespace Multiplayer
     {
         if (!HasController())
         {
-            AZ::Transform blendTransform(GetTranslation(), GetRotation(), GetScale());
+            AZ::Transform blendTransform(GetTranslation(), GetReplicatedRotation(), GetScale());
 
             if (!m_syncTransformImmediate)
             {
                 const float blendFactor = GetMultiplayer()->GetCurrentBlendFactor();
                 if (!AZ::IsClose(blendFactor, 1.0f))
                 {
-                    const AZ::Transform blendTransformPrevious(GetTranslationPrevious(), GetRotationPrevious(), GetScalePrevious());
+                    const AZ::Transform blendTransformPrevious(GetTranslationPrevious(), GetReplicatedRotationPrevious(), GetScalePrevious());
 
                     if (!blendTransform.IsClose(blendTransformPrevious))
                     {
@@ -153,7 +155,7 @@ namespace Multiplayer
     {
         // Snap to latest
         AZ::Transform targetTransform;
-        targetTransform.SetRotation(GetRotation());
+        targetTransform.SetRotation(GetReplicatedRotation());
         targetTransform.SetTranslation(GetTranslation());
         targetTransform.SetUniformScale(GetScale());
 
@@ -199,6 +201,24 @@ namespace Multiplayer
         }
     }
 
+    AZ::Quaternion NetworkTransformComponent::GetReplicatedRotation() const
+    {
+        if (GetQuantizeRotation())
+        {
+            return GetQuantizedRotation();
+        }
+        return GetRotation();
+    }
+
+    AZ::Quaternion NetworkTransformComponent::GetReplicatedRotationPrevious() const
+    {
+        if (GetQuantizeRotation())
+        {
+            return GetQuantizedRotationPrevious();
+        }
+        return GetRotationPrevious();
+    }
+
     NetworkTransformComponentController::NetworkTransformComponentController(NetworkTransformComponent& parent)
         : NetworkTransformComponentControllerBase(parent)
         , m_transformChangedHandler([this](const AZ::Transform& localTm, const AZ::Transform& worldTm) { OnTransformChangedEvent(localTm, worldTm); })
@@ -228,7 +248,14 @@ namespace Multiplayer
     void NetworkTransformComponentController::OnTransformChangedEvent(const AZ::Transform& localTm, const AZ::Transform& worldTm)
     {
         const AZ::Transform& localOrWorld = GetParentEntityId() == InvalidNetEntityId ? worldTm : localTm;
-        SetRotation(localOrWorld.GetRotation());
+        if (GetQuantizeRotation())
+        {
+            SetQuantizedRotation(localOrWorld.GetRotation());
+        }
+        else
+        {
+            SetRotation(localOrWorld.GetRotation());
+        }
         SetTranslation(localOrWorld.GetTranslation());
         SetScale(localOrWorld.GetUniformScale());
     }
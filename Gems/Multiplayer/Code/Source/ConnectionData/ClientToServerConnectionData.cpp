@@ -53,6 +53,17 @@ namespace Multiplayer
     void ClientToServerConnectionData::Update()
     {
         m_entityReplicationManager.ActivatePendingEntities();
-        m_entityReplicationManager.SendUpdates();
+        PrepareUpdate();
+        SendPreparedUpdate();
+    }
+
+    void ClientToServerConnectionData::PrepareUpdate()
+    {
+        m_entityReplicationManager.PrepareUpdates();
+    }
+
+    void ClientToServerConnectionData::SendPreparedUpdate()
+    {
+        m_entityReplicationManager.SendPreparedUpdates();
     }
 }
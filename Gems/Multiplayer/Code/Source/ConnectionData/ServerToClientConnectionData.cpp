@@ -74,18 +74,29 @@ namespace Multiplayer
     void ServerToClientConnectionData::Update()
     {
         m_entityReplicationManager.ActivatePendingEntities();
+        PrepareUpdate();
+        SendPreparedUpdate();
+    }
 
+    void ServerToClientConnectionData::PrepareUpdate()
+    {
         if (CanSendUpdates())
         {
             NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
             // potentially false if we just migrated the player, if that is the case, don't send any more updates
             if (netBindComponent != nullptr && (netBindComponent->GetNetEntityRole() == NetEntityRole::Authority))
             {
-                m_entityReplicationManager.SendUpdates();
+                m_entityReplicationManager.PrepareUpdates();
             }
         }
     }
 
+    void ServerToClientConnectionData::SendPreparedUpdate()
+    {
+        // No-op if PrepareUpdate decided there was nothing to send
+        m_entityReplicationManager.SendPreparedUpdates();
+    }
+
     void ServerToClientConnectionData::OnControlledEntityRemove()
     {
         m_connection->Disconnect(AzNetworking::DisconnectReason::TerminatedByServer, AzNetworking::TerminationEndpoint::Local);
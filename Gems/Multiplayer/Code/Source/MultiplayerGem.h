@@ -10,6 +10,10 @@
 
 #include <AzCore/Module/Module.h>
 
+#if AZ_TRAIT_SERVER && !defined(MULTIPLAYER_EDITOR)
+#include <Source/Session/HostInstanceSupervisor.h>
+#endif
+
 namespace Multiplayer
 {
     class MultiplayerModule
@@ -24,5 +28,10 @@ namespace Multiplayer
         ~MultiplayerModule() override = default;
 
         AZ::ComponentTypeList GetRequiredSystemComponents() const override;
+
+#if AZ_TRAIT_SERVER && !defined(MULTIPLAYER_EDITOR)
+    private:
+        HostInstanceSupervisor m_hostInstanceSupervisor;
+#endif
     };
 }
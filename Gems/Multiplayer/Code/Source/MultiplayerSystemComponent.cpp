@@ -17,6 +17,7 @@
 #include <EntityDomains/NullEntityDomain.h>
 #include <ReplicationWindows/NullReplicationWindow.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Session/HostInstanceSupervisor.h>
 #include <Source/AutoGen/AutoComponentTypes.h>
 #include <Multiplayer/Session/ISessionRequests.h>
 #include <Multiplayer/Session/SessionConfig.h>
@@ -43,6 +44,7 @@
 #include <cmath>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <System/PhysXSystem.h>
 
 #include <AzCore/Jobs/JobCompletion.h>
@@ -130,6 +132,9 @@ namespace Multiplayer
 
     AZ_CVAR(bool, sv_multithreadedConnectionUpdates, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, the server will send updates to clients on different threads, which improves performance with large number of clients");
+    AZ_CVAR(bool, sv_parallelReplicationPrepare, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server will gather and serialize entity updates for each client in parallel and send them from the main thread. "
+        "Combine with net_ShareEntitySerialization to serialize each entity only once per frame for all clients.");
     AZ_CVAR(bool, bg_parallelNotifyPreRender, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "If true, OnPreRender events will be sent in parallel from job threads. Please make sure the handlers of the event are thread safe.");
     
@@ -327,9 +332,20 @@ namespace Multiplayer
                     }
 
                     // Dedicated servers will automatically begin hosting
+                    // Host instances forked from a single process start from their own port to avoid contending for the same one
                     if (isDedicatedServer && dedicatedServerHostOnStartup)
                     {
-                        this->StartHosting(sv_port, /*is dedicated*/ true);
+                        const uint16_t instanceCount = HostInstanceSupervisor::GetRequestedHostInstanceCount(*AZ::SettingsRegistry::Get());
+                        const uint16_t instanceIndex = HostInstanceSupervisor::GetHostInstanceIndex();
+                        uint16_t hostPort = sv_port;
+                        if (!HostInstanceSupervisor::GetHostInstancePort(sv_port, sv_portRange, instanceCount, instanceIndex, hostPort))
+                        {
+                            AZLOG_ERROR("Multiplayer host instance %u can't host, %u instances starting at sv_port %u exceed sv_portRange %u or port 65535.",
+                                static_cast<uint32_t>(instanceIndex), static_cast<uint32_t>(instanceCount),
+                                static_cast<uint32_t>(sv_port), static_cast<uint32_t>(sv_portRange));
+                            return;
+                        }
+                        this->StartHosting(hostPort, /*is dedicated*/ true);
                     }
                 },
                 "SystemComponentsActivated",
@@ -557,11 +573,15 @@ namespace Multiplayer
         const AZ::TimeMs serverRateMs = static_cast<AZ::TimeMs>(sv_serverSendRateMs);
         const float serverRateSeconds = static_cast<float>(serverRateMs) / 1000.0f;
 
+        const bool isServer = IsHosting();
+
         TickVisibleNetworkEntities(deltaTime, serverRateSeconds);
 
-        if (GetAgentType() == MultiplayerAgentType::ClientServer
-         || GetAgentType() == MultiplayerAgentType::DedicatedServer)
+        if (isServer)
         {
+            // Recorded from the server tick rather than pre-render, so entities outside the host's view and headless servers are covered
+            m_networkTime.RecordLagCompensationFrame();
+
             m_serverSendAccumulator += deltaTime;
             if (m_serverSendAccumulator < serverRateSeconds)
             {
@@ -651,8 +671,68 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::UpdateConnections()
     {
-        if (sv_multithreadedConnectionUpdates && (GetAgentType() == MultiplayerAgentType::ClientServer ||
-                                                  GetAgentType() == MultiplayerAgentType::DedicatedServer))
+        const bool isServer = (GetAgentType() == MultiplayerAgentType::ClientServer || GetAgentType() == MultiplayerAgentType::DedicatedServer);
+        if (sv_parallelReplicationPrepare && isServer)
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections - ParallelPrepare");
+
+            // Entity activation must happen on the main thread, only the update generation is distributed
+            AZStd::vector<IConnectionData*> connectionDatas;
+            auto activatePendingEntities = [&connectionDatas](IConnection& connection)
+            {
+                if (connection.GetUserData() != nullptr)
+                {
+                    IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
+                    connectionData->GetReplicationManager().ActivatePendingEntities();
+                    connectionDatas.push_back(connectionData);
+                }
+            };
+            m_networkInterface->GetConnectionSet().VisitConnections(activatePendingEntities);
+
+            AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            if (taskGraphActive && taskGraphActive->IsTaskGraphActive())
+            {
+                static const AZ::TaskDescriptor prepareDescriptor{ "Multiplayer_PrepareConnectionUpdate", "Multiplayer" };
+                AZ::TaskGraph taskGraph{ "Multiplayer::UpdateConnections" };
+                for (IConnectionData* connectionData : connectionDatas)
+                {
+                    taskGraph.AddTask(prepareDescriptor, [connectionData]()
+                    {
+                        AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: PrepareConnectionUpdate");
+                        connectionData->PrepareUpdate();
+                    });
+                }
+
+                if (!taskGraph.IsEmpty())
+                {
+                    AZ::TaskGraphEvent waitForCompletion{ "Multiplayer::UpdateConnections Wait" };
+                    taskGraph.Submit(&waitForCompletion);
+                    waitForCompletion.Wait();
+                }
+            }
+            else
+            {
+                AZ::JobCompletion jobCompletion;
+                for (IConnectionData* connectionData : connectionDatas)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([connectionData]()
+                        {
+                            AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: PrepareConnectionUpdate");
+                            connectionData->PrepareUpdate();
+                        }, true /*auto delete*/, nullptr);
+
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+
+            for (IConnectionData* connectionData : connectionDatas)
+            {
+                connectionData->SendPreparedUpdate();
+            }
+        }
+        else if (sv_multithreadedConnectionUpdates && isServer)
         {
             // Threaded update calls.
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: UpdateConnections");
@@ -119,6 +119,13 @@ namespace Multiplayer
     // Get the list of entities to update/delete, create and send update/delete messages, send RPCs, and send entity resets.
     void EntityReplicationManager::SendUpdates()
     {
+        PrepareUpdates();
+        SendPreparedUpdates();
+    }
+
+    void EntityReplicationManager::PrepareUpdates()
+    {
+        AZ_Assert(!m_hasPreparedUpdates, "PrepareUpdates called twice without sending the prepared updates");
         m_frameTimeMs = AZ::GetElapsedTimeMs();
 
         {
@@ -143,17 +150,53 @@ namespace Multiplayer
             }
 
             {
-                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
+                AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - PrepareEntityUpdateMessages");
                 // While our to send list is not empty, build up another packet to send
                 do
                 {
-                    SendEntityUpdateMessages(toSendList);
+                    PrepareEntityUpdateMessages(toSendList);
                 } while (!toSendList.empty());
             }
         }
 
-        SendEntityRpcs(m_deferredRpcMessagesReliable, true);
-        SendEntityRpcs(m_deferredRpcMessagesUnreliable, false);
+        PrepareEntityRpcs(m_deferredRpcMessagesReliable, m_preparedRpcsReliable);
+        PrepareEntityRpcs(m_deferredRpcMessagesUnreliable, m_preparedRpcsUnreliable);
+
+        m_hasPreparedUpdates = true;
+    }
+
+    void EntityReplicationManager::SendPreparedUpdates()
+    {
+        if (!m_hasPreparedUpdates)
+        {
+            return;
+        }
+        m_hasPreparedUpdates = false;
+
+        {
+            AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
+            for (PreparedEntityUpdates& preparedUpdates : m_preparedEntityUpdates)
+            {
+                if (m_replicationWindow)
+                {
+                    const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(preparedUpdates.m_entityUpdates);
+
+                    // Update the sent things with the packet id
+                    for (EntityReplicator* replicator : preparedUpdates.m_replicators)
+                    {
+                        replicator->RecordSentPacketId(sentId);
+                    }
+                }
+                else
+                {
+                    AZ_Assert(false, "Failed to send entity update message, replication window does not exist");
+                }
+            }
+            m_preparedEntityUpdates.clear();
+        }
+
+        SendEntityRpcs(m_preparedRpcsReliable, true);
+        SendEntityRpcs(m_preparedRpcsUnreliable, false);
 
         m_orphanedEntityRpcs.Update();
 
@@ -245,11 +288,12 @@ namespace Multiplayer
         return toSendList;
     }
 
-    void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
+    void EntityReplicationManager::PrepareEntityUpdateMessages(EntityReplicatorList& replicatorList)
     {
         uint32_t pendingPacketSize = 0;
-        EntityReplicatorList replicatorUpdatedList;
-        NetworkEntityUpdateVector entityUpdates;
+        PreparedEntityUpdates& preparedUpdates = m_preparedEntityUpdates.emplace_back();
+        EntityReplicatorList& replicatorUpdatedList = preparedUpdates.m_replicators;
+        NetworkEntityUpdateVector& entityUpdates = preparedUpdates.m_entityUpdates;
         // Serialize everything
         while (!replicatorList.empty())
         {
@@ -268,7 +312,7 @@ namespace Multiplayer
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdates.push_back(updateMessage);
+            entityUpdates.push_back(AZStd::move(updateMessage));
             replicatorUpdatedList.push_back(replicator);
             replicatorList.pop_front();
 
@@ -284,28 +328,13 @@ namespace Multiplayer
                 break;
             }
         }
-
-        if (m_replicationWindow)
-        {
-            const AzNetworking::PacketId sentId = m_replicationWindow->SendEntityUpdateMessages(entityUpdates);
-
-            // Update the sent things with the packet id
-            for (EntityReplicator* replicator : replicatorUpdatedList)
-            {
-                replicator->RecordSentPacketId(sentId);
-            }
-        }
-        else
-        {
-            AZ_Assert(false, "Failed to send entity update message, replication window does not exist");
-        }
     }
 
-    void EntityReplicationManager::SendEntityRpcs(RpcMessages& rpcMessages, bool reliable)
+    void EntityReplicationManager::PrepareEntityRpcs(RpcMessages& rpcMessages, PreparedEntityRpcList& preparedRpcs)
     {
         while (!rpcMessages.empty())
         {
-            NetworkEntityRpcVector entityRpcs;
+            NetworkEntityRpcVector& entityRpcs = preparedRpcs.emplace_back();
             uint32_t pendingPacketSize = 0;
 
             while (!rpcMessages.empty())
@@ -336,7 +365,13 @@ namespace Multiplayer
                 entityRpcs.push_back(message);
                 rpcMessages.pop_front();
             }
+        }
+    }
 
+    void EntityReplicationManager::SendEntityRpcs(PreparedEntityRpcList& preparedRpcs, bool reliable)
+    {
+        for (NetworkEntityRpcVector& entityRpcs : preparedRpcs)
+        {
             if (m_replicationWindow)
             {
                 m_replicationWindow->SendEntityRpcs(entityRpcs, reliable);
@@ -346,6 +381,7 @@ namespace Multiplayer
                 AZ_Assert(false, "Failed to send entity rpc, replication window does not exist");
             }
         }
+        preparedRpcs.clear();
     }
 
     void EntityReplicationManager::SendEntityResets()
@@ -376,6 +412,10 @@ namespace Multiplayer
             m_replicatorsPendingReset.clear();
         }
 
+        // Prepared updates reference the replicators we're about to destroy
+        m_preparedEntityUpdates.clear();
+        m_hasPreparedUpdates = false;
+
         m_entityReplicatorMap.clear();
     }
 
@@ -913,7 +953,28 @@ namespace Multiplayer
             AZ_Assert(false, "Unhandled case");
         }
 
-        OutputSerializer outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+        const AzNetworking::PacketEncodingBuffer* updateData = updateMessage.GetData();
+        AZStd::unique_ptr<AzNetworking::PacketEncodingBuffer> snapshotData;
+        if (updateMessage.GetIsSnapshot())
+        {
+            // Validation lets stale updates through for replicators pending removal, but a stale snapshot is simply superseded
+            if ((entityReplicator != nullptr) && !entityReplicator->IsPacketIdValid(packetHeader.GetPacketId()))
+            {
+                return true;
+            }
+
+            // Snapshot updates are only sent to established replicators, reconstruct the full entity state they carry
+            snapshotData = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
+            if ((entityReplicator == nullptr) || !entityReplicator->ResolveSnapshotUpdate(packetHeader.GetPacketId(), *updateData, *snapshotData))
+            {
+                AZLOG_WARN("Unable to resolve entity snapshot for entity %llu, requesting a reset", aznumeric_cast<AZ::u64>(updateMessage.GetEntityId()));
+                m_replicatorsPendingReset.emplace(updateMessage.GetEntityId());
+                return true;
+            }
+            updateData = snapshotData.get();
+        }
+
+        OutputSerializer outputSerializer(updateData->GetBuffer(), static_cast<uint32_t>(updateData->GetSize()));
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -941,7 +1002,7 @@ namespace Multiplayer
         bool handled = true;
 
         // This may implicitly create a replicator for us
-        if (updateMessage.GetData()->GetSize() != 0)
+        if (updateData->GetSize() != 0)
         {
             handled = HandlePropertyChangeMessage(
                           invokingConnection,
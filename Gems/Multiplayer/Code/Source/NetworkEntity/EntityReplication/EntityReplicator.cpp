@@ -591,6 +591,12 @@ namespace Multiplayer
         return m_propertySubscriber ? m_propertySubscriber->IsPacketIdValid(packetId) : false;
     }
 
+    bool EntityReplicator::ResolveSnapshotUpdate(AzNetworking::PacketId packetId, const AzNetworking::PacketEncodingBuffer& updateData, AzNetworking::PacketEncodingBuffer& outStateData)
+    {
+        AZ_Assert(m_propertySubscriber, "Expected to have a property subscriber.");
+        return m_propertySubscriber ? m_propertySubscriber->ResolveSnapshotUpdate(packetId, updateData, outStateData) : false;
+    }
+
     AzNetworking::PacketId EntityReplicator::GetLastReceivedPacketId() const
     {
         AZ_Assert(m_propertySubscriber, "Expected to have a property subscriber.");
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntitySerializationCache.h>
+#include <AzCore/Console/IConsole.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(uint32_t, net_EntitySerializationCacheSize, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of distinct serialized state deltas cached per entity per host frame");
+
+    bool EntitySerializationCache::Find(HostFrameId hostFrameId, const ReplicationRecord& record, AzNetworking::PacketEncodingBuffer& outData) const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_hostFrameId != hostFrameId)
+        {
+            return false;
+        }
+
+        for (const CachedSerialization& cachedSerialization : m_cachedSerializations)
+        {
+            if (cachedSerialization.m_record.HasSameChanges(record))
+            {
+                return outData.CopyValues(cachedSerialization.m_data.data(), cachedSerialization.m_data.size());
+            }
+        }
+        return false;
+    }
+
+    void EntitySerializationCache::Store(HostFrameId hostFrameId, const ReplicationRecord& record, const AzNetworking::PacketEncodingBuffer& data)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_hostFrameId != hostFrameId)
+        {
+            m_cachedSerializations.clear();
+            m_hostFrameId = hostFrameId;
+        }
+
+        if (m_cachedSerializations.size() >= net_EntitySerializationCacheSize)
+        {
+            return;
+        }
+
+        for (const CachedSerialization& cachedSerialization : m_cachedSerializations)
+        {
+            if (cachedSerialization.m_record.HasSameChanges(record))
+            {
+                // Another connection stored an identical serialization while we were serializing
+                return;
+            }
+        }
+
+        CachedSerialization& cachedSerialization = m_cachedSerializations.emplace_back();
+        cachedSerialization.m_record = record;
+        cachedSerialization.m_data.assign(data.GetBuffer(), data.GetBufferEnd());
+    }
+
+    void EntitySerializationCache::Invalidate()
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_cachedSerializations.clear();
+        m_hostFrameId = InvalidHostFrameId;
+    }
+}
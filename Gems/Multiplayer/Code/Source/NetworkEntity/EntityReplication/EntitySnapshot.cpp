@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntitySnapshot.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzNetworking/Serialization/DeltaSerializer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(uint32_t, net_EntitySnapshotHistorySize, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Number of entity snapshots retained per entity for use as delta baselines, must cover the round trip time in host frames");
+
+    // Snapshots never exceed the size of a regular entity update, keep the capacity fixed so both endpoints agree on the size encoding
+    static constexpr uint32_t MaxSnapshotBytes = static_cast<uint32_t>(AzNetworking::PacketEncodingBuffer::GetCapacity());
+
+    EntitySnapshot::EntitySnapshot(HostFrameId hostFrameId, const uint8_t* data, uint32_t byteSize)
+        : m_hostFrameId(hostFrameId)
+        , m_byteSize(byteSize)
+        , m_words((byteSize + sizeof(uint32_t) - 1) / sizeof(uint32_t), 0)
+    {
+        memcpy(m_words.data(), data, byteSize);
+    }
+
+    AZStd::shared_ptr<EntitySnapshot> EntitySnapshot::Create(HostFrameId hostFrameId, NetBindComponent& netBindComponent)
+    {
+        // Snapshots are only used for proxy replication, so they contain everything replicated to the client role
+        ReplicationRecord record(NetEntityRole::Client);
+        netBindComponent.FillTotalReplicationRecord(record);
+
+        // Only allocated for the duration of the serialization, snapshots themselves are trimmed to size
+        AZStd::unique_ptr<AzNetworking::PacketEncodingBuffer> buffer = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
+        InputSerializer inputSerializer(buffer->GetBuffer(), static_cast<uint32_t>(buffer->GetCapacity()));
+        record.Serialize(inputSerializer);
+        netBindComponent.SerializeStateDeltaMessage(record, inputSerializer);
+        if (!inputSerializer.IsValid())
+        {
+            AZLOG_ERROR("EntitySnapshot: Serialization failed for entity %llu", static_cast<AZ::u64>(netBindComponent.GetNetEntityId()));
+            return nullptr;
+        }
+
+        return AZStd::make_shared<EntitySnapshot>(hostFrameId, buffer->GetBuffer(), inputSerializer.GetSize());
+    }
+
+    bool EntitySnapshot::WriteUpdate(AzNetworking::ISerializer& serializer, EntitySnapshot& snapshot, EntitySnapshot* baseline)
+    {
+        bool isDelta = (baseline != nullptr) && snapshot.CanDeltaEncode(*baseline);
+        serializer.Serialize(snapshot.m_hostFrameId, "HostFrameId");
+        serializer.Serialize(isDelta, "IsDelta");
+
+        if (isDelta)
+        {
+            AzNetworking::SerializerDelta delta;
+            AzNetworking::DeltaSerializerCreate createSerializer(delta);
+            if (!createSerializer.CreateDelta(*baseline, snapshot))
+            {
+                AZLOG_ERROR("EntitySnapshot: Failed to create a delta for host frame %u", static_cast<uint32_t>(snapshot.m_hostFrameId));
+                return false;
+            }
+            serializer.Serialize(baseline->m_hostFrameId, "BaselineHostFrameId");
+            serializer.Serialize(delta, "Delta");
+        }
+        else
+        {
+            uint32_t byteSize = snapshot.m_byteSize;
+            serializer.SerializeBytes(reinterpret_cast<uint8_t*>(snapshot.m_words.data()), MaxSnapshotBytes, false, byteSize, "Snapshot");
+        }
+        return serializer.IsValid();
+    }
+
+    AZStd::shared_ptr<EntitySnapshot> EntitySnapshot::ReadUpdate(AzNetworking::ISerializer& serializer, const EntitySnapshotHistory& history)
+    {
+        HostFrameId hostFrameId = InvalidHostFrameId;
+        bool isDelta = false;
+        serializer.Serialize(hostFrameId, "HostFrameId");
+        serializer.Serialize(isDelta, "IsDelta");
+
+        if (isDelta)
+        {
+            HostFrameId baselineHostFrameId = InvalidHostFrameId;
+            AzNetworking::SerializerDelta delta;
+            if (!serializer.Serialize(baselineHostFrameId, "BaselineHostFrameId") || !serializer.Serialize(delta, "Delta"))
+            {
+                return nullptr;
+            }
+
+            AZStd::shared_ptr<EntitySnapshot> baseline = history.Find(baselineHostFrameId);
+            if (baseline == nullptr)
+            {
+                AZLOG_WARN("EntitySnapshot: Baseline for host frame %u is no longer available", static_cast<uint32_t>(baselineHostFrameId));
+                return nullptr;
+            }
+
+            // Apply the delta on top of a copy of the baseline, anything not present in the delta is unchanged
+            AZStd::shared_ptr<EntitySnapshot> snapshot = AZStd::make_shared<EntitySnapshot>(*baseline);
+            snapshot->m_hostFrameId = hostFrameId;
+            AzNetworking::DeltaSerializerApply applySerializer(delta);
+            if (!applySerializer.ApplyDelta(*snapshot))
+            {
+                AZLOG_ERROR("EntitySnapshot: Failed to apply a delta for host frame %u", static_cast<uint32_t>(hostFrameId));
+                return nullptr;
+            }
+            return snapshot;
+        }
+
+        AZStd::unique_ptr<AzNetworking::PacketEncodingBuffer> buffer = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
+        uint32_t byteSize = 0;
+        if (!serializer.SerializeBytes(buffer->GetBuffer(), MaxSnapshotBytes, false, byteSize, "Snapshot"))
+        {
+            return nullptr;
+        }
+        return AZStd::make_shared<EntitySnapshot>(hostFrameId, buffer->GetBuffer(), byteSize);
+    }
+
+    bool EntitySnapshot::CanDeltaEncode(const EntitySnapshot& other) const
+    {
+        return (m_byteSize <= MaxDeltaBytes) && (other.m_byteSize <= MaxDeltaBytes);
+    }
+
+    HostFrameId EntitySnapshot::GetHostFrameId() const
+    {
+        return m_hostFrameId;
+    }
+
+    uint32_t EntitySnapshot::GetByteSize() const
+    {
+        return m_byteSize;
+    }
+
+    const uint8_t* EntitySnapshot::GetBuffer() const
+    {
+        return reinterpret_cast<const uint8_t*>(m_words.data());
+    }
+
+    bool EntitySnapshot::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        // The delta serializers only ever see snapshots that satisfy CanDeltaEncode
+        if (serializer.Serialize(m_byteSize, "ByteSize", 0, MaxDeltaBytes)
+            && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+        {
+            m_words.resize((m_byteSize + sizeof(uint32_t) - 1) / sizeof(uint32_t), 0);
+        }
+
+        for (uint32_t& word : m_words)
+        {
+            serializer.Serialize(word, "Word");
+        }
+        return serializer.IsValid();
+    }
+
+    EntitySnapshotHistory::EntitySnapshotHistory()
+        : m_snapshots(net_EntitySnapshotHistorySize)
+    {
+        ;
+    }
+
+    AZStd::shared_ptr<EntitySnapshot> EntitySnapshotHistory::GetOrCreate(HostFrameId hostFrameId, NetBindComponent& netBindComponent)
+    {
+        // Hold the lock while generating so concurrent connection updates share a single snapshot
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (!m_snapshots.empty() && m_snapshots.front()->GetHostFrameId() == hostFrameId)
+        {
+            return m_snapshots.front();
+        }
+
+        AZStd::shared_ptr<EntitySnapshot> snapshot = EntitySnapshot::Create(hostFrameId, netBindComponent);
+        if (snapshot != nullptr)
+        {
+            StoreInternal(AZStd::shared_ptr<EntitySnapshot>(snapshot));
+        }
+        return snapshot;
+    }
+
+    AZStd::shared_ptr<EntitySnapshot> EntitySnapshotHistory::Find(HostFrameId hostFrameId) const
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        for (const AZStd::shared_ptr<EntitySnapshot>& snapshot : m_snapshots)
+        {
+            if (snapshot->GetHostFrameId() == hostFrameId)
+            {
+                return snapshot;
+            }
+        }
+        return nullptr;
+    }
+
+    void EntitySnapshotHistory::Store(AZStd::shared_ptr<EntitySnapshot> snapshot)
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        StoreInternal(AZStd::move(snapshot));
+    }
+
+    void EntitySnapshotHistory::Clear()
+    {
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_snapshots.clear();
+    }
+
+    void EntitySnapshotHistory::StoreInternal(AZStd::shared_ptr<EntitySnapshot>&& snapshot)
+    {
+        if (m_snapshots.capacity() == 0)
+        {
+            return;
+        }
+
+        if (m_snapshots.full())
+        {
+            m_snapshots.pop_back();
+        }
+        m_snapshots.push_front(AZStd::move(snapshot));
+    }
+}
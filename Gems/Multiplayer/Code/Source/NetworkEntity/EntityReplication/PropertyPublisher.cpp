@@ -15,12 +15,17 @@
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, net_ShareEntitySerialization, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Share serialized entity state deltas between connections within a host frame, per-component serialization metrics are only recorded for the first serialization");
+    AZ_CVAR(bool, net_EntitySnapshotReplication, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Replicate proxy entity updates as per host frame snapshots shared between connections, delta encoded against the last snapshot each connection acknowledged");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
         , m_connection(connection)
         , m_pendingRecord(remoteNetworkRole)
         , m_sentRecords(net_EntityReplicatorRecordsMax)
+        , m_sentSnapshots(net_EntityReplicatorRecordsMax)
     {
         if ( ownsLifetime == OwnsLifetime::False )
         {
@@ -76,6 +81,15 @@ namespace Multiplayer
         m_replicatorState = EntityReplicatorState::Rebasing;
     }
 
+    bool PropertyPublisher::UsesSnapshots() const
+    {
+        // Snapshots only carry proxy state and can only be delta encoded once the remote replicator exists
+        return net_EntitySnapshotReplication
+            && (m_pendingRecord.GetRemoteNetworkRole() == NetEntityRole::Client)
+            && (m_ownsLifetime == OwnsLifetime::True)
+            && m_remoteReplicatorEstablished;
+    }
+
     void PropertyPublisher::UpdatePendingRecord(NetBindComponent* netBindComponent)
     {
         // Only update the pending record if we don't have a cached delete message already.
@@ -105,6 +119,17 @@ namespace Multiplayer
         // Delete all of the acknowledged records.
         m_sentRecords.erase(mostRecentAckedIter, m_sentRecords.end());
 
+        // Snapshots are tracked the same way, the most recent acknowledged snapshot becomes the delta baseline
+        for (auto iter = m_sentSnapshots.begin(); iter != m_sentSnapshots.end(); ++iter)
+        {
+            if (m_connection.WasPacketAcked(iter->m_sentPacketId))
+            {
+                m_ackedSnapshotHostFrameId = iter->m_hostFrameId;
+                m_sentSnapshots.erase(iter, m_sentSnapshots.end());
+                break;
+            }
+        }
+
         // Nothing to send
         if (!m_pendingRecord.HasChanges() && m_sentRecords.empty() && m_remoteReplicatorEstablished)
         {
@@ -173,6 +198,28 @@ namespace Multiplayer
         }
     }
 
+    void PropertyPublisher::PrepareSnapshotEntityRecord()
+    {
+        // Snapshots always contain the complete entity state, so the sent records are only kept to know which changes
+        // remain unacknowledged in case replication falls back to update or delete records
+        if (m_sentRecords.size() >= net_EntityReplicatorRecordsMax)
+        {
+            // Fold the oldest record into the next one rather than losing track of its changes
+            ReplicationRecord oldestRecord = m_sentRecords.back();
+            m_sentRecords.pop_back();
+            if (!m_sentRecords.empty())
+            {
+                m_sentRecords.back().Append(oldestRecord);
+            }
+            else
+            {
+                m_pendingRecord.Append(oldestRecord);
+            }
+        }
+        m_sentRecords.push_front(m_pendingRecord);
+        m_preparedSnapshot = true;
+    }
+
     void PropertyPublisher::PrepareDeleteEntityRecord(NetBindComponent* netBindComponent)
     {
         // Once the delete message is cached, there's nothing more that needs to be prepared.
@@ -203,8 +250,46 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    bool PropertyPublisher::SerializeEntitySnapshot(NetBindComponent* netBindComponent, AzNetworking::PacketEncodingBuffer& outData)
+    {
+        AZ_Assert(netBindComponent, "NetBindComponent is nullptr");
+        EntitySnapshotHistory& snapshotHistory = netBindComponent->GetSnapshotHistory();
+        AZStd::shared_ptr<EntitySnapshot> snapshot = snapshotHistory.GetOrCreate(GetNetworkTime()->GetHostFrameId(), *netBindComponent);
+        if (snapshot == nullptr)
+        {
+            return false;
+        }
+
+        // Lost snapshots are never resent, the next snapshot is simply encoded against whichever one was last acknowledged
+        AZStd::shared_ptr<EntitySnapshot> baseline = (m_ackedSnapshotHostFrameId != InvalidHostFrameId)
+            ? snapshotHistory.Find(m_ackedSnapshotHostFrameId)
+            : nullptr;
+
+        InputSerializer inputSerializer(outData.GetBuffer(), static_cast<uint32_t>(outData.GetCapacity()));
+        if (!EntitySnapshot::WriteUpdate(inputSerializer, *snapshot, baseline.get()))
+        {
+            return false;
+        }
+        outData.Resize(inputSerializer.GetSize());
+        m_preparedSnapshotHostFrameId = snapshot->GetHostFrameId();
+        return true;
+    }
+
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
+        if (m_preparedSnapshot)
+        {
+            m_preparedSnapshot = false;
+            if (packetId != AzNetworking::InvalidPacketId)
+            {
+                if (m_sentSnapshots.full())
+                {
+                    m_sentSnapshots.pop_back();
+                }
+                m_sentSnapshots.push_front(SentSnapshot{ packetId, m_preparedSnapshotHostFrameId });
+            }
+        }
+
         // Fill in the packet id for the last sent update
         ReplicationRecord& lastSentRecord = m_sentRecords.front();
         AZ_Assert(lastSentRecord.m_sentPacketId == AzNetworking::InvalidPacketId, "Assumed we pushed on a packet in UpdateSerialization");
@@ -316,7 +401,14 @@ namespace Multiplayer
             break;
 
         case PropertyPublisher::EntityReplicatorState::Updating:
-            PrepareUpdateEntityRecord(netBindComponent);
+            if (UsesSnapshots())
+            {
+                PrepareSnapshotEntityRecord();
+            }
+            else
+            {
+                PrepareUpdateEntityRecord(netBindComponent);
+            }
             break;
 
         case PropertyPublisher::EntityReplicatorState::Deleting:
@@ -372,11 +464,40 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
+        if (m_preparedSnapshot)
+        {
+            if (SerializeEntitySnapshot(netBindComponent, updateMessage.ModifyData()))
+            {
+                updateMessage.SetIsSnapshot(true);
+                return updateMessage;
+            }
+
+            // Fall back to a regular update containing the complete entity state
+            AZLOG_WARN("EntityReplicator: Failed to generate a snapshot, sending a full update instead");
+            m_preparedSnapshot = false;
+            netBindComponent->FillTotalReplicationRecord(m_pendingRecord);
+        }
+
+        // Connections that are in sync share identical pending records, so reuse any serialization another connection generated this frame
+        // The cache is keyed on the record alone, so deletes bypass it, they're cached per replicator in m_cachedDeleteMessage instead
+        const bool useSerializationCache = net_ShareEntitySerialization && !isDeleted;
+        const HostFrameId hostFrameId = GetNetworkTime()->GetHostFrameId();
+        EntitySerializationCache& serializationCache = netBindComponent->GetSerializationCache();
+        if (useSerializationCache && serializationCache.Find(hostFrameId, m_pendingRecord, updateMessage.ModifyData()))
+        {
+            return updateMessage;
+        }
+
         InputSerializer inputSerializer(
             updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
-        SerializeEntityRecord(inputSerializer, netBindComponent);
+        const bool serialized = SerializeEntityRecord(inputSerializer, netBindComponent);
         updateMessage.ModifyData().Resize(inputSerializer.GetSize());
 
+        if (useSerializationCache && serialized)
+        {
+            serializationCache.Store(hostFrameId, m_pendingRecord, updateMessage.ModifyData());
+        }
+
         return updateMessage;
     }
 
@@ -107,15 +107,21 @@ namespace Multiplayer
         //! This will return true if there are any unacknowledged changes, even if they aren't new for this frame.
         bool HasEntityChangesToSend();
 
+        //! Returns true if updates should be sent as entity snapshots delta encoded against the last acknowledged snapshot.
+        bool UsesSnapshots() const;
+
         //! Phase 1, setup of the record
         void PrepareFullReplicationEntityRecord(NetBindComponent* netBindComponent);
         void PrepareRebaseEntityRecord(NetBindComponent* netBindComponent);
         void PrepareUpdateEntityRecord(NetBindComponent* netBindComponent);
+        void PrepareSnapshotEntityRecord();
         void PrepareDeleteEntityRecord(NetBindComponent* netBindComponent);
 
         //! Phase 2, serialize the record
         //! Add/update/delete all use the same serialization path.
         bool SerializeEntityRecord(AzNetworking::ISerializer& serializer, NetBindComponent* netBindComponent);
+        //! Snapshot updates serialize the shared snapshot for the current host frame instead of the record.
+        bool SerializeEntitySnapshot(NetBindComponent* netBindComponent, AzNetworking::PacketEncodingBuffer& outData);
 
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
@@ -135,6 +141,21 @@ namespace Multiplayer
 
         //! List of sent records
         AZStd::ring_buffer<ReplicationRecord> m_sentRecords;
+        struct SentSnapshot
+        {
+            AzNetworking::PacketId m_sentPacketId = AzNetworking::InvalidPacketId;
+            HostFrameId m_hostFrameId = InvalidHostFrameId;
+        };
+
+        //! List of sent snapshots, used to find the most recent snapshot the remote endpoint can use as a delta baseline
+        AZStd::ring_buffer<SentSnapshot> m_sentSnapshots;
+        //! The host frame of the most recent acknowledged snapshot
+        HostFrameId m_ackedSnapshotHostFrameId = InvalidHostFrameId;
+        //! The host frame of the snapshot being sent, valid between preparation and finalization
+        HostFrameId m_preparedSnapshotHostFrameId = InvalidHostFrameId;
+        //! True if the prepared update is a snapshot update
+        bool m_preparedSnapshot = false;
+
         //! List of sent delete packets, tracked separately as a way to look for acknowledged deletes.
         //! (This could potentially get merged into m_sentRecords as an optimization)
         AZStd::vector<AzNetworking::PacketId> m_deletePacketIds;
@@ -9,6 +9,7 @@
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/IMultiplayer.h>
 
 namespace Multiplayer
 {
@@ -50,4 +51,23 @@ namespace Multiplayer
         m_lastReceivedPacketId = packetId;
         return m_netBindComponent->HandlePropertyChangeMessage(*serializer, notifyChanges);
     }
+
+    bool PropertySubscriber::ResolveSnapshotUpdate(AzNetworking::PacketId packetId, const AzNetworking::PacketEncodingBuffer& updateData, AzNetworking::PacketEncodingBuffer& outStateData)
+    {
+        // A stale snapshot must not become a baseline, the publisher never deltas against a snapshot it wasn't acknowledged for
+        if (!IsPacketIdValid(packetId))
+        {
+            return false;
+        }
+
+        OutputSerializer outputSerializer(updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetSize()));
+        AZStd::shared_ptr<EntitySnapshot> snapshot = EntitySnapshot::ReadUpdate(outputSerializer, m_snapshotHistory);
+        if (snapshot == nullptr)
+        {
+            return false;
+        }
+
+        m_snapshotHistory.Store(snapshot);
+        return outStateData.CopyValues(snapshot->GetBuffer(), snapshot->GetByteSize());
+    }
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzNetworking/Utilities/NetworkCommon.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntitySnapshot.h>
 
 namespace AzNetworking
 {
@@ -36,6 +37,14 @@ namespace Multiplayer
 
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges = true);
 
+        //! Reconstructs the entity snapshot carried by a snapshot update and retains it as a baseline for future updates.
+        //! Updates older than the last received packet are rejected without being retained.
+        //! @param packetId     the id of the packet carrying the snapshot update
+        //! @param updateData   the data of the received snapshot update
+        //! @param outStateData output buffer the reconstructed replication record and entity state is written to
+        //! @return boolean true on success, false if the update is stale or could not be resolved
+        bool ResolveSnapshotUpdate(AzNetworking::PacketId packetId, const AzNetworking::PacketEncodingBuffer& updateData, AzNetworking::PacketEncodingBuffer& outStateData);
+
     private:
         EntityReplicationManager& m_replicationManager;
         NetBindComponent* m_netBindComponent;
@@ -43,5 +52,8 @@ namespace Multiplayer
         // The last packet to have been received about this entity
         AzNetworking::PacketId m_lastReceivedPacketId = AzNetworking::InvalidPacketId;
         AZ::TimeMs m_markForRemovalTimeMs = AZ::Time::ZeroTimeMs;
+
+        // Received snapshots, used to resolve delta encoded snapshot updates
+        EntitySnapshotHistory m_snapshotHistory;
     };
 }
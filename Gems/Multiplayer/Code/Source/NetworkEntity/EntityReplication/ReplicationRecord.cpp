@@ -115,6 +115,15 @@ namespace Multiplayer
         m_autonomousToAuthority.Subtract(rhs.m_autonomousToAuthority);
     }
 
+    bool ReplicationRecord::HasSameChanges(const ReplicationRecord& rhs) const
+    {
+        return (m_remoteNetEntityRole == rhs.m_remoteNetEntityRole)
+            && (m_authorityToClient == rhs.m_authorityToClient)
+            && (m_authorityToServer == rhs.m_authorityToServer)
+            && (m_authorityToAutonomous == rhs.m_authorityToAutonomous)
+            && (m_autonomousToAuthority == rhs.m_autonomousToAuthority);
+    }
+
     bool ReplicationRecord::HasChanges() const
     {
         bool hasChanges(false);
@@ -9,12 +9,84 @@
 #include <Multiplayer/NetworkInput/NetworkInputArray.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
 #include <AzNetworking/Serialization/ISerializer.h>
-#include <AzNetworking/Serialization/DeltaSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 
 namespace Multiplayer
 {
     AZ_CVAR(bool, net_useInputDeltaSerialization, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, inputs will use delta-serialization to reduce RPC bandwidth");
 
+    // Inputs are delta encoded in chunks of this many bytes, each chunk costs one dirty bit
+    static constexpr uint32_t InputDeltaChunkSize = 4;
+    static constexpr uint32_t MaxSerializedInputSize = 1024;
+    using SerializedInputBuffer = AZStd::array<uint8_t, MaxSerializedInputSize>;
+
+    static bool IsInputChunkDirty(const uint8_t* base, uint32_t baseSize, const uint8_t* current, uint32_t chunkStart, uint32_t chunkEnd)
+    {
+        return (chunkEnd > baseSize) || (memcmp(base + chunkStart, current + chunkStart, chunkEnd - chunkStart) != 0);
+    }
+
+    // Serializes the bytes of a serialized input as a delta from the bytes of the preceding input
+    // When writing to the object, current is reconstructed from base and currentSize is updated
+    static bool SerializeInputDelta(AzNetworking::ISerializer& serializer, const uint8_t* base, uint32_t baseSize, uint8_t* current, uint32_t& currentSize)
+    {
+        if (!serializer.Serialize(currentSize, "InputSize", 0u, MaxSerializedInputSize) || (currentSize > MaxSerializedInputSize))
+        {
+            return false;
+        }
+
+        const bool isReading = (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject);
+        if (isReading)
+        {
+            // Anything past the end of the base is always sent, zero it so a malformed delta can't expose stale bytes
+            const uint32_t baseBytes = AZStd::min(baseSize, currentSize);
+            memcpy(current, base, baseBytes);
+            memset(current + baseBytes, 0, currentSize - baseBytes);
+        }
+
+        const uint32_t chunkCount = (currentSize + InputDeltaChunkSize - 1) / InputDeltaChunkSize;
+        for (uint32_t maskStart = 0; maskStart < chunkCount; maskStart += 8)
+        {
+            const uint32_t maskEnd = AZStd::min(maskStart + 8, chunkCount);
+            uint8_t dirtyMask = 0;
+            if (!isReading)
+            {
+                for (uint32_t chunk = maskStart; chunk < maskEnd; ++chunk)
+                {
+                    const uint32_t chunkStart = chunk * InputDeltaChunkSize;
+                    const uint32_t chunkEnd = AZStd::min(chunkStart + InputDeltaChunkSize, currentSize);
+                    if (IsInputChunkDirty(base, baseSize, current, chunkStart, chunkEnd))
+                    {
+                        dirtyMask |= static_cast<uint8_t>(1 << (chunk - maskStart));
+                    }
+                }
+            }
+
+            if (!serializer.Serialize(dirtyMask, "DirtyChunks"))
+            {
+                return false;
+            }
+
+            for (uint32_t chunk = maskStart; chunk < maskEnd; ++chunk)
+            {
+                if ((dirtyMask & (1 << (chunk - maskStart))) == 0)
+                {
+                    continue;
+                }
+
+                const uint32_t chunkEnd = AZStd::min((chunk + 1) * InputDeltaChunkSize, currentSize);
+                for (uint32_t byteIndex = chunk * InputDeltaChunkSize; byteIndex < chunkEnd; ++byteIndex)
+                {
+                    if (!serializer.Serialize(current[byteIndex], "ChunkByte"))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
     NetworkInputArray::NetworkInputArray()
         : m_owner()
         , m_inputs()
@@ -50,54 +122,43 @@ namespace Multiplayer
     {
         if (net_useInputDeltaSerialization)
         {
-            // Use delta-serialization to compress input RPC bandwidth usage
-            // Always serialize the full first element
-            if (!m_inputs[0].m_networkInput.Serialize(serializer))
-            {
-                return false;
-            }
-
-            // For each subsequent element
-            for (uint32_t i = 1; i < m_inputs.size(); ++i)
+            // Each element is delta encoded against the serialized bytes of the element before it, the first against an empty buffer
+            // Redundant inputs rarely differ by more than their ids and a handful of component values, so most chunks are skipped
+            const bool isReading = (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject);
+            AZStd::array<SerializedInputBuffer, 2> buffers;
+            uint32_t baseSize = 0;
+            for (uint32_t i = 0; i < m_inputs.size(); ++i)
             {
-                if (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject)
+                const uint8_t* base = buffers[(i + 1) % 2].data();
+                uint8_t* current = buffers[i % 2].data();
+                uint32_t currentSize = 0;
+                if (!isReading)
                 {
-                    AzNetworking::SerializerDelta deltaSerializer;
-                    // Read out the delta
-                    if (!deltaSerializer.Serialize(serializer))
-                    {
-                        return false;
-                    }
-                    // Start with previous value
-                    m_inputs[i].m_networkInput = m_inputs[i - 1].m_networkInput;
-                    // Then apply delta
-                    AzNetworking::DeltaSerializerApply applySerializer(deltaSerializer);
-                    if (!applySerializer.ApplyDelta(m_inputs[i].m_networkInput))
+                    AzNetworking::NetworkInputSerializer inputSerializer(current, MaxSerializedInputSize);
+                    if (!m_inputs[i].m_networkInput.Serialize(inputSerializer))
                     {
                         return false;
                     }
+                    currentSize = inputSerializer.GetSize();
                 }
-                else
+
+                if (!SerializeInputDelta(serializer, base, baseSize, current, currentSize))
                 {
-                    AzNetworking::SerializerDelta deltaSerializer;
-                    // Create the delta
-                    AzNetworking::DeltaSerializerCreate createSerializer(deltaSerializer);
-                    if (!createSerializer.CreateDelta(m_inputs[i - 1].m_networkInput, m_inputs[i].m_networkInput))
-                    {
-                        return false;
-                    }
-                    // Then write out the delta
-                    if (!deltaSerializer.Serialize(serializer))
+                    return false;
+                }
+
+                if (isReading)
+                {
+                    AzNetworking::NetworkOutputSerializer outputSerializer(current, currentSize);
+                    if (!m_inputs[i].m_networkInput.Serialize(outputSerializer))
                     {
                         return false;
                     }
                 }
+                baseSize = currentSize;
             }
+            return true;
         }
-        else
-        {
-            return serializer.Serialize(m_inputs, "InputArray");
-        }
-        return true;
+        return serializer.Serialize(m_inputs, "InputArray");
     }
 }
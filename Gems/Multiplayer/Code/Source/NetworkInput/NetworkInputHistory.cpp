@@ -7,36 +7,107 @@
  */
 
 #include <Multiplayer/NetworkInput/NetworkInputHistory.h>
+#include <AzCore/std/algorithm.h>
 
 namespace Multiplayer
 {
+    static constexpr AZStd::size_t MinHistoryCapacity = 8;
+
+    NetworkInputHistory::NetworkInputHistory(AZStd::size_t capacity)
+    {
+        Reserve(capacity);
+    }
+
     AZStd::size_t NetworkInputHistory::Size() const
     {
-        return m_history.size();
+        return m_size;
+    }
+
+    AZStd::size_t NetworkInputHistory::GetCapacity() const
+    {
+        return m_slots.size();
+    }
+
+    void NetworkInputHistory::Reserve(AZStd::size_t capacity)
+    {
+        const AZStd::size_t oldCapacity = m_slots.size();
+        if (capacity <= oldCapacity)
+        {
+            return;
+        }
+
+        // Move every slot, including vacated ones, so the component inputs they pool survive the resize
+        // Slots are moved by swapping their component inputs, copying a NetworkInput would reallocate them
+        AZStd::vector<Wrapper> slots(capacity);
+        for (AZStd::size_t i = 0; i < oldCapacity; ++i)
+        {
+            NetworkInput& source = m_slots[GetSlotIndex(i)].m_networkInput;
+            NetworkInput& target = slots[i].m_networkInput;
+            target.m_componentInputs.swap(source.m_componentInputs);
+            target.m_inputId = source.m_inputId;
+            target.m_hostFrameId = source.m_hostFrameId;
+            target.m_hostTimeMs = source.m_hostTimeMs;
+            target.m_hostBlendFactor = source.m_hostBlendFactor;
+            target.m_owner = source.m_owner;
+            target.m_wasAttached = source.m_wasAttached;
+        }
+
+        m_slots.swap(slots);
+        m_head = 0;
     }
 
     const NetworkInput& NetworkInputHistory::operator[](AZStd::size_t index) const
     {
-        return m_history[index].m_networkInput;
+        AZ_Assert(index < m_size, "Index %zu out of range, history holds %zu inputs", index, m_size);
+        return m_slots[GetSlotIndex(index)].m_networkInput;
     }
 
     NetworkInput& NetworkInputHistory::operator[](AZStd::size_t index)
     {
-        return m_history[index].m_networkInput;
+        AZ_Assert(index < m_size, "Index %zu out of range, history holds %zu inputs", index, m_size);
+        return m_slots[GetSlotIndex(index)].m_networkInput;
     }
 
-    void NetworkInputHistory::PushBack(NetworkInput& networkInput)
+    void NetworkInputHistory::PushBack(const NetworkInput& networkInput)
     {
-        m_history.push_back(Wrapper(networkInput));
+        if (m_size == m_slots.size())
+        {
+            Reserve(AZStd::max(m_slots.size() * 2, MinHistoryCapacity));
+        }
+
+        // Assignment reuses the component inputs already allocated for this slot whenever the component types match
+        NetworkInput& slot = m_slots[GetSlotIndex(m_size)].m_networkInput;
+        slot = networkInput;
+        slot.m_owner = networkInput.m_owner;
+        ++m_size;
     }
 
     void NetworkInputHistory::PopFront()
     {
-        m_history.pop_front();
+        AZ_Assert(m_size > 0, "PopFront called on an empty input history");
+        m_head = GetSlotIndex(1);
+        --m_size;
     }
 
     const NetworkInput& NetworkInputHistory::Front() const
     {
-        return m_history.front().m_networkInput;
+        return (*this)[0];
+    }
+
+    const NetworkInput& NetworkInputHistory::Back() const
+    {
+        return (*this)[m_size - 1];
+    }
+
+    void NetworkInputHistory::Clear()
+    {
+        m_head = 0;
+        m_size = 0;
+    }
+
+    AZStd::size_t NetworkInputHistory::GetSlotIndex(AZStd::size_t index) const
+    {
+        const AZStd::size_t slotIndex = m_head + index;
+        return (slotIndex < m_slots.size()) ? slotIndex : slotIndex - m_slots.size();
     }
 }
@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/LagCompensationScene.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/Obb.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/sort.h>
+
+AZ_DECLARE_BUDGET(MULTIPLAYER);
+
+namespace Multiplayer
+{
+    // Deep enough for a hierarchy built by median splits over far more hit volumes than a server will ever hold
+    static constexpr uint32_t MaxTraversalDepth = 64;
+
+    void LagCompensationScene::Frame::Clear()
+    {
+        Resize(0);
+        m_nodes.clear();
+    }
+
+    void LagCompensationScene::Frame::Resize(uint32_t count)
+    {
+        m_netEntityIds.resize_no_construct(count);
+        m_hitVolumeIndices.resize_no_construct(count);
+        m_shapeTypes.resize_no_construct(count);
+        m_positionX.resize_no_construct(count);
+        m_positionY.resize_no_construct(count);
+        m_positionZ.resize_no_construct(count);
+        m_rotations.resize_no_construct(count);
+        m_halfExtentX.resize_no_construct(count);
+        m_halfExtentY.resize_no_construct(count);
+        m_halfExtentZ.resize_no_construct(count);
+        m_previousIndices.resize_no_construct(count);
+    }
+
+    uint32_t LagCompensationScene::Frame::GetCount() const
+    {
+        return static_cast<uint32_t>(m_netEntityIds.size());
+    }
+
+    void LagCompensationScene::BeginFrame(HostFrameId hostFrameId)
+    {
+        AZ_Assert(m_recordingFrame == nullptr, "BeginFrame called while already recording a frame");
+
+        if ((m_lastRecordedFrameId != InvalidHostFrameId) && (hostFrameId < m_lastRecordedFrameId))
+        {
+            // Time was reset, none of the recorded history is meaningful anymore
+            Clear();
+        }
+
+        m_recordingFrame = &m_frames[static_cast<uint32_t>(hostFrameId) % RewindHistorySize];
+        m_recordingFrame->Clear();
+        m_recordingFrame->m_hostFrameId = InvalidHostFrameId;
+        m_lastRecordedFrameId = hostFrameId;
+        m_pendingHitVolumes.clear();
+    }
+
+    void LagCompensationScene::AddHitVolumes(const LagCompensationHitVolume* hitVolumes, uint32_t count)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordingMutex);
+        if (m_recordingFrame != nullptr)
+        {
+            m_pendingHitVolumes.insert(m_pendingHitVolumes.end(), hitVolumes, hitVolumes + count);
+        }
+    }
+
+    void LagCompensationScene::EndFrame()
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "LagCompensationScene: EndFrame");
+
+        if (m_recordingFrame == nullptr)
+        {
+            return;
+        }
+
+        Frame& frame = *m_recordingFrame;
+        const uint32_t count = static_cast<uint32_t>(m_pendingHitVolumes.size());
+
+        // Map the preceding frame's volumes so recorded volumes can refer back to them for blending
+        const Frame* previousFrame = FindFrame(m_lastRecordedFrameId - HostFrameId(1));
+        m_previousIndexMap.clear();
+        if (previousFrame != nullptr)
+        {
+            for (uint32_t index = 0; index < previousFrame->GetCount(); ++index)
+            {
+                const uint64_t netEntityId = static_cast<uint64_t>(previousFrame->m_netEntityIds[index]);
+                m_previousIndexMap.emplace(AZStd::make_pair(netEntityId, previousFrame->m_hitVolumeIndices[index]), index);
+            }
+        }
+
+        // Bounds cover the volume at both frames so a single hierarchy serves any blend factor between them
+        m_pendingBounds.resize_no_construct(count);
+        m_pendingCenters.resize_no_construct(count);
+        m_pendingOrder.resize_no_construct(count);
+        m_pendingPreviousIndices.resize_no_construct(count);
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            const LagCompensationHitVolume& hitVolume = m_pendingHitVolumes[index];
+            AZ::Aabb bounds = GetBounds(hitVolume.m_worldTransform.GetTranslation(), hitVolume.m_worldTransform.GetRotation(), hitVolume.m_halfExtents, hitVolume.m_shapeType);
+
+            auto previousIter = m_previousIndexMap.find(AZStd::make_pair(static_cast<uint64_t>(hitVolume.m_netEntityId), hitVolume.m_hitVolumeIndex));
+            if (previousIter != m_previousIndexMap.end())
+            {
+                const uint32_t previousIndex = previousIter->second;
+                const AZ::Vector3 previousPosition(previousFrame->m_positionX[previousIndex], previousFrame->m_positionY[previousIndex], previousFrame->m_positionZ[previousIndex]);
+                bounds.AddAabb(GetBounds(previousPosition, previousFrame->m_rotations[previousIndex], hitVolume.m_halfExtents, hitVolume.m_shapeType));
+                m_pendingPreviousIndices[index] = previousIndex;
+            }
+            else
+            {
+                m_pendingPreviousIndices[index] = InvalidIndex;
+            }
+
+            m_pendingBounds[index] = bounds;
+            m_pendingCenters[index] = bounds.GetCenter();
+            m_pendingOrder[index] = index;
+        }
+
+        frame.m_nodes.reserve(count > 0 ? (2 * count) / MaxLeafSize + 1 : 0);
+        if (count > 0)
+        {
+            BuildNode(0, count);
+        }
+
+        // Store the volumes in leaf order, so each leaf references a contiguous range of every array
+        frame.Resize(count);
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            const uint32_t sourceIndex = m_pendingOrder[index];
+            const LagCompensationHitVolume& hitVolume = m_pendingHitVolumes[sourceIndex];
+            const AZ::Vector3 position = hitVolume.m_worldTransform.GetTranslation();
+            frame.m_netEntityIds[index] = hitVolume.m_netEntityId;
+            frame.m_hitVolumeIndices[index] = hitVolume.m_hitVolumeIndex;
+            frame.m_shapeTypes[index] = hitVolume.m_shapeType;
+            frame.m_positionX[index] = position.GetX();
+            frame.m_positionY[index] = position.GetY();
+            frame.m_positionZ[index] = position.GetZ();
+            frame.m_rotations[index] = hitVolume.m_worldTransform.GetRotation();
+            frame.m_halfExtentX[index] = hitVolume.m_halfExtents.GetX();
+            frame.m_halfExtentY[index] = hitVolume.m_halfExtents.GetY();
+            frame.m_halfExtentZ[index] = hitVolume.m_halfExtents.GetZ();
+            frame.m_previousIndices[index] = m_pendingPreviousIndices[sourceIndex];
+        }
+
+        frame.m_hostFrameId = m_lastRecordedFrameId;
+        m_recordingFrame = nullptr;
+        m_pendingHitVolumes.clear();
+    }
+
+    void LagCompensationScene::Clear()
+    {
+        for (Frame& frame : m_frames)
+        {
+            frame.Clear();
+            frame.m_hostFrameId = InvalidHostFrameId;
+        }
+        m_lastRecordedFrameId = InvalidHostFrameId;
+    }
+
+    bool LagCompensationScene::HasFrame(HostFrameId hostFrameId) const
+    {
+        return FindFrame(hostFrameId) != nullptr;
+    }
+
+    uint32_t LagCompensationScene::GetHitVolumeCount(HostFrameId hostFrameId) const
+    {
+        const Frame* frame = FindFrame(hostFrameId);
+        return (frame != nullptr) ? frame->GetCount() : 0;
+    }
+
+    bool LagCompensationScene::RayCast
+    (
+        HostFrameId hostFrameId,
+        float blendFactor,
+        const LagCompensationRayCastRequest& request,
+        AZStd::vector<LagCompensationHit>& outHits
+    ) const
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "LagCompensationScene: RayCast");
+
+        outHits.clear();
+        const Frame* frame = FindFrame(hostFrameId);
+        if ((frame == nullptr) || frame->m_nodes.empty())
+        {
+            return false;
+        }
+
+        const Frame* previousFrame = FindFrame(hostFrameId - HostFrameId(1));
+        const AZ::Vector3 directionReciprocal = request.m_direction.GetReciprocal();
+        float closestDistance = request.m_distance;
+
+        AZStd::fixed_vector<uint32_t, MaxTraversalDepth> nodeStack;
+        nodeStack.push_back(0);
+        while (!nodeStack.empty())
+        {
+            const uint32_t nodeIndex = nodeStack.back();
+            const BvhNode& node = frame->m_nodes[nodeIndex];
+            nodeStack.pop_back();
+
+            float nodeStart = 0.0f;
+            float nodeEnd = 0.0f;
+            if ((AZ::Intersect::IntersectRayAABB2(request.m_start, directionReciprocal, node.m_bounds, nodeStart, nodeEnd) == AZ::Intersect::ISECT_RAY_AABB_NONE)
+             || (nodeEnd < 0.0f) || (nodeStart > closestDistance))
+            {
+                continue;
+            }
+
+            if (node.m_count == 0)
+            {
+                nodeStack.push_back(node.m_index);
+                nodeStack.push_back(nodeIndex + 1);
+                continue;
+            }
+
+            for (uint32_t index = node.m_index; index < node.m_index + node.m_count; ++index)
+            {
+                if (frame->m_netEntityIds[index] == request.m_ignoredNetEntityId)
+                {
+                    continue;
+                }
+
+                const BlendedHitVolume hitVolume = GetBlendedHitVolume(*frame, previousFrame, index, blendFactor);
+                float distance = 0.0f;
+                if (!RayCastHitVolume(hitVolume, request, distance) || (distance > closestDistance))
+                {
+                    continue;
+                }
+
+                LagCompensationHit hit;
+                hit.m_netEntityId = frame->m_netEntityIds[index];
+                hit.m_hitVolumeIndex = frame->m_hitVolumeIndices[index];
+                hit.m_distance = distance;
+                hit.m_position = request.m_start + request.m_direction * distance;
+                if (request.m_reportMultipleHits)
+                {
+                    outHits.push_back(hit);
+                }
+                else
+                {
+                    // Only the closest hit is wanted, so anything further away can be culled from here on
+                    closestDistance = distance;
+                    outHits.clear();
+                    outHits.push_back(hit);
+                }
+            }
+        }
+
+        if (request.m_reportMultipleHits)
+        {
+            AZStd::sort(outHits.begin(), outHits.end(), [](const LagCompensationHit& lhs, const LagCompensationHit& rhs)
+            {
+                return lhs.m_distance < rhs.m_distance;
+            });
+        }
+        return !outHits.empty();
+    }
+
+    void LagCompensationScene::OverlapAabb
+    (
+        HostFrameId hostFrameId,
+        float blendFactor,
+        const AZ::Aabb& volume,
+        AZStd::vector<NetEntityId>& outNetEntityIds
+    ) const
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "LagCompensationScene: OverlapAabb");
+
+        outNetEntityIds.clear();
+        const Frame* frame = FindFrame(hostFrameId);
+        if ((frame == nullptr) || frame->m_nodes.empty())
+        {
+            return;
+        }
+
+        const Frame* previousFrame = FindFrame(hostFrameId - HostFrameId(1));
+
+        AZStd::fixed_vector<uint32_t, MaxTraversalDepth> nodeStack;
+        nodeStack.push_back(0);
+        while (!nodeStack.empty())
+        {
+            const uint32_t nodeIndex = nodeStack.back();
+            const BvhNode& node = frame->m_nodes[nodeIndex];
+            nodeStack.pop_back();
+
+            if (!AZ::ShapeIntersection::Overlaps(node.m_bounds, volume))
+            {
+                continue;
+            }
+
+            if (node.m_count == 0)
+            {
+                nodeStack.push_back(node.m_index);
+                nodeStack.push_back(nodeIndex + 1);
+                continue;
+            }
+
+            for (uint32_t index = node.m_index; index < node.m_index + node.m_count; ++index)
+            {
+                const BlendedHitVolume hitVolume = GetBlendedHitVolume(*frame, previousFrame, index, blendFactor);
+                if (AZ::ShapeIntersection::Overlaps(GetBounds(hitVolume.m_position, hitVolume.m_rotation, hitVolume.m_halfExtents, hitVolume.m_shapeType), volume))
+                {
+                    outNetEntityIds.push_back(frame->m_netEntityIds[index]);
+                }
+            }
+        }
+
+        AZStd::sort(outNetEntityIds.begin(), outNetEntityIds.end());
+        outNetEntityIds.erase(AZStd::unique(outNetEntityIds.begin(), outNetEntityIds.end()), outNetEntityIds.end());
+    }
+
+    const LagCompensationScene::Frame* LagCompensationScene::FindFrame(HostFrameId hostFrameId) const
+    {
+        if (hostFrameId == InvalidHostFrameId)
+        {
+            return nullptr;
+        }
+
+        const Frame& frame = m_frames[static_cast<uint32_t>(hostFrameId) % RewindHistorySize];
+        return (frame.m_hostFrameId == hostFrameId) ? &frame : nullptr;
+    }
+
+    LagCompensationScene::BlendedHitVolume LagCompensationScene::GetBlendedHitVolume
+    (
+        const Frame& frame,
+        const Frame* previousFrame,
+        uint32_t index,
+        float blendFactor
+    ) const
+    {
+        BlendedHitVolume result;
+        result.m_position = AZ::Vector3(frame.m_positionX[index], frame.m_positionY[index], frame.m_positionZ[index]);
+        result.m_rotation = frame.m_rotations[index];
+        result.m_halfExtents = AZ::Vector3(frame.m_halfExtentX[index], frame.m_halfExtentY[index], frame.m_halfExtentZ[index]);
+        result.m_shapeType = frame.m_shapeTypes[index];
+
+        const uint32_t previousIndex = frame.m_previousIndices[index];
+        if ((blendFactor < 1.0f) && (previousFrame != nullptr) && (previousIndex < previousFrame->GetCount()))
+        {
+            // Blend the same way rewound hit volumes do, see NetworkHitVolumesComponent::AnimatedHitVolume::SyncToCurrentTransform
+            const AZ::Vector3 previousPosition(previousFrame->m_positionX[previousIndex], previousFrame->m_positionY[previousIndex], previousFrame->m_positionZ[previousIndex]);
+            result.m_position = previousPosition.Lerp(result.m_position, blendFactor);
+            result.m_rotation = previousFrame->m_rotations[previousIndex].Slerp(result.m_rotation, blendFactor);
+        }
+        return result;
+    }
+
+    uint32_t LagCompensationScene::BuildNode(uint32_t begin, uint32_t end)
+    {
+        AZStd::vector<BvhNode>& nodes = m_recordingFrame->m_nodes;
+        const uint32_t nodeIndex = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        AZ::Aabb centerBounds = AZ::Aabb::CreateNull();
+        for (uint32_t index = begin; index < end; ++index)
+        {
+            bounds.AddAabb(m_pendingBounds[m_pendingOrder[index]]);
+            centerBounds.AddPoint(m_pendingCenters[m_pendingOrder[index]]);
+        }
+        nodes[nodeIndex].m_bounds = bounds;
+
+        if (end - begin <= MaxLeafSize)
+        {
+            nodes[nodeIndex].m_index = begin;
+            nodes[nodeIndex].m_count = end - begin;
+            return nodeIndex;
+        }
+
+        // Median split along the axis the volume centers are most spread out on, which keeps the hierarchy balanced
+        const AZ::Vector3 centerExtents = centerBounds.GetExtents();
+        int32_t splitAxis = (centerExtents.GetY() > centerExtents.GetX()) ? 1 : 0;
+        splitAxis = (centerExtents.GetZ() > centerExtents.GetElement(splitAxis)) ? 2 : splitAxis;
+
+        const uint32_t middle = begin + (end - begin) / 2;
+        AZStd::nth_element(m_pendingOrder.begin() + begin, m_pendingOrder.begin() + middle, m_pendingOrder.begin() + end,
+            [this, splitAxis](uint32_t lhs, uint32_t rhs)
+        {
+            return m_pendingCenters[lhs].GetElement(splitAxis) < m_pendingCenters[rhs].GetElement(splitAxis);
+        });
+
+        BuildNode(begin, middle);
+        const uint32_t rightIndex = BuildNode(middle, end);
+        nodes[nodeIndex].m_index = rightIndex;
+        nodes[nodeIndex].m_count = 0;
+        return nodeIndex;
+    }
+
+    AZ::Aabb LagCompensationScene::GetBounds
+    (
+        const AZ::Vector3& position,
+        const AZ::Quaternion& rotation,
+        const AZ::Vector3& halfExtents,
+        LagCompensationShapeType shapeType
+    )
+    {
+        switch (shapeType)
+        {
+        case LagCompensationShapeType::Sphere:
+            return AZ::Aabb::CreateCenterRadius(position, halfExtents.GetX());
+        case LagCompensationShapeType::Capsule:
+        {
+            const float radius = halfExtents.GetX();
+            const AZ::Vector3 halfSegment = rotation.TransformVector(AZ::Vector3::CreateAxisZ(AZ::GetMax(halfExtents.GetZ() - radius, 0.0f)));
+            const AZ::Vector3 extents = halfSegment.GetAbs() + AZ::Vector3(radius);
+            return AZ::Aabb::CreateFromMinMax(position - extents, position + extents);
+        }
+        case LagCompensationShapeType::Box:
+            return AZ::Aabb::CreateFromObb(AZ::Obb::CreateFromPositionRotationAndHalfLengths(position, rotation, halfExtents));
+        }
+        return AZ::Aabb::CreateFromPoint(position);
+    }
+
+    bool LagCompensationScene::RayCastHitVolume(const BlendedHitVolume& hitVolume, const LagCompensationRayCastRequest& request, float& outDistance)
+    {
+        switch (hitVolume.m_shapeType)
+        {
+        case LagCompensationShapeType::Sphere:
+        {
+            float distance = 0.0f;
+            const AZ::Intersect::SphereIsectTypes result = AZ::Intersect::IntersectRaySphere(request.m_start, request.m_direction, hitVolume.m_position, hitVolume.m_halfExtents.GetX(), distance);
+            outDistance = (result == AZ::Intersect::ISECT_RAY_SPHERE_SA_INSIDE) ? 0.0f : distance;
+            return (result != AZ::Intersect::ISECT_RAY_SPHERE_NONE) && (outDistance <= request.m_distance);
+        }
+        case LagCompensationShapeType::Capsule:
+        {
+            const float radius = hitVolume.m_halfExtents.GetX();
+            const float halfSegmentLength = hitVolume.m_halfExtents.GetZ() - radius;
+            if (halfSegmentLength <= AZ::Constants::FloatEpsilon)
+            {
+                // Degenerate capsules are spheres, and the segment cylinder test does not handle a zero length axis
+                BlendedHitVolume sphere = hitVolume;
+                sphere.m_shapeType = LagCompensationShapeType::Sphere;
+                return RayCastHitVolume(sphere, request, outDistance);
+            }
+
+            const AZ::Vector3 halfSegment = hitVolume.m_rotation.TransformVector(AZ::Vector3::CreateAxisZ(halfSegmentLength));
+            float proportion = 0.0f;
+            const AZ::Intersect::CapsuleIsectTypes result = AZ::Intersect::IntersectSegmentCapsule(
+                request.m_start, request.m_direction * request.m_distance, hitVolume.m_position + halfSegment, hitVolume.m_position - halfSegment, radius, proportion);
+            outDistance = (result == AZ::Intersect::ISECT_RAY_CAPSULE_SA_INSIDE) ? 0.0f : proportion * request.m_distance;
+            return (result != AZ::Intersect::ISECT_RAY_CAPSULE_NONE) && (outDistance >= 0.0f) && (outDistance <= request.m_distance);
+        }
+        case LagCompensationShapeType::Box:
+        {
+            const AZ::Obb obb = AZ::Obb::CreateFromPositionRotationAndHalfLengths(hitVolume.m_position, hitVolume.m_rotation, hitVolume.m_halfExtents);
+            return AZ::Intersect::IntersectRayObb(request.m_start, request.m_direction, obb, outDistance)
+                && (outDistance >= 0.0f) && (outDistance <= request.m_distance);
+        }
+        }
+        return false;
+    }
+}
@@ -19,6 +19,8 @@ namespace Multiplayer
 {
     AZ_CVAR(float, sv_RewindVolumeExtrudeDistance, 50.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount to increase rewind volume checks to account for fast moving entities");
     AZ_CVAR(bool, bg_RewindDebugDraw, false, nullptr, AZ::ConsoleFunctorFlags::Null, "If true enables debug draw of rewind operations");
+    AZ_CVAR(bool, sv_LagCompensationScene, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true servers record hit volumes into a lag compensation scene for hit scans to query, instead of rewinding hit volumes inside the physics scene");
 
     void NetworkTime::Reflect(AZ::ReflectContext* context)
     {
@@ -195,4 +197,28 @@ namespace Multiplayer
         }
         m_rewoundEntities.clear();
     }
+
+    LagCompensationScene* NetworkTime::GetLagCompensationScene()
+    {
+        return sv_LagCompensationScene ? &m_lagCompensationScene : nullptr;
+    }
+
+    void NetworkTime::AddLagCompensationRecordHandler(LagCompensationRecordEvent::Handler& handler)
+    {
+        handler.Connect(m_lagCompensationRecordEvent);
+    }
+
+    void NetworkTime::RecordLagCompensationFrame()
+    {
+        LagCompensationScene* lagCompensationScene = GetLagCompensationScene();
+        if (lagCompensationScene == nullptr)
+        {
+            return;
+        }
+
+        // Recording the same host frame again replaces it, so the last server tick of a host frame wins
+        lagCompensationScene->BeginFrame(m_unalteredFrameId);
+        m_lagCompensationRecordEvent.Signal(*lagCompensationScene);
+        lagCompensationScene->EndFrame();
+    }
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <Multiplayer/NetworkTime/LagCompensationScene.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Console/IConsole.h>
@@ -38,11 +39,19 @@ namespace Multiplayer
         void AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, float blendFactor, AzNetworking::ConnectionId rewindConnectionId) override;
         void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) override;
         void ClearRewoundEntities() override;
+        LagCompensationScene* GetLagCompensationScene() override;
+        void AddLagCompensationRecordHandler(LagCompensationRecordEvent::Handler& handler) override;
         //! @}
 
+        //! Records the current host frame into the lag compensation scene, if it's enabled.
+        //! Signals every lag compensation record handler between LagCompensationScene::BeginFrame and EndFrame.
+        void RecordLagCompensationFrame();
+
     private:
 
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
+        LagCompensationScene m_lagCompensationScene;
+        LagCompensationRecordEvent m_lagCompensationRecordEvent;
 
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Session/HostInstanceSupervisor.h>
+#include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+
+#if defined(AZ_PLATFORM_LINUX)
+#include <csignal>
+#include <errno.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace Multiplayer
+{
+    // The logger system component doesn't exist yet when instances are forked, and never does in the supervisor, so use AZ_Trace* here
+    static constexpr const char* HostInstanceSupervisorWindow = "HostInstanceSupervisor";
+
+    static uint16_t s_hostInstanceIndex = 0;
+
+#if defined(AZ_PLATFORM_LINUX)
+    static volatile sig_atomic_t s_terminateRequested = 0;
+
+    static void OnSupervisorTerminateSignal(int)
+    {
+        s_terminateRequested = 1;
+    }
+#endif
+
+    HostInstanceSupervisor::HostInstanceSupervisor()
+    {
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+        {
+            AZ::ComponentApplicationLifecycle::RegisterHandler(
+                *settingsRegistry,
+                m_gemsLoadedHandler,
+                [this](const AZ::SettingsRegistryInterface::NotifyEventArgs&)
+                {
+                    OnGemsLoaded();
+                },
+                "GemsLoaded");
+        }
+    }
+
+    uint16_t HostInstanceSupervisor::GetHostInstanceIndex()
+    {
+        return s_hostInstanceIndex;
+    }
+
+    uint16_t HostInstanceSupervisor::GetRequestedHostInstanceCount(const AZ::SettingsRegistryInterface& settingsRegistry)
+    {
+        AZ::u64 instanceCount = 1;
+        settingsRegistry.Get(instanceCount, HostInstanceCountKey);
+        if (instanceCount > MaxHostInstanceCount)
+        {
+            AZ_Warning(HostInstanceSupervisorWindow, false, "Requested %llu multiplayer host instances, limiting to %u",
+                static_cast<unsigned long long>(instanceCount), aznumeric_cast<uint32_t>(MaxHostInstanceCount));
+            instanceCount = MaxHostInstanceCount;
+        }
+        return aznumeric_cast<uint16_t>(AZStd::max<AZ::u64>(instanceCount, 1));
+    }
+
+    bool HostInstanceSupervisor::ShouldReplaceHostInstance(AZStd::chrono::steady_clock::duration lifetime, bool terminateRequested)
+    {
+        return !terminateRequested && lifetime >= MinHostInstanceLifetime;
+    }
+
+    bool HostInstanceSupervisor::GetHostInstancePort(
+        uint16_t basePort, uint16_t portRange, uint16_t instanceCount, uint16_t instanceIndex, uint16_t& outPort)
+    {
+        const uint32_t lastInstanceOffset = AZStd::max<uint32_t>(instanceCount, 1) - 1;
+        const uint32_t lastInstancePort = static_cast<uint32_t>(basePort) + lastInstanceOffset;
+        if (lastInstanceOffset > portRange || lastInstancePort > AZStd::numeric_limits<uint16_t>::max() || instanceIndex > lastInstanceOffset)
+        {
+            return false;
+        }
+        outPort = aznumeric_cast<uint16_t>(basePort + instanceIndex);
+        return true;
+    }
+
+    void HostInstanceSupervisor::OnGemsLoaded()
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        const uint16_t instanceCount = settingsRegistry != nullptr ? GetRequestedHostInstanceCount(*settingsRegistry) : 1;
+        if (instanceCount <= 1)
+        {
+            return;
+        }
+
+#if defined(AZ_PLATFORM_LINUX)
+        AZ_TracePrintf(HostInstanceSupervisorWindow, "Forking %u multiplayer host instances\n", aznumeric_cast<uint32_t>(instanceCount));
+
+        m_instances.resize(instanceCount);
+        for (uint16_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex)
+        {
+            if (ForkInstance(instanceIndex))
+            {
+                // This is a host instance, continue application startup
+                return;
+            }
+        }
+
+        Supervise();
+#else
+        AZ_Warning(HostInstanceSupervisorWindow, false, "Multiplayer host instances are not supported on this platform, hosting a single session");
+#endif
+    }
+
+    bool HostInstanceSupervisor::ForkInstance([[maybe_unused]] uint16_t instanceIndex)
+    {
+#if defined(AZ_PLATFORM_LINUX)
+        const pid_t processId = fork();
+        if (processId == 0)
+        {
+            // Instances must not inherit the supervisor's signal handling, and should never outlive their supervisor
+            signal(SIGTERM, SIG_DFL);
+            signal(SIGINT, SIG_DFL);
+            prctl(PR_SET_PDEATHSIG, SIGTERM);
+            s_hostInstanceIndex = instanceIndex;
+            m_instances.clear();
+            return true;
+        }
+
+        if (processId < 0)
+        {
+            AZ_Error(HostInstanceSupervisorWindow, false, "Failed to fork multiplayer host instance %u, errno %d",
+                aznumeric_cast<uint32_t>(instanceIndex), errno);
+            m_instances[instanceIndex].m_processId = 0;
+            return false;
+        }
+
+        m_instances[instanceIndex].m_processId = processId;
+        m_instances[instanceIndex].m_startTime = AZStd::chrono::steady_clock::now();
+#endif
+        return false;
+    }
+
+    void HostInstanceSupervisor::Supervise()
+    {
+#if defined(AZ_PLATFORM_LINUX)
+        struct sigaction action = {};
+        action.sa_handler = OnSupervisorTerminateSignal;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGTERM, &action, nullptr);
+        sigaction(SIGINT, &action, nullptr);
+
+        int exitCode = 0;
+        auto isRunning = [](const HostInstance& instance) { return instance.m_processId > 0; };
+        while (AZStd::any_of(m_instances.begin(), m_instances.end(), isRunning))
+        {
+            if (s_terminateRequested)
+            {
+                for (const HostInstance& instance : m_instances)
+                {
+                    if (isRunning(instance))
+                    {
+                        kill(instance.m_processId, SIGTERM);
+                    }
+                }
+            }
+
+            int status = 0;
+            const pid_t processId = waitpid(-1, &status, 0);
+            if (processId < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                break;
+            }
+
+            auto instance = AZStd::find_if(m_instances.begin(), m_instances.end(),
+                [processId](const HostInstance& candidate) { return candidate.m_processId == processId; });
+            if (instance == m_instances.end())
+            {
+                continue;
+            }
+
+            const uint16_t instanceIndex = aznumeric_cast<uint16_t>(instance - m_instances.begin());
+            const bool exitedCleanly = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+            instance->m_processId = 0;
+            if (!exitedCleanly)
+            {
+                AZ_Warning(HostInstanceSupervisorWindow, false, "Multiplayer host instance %u exited abnormally, status %d",
+                    aznumeric_cast<uint32_t>(instanceIndex), status);
+                exitCode = 1;
+            }
+
+            if (s_terminateRequested)
+            {
+                continue;
+            }
+
+            if (!ShouldReplaceHostInstance(AZStd::chrono::steady_clock::now() - instance->m_startTime, s_terminateRequested != 0))
+            {
+                AZ_Error(HostInstanceSupervisorWindow, false, "Multiplayer host instance %u exited during startup, it will not be replaced",
+                    aznumeric_cast<uint32_t>(instanceIndex));
+                continue;
+            }
+
+            // Replace the finished session with a fresh instance, the supervisor still holds the pristine post gem load state
+            AZ_TracePrintf(HostInstanceSupervisorWindow, "Multiplayer host instance %u exited, forking a replacement\n",
+                aznumeric_cast<uint32_t>(instanceIndex));
+            if (ForkInstance(instanceIndex))
+            {
+                // Return into the gems loaded notification as a brand new host instance
+                return;
+            }
+        }
+
+        // The supervisor never completed application startup, so skip static destruction and exit immediately
+        _exit(exitCode);
+#endif
+    }
+}
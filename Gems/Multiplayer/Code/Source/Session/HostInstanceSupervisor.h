@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! Settings registry key holding the number of independent game sessions a dedicated server process should host.
+    //! Set with --regset=/O3DE/Multiplayer/HostInstanceCount=<count>, console variables are not yet available when instances are forked.
+    inline constexpr AZStd::string_view HostInstanceCountKey = "/O3DE/Multiplayer/HostInstanceCount";
+
+    //! @class HostInstanceSupervisor
+    //! @brief Hosts several independent dedicated server sessions from a single engine startup.
+    //!
+    //! Once every gem has been loaded and reflected, and before any system component starts a worker thread, the process forks
+    //! one host instance per requested session. Each instance finishes application startup on its own and owns its multiplayer
+    //! session, entity domain, network interface and physics scene, while gem code, static data, the settings registry and the
+    //! serialize and behavior contexts built during startup are shared copy-on-write between all instances.
+    //!
+    //! The original process becomes a supervisor that never proceeds past gem loading. It stays single threaded, so it can fork
+    //! a fresh instance whenever one exits, for example at the end of a match, and forwards termination requests to all instances.
+    //! Each instance hosts on sv_port offset by its instance index.
+    //!
+    //! Limitation: forking has to happen before system components activate and start their worker threads, which is also before
+    //! the asset catalog and any asset is loaded. Every instance loads the catalog, levels and shared assets on its own, so asset
+    //! memory is not shared between instances, only the memory built up to gem loading is.
+    class HostInstanceSupervisor
+    {
+    public:
+        HostInstanceSupervisor();
+        ~HostInstanceSupervisor() = default;
+
+        //! Instances that exit sooner than this after being forked are assumed to be failing on startup and are not replaced.
+        static constexpr AZStd::chrono::seconds MinHostInstanceLifetime = AZStd::chrono::seconds(10);
+        static constexpr uint16_t MaxHostInstanceCount = 256;
+
+        //! Returns the index of the host instance run by this process.
+        //! @return the host instance index, 0 unless this process was forked by a supervisor
+        static uint16_t GetHostInstanceIndex();
+
+        //! Reads the number of host instances requested through HostInstanceCountKey.
+        //! @param settingsRegistry the settings registry to read the count from
+        //! @return the requested count clamped to [1, MaxHostInstanceCount], 1 if no count was requested
+        static uint16_t GetRequestedHostInstanceCount(const AZ::SettingsRegistryInterface& settingsRegistry);
+
+        //! Returns whether a host instance that exited should be replaced with a freshly forked one.
+        //! @param lifetime           how long the instance ran for
+        //! @param terminateRequested true if the supervisor is shutting down
+        //! @return boolean true if the instance should be replaced
+        static bool ShouldReplaceHostInstance(AZStd::chrono::steady_clock::duration lifetime, bool terminateRequested);
+
+        //! Returns the port a host instance should host on, every instance's port must be a valid port within the host port range.
+        //! @param basePort      the port the first instance hosts on, sv_port
+        //! @param portRange     the range of ports above the base port the host may use, sv_portRange
+        //! @param instanceCount the number of host instances
+        //! @param instanceIndex the index of the instance to return the port for
+        //! @param outPort       the port the instance should host on
+        //! @return boolean true on success, false if the ports of all instances don't fit within the port range or above 65535
+        static bool GetHostInstancePort(uint16_t basePort, uint16_t portRange, uint16_t instanceCount, uint16_t instanceIndex, uint16_t& outPort);
+
+    private:
+        void OnGemsLoaded();
+
+        //! Forks a single host instance.
+        //! @param instanceIndex the index of the instance to fork
+        //! @return boolean true in the forked instance, false in the supervisor
+        bool ForkInstance(uint16_t instanceIndex);
+
+        //! Waits on the host instances and replaces any that exit.
+        //! Only returns in a replacement instance, the supervisor itself exits once every instance has exited.
+        void Supervise();
+
+        struct HostInstance
+        {
+            int m_processId = 0;
+            AZStd::chrono::steady_clock::time_point m_startTime;
+        };
+
+        AZ::SettingsRegistryInterface::NotifyEventHandler m_gemsLoadedHandler;
+        AZStd::vector<HostInstance> m_instances;
+    };
+}
@@ -145,6 +145,15 @@ namespace Multiplayer
         void AlterTime([[maybe_unused]] HostFrameId frameId, [[maybe_unused]] AZ::TimeMs timeMs, [[maybe_unused]] float blendFactor, [[maybe_unused]] AzNetworking::ConnectionId rewindConnectionId) override
         {
         }
+
+        Multiplayer::LagCompensationScene* GetLagCompensationScene() override
+        {
+            return nullptr;
+        }
+
+        void AddLagCompensationRecordHandler([[maybe_unused]] Multiplayer::LagCompensationRecordEvent::Handler& handler) override
+        {
+        }
     };
 
     class BenchmarkMultiplayerConnection : public IConnection
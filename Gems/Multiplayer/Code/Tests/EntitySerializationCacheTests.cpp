@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntitySerializationCache.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class EntitySerializationCacheTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static Multiplayer::ReplicationRecord MakeRecord(uint32_t dirtyBit)
+        {
+            Multiplayer::ReplicationRecord record(Multiplayer::NetEntityRole::Client);
+            record.m_authorityToClient.Resize(8);
+            record.m_authorityToClient.SetBit(dirtyBit, true);
+            return record;
+        }
+
+        static AzNetworking::PacketEncodingBuffer MakeData(uint8_t value, AZStd::size_t size)
+        {
+            AzNetworking::PacketEncodingBuffer data;
+            data.Resize(size);
+            memset(data.GetBuffer(), value, size);
+            return data;
+        }
+    };
+
+    TEST_F(EntitySerializationCacheTests, FindsMatchingRecord)
+    {
+        Multiplayer::EntitySerializationCache cache;
+        const Multiplayer::HostFrameId frameId{ 1 };
+        cache.Store(frameId, MakeRecord(1), MakeData(0x11, 12));
+        cache.Store(frameId, MakeRecord(2), MakeData(0x22, 7));
+
+        AzNetworking::PacketEncodingBuffer result;
+        EXPECT_TRUE(cache.Find(frameId, MakeRecord(2), result));
+        EXPECT_EQ(result, MakeData(0x22, 7));
+
+        EXPECT_TRUE(cache.Find(frameId, MakeRecord(1), result));
+        EXPECT_EQ(result, MakeData(0x11, 12));
+
+        EXPECT_FALSE(cache.Find(frameId, MakeRecord(3), result));
+    }
+
+    TEST_F(EntitySerializationCacheTests, RemoteRoleIsPartOfTheKey)
+    {
+        Multiplayer::EntitySerializationCache cache;
+        const Multiplayer::HostFrameId frameId{ 1 };
+        cache.Store(frameId, MakeRecord(1), MakeData(0x11, 4));
+
+        Multiplayer::ReplicationRecord autonomousRecord = MakeRecord(1);
+        autonomousRecord.SetRemoteNetworkRole(Multiplayer::NetEntityRole::Autonomous);
+
+        AzNetworking::PacketEncodingBuffer result;
+        EXPECT_FALSE(cache.Find(frameId, autonomousRecord, result));
+    }
+
+    TEST_F(EntitySerializationCacheTests, StaleFrameAndInvalidateMiss)
+    {
+        Multiplayer::EntitySerializationCache cache;
+        cache.Store(Multiplayer::HostFrameId{ 1 }, MakeRecord(1), MakeData(0x11, 4));
+
+        AzNetworking::PacketEncodingBuffer result;
+        EXPECT_FALSE(cache.Find(Multiplayer::HostFrameId{ 2 }, MakeRecord(1), result));
+
+        cache.Store(Multiplayer::HostFrameId{ 2 }, MakeRecord(1), MakeData(0x33, 4));
+        EXPECT_TRUE(cache.Find(Multiplayer::HostFrameId{ 2 }, MakeRecord(1), result));
+        EXPECT_EQ(result, MakeData(0x33, 4));
+
+        cache.Invalidate();
+        EXPECT_FALSE(cache.Find(Multiplayer::HostFrameId{ 2 }, MakeRecord(1), result));
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkEntity/EntityReplication/EntitySnapshot.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class EntitySnapshotTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static AZStd::shared_ptr<Multiplayer::EntitySnapshot> MakeSnapshot(uint32_t hostFrameId, uint8_t value, uint32_t size)
+        {
+            AZStd::vector<uint8_t> data(size, value);
+            return AZStd::make_shared<Multiplayer::EntitySnapshot>(Multiplayer::HostFrameId{ hostFrameId }, data.data(), size);
+        }
+
+        static uint32_t WriteUpdate(AzNetworking::PacketEncodingBuffer& buffer, Multiplayer::EntitySnapshot& snapshot, Multiplayer::EntitySnapshot* baseline)
+        {
+            AzNetworking::NetworkInputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+            EXPECT_TRUE(Multiplayer::EntitySnapshot::WriteUpdate(serializer, snapshot, baseline));
+            buffer.Resize(serializer.GetSize());
+            return serializer.GetSize();
+        }
+
+        static AZStd::shared_ptr<Multiplayer::EntitySnapshot> ReadUpdate(AzNetworking::PacketEncodingBuffer& buffer, const Multiplayer::EntitySnapshotHistory& history)
+        {
+            AzNetworking::NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+            return Multiplayer::EntitySnapshot::ReadUpdate(serializer, history);
+        }
+
+        static bool HasSameContents(const Multiplayer::EntitySnapshot& lhs, const Multiplayer::EntitySnapshot& rhs)
+        {
+            return (lhs.GetByteSize() == rhs.GetByteSize()) && (memcmp(lhs.GetBuffer(), rhs.GetBuffer(), lhs.GetByteSize()) == 0);
+        }
+    };
+
+    TEST_F(EntitySnapshotTests, FullUpdateRoundTrip)
+    {
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> snapshot = MakeSnapshot(1, 0x5A, 37);
+        Multiplayer::EntitySnapshotHistory history;
+
+        AzNetworking::PacketEncodingBuffer buffer;
+        WriteUpdate(buffer, *snapshot, nullptr);
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> result = ReadUpdate(buffer, history);
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(result->GetHostFrameId(), Multiplayer::HostFrameId{ 1 });
+        EXPECT_TRUE(HasSameContents(*result, *snapshot));
+    }
+
+    TEST_F(EntitySnapshotTests, DeltaUpdateRoundTrip)
+    {
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> baseline = MakeSnapshot(1, 0x11, 400);
+        AZStd::vector<uint8_t> data(baseline->GetBuffer(), baseline->GetBuffer() + baseline->GetByteSize());
+        data[3] = 0x22;
+        data[250] = 0x33;
+        data.push_back(0x44);
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> snapshot =
+            AZStd::make_shared<Multiplayer::EntitySnapshot>(Multiplayer::HostFrameId{ 2 }, data.data(), static_cast<uint32_t>(data.size()));
+
+        Multiplayer::EntitySnapshotHistory history;
+        history.Store(AZStd::make_shared<Multiplayer::EntitySnapshot>(*baseline));
+
+        AzNetworking::PacketEncodingBuffer fullBuffer;
+        AzNetworking::PacketEncodingBuffer deltaBuffer;
+        const uint32_t fullSize = WriteUpdate(fullBuffer, *snapshot, nullptr);
+        const uint32_t deltaSize = WriteUpdate(deltaBuffer, *snapshot, baseline.get());
+        EXPECT_LT(deltaSize, fullSize);
+
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> result = ReadUpdate(deltaBuffer, history);
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(result->GetHostFrameId(), Multiplayer::HostFrameId{ 2 });
+        EXPECT_TRUE(HasSameContents(*result, *snapshot));
+    }
+
+    TEST_F(EntitySnapshotTests, MissingBaselineFailsToResolve)
+    {
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> baseline = MakeSnapshot(1, 0x11, 64);
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> snapshot = MakeSnapshot(2, 0x12, 64);
+        Multiplayer::EntitySnapshotHistory history;
+
+        AzNetworking::PacketEncodingBuffer buffer;
+        WriteUpdate(buffer, *snapshot, baseline.get());
+        EXPECT_EQ(ReadUpdate(buffer, history), nullptr);
+    }
+
+    TEST_F(EntitySnapshotTests, OversizedSnapshotsAreSentInFull)
+    {
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> baseline = MakeSnapshot(1, 0x11, Multiplayer::EntitySnapshot::MaxDeltaBytes + 1);
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> snapshot = MakeSnapshot(2, 0x11, Multiplayer::EntitySnapshot::MaxDeltaBytes + 1);
+        EXPECT_FALSE(snapshot->CanDeltaEncode(*baseline));
+
+        // The baseline isn't stored, so this only resolves if the update was written in full
+        Multiplayer::EntitySnapshotHistory history;
+        AzNetworking::PacketEncodingBuffer buffer;
+        WriteUpdate(buffer, *snapshot, baseline.get());
+        AZStd::shared_ptr<Multiplayer::EntitySnapshot> result = ReadUpdate(buffer, history);
+        ASSERT_NE(result, nullptr);
+        EXPECT_TRUE(HasSameContents(*result, *snapshot));
+    }
+
+    TEST_F(EntitySnapshotTests, HistoryEvictsOldestSnapshots)
+    {
+        Multiplayer::EntitySnapshotHistory history;
+        for (uint32_t hostFrameId = 1; hostFrameId <= 100; ++hostFrameId)
+        {
+            history.Store(MakeSnapshot(hostFrameId, 0, 4));
+        }
+
+        EXPECT_NE(history.Find(Multiplayer::HostFrameId{ 100 }), nullptr);
+        EXPECT_EQ(history.Find(Multiplayer::HostFrameId{ 1 }), nullptr);
+
+        history.Clear();
+        EXPECT_EQ(history.Find(Multiplayer::HostFrameId{ 100 }), nullptr);
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Session/HostInstanceSupervisor.h>
+#include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class HostInstanceSupervisorTests
+        : public LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_settingsRegistry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+        }
+
+        void TearDown() override
+        {
+            m_settingsRegistry.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_settingsRegistry;
+    };
+
+    TEST_F(HostInstanceSupervisorTests, GetRequestedHostInstanceCount_NotSet_ReturnsOne)
+    {
+        EXPECT_EQ(HostInstanceSupervisor::GetRequestedHostInstanceCount(*m_settingsRegistry), 1);
+    }
+
+    TEST_F(HostInstanceSupervisorTests, GetRequestedHostInstanceCount_Set_ReturnsCount)
+    {
+        m_settingsRegistry->Set(HostInstanceCountKey, AZ::u64{ 4 });
+        EXPECT_EQ(HostInstanceSupervisor::GetRequestedHostInstanceCount(*m_settingsRegistry), 4);
+    }
+
+    TEST_F(HostInstanceSupervisorTests, GetRequestedHostInstanceCount_Zero_ReturnsOne)
+    {
+        m_settingsRegistry->Set(HostInstanceCountKey, AZ::u64{ 0 });
+        EXPECT_EQ(HostInstanceSupervisor::GetRequestedHostInstanceCount(*m_settingsRegistry), 1);
+    }
+
+    TEST_F(HostInstanceSupervisorTests, GetRequestedHostInstanceCount_AboveLimit_ClampedToLimit)
+    {
+        m_settingsRegistry->Set(HostInstanceCountKey, AZ::u64{ 100000 });
+        EXPECT_EQ(HostInstanceSupervisor::GetRequestedHostInstanceCount(*m_settingsRegistry), HostInstanceSupervisor::MaxHostInstanceCount);
+    }
+
+    TEST_F(HostInstanceSupervisorTests, ShouldReplaceHostInstance_ExitedDuringStartup_NotReplaced)
+    {
+        EXPECT_FALSE(HostInstanceSupervisor::ShouldReplaceHostInstance(AZStd::chrono::seconds(1), false));
+        EXPECT_FALSE(HostInstanceSupervisor::ShouldReplaceHostInstance(
+            HostInstanceSupervisor::MinHostInstanceLifetime - AZStd::chrono::milliseconds(1), false));
+    }
+
+    TEST_F(HostInstanceSupervisorTests, ShouldReplaceHostInstance_ExitedAfterStartup_Replaced)
+    {
+        EXPECT_TRUE(HostInstanceSupervisor::ShouldReplaceHostInstance(HostInstanceSupervisor::MinHostInstanceLifetime, false));
+        EXPECT_TRUE(HostInstanceSupervisor::ShouldReplaceHostInstance(AZStd::chrono::minutes(30), false));
+    }
+
+    TEST_F(HostInstanceSupervisorTests, ShouldReplaceHostInstance_TerminateRequested_NotReplaced)
+    {
+        EXPECT_FALSE(HostInstanceSupervisor::ShouldReplaceHostInstance(AZStd::chrono::minutes(30), true));
+    }
+
+    TEST_F(HostInstanceSupervisorTests, GetHostInstancePort_WithinRange_ReturnsOffsetPort)
+    {
+        uint16_t port = 0;
+        EXPECT_TRUE(HostInstanceSupervisor::GetHostInstancePort(33450, 999, 4, 0, port));
+        EXPECT_EQ(port, 33450);
+        EXPECT_TRUE(HostInstanceSupervisor::GetHostInstancePort(33450, 999, 4, 3, port));
+        EXPECT_EQ(port, 33453);
+    }
+
+    TEST_F(HostInstanceSupervisorTests, GetHostInstancePort_ExceedsPortRange_Fails)
+    {
+        uint16_t port = 0;
+        EXPECT_TRUE(HostInstanceSupervisor::GetHostInstancePort(33450, 3, 4, 0, port));
+        EXPECT_FALSE(HostInstanceSupervisor::GetHostInstancePort(33450, 2, 4, 0, port));
+    }
+
+    TEST_F(HostInstanceSupervisorTests, GetHostInstancePort_ExceedsMaxPort_Fails)
+    {
+        uint16_t port = 0;
+        EXPECT_TRUE(HostInstanceSupervisor::GetHostInstancePort(65532, 999, 4, 3, port));
+        EXPECT_EQ(port, 65535);
+        EXPECT_FALSE(HostInstanceSupervisor::GetHostInstancePort(65533, 999, 4, 0, port));
+    }
+}
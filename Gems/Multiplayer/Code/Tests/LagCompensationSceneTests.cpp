@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/LagCompensationScene.h>
+#include <Source/NetworkTime/NetworkTime.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR_EXTERNED(bool, sv_LagCompensationScene);
+}
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class LagCompensationSceneTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static LagCompensationHitVolume MakeSphere(uint64_t netEntityId, uint32_t hitVolumeIndex, const AZ::Vector3& position, float radius)
+        {
+            LagCompensationHitVolume hitVolume;
+            hitVolume.m_worldTransform = AZ::Transform::CreateTranslation(position);
+            hitVolume.m_halfExtents = AZ::Vector3(radius);
+            hitVolume.m_netEntityId = NetEntityId{ netEntityId };
+            hitVolume.m_hitVolumeIndex = hitVolumeIndex;
+            hitVolume.m_shapeType = LagCompensationShapeType::Sphere;
+            return hitVolume;
+        }
+
+        static LagCompensationRayCastRequest MakeRay(const AZ::Vector3& start, const AZ::Vector3& direction, float distance)
+        {
+            LagCompensationRayCastRequest request;
+            request.m_start = start;
+            request.m_direction = direction.GetNormalized();
+            request.m_distance = distance;
+            return request;
+        }
+
+        void RecordFrame(uint32_t hostFrameId, const AZStd::vector<LagCompensationHitVolume>& hitVolumes)
+        {
+            m_scene.BeginFrame(HostFrameId{ hostFrameId });
+            m_scene.AddHitVolumes(hitVolumes.data(), static_cast<uint32_t>(hitVolumes.size()));
+            m_scene.EndFrame();
+        }
+
+        LagCompensationScene m_scene;
+        AZStd::vector<LagCompensationHit> m_hits;
+    };
+
+    TEST_F(LagCompensationSceneTests, RayCastReportsClosestHit)
+    {
+        RecordFrame(1, { MakeSphere(1, 0, AZ::Vector3(0.0f, 10.0f, 0.0f), 1.0f), MakeSphere(2, 0, AZ::Vector3(0.0f, 20.0f, 0.0f), 1.0f) });
+
+        EXPECT_TRUE(m_scene.RayCast(HostFrameId{ 1 }, 1.0f, MakeRay(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f), m_hits));
+        ASSERT_EQ(m_hits.size(), 1);
+        EXPECT_EQ(m_hits[0].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_NEAR(m_hits[0].m_distance, 9.0f, 0.001f);
+        EXPECT_TRUE(m_hits[0].m_position.IsClose(AZ::Vector3(0.0f, 9.0f, 0.0f)));
+
+        // Out of range and missing rays
+        EXPECT_FALSE(m_scene.RayCast(HostFrameId{ 1 }, 1.0f, MakeRay(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 5.0f), m_hits));
+        EXPECT_FALSE(m_scene.RayCast(HostFrameId{ 1 }, 1.0f, MakeRay(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f), m_hits));
+        EXPECT_TRUE(m_hits.empty());
+    }
+
+    TEST_F(LagCompensationSceneTests, RayCastReportsMultipleHitsAndIgnoresShooter)
+    {
+        RecordFrame(1, { MakeSphere(2, 0, AZ::Vector3(0.0f, 20.0f, 0.0f), 1.0f), MakeSphere(1, 0, AZ::Vector3(0.0f, 10.0f, 0.0f), 1.0f),
+            MakeSphere(3, 0, AZ::Vector3(0.0f, 30.0f, 0.0f), 1.0f) });
+
+        LagCompensationRayCastRequest request = MakeRay(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f);
+        request.m_reportMultipleHits = true;
+        request.m_ignoredNetEntityId = NetEntityId{ 2 };
+        EXPECT_TRUE(m_scene.RayCast(HostFrameId{ 1 }, 1.0f, request, m_hits));
+        ASSERT_EQ(m_hits.size(), 2);
+        EXPECT_EQ(m_hits[0].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_EQ(m_hits[1].m_netEntityId, NetEntityId{ 3 });
+    }
+
+    TEST_F(LagCompensationSceneTests, RayCastBoxAndCapsule)
+    {
+        LagCompensationHitVolume box;
+        box.m_worldTransform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(AZ::Constants::QuarterPi), AZ::Vector3(10.0f, 0.0f, 0.0f));
+        box.m_halfExtents = AZ::Vector3(1.0f, 1.0f, 1.0f);
+        box.m_netEntityId = NetEntityId{ 1 };
+        box.m_shapeType = LagCompensationShapeType::Box;
+
+        // Capsule lying along the world x-axis, two units long including its caps
+        LagCompensationHitVolume capsule;
+        capsule.m_worldTransform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationY(AZ::Constants::HalfPi), AZ::Vector3(0.0f, 10.0f, 0.0f));
+        capsule.m_halfExtents = AZ::Vector3(0.5f, 0.5f, 1.0f);
+        capsule.m_netEntityId = NetEntityId{ 2 };
+        capsule.m_shapeType = LagCompensationShapeType::Capsule;
+
+        RecordFrame(1, { box, capsule });
+
+        // The rotated box presents a corner to a ray along the x-axis
+        EXPECT_TRUE(m_scene.RayCast(HostFrameId{ 1 }, 1.0f, MakeRay(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisX(), 100.0f), m_hits));
+        ASSERT_EQ(m_hits.size(), 1);
+        EXPECT_EQ(m_hits[0].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_NEAR(m_hits[0].m_distance, 10.0f - AZ::Sqrt(2.0f), 0.001f);
+
+        // Passes through the box's bounds, but beside the box itself
+        EXPECT_FALSE(m_scene.RayCast(HostFrameId{ 1 }, 1.0f, MakeRay(AZ::Vector3(11.2f, 1.2f, -5.0f), AZ::Vector3::CreateAxisZ(), 100.0f), m_hits));
+
+        // Hits the side of the capsule, then the cap
+        EXPECT_TRUE(m_scene.RayCast(HostFrameId{ 1 }, 1.0f, MakeRay(AZ::Vector3(0.25f, 0.0f, 0.0f), AZ::Vector3::CreateAxisY(), 100.0f), m_hits));
+        ASSERT_EQ(m_hits.size(), 1);
+        EXPECT_EQ(m_hits[0].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_NEAR(m_hits[0].m_distance, 9.5f, 0.001f);
+
+        EXPECT_TRUE(m_scene.RayCast(HostFrameId{ 1 }, 1.0f, MakeRay(AZ::Vector3(-5.0f, 10.0f, 0.0f), AZ::Vector3::CreateAxisX(), 100.0f), m_hits));
+        ASSERT_EQ(m_hits.size(), 1);
+        EXPECT_EQ(m_hits[0].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_NEAR(m_hits[0].m_distance, 4.0f, 0.001f);
+    }
+
+    TEST_F(LagCompensationSceneTests, QueriesPastFrames)
+    {
+        for (uint32_t hostFrameId = 1; hostFrameId <= RewindHistorySize + 10; ++hostFrameId)
+        {
+            RecordFrame(hostFrameId, { MakeSphere(1, 0, AZ::Vector3(static_cast<float>(hostFrameId), 10.0f, 0.0f), 0.25f) });
+        }
+
+        // The oldest frames have been evicted from the ring
+        EXPECT_FALSE(m_scene.HasFrame(HostFrameId{ 10 }));
+        EXPECT_TRUE(m_scene.HasFrame(HostFrameId{ 11 }));
+        EXPECT_TRUE(m_scene.HasFrame(HostFrameId{ RewindHistorySize + 10 }));
+        EXPECT_EQ(m_scene.GetHitVolumeCount(HostFrameId{ 50 }), 1);
+
+        // Each frame holds the volume where it was at that frame only
+        const LagCompensationRayCastRequest request = MakeRay(AZ::Vector3(50.0f, 0.0f, 0.0f), AZ::Vector3::CreateAxisY(), 100.0f);
+        EXPECT_TRUE(m_scene.RayCast(HostFrameId{ 50 }, 1.0f, request, m_hits));
+        EXPECT_FALSE(m_scene.RayCast(HostFrameId{ 52 }, 1.0f, request, m_hits));
+        EXPECT_FALSE(m_scene.RayCast(HostFrameId{ 10 }, 1.0f, MakeRay(AZ::Vector3(10.0f, 0.0f, 0.0f), AZ::Vector3::CreateAxisY(), 100.0f), m_hits));
+
+        // Recording the latest frame again replaces it
+        RecordFrame(RewindHistorySize + 10, {});
+        EXPECT_TRUE(m_scene.HasFrame(HostFrameId{ RewindHistorySize + 10 }));
+        EXPECT_EQ(m_scene.GetHitVolumeCount(HostFrameId{ RewindHistorySize + 10 }), 0);
+
+        // Time moving backwards invalidates all history
+        RecordFrame(5, {});
+        EXPECT_FALSE(m_scene.HasFrame(HostFrameId{ 50 }));
+    }
+
+    TEST_F(LagCompensationSceneTests, BlendsWithPreviousFrame)
+    {
+        RecordFrame(1, { MakeSphere(1, 0, AZ::Vector3(0.0f, 10.0f, 0.0f), 0.5f) });
+        RecordFrame(2, { MakeSphere(1, 0, AZ::Vector3(10.0f, 10.0f, 0.0f), 0.5f) });
+
+        const LagCompensationRayCastRequest request = MakeRay(AZ::Vector3(5.0f, 0.0f, 0.0f), AZ::Vector3::CreateAxisY(), 100.0f);
+        EXPECT_FALSE(m_scene.RayCast(HostFrameId{ 2 }, 1.0f, request, m_hits));
+        EXPECT_TRUE(m_scene.RayCast(HostFrameId{ 2 }, 0.5f, request, m_hits));
+        EXPECT_FALSE(m_scene.RayCast(HostFrameId{ 2 }, 0.0f, request, m_hits));
+        EXPECT_TRUE(m_scene.RayCast(HostFrameId{ 2 }, 0.0f, MakeRay(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisY(), 100.0f), m_hits));
+
+        AZStd::vector<NetEntityId> netEntityIds;
+        m_scene.OverlapAabb(HostFrameId{ 2 }, 0.5f, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(5.0f, 10.0f, 0.0f), AZ::Vector3(1.0f)), netEntityIds);
+        ASSERT_EQ(netEntityIds.size(), 1);
+        EXPECT_EQ(netEntityIds[0], NetEntityId{ 1 });
+        m_scene.OverlapAabb(HostFrameId{ 2 }, 1.0f, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(5.0f, 10.0f, 0.0f), AZ::Vector3(1.0f)), netEntityIds);
+        EXPECT_TRUE(netEntityIds.empty());
+    }
+
+    TEST_F(LagCompensationSceneTests, OverlapReportsUniqueEntities)
+    {
+        RecordFrame(1, { MakeSphere(1, 0, AZ::Vector3(0.0f, 0.0f, 0.0f), 0.5f), MakeSphere(1, 1, AZ::Vector3(0.0f, 0.0f, 1.0f), 0.5f),
+            MakeSphere(2, 0, AZ::Vector3(1.0f, 0.0f, 0.0f), 0.5f), MakeSphere(3, 0, AZ::Vector3(50.0f, 0.0f, 0.0f), 0.5f) });
+
+        AZStd::vector<NetEntityId> netEntityIds;
+        m_scene.OverlapAabb(HostFrameId{ 1 }, 1.0f, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(2.0f)), netEntityIds);
+        ASSERT_EQ(netEntityIds.size(), 2);
+        EXPECT_EQ(netEntityIds[0], NetEntityId{ 1 });
+        EXPECT_EQ(netEntityIds[1], NetEntityId{ 2 });
+    }
+
+    TEST_F(LagCompensationSceneTests, HierarchyMatchesBruteForce)
+    {
+        AZ::SimpleLcgRandom random(1234);
+        AZStd::vector<LagCompensationHitVolume> hitVolumes;
+        for (uint32_t index = 0; index < 500; ++index)
+        {
+            const AZ::Vector3 position(random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 10.0f);
+            hitVolumes.push_back(MakeSphere(index / 4, index % 4, position, 0.25f + random.GetRandomFloat()));
+        }
+        RecordFrame(1, hitVolumes);
+        EXPECT_EQ(m_scene.GetHitVolumeCount(HostFrameId{ 1 }), 500);
+
+        for (uint32_t rayIndex = 0; rayIndex < 100; ++rayIndex)
+        {
+            const AZ::Vector3 start(random.GetRandomFloat() * 200.0f - 100.0f, random.GetRandomFloat() * 200.0f - 100.0f, 5.0f);
+            const AZ::Vector3 direction(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, 0.0f);
+            LagCompensationRayCastRequest request = MakeRay(start, direction, 150.0f);
+            request.m_reportMultipleHits = true;
+            m_scene.RayCast(HostFrameId{ 1 }, 1.0f, request, m_hits);
+
+            // Every sphere the ray passes through must be reported
+            uint32_t expectedHits = 0;
+            for (const LagCompensationHitVolume& hitVolume : hitVolumes)
+            {
+                const AZ::Vector3 toCenter = hitVolume.m_worldTransform.GetTranslation() - start;
+                const float projection = AZ::GetClamp(toCenter.Dot(request.m_direction), 0.0f, request.m_distance);
+                if ((toCenter - request.m_direction * projection).GetLength() < hitVolume.m_halfExtents.GetX())
+                {
+                    ++expectedHits;
+                }
+            }
+            EXPECT_EQ(m_hits.size(), expectedHits);
+            for (AZStd::size_t hitIndex = 1; hitIndex < m_hits.size(); ++hitIndex)
+            {
+                EXPECT_LE(m_hits[hitIndex - 1].m_distance, m_hits[hitIndex].m_distance);
+            }
+        }
+    }
+
+    TEST_F(LagCompensationSceneTests, RecordLagCompensationFrameSignalsEveryRecordHandler)
+    {
+        NetworkTime networkTime;
+        networkTime.ForceSetTime(HostFrameId{ 3 }, AZ::Time::ZeroTimeMs);
+
+        // Each handler stands in for the hit volumes of one entity, recorded whether or not the entity is rendered
+        const LagCompensationHitVolume firstHitVolume = MakeSphere(1, 0, AZ::Vector3(0.0f, 10.0f, 0.0f), 1.0f);
+        const LagCompensationHitVolume secondHitVolume = MakeSphere(2, 0, AZ::Vector3(0.0f, 20.0f, 0.0f), 1.0f);
+        LagCompensationRecordEvent::Handler firstHandler([&firstHitVolume](LagCompensationScene& lagCompensationScene)
+        {
+            lagCompensationScene.AddHitVolumes(&firstHitVolume, 1);
+        });
+        LagCompensationRecordEvent::Handler secondHandler([&secondHitVolume](LagCompensationScene& lagCompensationScene)
+        {
+            lagCompensationScene.AddHitVolumes(&secondHitVolume, 1);
+        });
+        networkTime.AddLagCompensationRecordHandler(firstHandler);
+        networkTime.AddLagCompensationRecordHandler(secondHandler);
+
+        // Nothing is recorded while the lag compensation scene is disabled
+        sv_LagCompensationScene = false;
+        networkTime.RecordLagCompensationFrame();
+        EXPECT_EQ(networkTime.GetLagCompensationScene(), nullptr);
+
+        sv_LagCompensationScene = true;
+        networkTime.RecordLagCompensationFrame();
+        LagCompensationScene* lagCompensationScene = networkTime.GetLagCompensationScene();
+        ASSERT_NE(lagCompensationScene, nullptr);
+        EXPECT_EQ(lagCompensationScene->GetHitVolumeCount(HostFrameId{ 3 }), 2);
+
+        sv_LagCompensationScene = false;
+    }
+}
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <CommonBenchmarkSetup.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Time/ITime.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <MultiplayerSystemComponent.h>
+#include <IMultiplayerConnectionMock.h>
+#include <ConnectionData/ServerToClientConnectionData.h>
+#include <Multiplayer/Components/LocalPredictionPlayerInputComponent.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <Multiplayer/NetworkInput/NetworkInputArray.h>
+#include <Tests/TestMultiplayerComponent.h>
+
+namespace Multiplayer
+{
+    /*
+     * An autonomous player entity with a full client rewind history, used to measure the cost of recording inputs and of
+     * replaying them after a server correction.
+     */
+    class LocalPredictionPlayerInputBenchmark
+        : public benchmark::Fixture
+        , public LeakDetectionBase
+    {
+    public:
+        static constexpr int InputRateMs = 10;
+        static constexpr int MaxRewindHistoryMs = 2000;
+
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void internalSetUp()
+        {
+            AZ::NameDictionary::Create();
+
+            m_componentApplicationRequests = AZStd::make_unique<BenchmarkComponentApplicationRequests>();
+            AZ::Interface<AZ::ComponentApplicationRequests>::Register(m_componentApplicationRequests.get());
+
+            m_console.reset(aznew AZ::Console());
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            m_timeSystem = AZStd::make_unique<::testing::NiceMock<AZ::MockTimeSystem>>();
+            ON_CALL(*m_timeSystem, GetElapsedTimeUs()).WillByDefault([this]() { return AZ::TimeMsToUs(m_mockElapsedTime); });
+            ON_CALL(*m_timeSystem, GetRealElapsedTimeUs()).WillByDefault([this]() { return AZ::TimeMsToUs(m_mockElapsedTime); });
+            ON_CALL(*m_timeSystem, GetElapsedTimeMs()).WillByDefault([this]() { return m_mockElapsedTime; });
+            ON_CALL(*m_timeSystem, GetRealElapsedTimeMs()).WillByDefault([this]() { return m_mockElapsedTime; });
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_behaviorContext = AZStd::make_unique<AZ::BehaviorContext>();
+            m_transformDescriptor.reset(AzFramework::TransformComponent::CreateDescriptor());
+            m_transformDescriptor->Reflect(m_serializeContext.get());
+            m_netBindDescriptor.reset(NetBindComponent::CreateDescriptor());
+            m_netBindDescriptor->Reflect(m_serializeContext.get());
+            m_netTransformDescriptor.reset(NetworkTransformComponent::CreateDescriptor());
+            m_netTransformDescriptor->Reflect(m_serializeContext.get());
+            m_localPredictionDescriptor.reset(LocalPredictionPlayerInputComponent::CreateDescriptor());
+            m_localPredictionDescriptor->Reflect(m_serializeContext.get());
+            m_testMultiplayerComponentDescriptor.reset(MultiplayerTest::TestMultiplayerComponent::CreateDescriptor());
+            m_testMultiplayerComponentDescriptor->Reflect(m_serializeContext.get());
+            m_testInputDriverComponentDescriptor.reset(MultiplayerTest::TestInputDriverComponent::CreateDescriptor());
+            m_testInputDriverComponentDescriptor->Reflect(m_serializeContext.get());
+
+            m_netComponent = new AzNetworking::NetworkingSystemComponent();
+            m_mpComponent = new Multiplayer::MultiplayerSystemComponent();
+            m_mpComponent->Reflect(m_serializeContext.get());
+            m_mpComponent->Reflect(m_behaviorContext.get());
+            m_mpComponent->Activate();
+            m_eventScheduler = new AZ::EventSchedulerSystemComponent();
+            m_eventScheduler->Reflect(m_serializeContext.get());
+            m_eventScheduler->Activate();
+
+            m_console->PerformCommand("cl_InputRateMs", { AZStd::string::format("%d", InputRateMs) });
+            m_console->PerformCommand("cl_MaxRewindHistoryMs", { AZStd::string::format("%d", MaxRewindHistoryMs) });
+            m_console->PerformCommand("cl_EnableDesyncDebugging", { "false" });
+
+            m_playerEntity = AZStd::make_unique<AZ::Entity>(AZ::EntityId(1), "Player");
+            m_playerNetworkEntityTracker = AZStd::make_unique<NetworkEntityTracker>();
+            m_playerEntity->CreateComponent<AzFramework::TransformComponent>();
+            m_playerEntity->CreateComponent<NetworkTransformComponent>();
+            m_playerEntity->CreateComponent<MultiplayerTest::TestMultiplayerComponent>();
+            m_playerEntity->CreateComponent<MultiplayerTest::TestInputDriverComponent>();
+            LocalPredictionPlayerInputComponent* localPredictionComponent = m_playerEntity->CreateComponent<LocalPredictionPlayerInputComponent>();
+            NetBindComponent* netBindComponent = m_playerEntity->CreateComponent<NetBindComponent>();
+            netBindComponent->PreInit(m_playerEntity.get(), PrefabEntityId{ AZ::Name("player"), 1 }, NetEntityId{ 1 }, NetEntityRole::Autonomous);
+            m_playerNetworkEntityTracker->RegisterNetBindComponent(m_playerEntity.get(), netBindComponent);
+            m_playerEntity->Init();
+            m_playerEntity->Activate();
+
+            m_mpComponent->InitializeMultiplayer(MultiplayerAgentType::DedicatedServer);
+
+            m_connection = AZStd::make_unique<::testing::NiceMock<IMultiplayerConnectionMock>>(
+                ConnectionId{ 1 }, IpAddress("127.0.0.1", DefaultServerPort, ProtocolType::Udp), ConnectionRole::Connector);
+            m_connectionUserData = AZStd::make_unique<ServerToClientConnectionData>(m_connection.get(), *m_mpComponent);
+            m_connection->SetUserData(m_connectionUserData.get());
+
+            m_playerEntity->FindComponent<MultiplayerTest::TestMultiplayerComponent>()->m_createInputCallback =
+                [this]([[maybe_unused]] NetEntityId netEntityId, NetworkInput& input, [[maybe_unused]] float deltaTime)
+            {
+                m_lastCreatedInputId = input.GetClientInputId();
+            };
+
+            m_controller = static_cast<LocalPredictionPlayerInputComponentController*>(localPredictionComponent->GetController());
+            m_controller->ForceEnableAutonomousUpdate();
+
+            // Fill the client rewind history
+            CreateInputs(MaxRewindHistoryMs / InputRateMs);
+        }
+
+        void internalTearDown()
+        {
+            m_controller->ForceDisableAutonomousUpdate();
+            m_controller = nullptr;
+            m_playerEntity->Deactivate();
+            m_playerNetworkEntityTracker.reset();
+            m_connection->SetUserData(nullptr);
+            m_connectionUserData.reset();
+            m_connection.reset();
+            m_mpComponent->Deactivate();
+            m_eventScheduler->Deactivate();
+            m_playerEntity.reset();
+            delete m_mpComponent;
+            delete m_netComponent;
+            delete m_eventScheduler;
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+            m_timeSystem.reset();
+            AZ::Interface<AZ::ComponentApplicationRequests>::Unregister(m_componentApplicationRequests.get());
+            m_componentApplicationRequests.reset();
+            AZ::NameDictionary::Destroy();
+
+            m_testInputDriverComponentDescriptor.reset();
+            m_testMultiplayerComponentDescriptor.reset();
+            m_localPredictionDescriptor.reset();
+            m_transformDescriptor.reset();
+            m_netTransformDescriptor.reset();
+            m_netBindDescriptor.reset();
+            m_serializeContext.reset();
+            m_behaviorContext.reset();
+        }
+
+        void CreateInputs(int inputCount)
+        {
+            m_mockElapsedTime += AZ::TimeMs(inputCount * InputRateMs);
+            m_eventScheduler->OnTick(0.0f, AZ::ScriptTimePoint());
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::BehaviorContext> m_behaviorContext;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_transformDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_netBindDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_netTransformDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_localPredictionDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_testMultiplayerComponentDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_testInputDriverComponentDescriptor;
+        AZStd::unique_ptr<AZ::IConsole> m_console;
+        AZStd::unique_ptr<::testing::NiceMock<AZ::MockTimeSystem>> m_timeSystem;
+        AZStd::unique_ptr<BenchmarkComponentApplicationRequests> m_componentApplicationRequests;
+
+        AZ::TimeMs m_mockElapsedTime = AZ::TimeMs(0);
+        ClientInputId m_lastCreatedInputId = ClientInputId(0);
+
+        AzNetworking::NetworkingSystemComponent* m_netComponent = nullptr;
+        Multiplayer::MultiplayerSystemComponent* m_mpComponent = nullptr;
+        AZ::EventSchedulerSystemComponent* m_eventScheduler = nullptr;
+        LocalPredictionPlayerInputComponentController* m_controller = nullptr;
+
+        AZStd::unique_ptr<::testing::NiceMock<IMultiplayerConnectionMock>> m_connection;
+        AZStd::unique_ptr<ServerToClientConnectionData> m_connectionUserData;
+
+        AZStd::unique_ptr<AZ::Entity> m_playerEntity;
+        AZStd::unique_ptr<NetworkEntityTracker> m_playerNetworkEntityTracker;
+    };
+
+    // Cost of creating, processing and recording a single input once the rewind history is full
+    BENCHMARK_DEFINE_F(LocalPredictionPlayerInputBenchmark, RecordInput)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto value : state)
+        {
+            CreateInputs(1);
+        }
+    }
+
+    BENCHMARK_REGISTER_F(LocalPredictionPlayerInputBenchmark, RecordInput)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    // Cost of applying a server correction and replaying the given number of inputs recorded after the corrected one
+    BENCHMARK_DEFINE_F(LocalPredictionPlayerInputBenchmark, CorrectionReplay)(benchmark::State& state)
+    {
+        const ClientInputId replayCount = ClientInputId(aznumeric_cast<uint16_t>(state.range(0)));
+        AzNetworking::PacketEncodingBuffer correction;
+
+        for ([[maybe_unused]] auto value : state)
+        {
+            // Corrections for inputs that were already corrected are discarded, so advance the client by one input each iteration
+            state.PauseTiming();
+            CreateInputs(1);
+            state.ResumeTiming();
+
+            m_controller->HandleSendClientInputCorrection(m_connection.get(), HostFrameId(0), m_lastCreatedInputId - replayCount, correction);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(LocalPredictionPlayerInputBenchmark, CorrectionReplay)
+        ->Arg(8)
+        ->Arg(32)
+        ->Arg(128)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    // Cost and size of serializing the redundant inputs sent to the server with every new input
+    BENCHMARK_DEFINE_F(LocalPredictionPlayerInputBenchmark, SerializeInputArray)(benchmark::State& state)
+    {
+        m_console->PerformCommand("net_useInputDeltaSerialization", { state.range(0) ? "true" : "false" });
+
+        const ConstNetworkEntityHandle handle(m_playerEntity.get(), m_playerNetworkEntityTracker.get());
+        NetworkInputArray inputArray(handle);
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            inputArray[i].SetClientInputId(ClientInputId(aznumeric_cast<uint16_t>(1000 - i)));
+            inputArray[i].SetHostFrameId(HostFrameId(5000 - i / 2));
+            inputArray[i].SetHostTimeMs(AZ::TimeMs(100000 - i * InputRateMs));
+            inputArray[i].SetHostBlendFactor(0.5f);
+        }
+
+        AZStd::array<uint8_t, 2048> buffer;
+        uint32_t serializedSize = 0;
+        for ([[maybe_unused]] auto value : state)
+        {
+            AzNetworking::NetworkInputSerializer serializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            inputArray.Serialize(serializer);
+            serializedSize = serializer.GetSize();
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        state.counters["Bytes"] = static_cast<double>(serializedSize);
+    }
+
+    BENCHMARK_REGISTER_F(LocalPredictionPlayerInputBenchmark, SerializeInputArray)
+        ->ArgName("Delta")
+        ->Arg(0)
+        ->Arg(1)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+}
+
+#endif
@@ -127,6 +127,8 @@ namespace UnitTest
         MOCK_METHOD4(AlterTime, void (Multiplayer::HostFrameId, AZ::TimeMs, float, AzNetworking::ConnectionId));
         MOCK_METHOD1(SyncEntitiesToRewindState, void(const AZ::Aabb&));
         MOCK_METHOD0(ClearRewoundEntities, void());
+        MOCK_METHOD0(GetLagCompensationScene, Multiplayer::LagCompensationScene*());
+        MOCK_METHOD1(AddLagCompensationRecordHandler, void(Multiplayer::LagCompensationRecordEvent::Handler&));
     };
 
     class MockComponentApplicationRequests : public AZ::ComponentApplicationRequests
@@ -18,12 +18,15 @@
 #include <AzCore/Name/Name.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/StringifySerializer.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzTest/AzTest.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/EntitySnapshot.h>
 #include <Multiplayer/NetworkInput/NetworkInput.h>
 #include <Multiplayer/NetworkInput/NetworkInputArray.h>
 #include <Multiplayer/NetworkInput/NetworkInputHistory.h>
@@ -31,6 +34,8 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR_EXTERNED(bool, net_ShareEntitySerialization);
+
     class MultiplayerNetworkEntityTests : public NetworkEntityTests
     {
     public:
@@ -663,4 +668,213 @@ namespace Multiplayer
         EXPECT_FALSE(netBindComponent->ValidatePropertyWrite("TestProperty", NetEntityRole::Authority, NetEntityRole::Client, notPredictable));
         EXPECT_FALSE(netBindComponent->ValidatePropertyWrite("TestProperty", NetEntityRole::Autonomous, NetEntityRole::Authority, notPredictable));
     }
+
+    TEST_F(MultiplayerNetworkEntityTests, EntityReplicatorStaleSnapshotIsNotStored)
+    {
+        // Create a proxy entity with a replicator subscribing to the authority
+        EntityInfo proxy(2, "proxy", NetEntityId{ 2 }, EntityInfo::Role::None);
+        PopulateNetworkEntity(proxy);
+        SetupEntity(proxy.m_entity, proxy.m_netId, NetEntityRole::Client);
+
+        const NetworkEntityHandle proxyHandle(proxy.m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        proxy.m_replicator = AZStd::make_unique<EntityReplicator>(
+            *m_entityReplicationManager, m_mockConnection.get(), NetEntityRole::Authority, proxyHandle);
+        proxy.m_replicator->Initialize(proxyHandle);
+        proxy.m_replicator->ActivateNetworkEntity();
+
+        NetBindComponent* netBindComponent = m_root->m_entity->FindComponent<NetBindComponent>();
+        AZStd::shared_ptr<EntitySnapshot> firstSnapshot = EntitySnapshot::Create(HostFrameId{ 1 }, *netBindComponent);
+        AZStd::shared_ptr<EntitySnapshot> staleSnapshot = EntitySnapshot::Create(HostFrameId{ 2 }, *netBindComponent);
+        AZStd::shared_ptr<EntitySnapshot> latestSnapshot = EntitySnapshot::Create(HostFrameId{ 3 }, *netBindComponent);
+        ASSERT_NE(firstSnapshot, nullptr);
+        ASSERT_NE(staleSnapshot, nullptr);
+        ASSERT_NE(latestSnapshot, nullptr);
+
+        auto writeUpdate = [](EntitySnapshot& snapshot, EntitySnapshot* baseline)
+        {
+            AzNetworking::PacketEncodingBuffer updateData;
+            InputSerializer inputSerializer(updateData.GetBuffer(), static_cast<uint32_t>(updateData.GetCapacity()));
+            EXPECT_TRUE(EntitySnapshot::WriteUpdate(inputSerializer, snapshot, baseline));
+            updateData.Resize(inputSerializer.GetSize());
+            return updateData;
+        };
+
+        // Receive the first snapshot and apply it, the same way the replication manager does
+        AzNetworking::PacketEncodingBuffer stateData;
+        EXPECT_TRUE(proxy.m_replicator->ResolveSnapshotUpdate(AzNetworking::PacketId{ 10 }, writeUpdate(*firstSnapshot, nullptr), stateData));
+        OutputSerializer outputSerializer(stateData.GetBuffer(), static_cast<uint32_t>(stateData.GetSize()));
+        EXPECT_TRUE(proxy.m_replicator->HandlePropertyChangeMessage(AzNetworking::PacketId{ 10 }, &outputSerializer, false));
+
+        // A snapshot arriving out of order is rejected
+        EXPECT_FALSE(proxy.m_replicator->ResolveSnapshotUpdate(AzNetworking::PacketId{ 5 }, writeUpdate(*staleSnapshot, nullptr), stateData));
+
+        // The rejected snapshot was not retained as a baseline, while the accepted one was
+        EXPECT_FALSE(proxy.m_replicator->ResolveSnapshotUpdate(
+            AzNetworking::PacketId{ 11 }, writeUpdate(*latestSnapshot, staleSnapshot.get()), stateData));
+        EXPECT_TRUE(proxy.m_replicator->ResolveSnapshotUpdate(
+            AzNetworking::PacketId{ 12 }, writeUpdate(*latestSnapshot, firstSnapshot.get()), stateData));
+    }
+
+    //! Replication window holding a fixed set of entities that records the entity update packets it is asked to send.
+    class RecordingReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+        explicit RecordingReplicationWindow(const ConstNetworkEntityHandle& entityHandle)
+        {
+            EntityReplicationData& replicationData = m_replicationSet[entityHandle];
+            replicationData.m_netEntityRole = NetEntityRole::Client;
+            replicationData.m_priority = 1.0f;
+        }
+
+        bool ReplicationSetUpdateReady() override
+        {
+            return true;
+        }
+
+        const ReplicationSet& GetReplicationSet() const override
+        {
+            return m_replicationSet;
+        }
+
+        uint32_t GetMaxProxyEntityReplicatorSendCount() const override
+        {
+            return AZStd::numeric_limits<uint32_t>::max();
+        }
+
+        bool IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const override
+        {
+            auto iter = m_replicationSet.find(entityHandle);
+            if (iter != m_replicationSet.end())
+            {
+                outNetworkRole = iter->second.m_netEntityRole;
+                return true;
+            }
+            return false;
+        }
+
+        bool AddEntity(AZ::Entity*) override
+        {
+            return false;
+        }
+
+        void RemoveEntity(AZ::Entity*) override
+        {
+        }
+
+        void UpdateWindow() override
+        {
+        }
+
+        AzNetworking::PacketId SendEntityUpdateMessages(NetworkEntityUpdateVector& entityUpdateVector) override
+        {
+            AzNetworking::PacketEncodingBuffer packetData;
+            AzNetworking::NetworkInputSerializer serializer(packetData.GetBuffer(), static_cast<uint32_t>(packetData.GetCapacity()));
+            for (NetworkEntityUpdateMessage& updateMessage : entityUpdateVector)
+            {
+                updateMessage.Serialize(serializer);
+            }
+            EXPECT_TRUE(serializer.IsValid());
+            m_sentPackets.emplace_back(packetData.GetBuffer(), packetData.GetBuffer() + serializer.GetSize());
+            return AzNetworking::PacketId{ static_cast<uint32_t>(m_sentPackets.size()) };
+        }
+
+        void SendEntityRpcs(NetworkEntityRpcVector&, bool) override
+        {
+        }
+
+        void SendEntityResets(const NetEntityIdSet&) override
+        {
+        }
+
+        void DebugDraw() const override
+        {
+        }
+
+        ReplicationSet m_replicationSet;
+        AZStd::vector<AZStd::vector<uint8_t>> m_sentPackets;
+    };
+
+    TEST_F(MultiplayerNetworkEntityTests, ParallelReplicationPrepareMatchesSerialUpdates)
+    {
+        constexpr uint32_t ConnectionCount = 4;
+        net_ShareEntitySerialization = true;
+
+        struct ClientConnection
+        {
+            AZStd::unique_ptr<NiceMock<IMultiplayerConnectionMock>> m_connection;
+            AZStd::unique_ptr<EntityReplicationManager> m_replicationManager;
+            RecordingReplicationWindow* m_replicationWindow = nullptr;
+        };
+
+        // Two identical sets of clients that all have the root entity in their replication window
+        const ConstNetworkEntityHandle rootHandle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        uint32_t nextConnectionId = 2;
+        auto createConnections = [this, &rootHandle, &nextConnectionId]()
+        {
+            AZStd::vector<ClientConnection> connections(ConnectionCount);
+            for (ClientConnection& client : connections)
+            {
+                const IpAddress address("localhost", 1, ProtocolType::Udp);
+                client.m_connection = AZStd::make_unique<NiceMock<IMultiplayerConnectionMock>>(
+                    ConnectionId{ nextConnectionId++ }, address, ConnectionRole::Acceptor);
+                ON_CALL(*client.m_connection, WasPacketAcked).WillByDefault(::testing::Return(true));
+                client.m_replicationManager = AZStd::make_unique<EntityReplicationManager>(
+                    *client.m_connection, *m_mockConnectionListener, EntityReplicationManager::Mode::LocalServerToRemoteClient);
+
+                auto replicationWindow = AZStd::make_unique<RecordingReplicationWindow>(rootHandle);
+                client.m_replicationWindow = replicationWindow.get();
+                client.m_replicationManager->SetReplicationWindow(AZStd::move(replicationWindow));
+            }
+            return connections;
+        };
+        AZStd::vector<ClientConnection> serialConnections = createConnections();
+        AZStd::vector<ClientConnection> parallelConnections = createConnections();
+
+        auto sendUpdates = [&serialConnections, &parallelConnections]()
+        {
+            for (ClientConnection& client : serialConnections)
+            {
+                client.m_replicationManager->SendUpdates();
+            }
+
+            // Prepare on worker threads and send from this thread, the same way sv_parallelReplicationPrepare does
+            AZStd::vector<AZStd::thread> prepareThreads;
+            for (ClientConnection& client : parallelConnections)
+            {
+                EntityReplicationManager* replicationManager = client.m_replicationManager.get();
+                prepareThreads.emplace_back([replicationManager]()
+                {
+                    replicationManager->PrepareUpdates();
+                });
+            }
+            for (AZStd::thread& prepareThread : prepareThreads)
+            {
+                prepareThread.join();
+            }
+            for (ClientConnection& client : parallelConnections)
+            {
+                client.m_replicationManager->SendPreparedUpdates();
+            }
+        };
+
+        // First host frame sends the entity creates, the second one sends a property change
+        ON_CALL(*m_mockNetworkTime, GetHostFrameId()).WillByDefault(::testing::Return(HostFrameId{ 1 }));
+        sendUpdates();
+
+        ON_CALL(*m_mockNetworkTime, GetHostFrameId()).WillByDefault(::testing::Return(HostFrameId{ 2 }));
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(1.0f, 2.0f, 3.0f));
+        m_networkEntityManager->NotifyEntitiesDirtied();
+        sendUpdates();
+
+        for (uint32_t index = 0; index < ConnectionCount; ++index)
+        {
+            const AZStd::vector<AZStd::vector<uint8_t>>& serialPackets = serialConnections[index].m_replicationWindow->m_sentPackets;
+            const AZStd::vector<AZStd::vector<uint8_t>>& parallelPackets = parallelConnections[index].m_replicationWindow->m_sentPackets;
+            EXPECT_EQ(serialPackets.size(), 2u);
+            EXPECT_EQ(serialPackets, parallelPackets);
+        }
+
+        net_ShareEntitySerialization = false;
+    }
 } // namespace Multiplayer
@@ -167,6 +167,102 @@ namespace Multiplayer
         EXPECT_EQ(inHistory.Size(), 0);
     }
 
+    TEST_F(NetworkInputTests, NetworkInputArrayDeltaSerialization)
+    {
+        const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
+        NetworkInputArray inArray = NetworkInputArray(handle);
+
+        // Redundant inputs sent in a single array are consecutive, most of their serialized bytes match the preceding input
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            inArray[i].SetClientInputId(ClientInputId(1000 - i));
+            inArray[i].SetHostFrameId(HostFrameId(5000 - i / 2));
+            inArray[i].SetHostBlendFactor(0.5f);
+            inArray[i].SetHostTimeMs(AZ::TimeMs(100000));
+        }
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inArray.Serialize(inSerializer));
+        const uint32_t deltaSize = inSerializer.GetSize();
+
+        NetworkInputArray outArray;
+        AzNetworking::NetworkOutputSerializer outSerializer(buffer.data(), deltaSize);
+        EXPECT_TRUE(outArray.Serialize(outSerializer));
+        EXPECT_EQ(outSerializer.GetSize(), deltaSize);
+
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            EXPECT_EQ(inArray[i].GetClientInputId(), outArray[i].GetClientInputId());
+            EXPECT_EQ(inArray[i].GetHostFrameId(), outArray[i].GetHostFrameId());
+            EXPECT_EQ(inArray[i].GetHostBlendFactor(), outArray[i].GetHostBlendFactor());
+            EXPECT_EQ(inArray[i].GetHostTimeMs(), outArray[i].GetHostTimeMs());
+        }
+
+        m_console->PerformCommand("net_useInputDeltaSerialization false");
+        AzNetworking::NetworkInputSerializer fullSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(inArray.Serialize(fullSerializer));
+        EXPECT_LT(deltaSize, fullSerializer.GetSize());
+    }
+
+    TEST_F(NetworkInputTests, NetworkInputHistoryRecyclesSlots)
+    {
+        const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
+        NetworkInputArray inArray = NetworkInputArray(handle);
+        NetworkInputHistory inHistory = NetworkInputHistory(4);
+        EXPECT_EQ(inHistory.GetCapacity(), 4);
+
+        // Keep at most three inputs so the ring wraps several times without growing
+        for (uint32_t i = 0; i < 10; ++i)
+        {
+            inArray[0].SetClientInputId(ClientInputId(i));
+            inHistory.PushBack(inArray[0]);
+            while (inHistory.Size() > 3)
+            {
+                inHistory.PopFront();
+            }
+            EXPECT_EQ(inHistory.Back().GetClientInputId(), ClientInputId(i));
+        }
+
+        EXPECT_EQ(inHistory.GetCapacity(), 4);
+        ASSERT_EQ(inHistory.Size(), 3);
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            EXPECT_EQ(inHistory[i].GetClientInputId(), ClientInputId(7 + i));
+            EXPECT_EQ("root", inHistory[i].GetOwnerName());
+        }
+
+        inHistory.Clear();
+        EXPECT_EQ(inHistory.Size(), 0);
+        EXPECT_EQ(inHistory.GetCapacity(), 4);
+    }
+
+    TEST_F(NetworkInputTests, NetworkInputHistoryGrowsWhenFull)
+    {
+        const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
+        NetworkInputArray inArray = NetworkInputArray(handle);
+        NetworkInputHistory inHistory = NetworkInputHistory(4);
+
+        // Offset the head so growing has to unwrap the ring
+        inHistory.PushBack(inArray[0]);
+        inHistory.PushBack(inArray[0]);
+        inHistory.PopFront();
+        inHistory.PopFront();
+
+        for (uint32_t i = 0; i < 20; ++i)
+        {
+            inArray[0].SetClientInputId(ClientInputId(i));
+            inHistory.PushBack(inArray[0]);
+        }
+
+        EXPECT_GE(inHistory.GetCapacity(), 20);
+        ASSERT_EQ(inHistory.Size(), 20);
+        for (uint32_t i = 0; i < 20; ++i)
+        {
+            EXPECT_EQ(inHistory[i].GetClientInputId(), ClientInputId(i));
+        }
+    }
+
     TEST_F(NetworkInputTests, ConstNetworkInputHistory)
     {
         const NetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityTracker.get());
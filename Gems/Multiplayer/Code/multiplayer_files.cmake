@@ -46,9 +46,12 @@ set(FILES
     Include/Multiplayer/MultiplayerTypes.h
     Include/Multiplayer/NetworkEntity/IFilterEntityManager.h
     Include/Multiplayer/NetworkEntity/INetworkEntityManager.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/EntitySerializationCache.h
+    Include/Multiplayer/NetworkEntity/EntityReplication/EntitySnapshot.h
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
+    Include/Multiplayer/NetworkTime/LagCompensationScene.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
     Include/Multiplayer/NetworkTime/RewindableArray.inl
     Include/Multiplayer/NetworkTime/RewindableFixedVector.h
@@ -82,6 +85,8 @@ set(FILES
     Source/NetworkEntity/NetworkEntityTracker.h
     Source/NetworkEntity/NetworkEntityTracker.inl
     Source/NetworkEntity/NetworkEntityUpdateMessage.cpp
+    Source/NetworkEntity/EntityReplication/EntitySerializationCache.cpp
+    Source/NetworkEntity/EntityReplication/EntitySnapshot.cpp
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
     Source/NetworkInput/NetworkInput.cpp
     Source/NetworkInput/NetworkInputArray.cpp
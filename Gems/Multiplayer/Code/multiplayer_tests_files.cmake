@@ -18,10 +18,15 @@ set(FILES
     Tests/CommonHierarchySetup.h
     Tests/CommonNetworkEntitySetup.h
     Tests/CommonBenchmarkSetup.h
+    Tests/EntitySerializationCacheTests.cpp
+    Tests/EntitySnapshotTests.cpp
+    Tests/HostInstanceSupervisorTests.cpp
     Tests/IMultiplayerConnectionMock.h
+    Tests/LagCompensationSceneTests.cpp
     Tests/IMultiplayerSpawnerMock.h
     Tests/Main.cpp
     Tests/MockInterfaces.h
+    Tests/LocalPredictionPlayerInputBenchmarks.cpp
     Tests/LocalPredictionPlayerInputTests.cpp
     Tests/MultiplayerComponentTests.cpp
     Tests/MultiplayerSystemTests.cpp
@@ -32,12 +32,17 @@ namespace PhysX
         "Max size of a heightfield collider update region in heightfield points, used for partitioning updates for faster cancellation. "
         "Each update will be the largest number of heightfield rows that stays below this total point count threshold.");
 
+    AZ_CVAR(bool, physx_heightfieldColliderQueueRegionUpdates, true, nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "When enabled, height and surface data changes that arrive while a heightfield collider update is running are queued and "
+        "processed once the running update finishes, instead of canceling the update and blocking the caller on its completion.");
+
     // The HeightfieldUpdateJobContext is an extremely simplified way to manage the background update jobs.
     // On any heightfield change, the collider code will cancel any update job that's currently running, wait for it
     // to complete, and then start a new update job.
     // Also, on HeightfieldCollider destruction, any running jobs will get canceled and block on completion.
-    // Eventually, this could get migrated to a more complex system that allows for overlapping jobs, or potentially using a queue
-    // of regions to update in a currently-running job.
+    // Data-only changes that arrive while an update job is running don't cancel it, they get queued as a pending region that the
+    // running job chain picks up when it finishes (see physx_heightfieldColliderQueueRegionUpdates).
     void HeightfieldCollider::HeightfieldUpdateJobContext::Cancel()
     {
         m_isCanceled = true;
@@ -92,6 +97,11 @@ namespace PhysX
         m_maxColumnVertex = AZStd::numeric_limits<size_t>::lowest();
     }
 
+    bool HeightfieldCollider::DirtyHeightfieldRegion::IsNull() const
+    {
+        return (m_minRowVertex >= m_maxRowVertex) || (m_minColumnVertex >= m_maxColumnVertex);
+    }
+
     void HeightfieldCollider::DirtyHeightfieldRegion::AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId)
     {
         size_t startRowVertex = 0;
@@ -115,6 +125,19 @@ namespace PhysX
         m_maxColumnVertex = AZStd::max(m_maxColumnVertex, startColumnVertex + numColumnVertices);
     }
 
+    void HeightfieldCollider::DirtyHeightfieldRegion::AddRegion(const DirtyHeightfieldRegion& dirtyRegion)
+    {
+        if (dirtyRegion.IsNull())
+        {
+            return;
+        }
+
+        m_minRowVertex = AZStd::min(m_minRowVertex, dirtyRegion.m_minRowVertex);
+        m_minColumnVertex = AZStd::min(m_minColumnVertex, dirtyRegion.m_minColumnVertex);
+        m_maxRowVertex = AZStd::max(m_maxRowVertex, dirtyRegion.m_maxRowVertex);
+        m_maxColumnVertex = AZStd::max(m_maxColumnVertex, dirtyRegion.m_maxColumnVertex);
+    }
+
 
 
     HeightfieldCollider::HeightfieldCollider(
@@ -304,12 +327,35 @@ namespace PhysX
         }
     }
 
-    void HeightfieldCollider::RefreshComplete()
+    void HeightfieldCollider::RefreshComplete(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape)
     {
         // This method is called by an update job to signal that the chain of update jobs have completed.
 
+        const bool isCanceled = m_jobContext->IsCanceled();
+
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_pendingDirtyRegionMutex);
+
+            // If more data changed while the jobs were running, continue the refresh with the pending region instead of completing.
+            // The refresh stays in progress, so anything blocking on completion keeps waiting for the new jobs as well.
+            // If the refresh gets canceled, the pending region stays queued and gets picked up by the next refresh.
+            if (!isCanceled && !m_pendingDirtyRegion.IsNull())
+            {
+                m_dirtyRegion = m_pendingDirtyRegion;
+                m_pendingDirtyRegion.SetNull();
+
+                if (ClampDirtyRegion())
+                {
+                    StartRefreshJobs(scene, shape);
+                    return;
+                }
+            }
+
+            m_refreshJobsRunning = false;
+        }
+
         // If the job hasn't been canceled, notify any listeners that the collider has changed.
-        if (!m_jobContext->IsCanceled())
+        if (!isCanceled)
         {
             m_dirtyRegion.SetNull();
             Physics::ColliderComponentEventBus::Event(m_entityId, &Physics::ColliderComponentEvents::OnColliderChanged);
@@ -374,10 +420,10 @@ namespace PhysX
         // There are two refresh possibilities - resizing the area or updating the data.
         // Resize: we need to cancel any running jobs, wait for them to finish, resize the area, and kick them off again.
         //   PhysX heightfields need to have a static number of points, so a resize requires a complete rebuild of the heightfield.
-        // Update: technically, we could get more clever with updates, and potentially keep the same job chain running with a running list
-        //   of update regions. But for now, we're keeping it simple. Our update job will update in multiples of heightfield rows so
-        //   that we can incrementally shrink the update region as we finish updating pieces of it and cancel at a more granular level.
-        //   On a new update, we can then cancel the job, grow our update region as needed, and start the job chain back up again.
+        // Update: our update job will update in multiples of heightfield rows so that we can incrementally shrink the update region
+        //   as we finish updating pieces of it and cancel at a more granular level. If an update job is already running, the new
+        //   region is queued and the running job chain continues with it once it finishes the current region. Otherwise (or if
+        //   queueing is disabled), we cancel the job, grow our update region as needed, and start the job chain back up again.
 
         // If we don't have a shape configuration yet, or if the configuration itself changed, we need to recreate the entire heightfield.
         bool shouldRecreateHeightfield = (m_shapeConfig == nullptr) ||
@@ -394,10 +440,29 @@ namespace PhysX
             shouldRecreateHeightfield = shouldRecreateHeightfield || (baseConfiguration.GetMaxHeightBounds() != m_shapeConfig->GetMaxHeightBounds());
         }
 
+        // If only the data changed and the update job is running, queue the region for the running job instead of canceling it.
+        // Canceling would block this thread until the job reaches a cancellation point, and would restart the whole dirty region.
+        if (!shouldRecreateHeightfield && physx_heightfieldColliderQueueRegionUpdates)
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_pendingDirtyRegionMutex);
+            if (m_refreshJobsRunning)
+            {
+                m_pendingDirtyRegion.AddAabb(requestRegion, m_entityId);
+                return;
+            }
+        }
+
         // If the update job is running, stop it and wait for it to complete.
         m_jobContext->Cancel();
         m_jobContext->BlockUntilComplete();
 
+        // Any regions that were queued for a canceled job still need to be refreshed.
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_pendingDirtyRegionMutex);
+            m_dirtyRegion.AddRegion(m_pendingDirtyRegion);
+            m_pendingDirtyRegion.SetNull();
+        }
+
         // If our heightfield has changed size, recreate the configuration and initialize it.
         if (shouldRecreateHeightfield)
         {
@@ -437,17 +502,8 @@ namespace PhysX
         AZ_Assert(m_dirtyRegion.m_maxColumnVertex >= m_dirtyRegion.m_minColumnVertex,
             "Invalid dirty region (min=%zu max=%zu)", m_dirtyRegion.m_maxColumnVertex, m_dirtyRegion.m_minColumnVertex);
 
-        // If our heightfield size has just shrunk and we had a pre-existing dirty region, the max vertex values could be higher than
-        // our current size, so clamp them to the current size.
-        m_dirtyRegion.m_maxRowVertex = AZStd::min(m_dirtyRegion.m_maxRowVertex, m_shapeConfig->GetNumRowVertices());
-        m_dirtyRegion.m_maxColumnVertex = AZStd::min(m_dirtyRegion.m_maxColumnVertex, m_shapeConfig->GetNumColumnVertices());
-
-        size_t startColumn = m_dirtyRegion.m_minColumnVertex;
-        size_t numColumns = m_dirtyRegion.m_maxColumnVertex - m_dirtyRegion.m_minColumnVertex;
-        size_t numRows = m_dirtyRegion.m_maxRowVertex - m_dirtyRegion.m_minRowVertex;
-
         // If our dirty region is too small to affect any vertices, early-out.
-        if ((numRows == 0) || (numColumns == 0))
+        if (!ClampDirtyRegion())
         {
             return;
         }
@@ -457,6 +513,33 @@ namespace PhysX
 
         auto shape = GetHeightfieldShape();
 
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_pendingDirtyRegionMutex);
+            m_refreshJobsRunning = true;
+        }
+
+        // Track that we're starting our refresh job chain.
+        m_jobContext->OnRefreshStart();
+
+        StartRefreshJobs(scene, shape);
+    }
+
+    bool HeightfieldCollider::ClampDirtyRegion()
+    {
+        // If our heightfield size has just shrunk and we had a pre-existing dirty region, the max vertex values could be higher than
+        // our current size, so clamp them to the current size.
+        m_dirtyRegion.m_maxRowVertex = AZStd::min(m_dirtyRegion.m_maxRowVertex, m_shapeConfig->GetNumRowVertices());
+        m_dirtyRegion.m_maxColumnVertex = AZStd::min(m_dirtyRegion.m_maxColumnVertex, m_shapeConfig->GetNumColumnVertices());
+
+        return !m_dirtyRegion.IsNull();
+    }
+
+    void HeightfieldCollider::StartRefreshJobs(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape)
+    {
+        size_t startColumn = m_dirtyRegion.m_minColumnVertex;
+        size_t numColumns = m_dirtyRegion.m_maxColumnVertex - m_dirtyRegion.m_minColumnVertex;
+        size_t numRows = m_dirtyRegion.m_maxRowVertex - m_dirtyRegion.m_minRowVertex;
+
         // Get the number of rows to update in each job. We subdivide the region into multiple jobs when processing
         // so that cancellation requests can be detected and processed more quickly. If we just processed a single full dirty region,
         // regardless of size, there would be a lot more work that needs to complete before we could cancel a job.
@@ -530,17 +613,16 @@ namespace PhysX
             updatePhysXHeightfieldJobs.emplace_back(updatePhysXHeightfieldJob);
         }
 
+        AZ_Assert(!updateShapeConfigJobs.empty(), "Refresh jobs started for an empty dirty region.");
+
         if (!updateShapeConfigJobs.empty())
         {
             // Set up the final completion job and dependency:
             // UpdatePhysXHeightfieldJob -> RefreshCompleteJob
-            auto* refreshCompleteJob =
-                AZ::CreateJobFunction(AZStd::bind(&HeightfieldCollider::RefreshComplete, this), autoDelete, m_jobContext.get());
+            auto* refreshCompleteJob = AZ::CreateJobFunction(
+                AZStd::bind(&HeightfieldCollider::RefreshComplete, this, scene, shape), autoDelete, m_jobContext.get());
             updatePhysXHeightfieldJobs.back()->SetDependent(refreshCompleteJob);
 
-            // Track that we're starting our refresh job chain.
-            m_jobContext->OnRefreshStart();
-
             // Start all the jobs except the UpdateShapeConfigCompletion jobs.
             // None of the jobs will actually start until all their dependencies are met, this just "primes" them so that they'll start
             // as soon as they can.
@@ -116,7 +116,16 @@ namespace PhysX
             size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
         //! Called once all of the asynchronous update jobs have completed.
-        void RefreshComplete();
+        //! If more regions were queued while the jobs were running, this continues the refresh with a new set of update jobs.
+        void RefreshComplete(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape);
+
+        //! Creates and starts the chain of update jobs that refreshes the current dirty region.
+        //! The dirty region is expected to contain at least one vertex, see ClampDirtyRegion().
+        void StartRefreshJobs(AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape);
+
+        //! Clamps the dirty region to the current heightfield size.
+        //! @return True if the clamped dirty region still contains any vertices to update.
+        bool ClampDirtyRegion();
 
         //! Helper class to manage the spawned physics update jobs.
         class HeightfieldUpdateJobContext : public AZ::JobContext
@@ -183,7 +192,9 @@ namespace PhysX
         {
             DirtyHeightfieldRegion();
             void SetNull();
+            bool IsNull() const;
             void AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId);
+            void AddRegion(const DirtyHeightfieldRegion& dirtyRegion);
 
             size_t m_minRowVertex;      //! the first dirty row vertex
             size_t m_minColumnVertex;   //! the first dirty column vertex
@@ -192,6 +203,13 @@ namespace PhysX
         };
 
         DirtyHeightfieldRegion m_dirtyRegion;
+
+        //! Regions that changed while a refresh was running, and that will be refreshed once the running update jobs finish.
+        DirtyHeightfieldRegion m_pendingDirtyRegion;
+        //! Track whether the update jobs are running and can still pick up pending regions.
+        bool m_refreshJobsRunning = false;
+        //! Mutex to protect the pending region and the running state of the update jobs.
+        AZStd::mutex m_pendingDirtyRegionMutex;
         
         //! Specifies the way of creating Heightfield Collider.
         DataSource m_dataSourceType = DataSource::GenerateNewHeightfield;
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/std/algorithm.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <PhysX/PhysXLocks.h>
+#include <PhysXCharacters/API/CharacterController.h>
+#include <PhysXCharacters/API/CharacterControllerBatch.h>
+#include <Scene/PhysXScene.h>
+
+namespace PhysX
+{
+    CharacterControllerBatch::CharacterControllerBatch(PhysXScene* scene)
+        : m_scene(scene)
+    {
+        AZ_Assert(m_scene, "CharacterControllerBatch requires a valid scene.");
+
+        m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
+            [this]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                ApplyRequestedVelocities(fixedDeltaTime);
+            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
+        m_scene->RegisterSceneSimulationStartHandler(m_sceneSimulationStartHandler);
+
+        m_postSimulateHandler = AzPhysics::SystemEvents::OnPostsimulateEvent::Handler(
+            [this]([[maybe_unused]] float deltaTime)
+            {
+                WriteBackTransforms();
+            });
+        if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
+        {
+            physicsSystem->RegisterPostSimulateEvent(m_postSimulateHandler);
+        }
+    }
+
+    void CharacterControllerBatch::AddController(AzPhysics::SimulatedBodyHandle bodyHandle, AZ::EntityId entityId)
+    {
+        AZ_Assert(bodyHandle != AzPhysics::InvalidSimulatedBodyHandle, "Attempting to batch an invalid character controller.");
+        RemoveController(bodyHandle);
+        m_batchedControllers.push_back({ bodyHandle, entityId });
+    }
+
+    void CharacterControllerBatch::RemoveController(AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        auto it = AZStd::find_if(m_batchedControllers.begin(), m_batchedControllers.end(),
+            [bodyHandle](const BatchedController& batchedController)
+            {
+                return batchedController.m_bodyHandle == bodyHandle;
+            });
+        if (it != m_batchedControllers.end())
+        {
+            // order of the controllers does not matter, swap with the last one to avoid shifting the remaining controllers
+            *it = m_batchedControllers.back();
+            m_batchedControllers.pop_back();
+        }
+    }
+
+    size_t CharacterControllerBatch::GetControllerCount() const
+    {
+        return m_batchedControllers.size();
+    }
+
+    void CharacterControllerBatch::GatherControllers()
+    {
+        m_controllers.clear();
+        m_controllers.reserve(m_batchedControllers.size());
+        for (const BatchedController& batchedController : m_batchedControllers)
+        {
+            m_controllers.push_back(
+                azdynamic_cast<CharacterController*>(m_scene->GetSimulatedBodyFromHandle(batchedController.m_bodyHandle)));
+        }
+    }
+
+    void CharacterControllerBatch::ApplyRequestedVelocities(float deltaTime)
+    {
+        if (m_batchedControllers.empty())
+        {
+            return;
+        }
+
+        GatherControllers();
+
+        // The controllers share the scene's controller manager and write their kinematic actors into the scene as they move,
+        // so moves cannot run concurrently. Acquire the write lock once for the whole batch instead of once per controller.
+        physx::PxScene* pxScene = static_cast<physx::PxScene*>(m_scene->GetNativePointer());
+        PHYSX_SCENE_WRITE_LOCK(pxScene);
+        for (CharacterController* controller : m_controllers)
+        {
+            if (controller)
+            {
+                controller->ApplyRequestedVelocity(deltaTime);
+                controller->ResetRequestedVelocityForPhysicsTimestep();
+            }
+        }
+    }
+
+    void CharacterControllerBatch::WriteBackTransforms()
+    {
+        if (m_batchedControllers.empty())
+        {
+            return;
+        }
+
+        GatherControllers();
+
+        // Copy every entity and position first, updating the transforms moves the controllers again which needs the write lock.
+        // Transform handlers may also add or remove controllers, which would reorder the batch while it is being iterated.
+        m_transformUpdates.clear();
+        m_transformUpdates.reserve(m_controllers.size());
+        {
+            physx::PxScene* pxScene = static_cast<physx::PxScene*>(m_scene->GetNativePointer());
+            PHYSX_SCENE_READ_LOCK(pxScene);
+            for (size_t i = 0; i < m_controllers.size(); ++i)
+            {
+                if (m_controllers[i])
+                {
+                    m_transformUpdates.push_back({ m_batchedControllers[i].m_entityId, m_controllers[i]->GetBasePosition() });
+                }
+            }
+        }
+
+        for (CharacterController* controller : m_controllers)
+        {
+            if (controller)
+            {
+                controller->ResetRequestedVelocityForTick();
+            }
+        }
+
+        for (const TransformUpdate& transformUpdate : m_transformUpdates)
+        {
+            AZ::TransformBus::Event(transformUpdate.m_entityId, &AZ::TransformBus::Events::SetWorldTranslation, transformUpdate.m_position);
+        }
+    }
+} // namespace PhysX
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+
+namespace PhysX
+{
+    class CharacterController;
+    class PhysXScene;
+
+    //! Updates the character controllers of a scene which apply their movement on the physics tick in a single pass.
+    //! Rather than every character handling the scene simulation start and post simulate events on its own, the batch
+    //! gathers all requested velocities and moves every controller while holding the scene write lock once, then writes
+    //! the resulting positions back to the entity transforms in one pass once the simulation has finished.
+    class CharacterControllerBatch
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CharacterControllerBatch, AZ::SystemAllocator);
+
+        explicit CharacterControllerBatch(PhysXScene* scene);
+        ~CharacterControllerBatch() = default;
+
+        //! Adds a character controller to the batch, its requested velocity will be applied on every physics timestep.
+        //! @param bodyHandle The handle of the character controller in the batch's scene.
+        //! @param entityId The entity whose transform will be updated with the position of the controller.
+        void AddController(AzPhysics::SimulatedBodyHandle bodyHandle, AZ::EntityId entityId);
+
+        //! Removes a character controller from the batch.
+        //! @param bodyHandle The handle of the character controller in the batch's scene.
+        void RemoveController(AzPhysics::SimulatedBodyHandle bodyHandle);
+
+        //! Returns the number of character controllers in the batch.
+        size_t GetControllerCount() const;
+
+        //! Moves every controller in the batch by its requested velocity, then clears the velocities requested for the timestep.
+        //! @param deltaTime The physics timestep to move the controllers for.
+        void ApplyRequestedVelocities(float deltaTime);
+
+        //! Clears the velocities requested for the tick of every controller in the batch, then writes their positions to the
+        //! entity transforms. Transform handlers may safely add or remove controllers.
+        void WriteBackTransforms();
+
+    private:
+        //! Resolves the controllers in the batch from their handles, controllers which no longer exist are left null.
+        void GatherControllers();
+
+        struct BatchedController
+        {
+            AzPhysics::SimulatedBodyHandle m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+            AZ::EntityId m_entityId;
+        };
+
+        struct TransformUpdate
+        {
+            AZ::EntityId m_entityId;
+            AZ::Vector3 m_position;
+        };
+
+        PhysXScene* m_scene = nullptr;
+        AZStd::vector<BatchedController> m_batchedControllers;
+        AZStd::vector<CharacterController*> m_controllers; //!< Controllers resolved for the current pass, parallel to m_batchedControllers.
+        AZStd::vector<TransformUpdate> m_transformUpdates; //!< Entity positions copied for the transform write back.
+        AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimulationStartHandler;
+        AzPhysics::SystemEvents::OnPostsimulateEvent::Handler m_postSimulateHandler;
+    };
+} // namespace PhysX
@@ -8,10 +8,12 @@
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <PhysXCharacters/API/CharacterController.h>
+#include <PhysXCharacters/API/CharacterControllerBatch.h>
 #include <PhysXCharacters/Components/CharacterControllerComponent.h>
 #include <PhysX/ColliderComponentBus.h>
 #include <Scene/PhysXScene.h>
@@ -25,6 +27,9 @@
 
 namespace PhysX
 {
+    AZ_CVAR(bool, physx_batchCharacterControllerUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled, character controllers moving on the physics tick are updated by their scene in a single batched pass.");
+
     void CharacterControllerComponent::Reflect(AZ::ReflectContext* context)
     {
         CharacterControllerConfiguration::Reflect(context);
@@ -562,7 +567,15 @@ namespace PhysX
 
         CharacterControllerRequestBus::Handler::BusConnect(GetEntityId());
 
-        if (m_characterConfig->m_applyMoveOnPhysicsTick)
+        auto* physXScene = sceneInterface != nullptr
+            ? azdynamic_cast<PhysXScene*>(sceneInterface->GetScene(m_attachedSceneHandle))
+            : nullptr;
+        if (m_characterConfig->m_applyMoveOnPhysicsTick && physx_batchCharacterControllerUpdates && physXScene != nullptr)
+        {
+            physXScene->GetOrCreateCharacterControllerBatch()->AddController(m_controllerBodyHandle, GetEntityId());
+            m_isBatched = true;
+        }
+        else if (m_characterConfig->m_applyMoveOnPhysicsTick)
         {
             m_sceneSimulationStartHandler = AzPhysics::SceneEvents::OnSceneSimulationStartHandler(
                 [this](
@@ -601,6 +614,19 @@ namespace PhysX
 
     void CharacterControllerComponent::DestroyController()
     {
+        if (m_isBatched)
+        {
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            auto* physXScene = sceneInterface != nullptr
+                ? azdynamic_cast<PhysXScene*>(sceneInterface->GetScene(m_attachedSceneHandle))
+                : nullptr;
+            if (auto* batch = physXScene != nullptr ? physXScene->GetCharacterControllerBatch() : nullptr)
+            {
+                batch->RemoveController(m_controllerBodyHandle);
+            }
+            m_isBatched = false;
+        }
+
         if (auto* controller = GetController())
         {
             Physics::CharacterNotificationBus::Event(
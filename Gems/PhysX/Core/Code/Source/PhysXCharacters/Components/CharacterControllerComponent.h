@@ -155,5 +155,6 @@ namespace PhysX
         AzPhysics::SystemEvents::OnPostsimulateEvent::Handler m_postSimulateHandler;
         AzPhysics::SceneEvents::OnSceneSimulationStartHandler m_sceneSimulationStartHandler;
         AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler m_onSimulatedBodyRemovedHandler;
+        bool m_isBatched = false; //!< Whether the controller is moved by its scene's CharacterControllerBatch.
     };
 } // namespace PhysX
@@ -16,6 +16,7 @@
 #include <PhysX/PhysXLocks.h>
 #include <PhysX/Utils.h>
 #include <PhysXCharacters/API/CharacterController.h>
+#include <PhysXCharacters/API/CharacterControllerBatch.h>
 #include <PhysXCharacters/API/CharacterUtils.h>
 #include <System/PhysXSystem.h>
 #include <PhysX/Joint/Configuration/PhysXJointConfiguration.h>
@@ -25,9 +26,12 @@
 
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/variant.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Task/TaskGraph.h>
@@ -48,6 +52,22 @@ namespace PhysX
     AZ_CVAR(size_t, physx_parallelTransformSyncBatchSize, 250, nullptr, AZ::ConsoleFunctorFlags::Null,
         "How many rigid bodies should be processed per task");
 
+    AZ_CVAR(bool, physx_parallelSceneQueries, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Run batched and asynchronous scene queries on the task graph workers. "
+        "Filter callbacks of these queries must be safe to invoke from any thread.");
+    AZ_CVAR(size_t, physx_parallelSceneQueryBatchSize, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How many scene queries should be processed per task");
+
+    AZ_CVAR(bool, physx_determinismCheck, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Hash the state of every dynamic body at the end of each simulation step and log it per scene. "
+        "Comparing the logs of two runs shows the first step where their simulations diverged.");
+
+    AZ_CVAR(bool, physx_bufferContactEvents, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Record the contacts of each simulation step in a contiguous buffer read through PhysXScene::GetContactEventBuffer, "
+        "instead of signaling a collision event per contact pair to the scene and body handlers. "
+        "This is an opt-in that replaces the collision events: while enabled, OnCollisionBegin/Persist/End handlers "
+        "receive nothing and every collision consumer must read the buffer instead. Trigger events are still signaled.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -59,6 +79,22 @@ namespace PhysX
     /*static*/ thread_local AZStd::vector<physx::PxSweepHit> PhysXScene::s_sweepBuffer;
     /*static*/ thread_local AZStd::vector<physx::PxOverlapHit> PhysXScene::s_overlapBuffer;
 
+    struct PhysXScene::AsyncSceneQuery
+    {
+        AzPhysics::SceneQuery::AsyncRequestId m_requestId = 0;
+        AzPhysics::SceneQueryRequests m_requests;
+        AzPhysics::SceneQueryHitsList m_results;
+        AzPhysics::SceneQuery::AsyncCallback m_callback; //!< Set for a single request.
+        AzPhysics::SceneQuery::AsyncBatchCallback m_batchCallback; //!< Set for a batch of requests.
+        AZ::TaskGraphEvent m_finishEvent{ "PhysX async scene query" };
+        bool m_submitted = false; //!< False if the queries were run immediately, the finish event is never signaled then.
+
+        bool IsComplete()
+        {
+            return !m_submitted || m_finishEvent.IsSignaled();
+        }
+    };
+
     namespace Internal
     {
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
@@ -144,15 +180,42 @@ namespace PhysX
             return nullptr;
         }
 
-        bool AddShape(AZStd::variant<AzPhysics::RigidBody*, AzPhysics::StaticRigidBody*> simulatedBody, const AzPhysics::ShapeVariantData& shapeData)
+        //! Shapes created while adding a batch of simulated bodies, keyed by the configurations they were created from.
+        //! Configurations cannot change during a batch, so bodies sharing configurations can clone the first shape created from them.
+        using ShapePrototypeCache = AZStd::unordered_map<
+            AZStd::pair<const Physics::ColliderConfiguration*, const Physics::ShapeConfiguration*>, AZStd::shared_ptr<Shape>>;
+
+        AZStd::shared_ptr<Shape> CreateShape(const AzPhysics::ShapeColliderPair& shapeColliderPair, ShapePrototypeCache* shapePrototypes)
+        {
+            if (shapePrototypes == nullptr)
+            {
+                return AZStd::make_shared<Shape>(*(shapeColliderPair.first), *(shapeColliderPair.second));
+            }
+
+            const auto key = AZStd::make_pair(shapeColliderPair.first.get(), shapeColliderPair.second.get());
+            if (auto prototype = shapePrototypes->find(key); prototype != shapePrototypes->end())
+            {
+                return Shape::CreateFromPrototype(*prototype->second);
+            }
+
+            auto shapePtr = AZStd::make_shared<Shape>(*(shapeColliderPair.first), *(shapeColliderPair.second));
+            if (shapePtr->GetPxShape())
+            {
+                shapePrototypes->emplace(key, shapePtr);
+            }
+            return shapePtr;
+        }
+
+        bool AddShape(AZStd::variant<AzPhysics::RigidBody*, AzPhysics::StaticRigidBody*> simulatedBody, const AzPhysics::ShapeVariantData& shapeData,
+            ShapePrototypeCache* shapePrototypes)
         {
             if (const auto* shapeColliderPair = AZStd::get_if<AzPhysics::ShapeColliderPair>(&shapeData))
             {
                 bool shapeAdded = false;
-                auto shapePtr = AZStd::make_shared<Shape>(*(shapeColliderPair->first), *(shapeColliderPair->second));
+                auto shapePtr = CreateShape(*shapeColliderPair, shapePrototypes);
                 AZStd::visit([shapePtr, &shapeAdded](auto&& body)
                     {
-                        if (shapePtr->GetPxShape())
+                        if (shapePtr && shapePtr->GetPxShape())
                         {
                             body->AddShape(shapePtr);
                             shapeAdded = true;
@@ -165,10 +228,10 @@ namespace PhysX
                 bool shapeAdded = false;
                 for (const auto& shapeColliderConfigs : *shapeColliderPairList)
                 {
-                    auto shapePtr = AZStd::make_shared<Shape>(*(shapeColliderConfigs.first), *(shapeColliderConfigs.second));
+                    auto shapePtr = CreateShape(shapeColliderConfigs, shapePrototypes);
                     AZStd::visit([shapePtr, &shapeAdded](auto&& body)
                         {
-                            if (shapePtr->GetPxShape())
+                            if (shapePtr && shapePtr->GetPxShape())
                             {
                                 body->AddShape(shapePtr);
                                 shapeAdded = true;
@@ -201,24 +264,24 @@ namespace PhysX
         }
 
         template<class SimulatedBodyType, class ConfigurationType>
-        AzPhysics::SimulatedBody* CreateSimulatedBody(const ConfigurationType* configuration, AZ::Crc32& crc)
+        AzPhysics::SimulatedBody* CreateSimulatedBody(const ConfigurationType* configuration, AZ::Crc32& crc, ShapePrototypeCache* shapePrototypes)
         {
             SimulatedBodyType* newBody = aznew SimulatedBodyType(*configuration);
             if (!AZStd::holds_alternative<AZStd::monostate>(configuration->m_colliderAndShapeData))
             {
-                [[maybe_unused]] const bool shapeAdded = AddShape(newBody, configuration->m_colliderAndShapeData);
+                [[maybe_unused]] const bool shapeAdded = AddShape(newBody, configuration->m_colliderAndShapeData, shapePrototypes);
                 AZ_Warning("PhysXScene", shapeAdded, "No Collider or Shape information found when creating Rigid body [%s]", configuration->m_debugName.c_str());
             }
             crc = AZ::Crc32(newBody, sizeof(*newBody));
             return newBody;
         }
 
-        AzPhysics::SimulatedBody* CreateRigidBody(const AzPhysics::RigidBodyConfiguration* configuration, AZ::Crc32& crc)
+        AzPhysics::SimulatedBody* CreateRigidBody(const AzPhysics::RigidBodyConfiguration* configuration, AZ::Crc32& crc, ShapePrototypeCache* shapePrototypes)
         {
             RigidBody* newBody = aznew RigidBody(*configuration);
             if (!AZStd::holds_alternative<AZStd::monostate>(configuration->m_colliderAndShapeData))
             {
-                [[maybe_unused]] const bool shapeAdded = AddShape(newBody, configuration->m_colliderAndShapeData);
+                [[maybe_unused]] const bool shapeAdded = AddShape(newBody, configuration->m_colliderAndShapeData, shapePrototypes);
                 AZ_Warning("PhysXScene", shapeAdded, "No Collider or Shape information found when creating Rigid body [%s]", configuration->m_debugName.c_str());
             }
             const AzPhysics::MassComputeFlags& flags = configuration->GetMassComputeFlags();
@@ -474,8 +537,45 @@ namespace PhysX
 
             return status;
         }
+
+        bool IsParallelSceneQueryAvailable()
+        {
+            AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            return physx_parallelSceneQueries && taskGraphActive && taskGraphActive->IsTaskGraphActive();
+        }
+
+        //! Asynchronous queries may outlive the request passed by the caller, so they run on a copy of it.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CopySceneQueryRequest(const AzPhysics::SceneQueryRequest& request)
+        {
+            switch (request.m_requestType)
+            {
+            case AzPhysics::SceneQueryRequest::RequestType::Raycast:
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(static_cast<const AzPhysics::RayCastRequest&>(request));
+            case AzPhysics::SceneQueryRequest::RequestType::Shapecast:
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(static_cast<const AzPhysics::ShapeCastRequest&>(request));
+            case AzPhysics::SceneQueryRequest::RequestType::Overlap:
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(static_cast<const AzPhysics::OverlapRequest&>(request));
+            default:
+                return nullptr;
+            }
+        }
+
+        //! Character controllers, ragdolls and articulation links manage their own PhysX actors,
+        //! all other simulated bodies are added to and removed from the PhysX scene directly.
+        bool IsSceneActor(const AzPhysics::SimulatedBody& body)
+        {
+            return !azrtti_istypeof<PhysX::CharacterController>(body) &&
+                !azrtti_istypeof<PhysX::Ragdoll>(body) &&
+                !azrtti_istypeof<PhysX::ArticulationLink>(body);
+        }
     }
 
+    struct PhysXScene::SimulatedBodyBatch
+    {
+        Internal::ShapePrototypeCache m_shapePrototypes;
+        AZStd::vector<AzPhysics::SimulatedBody*> m_bodiesToEnable; //!< Bodies to add to the PhysX scene once the whole batch is created.
+    };
+
     PhysXScene::PhysXScene(const AzPhysics::SceneConfiguration& config, const AzPhysics::SceneHandle& sceneHandle)
         : Scene(config)
         , m_config(config)
@@ -516,10 +616,15 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // Pending asynchronous queries are still reading the scene, their callbacks are dropped
+        WaitForAsyncSceneQueries();
+
         s_overlapBuffer = {};
         s_rayCastBuffer = {};
         s_sweepBuffer = {};
 
+        m_characterControllerBatch.reset();
+
         for (auto& simulatedBody : m_simulatedBodies)
         {
             if (simulatedBody.second != nullptr)
@@ -566,6 +671,10 @@ namespace PhysX
 
         m_currentDeltaTime = deltatime;
 
+        // contacts are buffered per simulation step, consumers read them on the scene simulation finish event
+        m_simulationEventCallback.GetContactEventBuffer().Clear();
+        m_simulationEventCallback.SetBufferContactEvents(physx_bufferContactEvents);
+
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
     }
@@ -576,6 +685,7 @@ namespace PhysX
 
         if (!IsEnabled())
         {
+            DispatchCompletedSceneQueries();
             return;
         }
 
@@ -601,6 +711,14 @@ namespace PhysX
             m_pxScene->fetchResults(true);
         }
 
+        ++m_simulationStepCount;
+        if (physx_determinismCheck)
+        {
+            m_lastStepStateHash = ComputeStateHash();
+            AZ_TracePrintf("PhysXScene", "Scene '%s' step %llu state hash 0x%016llx\n", m_config.m_sceneName.c_str(),
+                static_cast<unsigned long long>(m_simulationStepCount), static_cast<unsigned long long>(m_lastStepStateHash));
+        }
+
         if (activeActorsEnabled)
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::ActiveActors");
@@ -643,6 +761,15 @@ namespace PhysX
         }
 
         FlushQueuedEvents();
+
+        if (m_simulationEventCallback.IsBufferingContactEvents())
+        {
+            // bodies removed during the step are deleted before the buffer is read, drop their pairs first
+            ContactEventBuffer& contactEventBuffer = m_simulationEventCallback.GetContactEventBuffer();
+            contactEventBuffer.RemoveContactPairsOfBodies(m_deferredDeletions);
+            contactEventBuffer.BuildBodyLookup();
+        }
+
         ClearDeferedDeletions();
 
         {
@@ -650,6 +777,8 @@ namespace PhysX
             m_sceneSimulationFinishEvent.Signal(m_sceneHandle, m_currentDeltaTime);
         }
 
+        DispatchCompletedSceneQueries();
+
         UpdateAzProfilerDataPoints();
     }
 
@@ -691,17 +820,24 @@ namespace PhysX
 
     AzPhysics::SimulatedBodyHandle PhysXScene::AddSimulatedBody(const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig)
     {
+        return AddSimulatedBodyInternal(simulatedBodyConfig, nullptr);
+    }
+
+    AzPhysics::SimulatedBodyHandle PhysXScene::AddSimulatedBodyInternal(
+        const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig, SimulatedBodyBatch* batch)
+    {
+        Internal::ShapePrototypeCache* shapePrototypes = batch ? &batch->m_shapePrototypes : nullptr;
         AzPhysics::SimulatedBody* newBody = nullptr;
         AZ::Crc32 newBodyCrc;
         if (azrtti_istypeof<AzPhysics::RigidBodyConfiguration>(simulatedBodyConfig))
         {
             newBody = Internal::CreateRigidBody(
-                azdynamic_cast<const AzPhysics::RigidBodyConfiguration*>(simulatedBodyConfig), newBodyCrc);
+                azdynamic_cast<const AzPhysics::RigidBodyConfiguration*>(simulatedBodyConfig), newBodyCrc, shapePrototypes);
         }
         else if (azrtti_istypeof<AzPhysics::StaticRigidBodyConfiguration>(simulatedBodyConfig))
         {
             newBody = Internal::CreateSimulatedBody<StaticRigidBody, AzPhysics::StaticRigidBodyConfiguration>(
-                azdynamic_cast<const AzPhysics::StaticRigidBodyConfiguration*>(simulatedBodyConfig), newBodyCrc);
+                azdynamic_cast<const AzPhysics::StaticRigidBodyConfiguration*>(simulatedBodyConfig), newBodyCrc, shapePrototypes);
         }
         else if (azrtti_istypeof<Physics::CharacterConfiguration>(simulatedBodyConfig))
         {
@@ -749,7 +885,14 @@ namespace PhysX
             // Enable simulation by default (not signaling OnSimulationBodySimulationEnabled event)
             if (simulatedBodyConfig->m_startSimulationEnabled)
             {
-                EnableSimulationOfBodyInternal(*newBody);
+                if (batch)
+                {
+                    batch->m_bodiesToEnable.push_back(newBody);
+                }
+                else
+                {
+                    EnableSimulationOfBodyInternal(*newBody);
+                }
             }
 
             return newBodyHandle;
@@ -760,12 +903,26 @@ namespace PhysX
 
     AzPhysics::SimulatedBodyHandleList PhysXScene::AddSimulatedBodies(const AzPhysics::SimulatedBodyConfigurationList& simulatedBodyConfigs)
     {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::AddSimulatedBodies");
+
+        if (m_freeSceneSlots.size() < simulatedBodyConfigs.size())
+        {
+            m_simulatedBodies.reserve(m_simulatedBodies.size() + simulatedBodyConfigs.size() - m_freeSceneSlots.size());
+        }
+
+        // Bodies sharing collider and shape configurations clone their shapes from the first one created,
+        // and all bodies are added to the PhysX scene at once after the whole batch is created
+        SimulatedBodyBatch batch;
+        batch.m_bodiesToEnable.reserve(simulatedBodyConfigs.size());
+
         AzPhysics::SimulatedBodyHandleList newBodyHandles;
         newBodyHandles.reserve(simulatedBodyConfigs.size());
         for (auto* config : simulatedBodyConfigs)
         {
-            newBodyHandles.emplace_back(AddSimulatedBody(config));
+            newBodyHandles.emplace_back(AddSimulatedBodyInternal(config, &batch));
         }
+
+        EnableSimulationOfBodiesInternal(batch.m_bodiesToEnable);
         return newBodyHandles;
     }
 
@@ -824,6 +981,20 @@ namespace PhysX
 
     void PhysXScene::RemoveSimulatedBodies(AzPhysics::SimulatedBodyHandleList& bodyHandles)
     {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::RemoveSimulatedBodies");
+
+        // Take all the bodies out of the PhysX scene at once, so removing each body below doesn't need to
+        AZStd::vector<AzPhysics::SimulatedBody*> simulatingBodies;
+        simulatingBodies.reserve(bodyHandles.size());
+        for (const auto& handle : bodyHandles)
+        {
+            if (AzPhysics::SimulatedBody* body = GetSimulatedBodyFromHandle(handle))
+            {
+                simulatingBodies.push_back(body);
+            }
+        }
+        DisableSimulationOfBodiesInternal(simulatingBodies);
+
         for (auto& handle: bodyHandles)
         {
             RemoveSimulatedBody(handle);
@@ -1014,27 +1185,166 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        AzPhysics::SceneQueryHitsList results(requests.size());
+        if (requests.size() > physx_parallelSceneQueryBatchSize && Internal::IsParallelSceneQueryAvailable())
         {
-            results.emplace_back(QueryScene(request.get()));
+            AZ::TaskGraph taskGraph("PhysX Scene Query Batch");
+            AZ::TaskGraphEvent finishEvent("PhysX scene query batch event");
+            AddSceneQueryTasks(taskGraph, requests, results);
+            taskGraph.Submit(&finishEvent);
+            finishEvent.Wait();
+        }
+        else
+        {
+            QuerySceneRange(requests, results, 0, requests.size());
         }
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CopySceneQueryRequest(*request);
+        if (requestCopy == nullptr)
+        {
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        auto asyncQuery = AZStd::make_unique<AsyncSceneQuery>();
+        asyncQuery->m_requestId = requestId;
+        asyncQuery->m_requests.emplace_back(AZStd::move(requestCopy));
+        asyncQuery->m_callback = AZStd::move(callback);
+        SubmitAsyncSceneQuery(AZStd::move(asyncQuery));
+        return true;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (!callback)
+        {
+            return false;
+        }
+
+        // The requests are shared with the caller, they must not be modified until the callback is invoked
+        auto asyncQuery = AZStd::make_unique<AsyncSceneQuery>();
+        asyncQuery->m_requestId = requestId;
+        asyncQuery->m_requests = requests;
+        asyncQuery->m_batchCallback = AZStd::move(callback);
+        SubmitAsyncSceneQuery(AZStd::move(asyncQuery));
+        return true;
+    }
+
+    void PhysXScene::QuerySceneRange(
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results, size_t start, size_t end)
+    {
+        // Keep the scene locked for read for the whole range rather than locking it again for every query
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+        for (size_t requestIndex = start; requestIndex < end; ++requestIndex)
+        {
+            QueryScene(requests[requestIndex].get(), results[requestIndex]);
+        }
+    }
+
+    void PhysXScene::AddSceneQueryTasks(
+        AZ::TaskGraph& taskGraph, const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results)
+    {
+        // Each worker thread reuses its own thread local hit buffers, and each task writes to its own preallocated results
+        const size_t batchSize = AZStd::max<size_t>(physx_parallelSceneQueryBatchSize, 1);
+        const size_t fullSize = requests.size();
+        for (size_t i = 0; i < fullSize; i += batchSize)
+        {
+            AZ::TaskDescriptor taskDescriptor{ "SceneQueryTask", "Physics" };
+            taskGraph.AddTask(
+                taskDescriptor,
+                [start = i, end = AZStd::min(i + batchSize, fullSize), &requests, &results, this]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "Scene Query Task");
+                    QuerySceneRange(requests, results, start, end);
+                });
+        }
+    }
+
+    void PhysXScene::SubmitAsyncSceneQuery(AZStd::unique_ptr<AsyncSceneQuery> asyncQuery)
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::SubmitAsyncSceneQuery");
+
+        asyncQuery->m_results.resize(asyncQuery->m_requests.size());
+        if (Internal::IsParallelSceneQueryAvailable())
+        {
+            // The graph deallocates its tasks on completion, the query itself is owned by the scene until its callback is invoked
+            AZ::TaskGraph taskGraph("PhysX Async Scene Query");
+            AddSceneQueryTasks(taskGraph, asyncQuery->m_requests, asyncQuery->m_results);
+            taskGraph.Detach();
+            taskGraph.Submit(&asyncQuery->m_finishEvent);
+            asyncQuery->m_submitted = true;
+        }
+        else
+        {
+            QuerySceneRange(asyncQuery->m_requests, asyncQuery->m_results, 0, asyncQuery->m_requests.size());
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+        m_asyncSceneQueries.emplace_back(AZStd::move(asyncQuery));
+    }
+
+    void PhysXScene::DispatchCompletedSceneQueries()
+    {
+        AZStd::vector<AZStd::unique_ptr<AsyncSceneQuery>> completedQueries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+            if (m_asyncSceneQueries.empty())
+            {
+                return;
+            }
+
+            // Callbacks are invoked in submission order, so only the completed queries ahead of the first one still
+            // in flight are dispatched, the rest are kept for a later simulation pass
+            auto firstPending = AZStd::find_if(m_asyncSceneQueries.begin(), m_asyncSceneQueries.end(),
+                [](const AZStd::unique_ptr<AsyncSceneQuery>& asyncQuery)
+                {
+                    return !asyncQuery->IsComplete();
+                });
+            completedQueries.insert(completedQueries.end(),
+                AZStd::make_move_iterator(m_asyncSceneQueries.begin()), AZStd::make_move_iterator(firstPending));
+            m_asyncSceneQueries.erase(m_asyncSceneQueries.begin(), firstPending);
+        }
+
+        // Invoke the callbacks outside of the lock, so they can issue new asynchronous queries
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::DispatchCompletedSceneQueries");
+        for (AZStd::unique_ptr<AsyncSceneQuery>& asyncQuery : completedQueries)
+        {
+            if (asyncQuery->m_batchCallback)
+            {
+                asyncQuery->m_batchCallback(asyncQuery->m_requestId, AZStd::move(asyncQuery->m_results));
+            }
+            else
+            {
+                asyncQuery->m_callback(asyncQuery->m_requestId, AZStd::move(asyncQuery->m_results.front()));
+            }
+        }
+    }
+
+    void PhysXScene::WaitForAsyncSceneQueries()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncSceneQueryMutex);
+        for (AZStd::unique_ptr<AsyncSceneQuery>& asyncQuery : m_asyncSceneQueries)
+        {
+            if (asyncQuery->m_submitted)
+            {
+                asyncQuery->m_finishEvent.Wait();
+            }
+        }
+        m_asyncSceneQueries.clear();
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -1082,9 +1392,7 @@ namespace PhysX
     void PhysXScene::EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body)
     {
         //character controller is a special actor and only needs the m_simulating flag set,
-        if (!azrtti_istypeof<PhysX::CharacterController>(body) &&
-            !azrtti_istypeof<PhysX::Ragdoll>(body) &&
-            !azrtti_istypeof<PhysX::ArticulationLink>(body))
+        if (Internal::IsSceneActor(body))
         {
             auto pxActor = static_cast<physx::PxActor*>(body.GetNativePointer());
             AZ_Assert(pxActor, "Simulated Body doesn't have a valid physx actor");
@@ -1110,9 +1418,7 @@ namespace PhysX
     void PhysXScene::DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body)
     {
         //character controller is a special actor and only needs the m_simulating flag set,
-        if (!azrtti_istypeof<PhysX::CharacterController>(body) &&
-            !azrtti_istypeof<PhysX::Ragdoll>(body) &&
-            !azrtti_istypeof<PhysX::ArticulationLink>(body))
+        if (Internal::IsSceneActor(body))
         {
             auto pxActor = static_cast<physx::PxActor*>(body.GetNativePointer());
             AZ_Assert(pxActor, "Simulated Body doesn't have a valid physx actor");
@@ -1125,6 +1431,69 @@ namespace PhysX
         body.m_simulating = false;
     }
 
+    void PhysXScene::EnableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies)
+    {
+        AZStd::vector<physx::PxActor*> pxActors;
+        pxActors.reserve(bodies.size());
+        for (AzPhysics::SimulatedBody* body : bodies)
+        {
+            if (body->m_simulating)
+            {
+                continue;
+            }
+
+            if (Internal::IsSceneActor(*body))
+            {
+                auto pxActor = static_cast<physx::PxActor*>(body->GetNativePointer());
+                AZ_Assert(pxActor, "Simulated Body doesn't have a valid physx actor");
+                pxActors.push_back(pxActor);
+            }
+            body->m_simulating = true;
+        }
+
+        if (!pxActors.empty())
+        {
+            // A single addActors call inserts the whole batch into the broad phase at once
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->addActors(pxActors.data(), aznumeric_cast<physx::PxU32>(pxActors.size()));
+        }
+
+        for (AzPhysics::SimulatedBody* body : bodies)
+        {
+            if (auto* rigidBody = azdynamic_cast<PhysX::RigidBody*>(body); rigidBody && rigidBody->ShouldStartAsleep())
+            {
+                rigidBody->ForceAsleep();
+            }
+        }
+    }
+
+    void PhysXScene::DisableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies)
+    {
+        AZStd::vector<physx::PxActor*> pxActors;
+        pxActors.reserve(bodies.size());
+        for (AzPhysics::SimulatedBody* body : bodies)
+        {
+            if (!body->m_simulating)
+            {
+                continue;
+            }
+
+            if (Internal::IsSceneActor(*body))
+            {
+                auto pxActor = static_cast<physx::PxActor*>(body->GetNativePointer());
+                AZ_Assert(pxActor, "Simulated Body doesn't have a valid physx actor");
+                pxActors.push_back(pxActor);
+            }
+            body->m_simulating = false;
+        }
+
+        if (!pxActors.empty())
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->removeActors(pxActors.data(), aznumeric_cast<physx::PxU32>(pxActors.size()));
+        }
+    }
+
     physx::PxControllerManager* PhysXScene::GetOrCreateControllerManager()
     {
         if (m_controllerManager)
@@ -1149,6 +1518,15 @@ namespace PhysX
         return m_controllerManager;
     }
 
+    CharacterControllerBatch* PhysXScene::GetOrCreateCharacterControllerBatch()
+    {
+        if (!m_characterControllerBatch)
+        {
+            m_characterControllerBatch = AZStd::make_unique<CharacterControllerBatch>(this);
+        }
+        return m_characterControllerBatch.get();
+    }
+
     void* PhysXScene::GetNativePointer() const
     {
         return m_pxScene;
@@ -1330,6 +1708,57 @@ namespace PhysX
         }
     }
 
+    size_t PhysXScene::AccumulateFixedTimesteps(float deltaTime)
+    {
+        AZ_Assert(m_config.m_fixedTimestep > 0.0f, "PhysXScene::AccumulateFixedTimesteps - scene '%s' has no fixed timestep.",
+            m_config.m_sceneName.c_str());
+
+        m_fixedTimestepAccumulatedTime += deltaTime;
+
+        size_t numTimesteps = 0;
+        while (m_fixedTimestepAccumulatedTime >= m_config.m_fixedTimestep)
+        {
+            m_fixedTimestepAccumulatedTime -= m_config.m_fixedTimestep;
+            ++numTimesteps;
+        }
+        return numTimesteps;
+    }
+
+    AZ::HashValue64 PhysXScene::ComputeStateHash() const
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        AZ::HashValue64 hash = AZ::HashValue64{ 0 };
+
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+        // Actors are visited in the order of the PhysX scene, which only depends on the order they were added and removed in.
+        const physx::PxActorTypeFlags actorTypes = physx::PxActorTypeFlag::eRIGID_DYNAMIC;
+        constexpr physx::PxU32 maxActorsPerBatch = 64;
+        physx::PxActor* actors[maxActorsPerBatch];
+
+        const physx::PxU32 numActors = m_pxScene->getNbActors(actorTypes);
+        for (physx::PxU32 startIndex = 0; startIndex < numActors; startIndex += maxActorsPerBatch)
+        {
+            const physx::PxU32 numActorsInBatch = m_pxScene->getActors(actorTypes, actors, maxActorsPerBatch, startIndex);
+            for (physx::PxU32 actorIndex = 0; actorIndex < numActorsInBatch; ++actorIndex)
+            {
+                const physx::PxRigidDynamic* rigidDynamic = static_cast<const physx::PxRigidDynamic*>(actors[actorIndex]);
+                hash = AZ::TypeHash64(rigidDynamic->getGlobalPose(), hash);
+                hash = AZ::TypeHash64(rigidDynamic->getLinearVelocity(), hash);
+                hash = AZ::TypeHash64(rigidDynamic->getAngularVelocity(), hash);
+                hash = AZ::TypeHash64(static_cast<AZ::u8>(rigidDynamic->isSleeping()), hash);
+            }
+        }
+
+        return hash;
+    }
+
+    AZ::HashValue64 PhysXScene::GetLastStepStateHash() const
+    {
+        return m_lastStepStateHash;
+    }
+
     void PhysXScene::FlushTransformSync()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysX::FlushTransformSync");
@@ -12,6 +12,9 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Utils/TypeHash.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
@@ -25,8 +28,15 @@ namespace physx
     struct PxSweepHit;
 }
 
+namespace AZ
+{
+    class TaskGraph;
+}
+
 namespace PhysX
 {
+    class CharacterControllerBatch;
+
     //! PhysX implementation of the AzPhysics::Scene.
     class PhysXScene final
         : public AzPhysics::Scene
@@ -81,9 +91,31 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Returns the batch updating the character controllers of this scene in a single pass, creating it if needed.
+        CharacterControllerBatch* GetOrCreateCharacterControllerBatch();
+        //! Returns the batch updating the character controllers of this scene, or null if no controller has been batched yet.
+        CharacterControllerBatch* GetCharacterControllerBatch() const { return m_characterControllerBatch.get(); }
+
+        //! Returns the contacts recorded during the last simulation step while physx_bufferContactEvents is enabled.
+        //! The buffer is filled by the time the scene simulation finish event is signaled and cleared when the next step starts.
+        //! While buffering is enabled no collision events are signaled, so the buffer is the only source of contacts.
+        const ContactEventBuffer& GetContactEventBuffer() const { return m_simulationEventCallback.GetContactEventBuffer(); }
+
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
+
+        //! Accumulates frame time for a scene stepped with its own fixed timestep, see SceneConfiguration::m_fixedTimestep.
+        //! @param deltaTime The frame time to accumulate.
+        //! @return The number of fixed timesteps to simulate the scene for.
+        size_t AccumulateFixedTimesteps(float deltaTime);
+
+        //! Computes a hash of the pose, velocities and sleep state of every dynamic actor in the scene.
+        //! A deterministic simulation produces the same sequence of hashes when it is run again from the same initial state.
+        AZ::HashValue64 ComputeStateHash() const;
+
+        //! Returns the state hash recorded at the end of the last simulation step while physx_determinismCheck is enabled.
+        AZ::HashValue64 GetLastStepStateHash() const;
         
     private:
 
@@ -103,8 +135,18 @@ namespace PhysX
             AZStd::vector<AzPhysics::SimulatedBodyIndex> m_packedIndices;
         };
 
+        //! Shapes and bodies shared while adding a batch of simulated bodies.
+        struct SimulatedBodyBatch;
+
+        //! Creates a simulated body and adds it to the scene.
+        //! @param batch The batch the body is part of, or nullptr to add the body to the PhysX scene immediately.
+        AzPhysics::SimulatedBodyHandle AddSimulatedBodyInternal(const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig, SimulatedBodyBatch* batch);
+
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
+        //! Adds or removes the PhysX actors of all the bodies with a single call to the PhysX scene.
+        void EnableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies);
+        void DisableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies);
 
         void FlushQueuedEvents();
         void ClearDeferedDeletions();
@@ -115,6 +157,19 @@ namespace PhysX
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
 
+        //! An asynchronous scene query request, its preallocated results and the callback to deliver them to.
+        struct AsyncSceneQuery;
+
+        //! Runs a range of scene queries, keeping the scene locked for read for the whole range.
+        void QuerySceneRange(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results, size_t start, size_t end);
+        //! Adds tasks running the scene queries in batches, each task writes to its own range of the results.
+        void AddSceneQueryTasks(AZ::TaskGraph& taskGraph, const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results);
+        void SubmitAsyncSceneQuery(AZStd::unique_ptr<AsyncSceneQuery> asyncQuery);
+        //! Invokes the callbacks of completed asynchronous scene queries in submission order.
+        //! A completed query submitted after one still in flight waits for it, so its callback is invoked on a later pass.
+        void DispatchCompletedSceneQueries();
+        void WaitForAsyncSceneQueries();
+
         bool m_isEnabled = true;
 
         // Batch transform sync data. Here we store the indices of actors that have moved since the last simulation pass.
@@ -133,6 +188,13 @@ namespace PhysX
         // Delta time for the current simulation sub-step
         float m_currentDeltaTime = 0.0f;
 
+        // Time accumulated but not yet simulated when the scene is stepped with its own fixed timestep.
+        float m_fixedTimestepAccumulatedTime = 0.0f;
+
+        // Number of simulation steps completed and the state hash at the end of the last one, used by physx_determinismCheck.
+        AZ::u64 m_simulationStepCount = 0;
+        AZ::HashValue64 m_lastStepStateHash = AZ::HashValue64{ 0 };
+
         AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::SimulatedBody*>> m_simulatedBodies;
         AZStd::vector<AzPhysics::SimulatedBody*> m_deferredDeletions;
         AZStd::queue<AzPhysics::SimulatedBodyIndex> m_freeSceneSlots;
@@ -154,7 +216,11 @@ namespace PhysX
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
+        AZStd::unique_ptr<CharacterControllerBatch> m_characterControllerBatch; //!< Batched update of the scene's character controllers.
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
+
+        AZStd::vector<AZStd::unique_ptr<AsyncSceneQuery>> m_asyncSceneQueries; //!< Asynchronous scene queries waiting for their callbacks to be invoked.
+        AZStd::mutex m_asyncSceneQueryMutex;
     };
 }
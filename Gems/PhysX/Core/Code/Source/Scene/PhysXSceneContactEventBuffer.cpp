@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Scene/PhysXSceneContactEventBuffer.h>
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace PhysX
+{
+    void ContactEventBuffer::Clear()
+    {
+        m_contactPairs.clear();
+        m_contacts.clear();
+        m_bodyLookup.clear();
+    }
+
+    AZStd::span<AzPhysics::Contact> ContactEventBuffer::AddContactPair(const BufferedContactPair& pair, AZ::u32 contactCount)
+    {
+        BufferedContactPair& addedPair = m_contactPairs.emplace_back(pair);
+        addedPair.m_firstContact = aznumeric_cast<AZ::u32>(m_contacts.size());
+        addedPair.m_contactCount = contactCount;
+
+        m_contacts.resize(m_contacts.size() + contactCount);
+        return AZStd::span<AzPhysics::Contact>(m_contacts.data() + addedPair.m_firstContact, contactCount);
+    }
+
+    void ContactEventBuffer::RemoveContactPairsOfBodies(AZStd::span<AzPhysics::SimulatedBody* const> bodies)
+    {
+        if (bodies.empty() || m_contactPairs.empty())
+        {
+            return;
+        }
+
+        auto isRemoved = [bodies](const AzPhysics::SimulatedBody* body)
+        {
+            return AZStd::find(bodies.begin(), bodies.end(), body) != bodies.end();
+        };
+
+        // shift the kept pairs and their contact points down over the removed ones, preserving the order of the step
+        size_t keptPairCount = 0;
+        AZ::u32 keptContactCount = 0;
+        for (const BufferedContactPair& pair : m_contactPairs)
+        {
+            if (isRemoved(pair.m_body1) || isRemoved(pair.m_body2))
+            {
+                continue;
+            }
+
+            BufferedContactPair& keptPair = m_contactPairs[keptPairCount++];
+            AZStd::copy(
+                m_contacts.begin() + pair.m_firstContact,
+                m_contacts.begin() + pair.m_firstContact + pair.m_contactCount,
+                m_contacts.begin() + keptContactCount);
+            keptPair = pair;
+            keptPair.m_firstContact = keptContactCount;
+            keptContactCount += pair.m_contactCount;
+        }
+        m_contactPairs.resize(keptPairCount);
+        m_contacts.resize(keptContactCount);
+        m_bodyLookup.clear();
+    }
+
+    void ContactEventBuffer::BuildBodyLookup()
+    {
+        m_bodyLookup.clear();
+        m_bodyLookup.reserve(m_contactPairs.size() * 2);
+        for (AZ::u32 pairIndex = 0; pairIndex < aznumeric_cast<AZ::u32>(m_contactPairs.size()); ++pairIndex)
+        {
+            const BufferedContactPair& pair = m_contactPairs[pairIndex];
+            m_bodyLookup.emplace_back(AZStd::get<1>(pair.m_bodyHandle1), pairIndex);
+            m_bodyLookup.emplace_back(AZStd::get<1>(pair.m_bodyHandle2), pairIndex);
+        }
+        AZStd::sort(m_bodyLookup.begin(), m_bodyLookup.end());
+    }
+
+    bool ContactEventBuffer::IsEmpty() const
+    {
+        return m_contactPairs.empty();
+    }
+
+    AZStd::span<const BufferedContactPair> ContactEventBuffer::GetContactPairs() const
+    {
+        return m_contactPairs;
+    }
+
+    AZStd::span<const AzPhysics::Contact> ContactEventBuffer::GetContacts() const
+    {
+        return m_contacts;
+    }
+
+    AZStd::span<const AzPhysics::Contact> ContactEventBuffer::GetContacts(const BufferedContactPair& pair) const
+    {
+        return AZStd::span<const AzPhysics::Contact>(m_contacts.data() + pair.m_firstContact, pair.m_contactCount);
+    }
+
+    void ContactEventBuffer::VisitContactPairs(AzPhysics::SimulatedBodyHandle bodyHandle, const ContactPairVisitor& visitor) const
+    {
+        AZ_Assert(m_bodyLookup.size() == m_contactPairs.size() * 2, "ContactEventBuffer body lookup is out of date.");
+
+        const AzPhysics::SimulatedBodyIndex bodyIndex = AZStd::get<1>(bodyHandle);
+        auto it = AZStd::lower_bound(m_bodyLookup.begin(), m_bodyLookup.end(),
+            AZStd::make_pair(bodyIndex, AZ::u32(0)));
+        for (; it != m_bodyLookup.end() && it->first == bodyIndex; ++it)
+        {
+            const BufferedContactPair& pair = m_contactPairs[it->second];
+            // the index only identifies the slot of the body, make sure the pair was recorded for this body
+            if (pair.m_bodyHandle1 == bodyHandle || pair.m_bodyHandle2 == bodyHandle)
+            {
+                visitor(pair, GetContacts(pair));
+            }
+        }
+    }
+} // namespace PhysX
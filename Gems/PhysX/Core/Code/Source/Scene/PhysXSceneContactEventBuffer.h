@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/utils.h>
+#include <AzFramework/Physics/Collision/CollisionEvents.h>
+
+namespace PhysX
+{
+    //! A contact pair recorded in a ContactEventBuffer.
+    //! Same data as an AzPhysics::CollisionEvent, but the contact points are stored contiguously in the buffer instead of
+    //! in a vector owned by each event.
+    //! Pairs of bodies deleted at the end of the step are removed from the buffer, so the body and shape pointers are
+    //! valid while the buffer is read on the scene simulation finish event. A body removed by another finish handler is
+    //! not deleted until the next step, but is no longer in the scene.
+    struct BufferedContactPair
+    {
+        AzPhysics::CollisionEvent::Type m_type = AzPhysics::CollisionEvent::Type::Begin;
+        AzPhysics::SimulatedBodyHandle m_bodyHandle1 = AzPhysics::InvalidSimulatedBodyHandle;
+        AzPhysics::SimulatedBody* m_body1 = nullptr;
+        Physics::Shape* m_shape1 = nullptr;
+        AzPhysics::SimulatedBodyHandle m_bodyHandle2 = AzPhysics::InvalidSimulatedBodyHandle;
+        AzPhysics::SimulatedBody* m_body2 = nullptr;
+        Physics::Shape* m_shape2 = nullptr;
+        AZ::u32 m_firstContact = 0; //!< Index of the first contact point of the pair in the buffer.
+        AZ::u32 m_contactCount = 0; //!< Number of contact points of the pair.
+    };
+
+    //! Holds the contact pairs reported by PhysX during a simulation step in contiguous storage.
+    //! Memory is kept between steps, so once the buffer has grown to the scene's peak contact count, recording contacts no
+    //! longer allocates. Consumers read the whole step through spans, or only the pairs involving a given body.
+    class ContactEventBuffer
+    {
+    public:
+        using ContactPairVisitor = AZStd::function<void(const BufferedContactPair& pair, AZStd::span<const AzPhysics::Contact> contacts)>;
+
+        //! Removes all recorded pairs, keeping the allocated memory for the next step.
+        void Clear();
+
+        //! Records a contact pair.
+        //! @param pair The pair to record, its contact range is set by the buffer.
+        //! @param contactCount The number of contact points of the pair.
+        //! @return The contact points of the pair to be filled by the caller, only valid until the next pair is added.
+        AZStd::span<AzPhysics::Contact> AddContactPair(const BufferedContactPair& pair, AZ::u32 contactCount);
+
+        //! Removes the pairs involving any of the bodies, compacting the remaining pairs and contact points.
+        //! Used to drop the pairs of bodies that are deleted before the buffer is read.
+        void RemoveContactPairsOfBodies(AZStd::span<AzPhysics::SimulatedBody* const> bodies);
+
+        //! Builds the lookup used by VisitContactPairs, to be called once every pair of the step has been recorded.
+        void BuildBodyLookup();
+
+        bool IsEmpty() const;
+
+        //! Returns all the contact pairs recorded for the step.
+        AZStd::span<const BufferedContactPair> GetContactPairs() const;
+
+        //! Returns the contact points of all the pairs recorded for the step.
+        AZStd::span<const AzPhysics::Contact> GetContacts() const;
+
+        //! Returns the contact points of a pair recorded for the step.
+        AZStd::span<const AzPhysics::Contact> GetContacts(const BufferedContactPair& pair) const;
+
+        //! Invokes the visitor for every contact pair of the step involving a body.
+        //! The body may be either the first or the second body of the pair.
+        //! @param bodyHandle The body to visit the pairs of.
+        //! @param visitor The function called with each pair and its contact points.
+        void VisitContactPairs(AzPhysics::SimulatedBodyHandle bodyHandle, const ContactPairVisitor& visitor) const;
+
+    private:
+        AZStd::vector<BufferedContactPair> m_contactPairs;
+        AZStd::vector<AzPhysics::Contact> m_contacts;
+        //! Index of every pair for both of its bodies, sorted by body index.
+        AZStd::vector<AZStd::pair<AzPhysics::SimulatedBodyIndex, AZ::u32>> m_bodyLookup;
+    };
+} // namespace PhysX
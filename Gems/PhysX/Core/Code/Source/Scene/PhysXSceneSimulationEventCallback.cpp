@@ -13,6 +13,33 @@
 
 namespace PhysX
 {
+    namespace
+    {
+        void ConvertContactPoint(const physx::PxContactPairPoint& point, AzPhysics::Contact& contact)
+        {
+            contact.m_position = PxMathConvert(point.position);
+            contact.m_normal = PxMathConvert(point.normal);
+            contact.m_impulse = PxMathConvert(point.impulse);
+            contact.m_separation = point.separation;
+            contact.m_internalFaceIndex01 = point.internalFaceIndex0;
+            contact.m_internalFaceIndex02 = point.internalFaceIndex1;
+        }
+
+        // Matches the order the events are checked in when queuing collision events, found takes priority over persists and lost.
+        AzPhysics::CollisionEvent::Type GetCollisionEventType(physx::PxPairFlags events)
+        {
+            if (events & physx::PxPairFlag::eNOTIFY_TOUCH_FOUND)
+            {
+                return AzPhysics::CollisionEvent::Type::Begin;
+            }
+            if (events & physx::PxPairFlag::eNOTIFY_TOUCH_PERSISTS)
+            {
+                return AzPhysics::CollisionEvent::Type::Persist;
+            }
+            return AzPhysics::CollisionEvent::Type::End;
+        }
+    } // namespace
+
     AzPhysics::CollisionEventList& SceneSimulationEventCallback::GetQueuedCollisionEvents()
     {
         return m_queuedCollisionEvents;
@@ -33,6 +60,26 @@ namespace PhysX
         m_queuedTriggerEvents.clear();
     }
 
+    void SceneSimulationEventCallback::SetBufferContactEvents(bool enabled)
+    {
+        m_bufferContactEvents = enabled;
+    }
+
+    bool SceneSimulationEventCallback::IsBufferingContactEvents() const
+    {
+        return m_bufferContactEvents;
+    }
+
+    ContactEventBuffer& SceneSimulationEventCallback::GetContactEventBuffer()
+    {
+        return m_contactEventBuffer;
+    }
+
+    const ContactEventBuffer& SceneSimulationEventCallback::GetContactEventBuffer() const
+    {
+        return m_contactEventBuffer;
+    }
+
     void SceneSimulationEventCallback::onConstraintBreak(
         [[maybe_unused]] physx::PxConstraintInfo* constraints, [[maybe_unused]] physx::PxU32 count)
     {
@@ -97,6 +144,29 @@ namespace PhysX
                     continue;
                 }
 
+                // Extract contacts for collision event
+                physx::PxContactPairPoint extractedPoints[MaxPointsToReport];
+                physx::PxU32 contactPointCount = contactPair.extractContacts(extractedPoints, MaxPointsToReport);
+
+                if (m_bufferContactEvents)
+                {
+                    BufferedContactPair bufferedPair;
+                    bufferedPair.m_type = GetCollisionEventType(contactPair.events);
+                    bufferedPair.m_bodyHandle1 = actorData1->GetBodyHandle();
+                    bufferedPair.m_body1 = body1;
+                    bufferedPair.m_shape1 = shape1;
+                    bufferedPair.m_bodyHandle2 = actorData2->GetBodyHandle();
+                    bufferedPair.m_body2 = body2;
+                    bufferedPair.m_shape2 = shape2;
+
+                    AZStd::span<AzPhysics::Contact> contacts = m_contactEventBuffer.AddContactPair(bufferedPair, contactPointCount);
+                    for (physx::PxU32 j = 0; j < contactPointCount; ++j)
+                    {
+                        ConvertContactPoint(extractedPoints[j], contacts[j]);
+                    }
+                    continue;
+                }
+
                 // Collision Event
                 AzPhysics::CollisionEvent collision;
                 collision.m_bodyHandle1 = actorData1->GetBodyHandle();
@@ -106,21 +176,10 @@ namespace PhysX
                 collision.m_shape1 = shape1;
                 collision.m_shape2 = shape2;
 
-                // Extract contacts for collision event
-                physx::PxContactPairPoint extractedPoints[MaxPointsToReport];
-                physx::PxU32 contactPointCount = contactPair.extractContacts(extractedPoints, MaxPointsToReport);
                 collision.m_contacts.resize(contactPointCount);
                 for (physx::PxU8 j = 0; j < contactPointCount; ++j)
                 {
-                    const physx::PxContactPairPoint& point = extractedPoints[j];
-
-                    AzPhysics::Contact& contact = collision.m_contacts[j];
-                    contact.m_position = PxMathConvert(point.position);
-                    contact.m_normal = PxMathConvert(point.normal);
-                    contact.m_impulse = PxMathConvert(point.impulse);
-                    contact.m_separation = point.separation;
-                    contact.m_internalFaceIndex01 = point.internalFaceIndex0;
-                    contact.m_internalFaceIndex02 = point.internalFaceIndex1;
+                    ConvertContactPoint(extractedPoints[j], collision.m_contacts[j]);
                 }
 
                 if (contactPair.events & physx::PxPairFlag::eNOTIFY_TOUCH_FOUND)
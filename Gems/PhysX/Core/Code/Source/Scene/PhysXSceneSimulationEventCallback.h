@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
+#include <Scene/PhysXSceneContactEventBuffer.h>
 
 #include <PxSimulationEventCallback.h>
 namespace PhysX
@@ -30,6 +31,14 @@ namespace PhysX
         void FlushQueuedCollisionEvents();
         void FlushQueuedTriggerEvents();
 
+        //! When enabled, contacts are recorded in the contact event buffer instead of being queued as collision events.
+        void SetBufferContactEvents(bool enabled);
+        bool IsBufferingContactEvents() const;
+
+        //! Accessor to the contacts recorded while contact event buffering is enabled.
+        ContactEventBuffer& GetContactEventBuffer();
+        const ContactEventBuffer& GetContactEventBuffer() const;
+
         // physx::PxSimulationEventCallback Interface
         void onConstraintBreak(physx::PxConstraintInfo* constraints, physx::PxU32 count) override;
         void onWake(physx::PxActor** actors, physx::PxU32 count) override;
@@ -41,5 +50,7 @@ namespace PhysX
     private:
         AzPhysics::CollisionEventList m_queuedCollisionEvents; //!< Holds all the collision events the happened until the next call to FlushCollisionEvents;
         AzPhysics::TriggerEventList m_queuedTriggerEvents; //!< Holds all the trigger events the happened until the next call to FlushTriggerEvents;
+        ContactEventBuffer m_contactEventBuffer; //!< Holds the contacts of the current simulation step while buffering is enabled.
+        bool m_bufferContactEvents = false;
     };
 }
@@ -88,6 +88,52 @@ namespace PhysX
         ExtractMaterialsFromPxShape();
     }
 
+    AZStd::shared_ptr<Shape> Shape::CreateFromPrototype(const Shape& prototype)
+    {
+        const physx::PxShape* prototypePxShape = prototype.m_pxShape.get();
+        if (prototypePxShape == nullptr)
+        {
+            return nullptr;
+        }
+
+        AZStd::vector<physx::PxMaterial*> pxMaterials(prototypePxShape->getNbMaterials(), nullptr);
+        prototypePxShape->getMaterials(pxMaterials.data(), aznumeric_cast<physx::PxU32>(pxMaterials.size()));
+
+#if (PX_PHYSICS_VERSION_MAJOR == 5)
+        const physx::PxGeometry& geometry = prototypePxShape->getGeometry();
+#else
+        const physx::PxGeometryHolder geometryHolder = prototypePxShape->getGeometry();
+        const physx::PxGeometry& geometry = geometryHolder.any();
+#endif
+
+        physx::PxShape* newShape = PxGetPhysics().createShape(
+            geometry,
+            pxMaterials.data(),
+            aznumeric_cast<physx::PxU16>(pxMaterials.size()),
+            prototypePxShape->isExclusive(),
+            prototypePxShape->getFlags());
+        if (newShape == nullptr)
+        {
+            AZ_Error("PhysX Shape", false, "Failed to create shape from prototype.");
+            return nullptr;
+        }
+
+        newShape->setSimulationFilterData(prototypePxShape->getSimulationFilterData());
+        newShape->setQueryFilterData(prototypePxShape->getQueryFilterData());
+        newShape->setRestOffset(prototypePxShape->getRestOffset());
+        newShape->setContactOffset(prototypePxShape->getContactOffset());
+        newShape->setLocalPose(prototypePxShape->getLocalPose());
+
+        AZStd::shared_ptr<Shape> shape(aznew Shape());
+        shape->m_pxShape = PxShapeUniquePtr(newShape, AZStd::bind(&Shape::ReleasePxShape, shape.get(), newShape));
+        shape->m_pxShape->userData = shape.get();
+        shape->m_materials = prototype.m_materials;
+        shape->m_collisionLayer = prototype.m_collisionLayer;
+        shape->m_collisionGroup = prototype.m_collisionGroup;
+        shape->m_tag = prototype.m_tag;
+        return shape;
+    }
+
     Shape::~Shape()
     {
         //release the shape here, so when Shape::ReleasePxShape is called to delete the physx::PxShape* we can still acquire the scene lock.
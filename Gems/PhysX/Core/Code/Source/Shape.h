@@ -37,6 +37,11 @@ namespace PhysX
         Shape(physx::PxShape* nativeShape);
         virtual ~Shape();
 
+        //! Creates a new shape with the same geometry, materials, collision filtering, flags, offsets and local pose as the prototype.
+        //! Much cheaper than creating the shape from its configurations again, materials and collision groups are not looked up
+        //! and cooked meshes are shared with the prototype.
+        static AZStd::shared_ptr<Shape> CreateFromPrototype(const Shape& prototype);
+
         Shape(Shape&& shape);
         Shape& operator=(Shape&& shape);
         Shape(const Shape& shape) = delete;
@@ -36,6 +36,12 @@ namespace PhysX
         "True: Sync entity transform once per Simulate call. "
         "False: Sync entity transform for every simulation sub-step.");
 
+    AZ_CVAR(bool, physx_parallelSceneSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Simulate all enabled scenes concurrently. "
+        "True: Every scene starts a simulation sub-step before any scene finishes it, so independent scenes are simulated "
+        "across the job worker threads at the same time. Scene events are still signaled on the calling thread, in scene order. "
+        "False: Each scene finishes its simulation sub-step before the next scene starts.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator);
 
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
@@ -185,19 +191,6 @@ namespace PhysX
             return;
         }
 
-        auto simulateScenes = [this](float timeStep)
-        {
-            for (auto& scenePtr : m_sceneList)
-            {
-                if (scenePtr != nullptr && scenePtr->IsEnabled())
-                {
-                    AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
-                    scenePtr->StartSimulation(timeStep);
-                    scenePtr->FinishSimulation();
-                }
-            }
-        };
-
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
         if (FrameTimeWarning::NumSamples < FrameTimeWarning::MaxSamples)
         {
@@ -222,24 +215,97 @@ namespace PhysX
 
         AZ_Assert(m_systemConfig.m_fixedTimestep >= 0.0f, "PhysXSystem - fixed timestep is negitive.");
         float tickTime = deltaTime;
+        float systemTimestep = tickTime;
+        size_t numSystemTimesteps = 1;
         if (m_systemConfig.m_fixedTimestep > 0.0f) //use the fixed timestep
         {
             m_accumulatedTime += tickTime;
             //divide accumulated time by the fixed step and floor it to get the number of steps that would occur. Then multiply by fixedTimeStep to get the total executed time.
             tickTime = AZStd::floorf(m_accumulatedTime / m_systemConfig.m_fixedTimestep) * m_systemConfig.m_fixedTimestep;
-            m_preSimulateEvent.Signal(tickTime);
+            systemTimestep = m_systemConfig.m_fixedTimestep;
 
+            numSystemTimesteps = 0;
             while (m_accumulatedTime >= m_systemConfig.m_fixedTimestep)
             {
-                simulateScenes(m_systemConfig.m_fixedTimestep);
+                ++numSystemTimesteps;
                 m_accumulatedTime -= m_systemConfig.m_fixedTimestep;
             }
         }
-        else
+
+        // Scenes with their own fixed timestep accumulate the frame time separately, all other scenes step with the system timestep.
+        m_sceneTimesteps.clear();
+        size_t maxNumTimesteps = 0;
+        for (size_t sceneIndex = 0; sceneIndex < m_sceneList.size(); ++sceneIndex)
         {
-            m_preSimulateEvent.Signal(tickTime);
+            auto& scenePtr = m_sceneList[sceneIndex];
+            if (scenePtr == nullptr || !scenePtr->IsEnabled())
+            {
+                continue;
+            }
+
+            SceneTimesteps sceneTimesteps{ sceneIndex, systemTimestep, numSystemTimesteps };
+            if (const float sceneFixedTimestep = scenePtr->GetConfiguration().m_fixedTimestep; sceneFixedTimestep > 0.0f)
+            {
+                sceneTimesteps.m_timestep = sceneFixedTimestep;
+                sceneTimesteps.m_numTimesteps = static_cast<PhysXScene*>(scenePtr.get())->AccumulateFixedTimesteps(deltaTime);
+            }
+
+            if (sceneTimesteps.m_numTimesteps > 0)
+            {
+                maxNumTimesteps = AZStd::max(maxNumTimesteps, sceneTimesteps.m_numTimesteps);
+                m_sceneTimesteps.push_back(sceneTimesteps);
+            }
+        }
 
-            simulateScenes(tickTime);
+        m_preSimulateEvent.Signal(tickTime);
+
+        // Scenes are looked up again for every sub-step, since scene events can remove or disable scenes.
+        auto getSceneToStep = [this](const SceneTimesteps& sceneTimesteps, size_t timestepIndex) -> AzPhysics::Scene*
+        {
+            if (timestepIndex < sceneTimesteps.m_numTimesteps && sceneTimesteps.m_sceneIndex < m_sceneList.size())
+            {
+                if (auto& scenePtr = m_sceneList[sceneTimesteps.m_sceneIndex]; scenePtr != nullptr && scenePtr->IsEnabled())
+                {
+                    return scenePtr.get();
+                }
+            }
+            return nullptr;
+        };
+
+        for (size_t timestepIndex = 0; timestepIndex < maxNumTimesteps; ++timestepIndex)
+        {
+            if (physx_parallelSceneSimulation)
+            {
+                // Start the sub-step on every scene so that PhysX simulates them together on the job worker threads,
+                // then wait for each one in scene order.
+                AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
+                for (const SceneTimesteps& sceneTimesteps : m_sceneTimesteps)
+                {
+                    if (AzPhysics::Scene* scene = getSceneToStep(sceneTimesteps, timestepIndex))
+                    {
+                        scene->StartSimulation(sceneTimesteps.m_timestep);
+                    }
+                }
+                for (const SceneTimesteps& sceneTimesteps : m_sceneTimesteps)
+                {
+                    if (AzPhysics::Scene* scene = getSceneToStep(sceneTimesteps, timestepIndex))
+                    {
+                        scene->FinishSimulation();
+                    }
+                }
+            }
+            else
+            {
+                for (const SceneTimesteps& sceneTimesteps : m_sceneTimesteps)
+                {
+                    if (AzPhysics::Scene* scene = getSceneToStep(sceneTimesteps, timestepIndex))
+                    {
+                        AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
+                        scene->StartSimulation(sceneTimesteps.m_timestep);
+                        scene->FinishSimulation();
+                    }
+                }
+            }
         }
         
         // Flush performance data for this tick
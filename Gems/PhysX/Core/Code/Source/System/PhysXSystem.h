@@ -103,6 +103,15 @@ namespace PhysX
 
         float m_accumulatedTime = 0.0f;
 
+        //! The timestep and number of sub-steps to simulate a scene for during the current Simulate call.
+        struct SceneTimesteps
+        {
+            size_t m_sceneIndex = 0;
+            float m_timestep = 0.0f;
+            size_t m_numTimesteps = 0;
+        };
+        AZStd::vector<SceneTimesteps> m_sceneTimesteps; //!< Reused by every Simulate call to avoid allocations.
+
         struct PhysXSdk
         {
             physx::PxFoundation* m_foundation = nullptr;
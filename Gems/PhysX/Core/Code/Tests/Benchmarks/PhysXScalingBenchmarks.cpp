@@ -0,0 +1,738 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/Physics/Collision/CollisionEvents.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
+#include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
+#include <AzFramework/Physics/HeightfieldProviderBus.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+
+#include <Benchmarks/PhysXBenchmarksCommon.h>
+#include <Benchmarks/PhysXBenchmarksUtilities.h>
+
+#include <PhysX/Joint/Configuration/PhysXJointConfiguration.h>
+#include <PhysX/PhysXLocks.h>
+#include <PhysXCharacters/API/CharacterController.h>
+#include <Scene/PhysXScene.h>
+
+#include <PhysXTestCommon.h>
+
+namespace PhysX::Benchmarks
+{
+    //! Scaling benchmarks run every scenario at 1k, 10k and 100k bodies, so results can be tracked for regressions as scenes grow.
+    //! Query benchmarks additionally split a fixed amount of work across a varying number of threads.
+    //! Run with --benchmark_out=<file> --benchmark_out_format=json to record the results, every benchmark reports
+    //! its body and thread counts as counters alongside the timings.
+    namespace ScalingConstants
+    {
+        //! Spacing between neighboring bodies laid out on a grid
+        static const float GridSpacing = 3.0f;
+
+        //! Half extents of the box colliders used for static geometry and triggers
+        static const float BoxSize = 1.0f;
+
+        //! Radius of the sphere colliders used for dynamic bodies and sphere queries
+        static const float SphereRadius = 0.5f;
+
+        //! Constant seed to use with random number generation
+        static const int Seed = 100;
+
+        //! Number of queries issued per iteration of the query benchmarks, split evenly across the benchmark threads
+        static const int NumQueries = 8192;
+
+        //! Number of bodies linked together by each joint chain
+        static const int JointChainLength = 32;
+
+        //! Number of game frames simulated per iteration of the frame based benchmarks
+        static const int GameFramesToSimulate = 60;
+
+        namespace BenchmarkSettings
+        {
+            //! Values passed to benchmark to select the number of bodies to spawn during each test
+            //! Current values will run tests between StartRange to EndRange (inclusive), multiplying by RangeMultiplier each step.
+            static const int StartRange = 1000;
+            static const int EndRange = 100000;
+            static const int RangeMultipler = 10;
+
+            //! Number of threads issuing queries in the thread scaling benchmarks
+            static const std::vector<int64_t> ThreadCounts = { 1, 2, 4, 8 };
+
+            //! Number of iterations for each frame based test
+            static const int NumIterations = 3;
+        } // namespace BenchmarkSettings
+    } // namespace ScalingConstants
+
+    namespace Utils
+    {
+        //! Returns the position of a body on a square grid centered around the origin, large enough to hold numBodies bodies.
+        AZ::Vector3 GetGridPosition(int index, int numBodies, float height)
+        {
+            const int bodiesPerRow = aznumeric_cast<int>(AZStd::ceil(AZStd::sqrt(aznumeric_cast<float>(numBodies))));
+            const float halfExtent = bodiesPerRow * ScalingConstants::GridSpacing * 0.5f;
+            return AZ::Vector3(
+                (index % bodiesPerRow) * ScalingConstants::GridSpacing - halfExtent,
+                (index / bodiesPerRow) * ScalingConstants::GridSpacing - halfExtent,
+                height);
+        }
+
+        //! Adds bodies built from the provided configuration to the scene, moving each one to its place on the grid.
+        //! All the bodies share the shape held by the configuration.
+        template<typename ConfigurationType>
+        AzPhysics::SimulatedBodyHandleList AddBodiesOnGrid(
+            AzPhysics::SceneHandle sceneHandle, const ConfigurationType& configuration, int numBodies, float height)
+        {
+            AZStd::vector<ConfigurationType> configurations(numBodies, configuration);
+            AzPhysics::SimulatedBodyConfigurationList configurationList;
+            configurationList.reserve(numBodies);
+            for (int i = 0; i < numBodies; i++)
+            {
+                configurations[i].m_position = GetGridPosition(i, numBodies, height);
+                configurationList.push_back(&configurations[i]);
+            }
+
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            return sceneInterface->AddSimulatedBodies(sceneHandle, configurationList);
+        }
+
+        //! Runs the provided queries, splitting them evenly across numThreads threads that each hold the scene read lock.
+        template<typename RequestType>
+        void RunQueriesOnThreads(AzPhysics::SceneHandle sceneHandle, const AZStd::vector<RequestType>& requests, size_t numThreads)
+        {
+            auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+            const size_t queriesPerThread = (requests.size() + numThreads - 1) / numThreads;
+
+            AZStd::vector<AZStd::thread> threads;
+            threads.reserve(numThreads);
+            for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+            {
+                const size_t begin = threadIndex * queriesPerThread;
+                const size_t end = AZStd::min(begin + queriesPerThread, requests.size());
+                threads.emplace_back(
+                    [sceneHandle, sceneInterface, &requests, begin, end]()
+                    {
+                        PhysXScene* azScene = static_cast<PhysXScene*>(sceneInterface->GetScene(sceneHandle));
+                        physx::PxScene* pxScene = static_cast<physx::PxScene*>(azScene->GetNativePointer());
+
+                        PHYSX_SCENE_READ_LOCK(pxScene);
+
+                        AzPhysics::SceneQueryHits result;
+                        for (size_t i = begin; i < end; ++i)
+                        {
+                            sceneInterface->QueryScene(sceneHandle, &requests[i], result);
+                            result.m_hits.clear();
+                        }
+                        benchmark::DoNotOptimize(result);
+                    });
+            }
+
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        //! Registers every combination of body count and thread count with the benchmark.
+        void ApplyBodyAndThreadCounts(benchmark::internal::Benchmark* benchmark)
+        {
+            for (int64_t numBodies = ScalingConstants::BenchmarkSettings::StartRange;
+                 numBodies <= ScalingConstants::BenchmarkSettings::EndRange;
+                 numBodies *= ScalingConstants::BenchmarkSettings::RangeMultipler)
+            {
+                for (int64_t numThreads : ScalingConstants::BenchmarkSettings::ThreadCounts)
+                {
+                    benchmark->Args({ numBodies, numThreads });
+                }
+            }
+        }
+
+        //! Reports the scene size and thread count of a benchmark, so they are recorded along with its results.
+        void ReportScalingCounters(benchmark::State& state, int64_t numBodies, int64_t numThreads = 1)
+        {
+            state.counters["Bodies"] = aznumeric_cast<double>(numBodies);
+            state.counters["Threads"] = aznumeric_cast<double>(numThreads);
+        }
+    } // namespace Utils
+
+    //! Scaling benchmark fixture.
+    //! Creates an empty scene with gravity, each benchmark populates it with the requested number of bodies.
+    class PhysXScalingBenchmarkFixture
+        : public PhysXBaseBenchmarkFixture
+    {
+    protected:
+        void internalSetUp()
+        {
+            PhysXBaseBenchmarkFixture::SetUpInternal();
+            m_random = AZ::SimpleLcgRandom(ScalingConstants::Seed);
+        }
+
+        void internalTearDown()
+        {
+            PhysXBaseBenchmarkFixture::TearDownInternal();
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        // PhysXBaseBenchmarkFixture Interface ---------
+        AzPhysics::SceneConfiguration GetDefaultSceneConfiguration() override
+        {
+            return AzPhysics::SceneConfiguration::CreateDefault();
+        }
+        // PhysXBaseBenchmarkFixture Interface ---------
+
+        //! Fills the scene with a grid of static boxes for the query benchmarks to hit.
+        AzPhysics::SimulatedBodyHandleList AddStaticBoxes(int numBodies)
+        {
+            AzPhysics::StaticRigidBodyConfiguration staticConfig;
+            staticConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(
+                AZStd::make_shared<Physics::ColliderConfiguration>(),
+                AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(ScalingConstants::BoxSize)));
+            return Utils::AddBodiesOnGrid(m_testSceneHandle, staticConfig, numBodies, 0.0f);
+        }
+
+        //! Returns a random position above the grid of numBodies bodies.
+        AZ::Vector3 GetRandomPositionAboveGrid(int numBodies, float height)
+        {
+            const AZ::Vector3 gridPosition = Utils::GetGridPosition(m_random.GetRandom() % numBodies, numBodies, height);
+            const AZ::Vector3 jitter(m_random.GetRandomFloat() - 0.5f, m_random.GetRandomFloat() - 0.5f, 0.0f);
+            return gridPosition + jitter * ScalingConstants::GridSpacing;
+        }
+
+        AZ::SimpleLcgRandom m_random;
+    };
+
+    //! BM_SimulatedBody_Churn - Adds the requested number of dynamic rigid bodies to the scene and removes them again.
+    //! Measures the cost of batched body creation and removal, the simulation step that flushes the removals is not timed.
+    BENCHMARK_DEFINE_F(PhysXScalingBenchmarkFixture, BM_SimulatedBody_Churn)(benchmark::State& state)
+    {
+        const int numBodies = aznumeric_cast<int>(state.range(0));
+
+        AzPhysics::RigidBodyConfiguration rigidBodyConfig;
+        rigidBodyConfig.m_computeMass = false;
+        rigidBodyConfig.m_mass = 1.0f;
+        rigidBodyConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(
+            AZStd::make_shared<Physics::ColliderConfiguration>(),
+            AZStd::make_shared<Physics::SphereShapeConfiguration>(ScalingConstants::SphereRadius));
+
+        AZStd::vector<int64_t> executionTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            AzPhysics::SimulatedBodyHandleList bodyHandles =
+                Utils::AddBodiesOnGrid(m_testSceneHandle, rigidBodyConfig, numBodies, ScalingConstants::GridSpacing);
+            m_defaultScene->RemoveSimulatedBodies(bodyHandles);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            // removed bodies are released at the end of the next simulation step
+            state.PauseTiming();
+            StepScene1Tick(DefaultTimeStep);
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * numBodies);
+        Utils::ReportScalingCounters(state, numBodies);
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    //! BM_Raycast_Scaling - Casts rays down onto the requested number of static boxes from the requested number of threads.
+    BENCHMARK_DEFINE_F(PhysXScalingBenchmarkFixture, BM_Raycast_Scaling)(benchmark::State& state)
+    {
+        const int numBodies = aznumeric_cast<int>(state.range(0));
+        const size_t numThreads = aznumeric_cast<size_t>(state.range(1));
+        AzPhysics::SimulatedBodyHandleList bodyHandles = AddStaticBoxes(numBodies);
+
+        AZStd::vector<AzPhysics::RayCastRequest> requests(ScalingConstants::NumQueries);
+        for (AzPhysics::RayCastRequest& request : requests)
+        {
+            request.m_start = GetRandomPositionAboveGrid(numBodies, ScalingConstants::GridSpacing * 2.0f);
+            request.m_direction = -AZ::Vector3::CreateAxisZ();
+            request.m_distance = ScalingConstants::GridSpacing * 4.0f;
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            Utils::RunQueriesOnThreads(m_testSceneHandle, requests, numThreads);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+        }
+
+        m_defaultScene->RemoveSimulatedBodies(bodyHandles);
+
+        state.SetItemsProcessed(state.iterations() * ScalingConstants::NumQueries);
+        Utils::ReportScalingCounters(state, numBodies, numThreads);
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    //! BM_Shapecast_Scaling - Sweeps spheres down onto the requested number of static boxes from the requested number of threads.
+    BENCHMARK_DEFINE_F(PhysXScalingBenchmarkFixture, BM_Shapecast_Scaling)(benchmark::State& state)
+    {
+        const int numBodies = aznumeric_cast<int>(state.range(0));
+        const size_t numThreads = aznumeric_cast<size_t>(state.range(1));
+        AzPhysics::SimulatedBodyHandleList bodyHandles = AddStaticBoxes(numBodies);
+
+        AZStd::vector<AzPhysics::ShapeCastRequest> requests;
+        requests.reserve(ScalingConstants::NumQueries);
+        for (int i = 0; i < ScalingConstants::NumQueries; i++)
+        {
+            requests.emplace_back(AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
+                ScalingConstants::SphereRadius,
+                AZ::Transform::CreateTranslation(GetRandomPositionAboveGrid(numBodies, ScalingConstants::GridSpacing * 2.0f)),
+                -AZ::Vector3::CreateAxisZ(),
+                ScalingConstants::GridSpacing * 4.0f));
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            Utils::RunQueriesOnThreads(m_testSceneHandle, requests, numThreads);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+        }
+
+        m_defaultScene->RemoveSimulatedBodies(bodyHandles);
+
+        state.SetItemsProcessed(state.iterations() * ScalingConstants::NumQueries);
+        Utils::ReportScalingCounters(state, numBodies, numThreads);
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    //! BM_Overlap_Scaling - Overlaps spheres with the requested number of static boxes from the requested number of threads.
+    BENCHMARK_DEFINE_F(PhysXScalingBenchmarkFixture, BM_Overlap_Scaling)(benchmark::State& state)
+    {
+        const int numBodies = aznumeric_cast<int>(state.range(0));
+        const size_t numThreads = aznumeric_cast<size_t>(state.range(1));
+        AzPhysics::SimulatedBodyHandleList bodyHandles = AddStaticBoxes(numBodies);
+
+        AZStd::vector<AzPhysics::OverlapRequest> requests;
+        requests.reserve(ScalingConstants::NumQueries);
+        for (int i = 0; i < ScalingConstants::NumQueries; i++)
+        {
+            requests.emplace_back(AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(
+                ScalingConstants::GridSpacing,
+                AZ::Transform::CreateTranslation(GetRandomPositionAboveGrid(numBodies, 0.0f))));
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            Utils::RunQueriesOnThreads(m_testSceneHandle, requests, numThreads);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+        }
+
+        m_defaultScene->RemoveSimulatedBodies(bodyHandles);
+
+        state.SetItemsProcessed(state.iterations() * ScalingConstants::NumQueries);
+        Utils::ReportScalingCounters(state, numBodies, numThreads);
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    //! BM_RaycastBatch_Scaling - Casts rays down onto the requested number of static boxes with a single batched scene query,
+    //! which spreads the queries across the task graph workers when they are available.
+    BENCHMARK_DEFINE_F(PhysXScalingBenchmarkFixture, BM_RaycastBatch_Scaling)(benchmark::State& state)
+    {
+        const int numBodies = aznumeric_cast<int>(state.range(0));
+        AzPhysics::SimulatedBodyHandleList bodyHandles = AddStaticBoxes(numBodies);
+
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(ScalingConstants::NumQueries);
+        for (int i = 0; i < ScalingConstants::NumQueries; i++)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = GetRandomPositionAboveGrid(numBodies, ScalingConstants::GridSpacing * 2.0f);
+            request->m_direction = -AZ::Vector3::CreateAxisZ();
+            request->m_distance = ScalingConstants::GridSpacing * 4.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AZStd::vector<int64_t> executionTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(results);
+        }
+
+        m_defaultScene->RemoveSimulatedBodies(bodyHandles);
+
+        state.SetItemsProcessed(state.iterations() * ScalingConstants::NumQueries);
+        Utils::ReportScalingCounters(state, numBodies);
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    //! BM_HeightfieldRaycast_Scaling - Casts rays down onto a heightfield with the requested number of samples
+    //! from the requested number of threads.
+    BENCHMARK_DEFINE_F(PhysXScalingBenchmarkFixture, BM_HeightfieldRaycast_Scaling)(benchmark::State& state)
+    {
+        const int numSamples = aznumeric_cast<int>(state.range(0));
+        const size_t numThreads = aznumeric_cast<size_t>(state.range(1));
+
+        const size_t verticesPerSide = aznumeric_cast<size_t>(AZStd::ceil(AZStd::sqrt(aznumeric_cast<float>(numSamples))));
+        const float heightBounds = ScalingConstants::GridSpacing;
+
+        auto heightfieldConfig = AZStd::make_shared<Physics::HeightfieldShapeConfiguration>();
+        heightfieldConfig->SetNumRowVertices(verticesPerSide);
+        heightfieldConfig->SetNumColumnVertices(verticesPerSide);
+        heightfieldConfig->SetGridResolution(AZ::Vector2(ScalingConstants::GridSpacing));
+        heightfieldConfig->SetMinHeightBounds(-heightBounds);
+        heightfieldConfig->SetMaxHeightBounds(heightBounds);
+
+        AZStd::vector<Physics::HeightMaterialPoint> samples(verticesPerSide * verticesPerSide);
+        for (Physics::HeightMaterialPoint& sample : samples)
+        {
+            sample.m_height = (m_random.GetRandomFloat() * 2.0f - 1.0f) * heightBounds;
+        }
+        heightfieldConfig->SetSamples(samples);
+
+        AzPhysics::StaticRigidBodyConfiguration heightfieldBodyConfig;
+        heightfieldBodyConfig.m_colliderAndShapeData =
+            AzPhysics::ShapeColliderPair(AZStd::make_shared<Physics::ColliderConfiguration>(), heightfieldConfig);
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AzPhysics::SimulatedBodyHandle heightfieldHandle = sceneInterface->AddSimulatedBody(m_testSceneHandle, &heightfieldBodyConfig);
+
+        AZStd::vector<AzPhysics::RayCastRequest> requests(ScalingConstants::NumQueries);
+        for (AzPhysics::RayCastRequest& request : requests)
+        {
+            request.m_start = GetRandomPositionAboveGrid(numSamples, heightBounds * 2.0f);
+            request.m_direction = -AZ::Vector3::CreateAxisZ();
+            request.m_distance = heightBounds * 4.0f;
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            auto start = AZStd::chrono::steady_clock::now();
+
+            Utils::RunQueriesOnThreads(m_testSceneHandle, requests, numThreads);
+
+            auto timeElasped = AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(AZStd::chrono::steady_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+        }
+
+        sceneInterface->RemoveSimulatedBody(m_testSceneHandle, heightfieldHandle);
+
+        state.SetItemsProcessed(state.iterations() * ScalingConstants::NumQueries);
+        Utils::ReportScalingCounters(state, numSamples, numThreads);
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+    }
+
+    //! BM_CharacterController_Scaling - Spawns the requested number of character controllers on a floor and moves them every frame.
+    //! The test will run the simulation for ~60 game frames at 60fps, timing the character updates and the simulation step.
+    BENCHMARK_DEFINE_F(PhysXScalingBenchmarkFixture, BM_CharacterController_Scaling)(benchmark::State& state)
+    {
+        const int numCharacters = aznumeric_cast<int>(state.range(0));
+
+        const float floorSize = Utils::GetGridPosition(0, numCharacters, 0.0f).GetLength() * 4.0f;
+        AzPhysics::SimulatedBodyHandle floorHandle = TestUtils::AddStaticBoxToScene(
+            m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, -ScalingConstants::BoxSize), AZ::Vector3(floorSize, floorSize, ScalingConstants::BoxSize));
+
+        PhysX::CharacterControllerConfiguration characterConfig;
+        characterConfig.m_shapeConfig = AZStd::make_shared<Physics::CapsuleShapeConfiguration>(
+            ScalingConstants::BoxSize * 2.0f, ScalingConstants::SphereRadius);
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AZStd::vector<Physics::Character*> controllers;
+        controllers.reserve(numCharacters);
+        for (int i = 0; i < numCharacters; i++)
+        {
+            characterConfig.m_position = Utils::GetGridPosition(i, numCharacters, ScalingConstants::BoxSize);
+            AzPhysics::SimulatedBodyHandle newHandle = sceneInterface->AddSimulatedBody(m_testSceneHandle, &characterConfig);
+            if (auto* character =
+                    azdynamic_cast<Physics::Character*>(sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, newHandle)))
+            {
+                controllers.emplace_back(character);
+            }
+        }
+
+        AZStd::vector<AZ::Vector3> velocities(controllers.size());
+        for (AZ::Vector3& velocity : velocities)
+        {
+            velocity = AZ::Vector3(m_random.GetRandomFloat() - 0.5f, m_random.GetRandomFloat() - 0.5f, 0.0f);
+        }
+
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        Types::TimeList tickTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < ScalingConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+
+                for (size_t characterIndex = 0; characterIndex < controllers.size(); characterIndex++)
+                {
+                    controllers[characterIndex]->AddVelocity(velocities[characterIndex]);
+                    controllers[characterIndex]->ApplyRequestedVelocity(DefaultTimeStep);
+                }
+                StepScene1Tick(DefaultTimeStep);
+
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+        subTickTracker.Stop();
+
+        for (Physics::Character* character : controllers)
+        {
+            sceneInterface->RemoveSimulatedBody(m_testSceneHandle, character->m_bodyHandle);
+        }
+        sceneInterface->RemoveSimulatedBody(m_testSceneHandle, floorHandle);
+
+        state.SetItemsProcessed(state.iterations() * ScalingConstants::GameFramesToSimulate * controllers.size());
+        Utils::ReportScalingCounters(state, numCharacters);
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+    }
+
+    //! BM_JointChains_Scaling - Links the requested number of rigid bodies into chains hanging from static anchors.
+    //! The test will run the simulation for ~60 game frames at 60fps while the chains swing.
+    BENCHMARK_DEFINE_F(PhysXScalingBenchmarkFixture, BM_JointChains_Scaling)(benchmark::State& state)
+    {
+        const int numBodies = aznumeric_cast<int>(state.range(0));
+        const int numChains = numBodies / ScalingConstants::JointChainLength;
+        const float chainHeight = ScalingConstants::JointChainLength * ScalingConstants::SphereRadius * 2.0f;
+
+        auto sphereShapeConfiguration = AZStd::make_shared<Physics::SphereShapeConfiguration>(ScalingConstants::SphereRadius);
+        AzPhysics::ShapeColliderPair shapeColliderConfig(AZStd::make_shared<Physics::ColliderConfiguration>(), sphereShapeConfiguration);
+
+        AzPhysics::StaticRigidBodyConfiguration anchorConfig;
+        anchorConfig.m_colliderAndShapeData = shapeColliderConfig;
+        AzPhysics::SimulatedBodyHandleList anchorHandles = Utils::AddBodiesOnGrid(m_testSceneHandle, anchorConfig, numChains, chainHeight);
+
+        // the links of every chain are added one layer at a time, each layer hanging below the previous one
+        AzPhysics::RigidBodyConfiguration linkConfig;
+        linkConfig.m_computeMass = false;
+        linkConfig.m_mass = 1.0f;
+        linkConfig.m_colliderAndShapeData = shapeColliderConfig;
+        // start the chains swinging
+        linkConfig.m_initialLinearVelocity = AZ::Vector3(1.0f, 0.0f, 0.0f);
+
+        PhysX::D6JointLimitConfiguration jointConfig;
+        jointConfig.m_swingLimitY = 45.0f;
+        jointConfig.m_swingLimitZ = 45.0f;
+
+        AzPhysics::SimulatedBodyHandleList bodyHandles;
+        AZStd::vector<AzPhysics::JointHandle> jointHandles;
+        bodyHandles.reserve(numChains * ScalingConstants::JointChainLength);
+        jointHandles.reserve(numChains * ScalingConstants::JointChainLength);
+
+        AzPhysics::SimulatedBodyHandleList parentHandles = anchorHandles;
+        for (int link = 1; link <= ScalingConstants::JointChainLength; link++)
+        {
+            const float linkHeight = chainHeight - link * ScalingConstants::SphereRadius * 2.0f;
+            AzPhysics::SimulatedBodyHandleList linkHandles = Utils::AddBodiesOnGrid(m_testSceneHandle, linkConfig, numChains, linkHeight);
+            for (size_t chain = 0; chain < linkHandles.size(); chain++)
+            {
+                jointHandles.emplace_back(m_defaultScene->AddJoint(&jointConfig, linkHandles[chain], parentHandles[chain]));
+            }
+            bodyHandles.insert(bodyHandles.end(), linkHandles.begin(), linkHandles.end());
+            parentHandles = AZStd::move(linkHandles);
+        }
+
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        Types::TimeList tickTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < ScalingConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+        subTickTracker.Stop();
+
+        for (const AzPhysics::JointHandle& jointHandle : jointHandles)
+        {
+            m_defaultScene->RemoveJoint(jointHandle);
+        }
+        m_defaultScene->RemoveSimulatedBodies(bodyHandles);
+        m_defaultScene->RemoveSimulatedBodies(anchorHandles);
+
+        Utils::ReportScalingCounters(state, numBodies);
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+    }
+
+    //! BM_TriggerEvents_Scaling - Drops the requested number of dynamic spheres through as many static trigger boxes.
+    //! The test will run the simulation for ~60 game frames at 60fps, with a scene handler receiving every trigger event.
+    BENCHMARK_DEFINE_F(PhysXScalingBenchmarkFixture, BM_TriggerEvents_Scaling)(benchmark::State& state)
+    {
+        const int numBodies = aznumeric_cast<int>(state.range(0));
+
+        auto triggerColliderConfig = AZStd::make_shared<Physics::ColliderConfiguration>();
+        triggerColliderConfig->m_isTrigger = true;
+        AzPhysics::StaticRigidBodyConfiguration triggerConfig;
+        triggerConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(
+            triggerColliderConfig, AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(ScalingConstants::BoxSize)));
+        AzPhysics::SimulatedBodyHandleList triggerHandles = Utils::AddBodiesOnGrid(m_testSceneHandle, triggerConfig, numBodies, 0.0f);
+
+        AzPhysics::RigidBodyConfiguration sphereConfig;
+        sphereConfig.m_computeMass = false;
+        sphereConfig.m_mass = 1.0f;
+        sphereConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(
+            AZStd::make_shared<Physics::ColliderConfiguration>(),
+            AZStd::make_shared<Physics::SphereShapeConfiguration>(ScalingConstants::SphereRadius));
+
+        size_t numTriggerEvents = 0;
+        AzPhysics::SceneEvents::OnSceneTriggersEvent::Handler triggerHandler(
+            [&numTriggerEvents]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, const AzPhysics::TriggerEventList& triggerEvents)
+            {
+                numTriggerEvents += triggerEvents.size();
+            });
+        m_defaultScene->RegisterSceneTriggersEventHandler(triggerHandler);
+
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        Types::TimeList tickTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            // drop a fresh set of spheres through the triggers every iteration
+            state.PauseTiming();
+            AzPhysics::SimulatedBodyHandleList sphereHandles =
+                Utils::AddBodiesOnGrid(m_testSceneHandle, sphereConfig, numBodies, ScalingConstants::BoxSize * 2.0f);
+            state.ResumeTiming();
+
+            for (AZ::u32 i = 0; i < ScalingConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+
+            state.PauseTiming();
+            m_defaultScene->RemoveSimulatedBodies(sphereHandles);
+            StepScene1Tick(DefaultTimeStep);
+            state.ResumeTiming();
+        }
+        subTickTracker.Stop();
+        triggerHandler.Disconnect();
+
+        m_defaultScene->RemoveSimulatedBodies(triggerHandles);
+
+        state.SetItemsProcessed(numTriggerEvents);
+        state.counters["TriggerEvents"] = aznumeric_cast<double>(numTriggerEvents);
+        Utils::ReportScalingCounters(state, numBodies);
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+    }
+
+    BENCHMARK_REGISTER_F(PhysXScalingBenchmarkFixture, BM_SimulatedBody_Churn)
+        ->RangeMultiplier(ScalingConstants::BenchmarkSettings::RangeMultipler)
+        ->Range(ScalingConstants::BenchmarkSettings::StartRange, ScalingConstants::BenchmarkSettings::EndRange)
+        ->Unit(benchmark::kMillisecond)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXScalingBenchmarkFixture, BM_Raycast_Scaling)
+        ->Apply(Utils::ApplyBodyAndThreadCounts)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXScalingBenchmarkFixture, BM_Shapecast_Scaling)
+        ->Apply(Utils::ApplyBodyAndThreadCounts)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXScalingBenchmarkFixture, BM_Overlap_Scaling)
+        ->Apply(Utils::ApplyBodyAndThreadCounts)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXScalingBenchmarkFixture, BM_RaycastBatch_Scaling)
+        ->RangeMultiplier(ScalingConstants::BenchmarkSettings::RangeMultipler)
+        ->Range(ScalingConstants::BenchmarkSettings::StartRange, ScalingConstants::BenchmarkSettings::EndRange)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXScalingBenchmarkFixture, BM_HeightfieldRaycast_Scaling)
+        ->Apply(Utils::ApplyBodyAndThreadCounts)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXScalingBenchmarkFixture, BM_CharacterController_Scaling)
+        ->RangeMultiplier(ScalingConstants::BenchmarkSettings::RangeMultipler)
+        ->Range(ScalingConstants::BenchmarkSettings::StartRange, ScalingConstants::BenchmarkSettings::EndRange)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(ScalingConstants::BenchmarkSettings::NumIterations)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXScalingBenchmarkFixture, BM_JointChains_Scaling)
+        ->RangeMultiplier(ScalingConstants::BenchmarkSettings::RangeMultipler)
+        ->Range(ScalingConstants::BenchmarkSettings::StartRange, ScalingConstants::BenchmarkSettings::EndRange)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(ScalingConstants::BenchmarkSettings::NumIterations)
+        ;
+
+    BENCHMARK_REGISTER_F(PhysXScalingBenchmarkFixture, BM_TriggerEvents_Scaling)
+        ->RangeMultiplier(ScalingConstants::BenchmarkSettings::RangeMultipler)
+        ->Range(ScalingConstants::BenchmarkSettings::StartRange, ScalingConstants::BenchmarkSettings::EndRange)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(ScalingConstants::BenchmarkSettings::NumIterations)
+        ;
+} // namespace PhysX::Benchmarks
+#endif // HAVE_BENCHMARK
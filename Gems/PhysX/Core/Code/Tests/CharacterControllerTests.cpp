@@ -6,9 +6,11 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 
 #include <PhysXCharacters/API/CharacterController.h>
+#include <PhysXCharacters/API/CharacterControllerBatch.h>
 #include <PhysXCharacters/API/CharacterUtils.h>
 #include <PhysXCharacters/Components/CharacterControllerComponent.h>
 
@@ -19,6 +21,7 @@
 #include <PhysX/SystemComponentBus.h>
 #include <Source/SphereColliderComponent.h>
 #include <Source/CapsuleColliderComponent.h>
+#include <Scene/PhysXScene.h>
 #include <System/PhysXSystem.h>
 #include <Tests/PhysXTestFixtures.h>
 #include <Tests/PhysXTestUtil.h>
@@ -26,6 +29,8 @@
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_batchCharacterControllerUpdates);
+
     namespace Internal
     {
         void AddColliderComponentToEntity(AZ::Entity* entity, const Physics::ColliderConfiguration& colliderConfiguration, const Physics::ShapeConfiguration& shapeConfiguration)
@@ -176,6 +181,31 @@ namespace PhysX
         }
     }
 
+    TEST_F(PhysXDefaultWorldTest, CharacterController_BatchedUpdate_MovesAtDesiredVelocityAndUpdatesTransform)
+    {
+        physx_batchCharacterControllerUpdates = true;
+        ControllerTestBasis basis(m_testSceneHandle);
+        physx_batchCharacterControllerUpdates = false;
+
+        auto* physXScene = azdynamic_cast<PhysXScene*>(basis.m_testScene);
+        ASSERT_NE(physXScene, nullptr);
+        CharacterControllerBatch* batch = physXScene->GetCharacterControllerBatch();
+        ASSERT_NE(batch, nullptr);
+        EXPECT_EQ(batch->GetControllerCount(), 1u);
+
+        basis.Update(AZ::Vector3::CreateZero());
+        const AZ::Vector3 desiredVelocity = AZ::Vector3::CreateAxisX();
+        const AZ::u32 numTimeSteps = 50;
+        basis.Update(desiredVelocity, numTimeSteps);
+
+        const AZ::Vector3 expectedPosition = AZ::Vector3::CreateAxisX(basis.m_timeStep * numTimeSteps);
+        EXPECT_THAT(basis.m_controller->GetBasePosition(), UnitTest::IsCloseTolerance(expectedPosition, 0.01f));
+        EXPECT_THAT(basis.m_controllerEntity->GetTransform()->GetWorldTranslation(), UnitTest::IsCloseTolerance(expectedPosition, 0.01f));
+
+        basis.m_controllerEntity->Deactivate();
+        EXPECT_EQ(batch->GetControllerCount(), 0u);
+    }
+
     TEST_F(PhysXDefaultWorldTest, CharacterController_MovingDirectlyTowardsStaticBox_StoppedByBox)
     {
         ControllerTestBasis basis(m_testSceneHandle);
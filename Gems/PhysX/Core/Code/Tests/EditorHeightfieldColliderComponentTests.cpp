@@ -398,6 +398,55 @@ namespace PhysXEditorTests
         }
     }
 
+    TEST_F(PhysXEditorHeightfieldFixture, EditorHeightfieldColliderComponentRepeatedHeightDataChangesCorrectRuntimeHeights)
+    {
+        AZ::EntityId gameEntityId = m_gameEntity->GetId();
+
+        // Send several data changes back to back so that later changes arrive while the refresh for the earlier ones is running.
+        constexpr int numDataChanges = 8;
+        for (int change = 0; change < numDataChanges; ++change)
+        {
+            Physics::HeightfieldProviderNotificationBus::Event(
+                gameEntityId, &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged,
+                AZ::Aabb::CreateFromMinMaxValues(0.0f, 1.0f, -3.0f, 2.0f, 3.0f, 3.0f),
+                Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::HeightData);
+        }
+
+        // Blocking should wait for the queued changes as well as the refresh that was running when they arrived.
+        auto runtimeHeightfieldComponent = m_gameEntity->FindComponent<PhysX::HeightfieldColliderComponent>();
+        runtimeHeightfieldComponent->BlockOnPendingJobs();
+
+        AzPhysics::SimulatedBody* staticBody = nullptr;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+            staticBody, gameEntityId, &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBody);
+        ASSERT_TRUE(staticBody != nullptr);
+        const auto* pxRigidStatic = static_cast<const physx::PxRigidStatic*>(staticBody->GetNativePointer());
+
+        PHYSX_SCENE_READ_LOCK(pxRigidStatic->getScene());
+
+        physx::PxShape* shape = nullptr;
+        pxRigidStatic->getShapes(&shape, 1, 0);
+
+        physx::PxHeightFieldGeometry heightfieldGeometry;
+        shape->getHeightFieldGeometry(heightfieldGeometry);
+        physx::PxHeightField* heightfield = heightfieldGeometry.heightField;
+
+        const AZStd::vector<Physics::HeightMaterialPoint> samples = GetSamples();
+        constexpr size_t numRows = 3;
+        constexpr size_t numColumns = 3;
+        const float scaleFactor = AZStd::numeric_limits<int16_t>::max() / 3.0f;
+
+        for (size_t sampleRow = 0; sampleRow < numRows; ++sampleRow)
+        {
+            for (size_t sampleColumn = 0; sampleColumn < numColumns; ++sampleColumn)
+            {
+                physx::PxHeightFieldSample samplePhysX =
+                    heightfield->getSample(static_cast<physx::PxU32>(sampleRow), static_cast<physx::PxU32>(sampleColumn));
+                EXPECT_EQ(samplePhysX.height, azlossy_cast<physx::PxI16>(samples[sampleRow * numColumns + sampleColumn].m_height * scaleFactor));
+            }
+        }
+    }
+
     TEST_F(PhysXEditorHeightfieldFixture, EditorHeightfieldColliderComponentHeightfieldColliderCorrectMaterials)
     {
         AZ::EntityId gameEntityId = m_gameEntity->GetId();
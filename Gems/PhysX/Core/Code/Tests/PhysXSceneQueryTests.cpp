@@ -1007,4 +1007,170 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ResultsMatchRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup a row of bodies, large enough for the batch to be split over several tasks
+        constexpr size_t numBodies = 200;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        simBodies.reserve(numBodies);
+        for (size_t i = 0; i < numBodies; i++)
+        {
+            simBodies.emplace_back(TestUtils::AddStaticBoxToScene(m_testSceneHandle, AZ::Vector3(aznumeric_cast<float>(i) * 5.0f, 0.0f, 0.0f), AZ::Vector3(1.0f)));
+        }
+
+        //create a downward raycast request above each body
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(numBodies);
+        for (size_t i = 0; i < numBodies; i++)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3(aznumeric_cast<float>(i) * 5.0f, 0.0f, 10.0f);
+            request->m_direction = AZ::Vector3(0.0f, 0.0f, -1.0f);
+            request->m_distance = 20.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackReceivesExpectedHitAfterSimulation)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        constexpr AzPhysics::SceneQuery::AsyncRequestId requestId = 42;
+        AzPhysics::SceneQuery::AsyncRequestId receivedRequestId = 0;
+        AzPhysics::SceneQueryHits receivedHits;
+        bool callbackInvoked = false;
+        {
+            // the request only needs to live until the query is issued
+            AzPhysics::RayCastRequest request;
+            request.m_start = AZ::Vector3::CreateZero();
+            request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+            request.m_distance = 200.0f;
+
+            const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, requestId, &request,
+                [&](AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHits hits)
+                {
+                    callbackInvoked = true;
+                    receivedRequestId = id;
+                    receivedHits = AZStd::move(hits);
+                });
+            EXPECT_TRUE(queued);
+        }
+
+        // results are delivered on the simulating thread once the query completed
+        for (int i = 0; i < 100 && !callbackInvoked; i++)
+        {
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        }
+
+        EXPECT_TRUE(callbackInvoked);
+        EXPECT_EQ(receivedRequestId, requestId);
+        ASSERT_EQ(receivedHits.m_hits.size(), 1);
+        EXPECT_TRUE(receivedHits.m_hits[0].m_bodyHandle == sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallbackReceivesResultsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = pos.GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQueryHitsList results;
+        bool callbackInvoked = false;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 7, requests,
+            [&](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                callbackInvoked = true;
+                results = AZStd::move(hits);
+            });
+        EXPECT_TRUE(queued);
+
+        for (int i = 0; i < 100 && !callbackInvoked; i++)
+        {
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        }
+
+        EXPECT_TRUE(callbackInvoked);
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_MultipleRequests_CallbacksInvokedInSubmissionOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        request.m_distance = 200.0f;
+
+        constexpr size_t requestCount = 8;
+        AZStd::vector<AzPhysics::SceneQuery::AsyncRequestId> receivedRequestIds;
+        for (size_t i = 0; i < requestCount; i++)
+        {
+            const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, aznumeric_cast<AzPhysics::SceneQuery::AsyncRequestId>(i), &request,
+                [&](AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHits)
+                {
+                    receivedRequestIds.push_back(id);
+                });
+            EXPECT_TRUE(queued);
+        }
+
+        for (int i = 0; i < 100 && receivedRequestIds.size() < requestCount; i++)
+        {
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        }
+
+        ASSERT_EQ(receivedRequestIds.size(), requestCount);
+        for (size_t i = 0; i < requestCount; i++)
+        {
+            EXPECT_EQ(receivedRequestIds[i], aznumeric_cast<AzPhysics::SceneQuery::AsyncRequestId>(i));
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_NullRequest_IsNotQueued)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 0, nullptr,
+            [](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHits) {});
+        EXPECT_FALSE(queued);
+    }
 }
@@ -11,6 +11,8 @@
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/Shape.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 
 namespace PhysX
 {
@@ -588,4 +590,58 @@ namespace PhysX
 
         EXPECT_TRUE(handlerTriggered);
     }
+
+    TEST_F(PhysXSceneFixture, AddSimulatedBodies_SharedShapeConfiguration_EachBodyHasMatchingShape)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        auto colliderConfig = AZStd::make_shared<Physics::ColliderConfiguration>();
+        colliderConfig->m_collisionLayer = AzPhysics::CollisionLayer(3);
+        colliderConfig->m_tag = "Debris";
+        AzPhysics::ShapeColliderPair shapeColliderData(colliderConfig,
+            AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+
+        constexpr const int numberOfBodies = 20;
+        AZStd::vector<AzPhysics::RigidBodyConfiguration> rigidBodyConfigs(numberOfBodies);
+        AzPhysics::SimulatedBodyConfigurationList configs;
+        for (int i = 0; i < numberOfBodies; i++)
+        {
+            rigidBodyConfigs[i].m_colliderAndShapeData = shapeColliderData;
+            rigidBodyConfigs[i].m_position = AZ::Vector3::CreateAxisX(5.0f * static_cast<float>(i));
+            configs.emplace_back(&rigidBodyConfigs[i]);
+        }
+
+        AzPhysics::SimulatedBodyHandleList newBodies = sceneInterface->AddSimulatedBodies(m_testSceneHandle, configs);
+        ASSERT_EQ(newBodies.size(), configs.size());
+
+        //every body owns its own shape, with the same properties as the first one created
+        AZStd::vector<Physics::Shape*> shapes;
+        for (const AzPhysics::SimulatedBodyHandle& handle : newBodies)
+        {
+            auto* rigidBody = azdynamic_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, handle));
+            ASSERT_TRUE(rigidBody != nullptr);
+            EXPECT_TRUE(rigidBody->m_simulating);
+            ASSERT_EQ(rigidBody->GetShapeCount(), 1);
+
+            AZStd::shared_ptr<Physics::Shape> shape = rigidBody->GetShape(0);
+            EXPECT_EQ(shape->GetCollisionLayer(), colliderConfig->m_collisionLayer);
+            EXPECT_EQ(shape->GetTag(), AZ::Crc32("Debris"));
+            EXPECT_TRUE(shape->GetAabbLocal().IsClose(
+                AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(0.5f, 1.0f, 1.5f))));
+            EXPECT_TRUE(AZStd::find(shapes.begin(), shapes.end(), shape.get()) == shapes.end());
+            shapes.push_back(shape.get());
+        }
+
+        //the bodies are simulated
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 10);
+        auto* firstBody = sceneInterface->GetSimulatedBodyFromHandle(m_testSceneHandle, newBodies[0]);
+        EXPECT_LT(firstBody->GetPosition().GetZ(), 0.0f);
+
+        //and can be removed at once
+        sceneInterface->RemoveSimulatedBodies(m_testSceneHandle, newBodies);
+        for (const AzPhysics::SimulatedBodyHandle& handle : newBodies)
+        {
+            EXPECT_EQ(handle, AzPhysics::InvalidSimulatedBodyHandle);
+        }
+    }
 }
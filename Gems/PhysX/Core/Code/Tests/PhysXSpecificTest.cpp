@@ -11,6 +11,7 @@
 
 #include <AzTest/AzTest.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include <AZTestShared/Utils/Utils.h>
@@ -39,6 +40,8 @@
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_bufferContactEvents);
+
     class PhysXSpecificTest
         : public PhysXDefaultWorldTest
         , public UnitTest::TraceBusRedirector
@@ -767,6 +770,147 @@ namespace PhysX
         ASSERT_TRUE(true);
     }
 
+    TEST_F(PhysXSpecificTest, CollisionEvents_BufferContactEvents_ContactsRecordedInBufferInsteadOfSignaled)
+    {
+        physx_bufferContactEvents = true;
+
+        // Given a rigid body falling onto a static box.
+        auto staticBox = TestUtils::AddStaticUnitTestObject<BoxColliderComponent>(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 0.0f), "StaticTestBox");
+        auto testBox = TestUtils::AddUnitTestObject(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 1.2f), "TestBox");
+
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        const AzPhysics::SimulatedBodyHandle testBoxHandle = AZStd::get<1>(physicsSystem->FindAttachedBodyHandleFromEntityId(testBox->GetId()));
+        const AzPhysics::SimulatedBodyHandle staticBoxHandle = AZStd::get<1>(physicsSystem->FindAttachedBodyHandleFromEntityId(staticBox->GetId()));
+
+        int collisionEventCount = 0;
+        CollisionCallbacksListener collisionListener(testBox->GetId());
+        collisionListener.m_onCollisionBegin = [&collisionEventCount]([[maybe_unused]] const AzPhysics::CollisionEvent& collisionEvent)
+        {
+            ++collisionEventCount;
+        };
+
+        // When the scene is simulated, read the buffered contacts of the box at the end of each step.
+        int bufferedBeginCount = 0;
+        size_t bufferedContactCount = 0;
+        auto* scene = static_cast<PhysXScene*>(m_defaultScene);
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler simulationFinishHandler(
+            [&]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                scene->GetContactEventBuffer().VisitContactPairs(testBoxHandle,
+                    [&](const BufferedContactPair& pair, AZStd::span<const AzPhysics::Contact> contacts)
+                    {
+                        const bool isBoxPair = (pair.m_bodyHandle1 == testBoxHandle && pair.m_bodyHandle2 == staticBoxHandle) ||
+                            (pair.m_bodyHandle1 == staticBoxHandle && pair.m_bodyHandle2 == testBoxHandle);
+                        EXPECT_TRUE(isBoxPair);
+                        if (pair.m_type == AzPhysics::CollisionEvent::Type::Begin)
+                        {
+                            ++bufferedBeginCount;
+                        }
+                        bufferedContactCount += contacts.size();
+                    });
+            });
+        scene->RegisterSceneSimulationFinishHandler(simulationFinishHandler);
+
+        TestUtils::UpdateScene(m_defaultScene, 1.0f / 30.0f, 30);
+
+        // Then the contacts are in the buffer and no collision event was signaled.
+        EXPECT_EQ(bufferedBeginCount, 1);
+        EXPECT_GT(bufferedContactCount, 0u);
+        EXPECT_EQ(collisionEventCount, 0);
+
+        simulationFinishHandler.Disconnect();
+        physx_bufferContactEvents = false;
+    }
+
+    TEST_F(PhysXSpecificTest, CollisionEvents_BufferContactEventsDisabled_CollisionEventsSignaledAndBufferEmpty)
+    {
+        physx_bufferContactEvents = false;
+
+        // Given a rigid body falling onto a static box.
+        auto staticBox = TestUtils::AddStaticUnitTestObject<BoxColliderComponent>(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 0.0f), "StaticTestBox");
+        auto testBox = TestUtils::AddUnitTestObject(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 1.2f), "TestBox");
+
+        int collisionBeginCount = 0;
+        CollisionCallbacksListener collisionListener(testBox->GetId());
+        collisionListener.m_onCollisionBegin = [&collisionBeginCount]([[maybe_unused]] const AzPhysics::CollisionEvent& collisionEvent)
+        {
+            ++collisionBeginCount;
+        };
+
+        // When the scene is simulated, check the buffer at the end of each step.
+        bool bufferEmpty = true;
+        auto* scene = static_cast<PhysXScene*>(m_defaultScene);
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler simulationFinishHandler(
+            [&]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                bufferEmpty = bufferEmpty && scene->GetContactEventBuffer().IsEmpty();
+            });
+        scene->RegisterSceneSimulationFinishHandler(simulationFinishHandler);
+
+        TestUtils::UpdateScene(m_defaultScene, 1.0f / 30.0f, 30);
+
+        // Then the collision events are signaled as usual and nothing is buffered.
+        EXPECT_EQ(collisionBeginCount, 1);
+        EXPECT_TRUE(bufferEmpty);
+
+        simulationFinishHandler.Disconnect();
+    }
+
+    TEST_F(PhysXSpecificTest, CollisionEvents_BufferContactEvents_PairsOfBodyRemovedDuringStepDropped)
+    {
+        physx_bufferContactEvents = true;
+
+        // Given a rigid body falling onto a static box.
+        auto staticBox = TestUtils::AddStaticUnitTestObject<BoxColliderComponent>(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 0.0f), "StaticTestBox");
+        auto testBox = TestUtils::AddUnitTestObject(m_testSceneHandle, AZ::Vector3(0.0f, 0.0f, 1.2f), "TestBox");
+
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        const AzPhysics::SimulatedBodyHandle testBoxHandle = AZStd::get<1>(physicsSystem->FindAttachedBodyHandleFromEntityId(testBox->GetId()));
+
+        // When the box is destroyed during the step it first touches the static box, after its contacts were recorded.
+        auto* scene = static_cast<PhysXScene*>(m_defaultScene);
+        bool testBoxDestroyed = false;
+        AzPhysics::SceneEvents::OnSceneActiveSimulatedBodiesEvent::Handler activeBodiesHandler(
+            [&]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AzPhysics::SimulatedBodyHandleList& activeBodies,
+                [[maybe_unused]] float fixedDeltaTime)
+            {
+                for (const BufferedContactPair& pair : scene->GetContactEventBuffer().GetContactPairs())
+                {
+                    if (!testBoxDestroyed && (pair.m_bodyHandle1 == testBoxHandle || pair.m_bodyHandle2 == testBoxHandle))
+                    {
+                        testBox.reset();
+                        testBoxDestroyed = true;
+                    }
+                }
+            });
+        scene->RegisterSceneActiveSimulatedBodiesHandler(activeBodiesHandler);
+
+        int testBoxPairCount = 0;
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler simulationFinishHandler(
+            [&]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+            {
+                for (const BufferedContactPair& pair : scene->GetContactEventBuffer().GetContactPairs())
+                {
+                    if (pair.m_bodyHandle1 == testBoxHandle || pair.m_bodyHandle2 == testBoxHandle)
+                    {
+                        ++testBoxPairCount;
+                    }
+                }
+            });
+        scene->RegisterSceneSimulationFinishHandler(simulationFinishHandler);
+
+        TestUtils::UpdateScene(m_defaultScene, 1.0f / 30.0f, 30);
+
+        // Then the pairs of the deleted body are not in the buffer when it's read.
+        EXPECT_TRUE(testBoxDestroyed);
+        EXPECT_EQ(testBoxPairCount, 0);
+        EXPECT_TRUE(scene->GetContactEventBuffer().GetContacts().empty());
+
+        activeBodiesHandler.Disconnect();
+        simulationFinishHandler.Disconnect();
+        physx_bufferContactEvents = false;
+    }
+
     TEST_F(PhysXSpecificTest, RigidBody_ConvexRigidBodyCreatedFromCookedMesh_CachedMeshObjectCreated)
     {
         // Create rigid body
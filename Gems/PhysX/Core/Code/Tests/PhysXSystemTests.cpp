@@ -7,7 +7,9 @@
  */
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
+#include <Scene/PhysXScene.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
@@ -16,6 +18,8 @@
 
 namespace PhysX
 {
+    AZ_CVAR_EXTERNED(bool, physx_parallelSceneSimulation);
+
     namespace Internal
     {
         static constexpr const char* DefaultSceneNameFormat = "scene-%u";
@@ -328,4 +332,78 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    TEST_F(PhysXSystemFixture, Simulate_SceneWithFixedTimestep_StepsWithItsOwnTimestep)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        const float systemTimestep = physicsSystem->GetConfiguration()->m_fixedTimestep;
+
+        // The second scene steps at half the rate of the system
+        m_sceneConfigs[1].m_fixedTimestep = systemTimestep * 2.0f;
+        AzPhysics::SceneHandle systemStepSceneHandle = physicsSystem->AddScene(m_sceneConfigs[0]);
+        AzPhysics::SceneHandle fixedStepSceneHandle = physicsSystem->AddScene(m_sceneConfigs[1]);
+
+        int systemStepCount = 0;
+        int fixedStepCount = 0;
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler systemStepHandler(
+            [&systemStepCount, systemTimestep]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                EXPECT_NEAR(fixedDeltaTime, systemTimestep, 0.0001f);
+                systemStepCount++;
+            });
+        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler fixedStepHandler(
+            [&fixedStepCount, systemTimestep]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, float fixedDeltaTime)
+            {
+                EXPECT_NEAR(fixedDeltaTime, systemTimestep * 2.0f, 0.0001f);
+                fixedStepCount++;
+            });
+        physicsSystem->GetScene(systemStepSceneHandle)->RegisterSceneSimulationFinishHandler(systemStepHandler);
+        physicsSystem->GetScene(fixedStepSceneHandle)->RegisterSceneSimulationFinishHandler(fixedStepHandler);
+
+        constexpr int numFrames = 10;
+        for (int i = 0; i < numFrames; i++)
+        {
+            physicsSystem->Simulate(systemTimestep * 2.0f);
+        }
+
+        EXPECT_EQ(systemStepCount, numFrames * 2);
+        EXPECT_EQ(fixedStepCount, numFrames);
+    }
+
+    TEST_F(PhysXSystemFixture, Simulate_IdenticalScenes_ProduceIdenticalStateHashes)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+
+        const bool parallelSceneSimulation = physx_parallelSceneSimulation;
+        for (const bool parallel : { false, true })
+        {
+            physx_parallelSceneSimulation = parallel;
+
+            // Fill both scenes with the same pile of spheres falling onto a floor
+            AzPhysics::SceneHandleList sceneHandles = physicsSystem->AddScenes({ m_sceneConfigs[0], m_sceneConfigs[1] });
+            for (AzPhysics::SceneHandle sceneHandle : sceneHandles)
+            {
+                TestUtils::AddStaticFloorToScene(sceneHandle);
+                for (int i = 0; i < 20; i++)
+                {
+                    TestUtils::AddSphereToScene(sceneHandle, AZ::Vector3(0.1f * (i % 4), 0.1f * (i % 3), 1.0f + 1.1f * i));
+                }
+            }
+
+            auto* firstScene = static_cast<PhysXScene*>(physicsSystem->GetScene(sceneHandles[0]));
+            auto* secondScene = static_cast<PhysXScene*>(physicsSystem->GetScene(sceneHandles[1]));
+            EXPECT_EQ(firstScene->ComputeStateHash(), secondScene->ComputeStateHash());
+
+            const AZ::HashValue64 initialHash = firstScene->ComputeStateHash();
+            for (int i = 0; i < 30; i++)
+            {
+                physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+                EXPECT_EQ(firstScene->ComputeStateHash(), secondScene->ComputeStateHash());
+            }
+            EXPECT_NE(firstScene->ComputeStateHash(), initialHash);
+
+            physicsSystem->RemoveScenes(sceneHandles);
+        }
+        physx_parallelSceneSimulation = parallelSceneSimulation;
+    }
 }
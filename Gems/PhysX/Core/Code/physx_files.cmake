@@ -100,6 +100,8 @@ set(FILES
     Source/WindProvider.h
     Source/PhysXCharacters/API/CharacterController.cpp
     Source/PhysXCharacters/API/CharacterController.h
+    Source/PhysXCharacters/API/CharacterControllerBatch.cpp
+    Source/PhysXCharacters/API/CharacterControllerBatch.h
     Source/PhysXCharacters/API/Ragdoll.cpp
     Source/PhysXCharacters/API/Ragdoll.h
     Source/PhysXCharacters/API/RagdollNode.cpp
@@ -138,6 +140,8 @@ set(FILES
     Source/Scene/PhysXScene.cpp
     Source/Scene/PhysXSceneInterface.h
     Source/Scene/PhysXSceneInterface.cpp
+    Source/Scene/PhysXSceneContactEventBuffer.h
+    Source/Scene/PhysXSceneContactEventBuffer.cpp
     Source/Scene/PhysXSceneSimulationEventCallback.h
     Source/Scene/PhysXSceneSimulationEventCallback.cpp
     Source/Scene/PhysXSceneSimulationFilterCallback.h